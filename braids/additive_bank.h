@@ -0,0 +1,150 @@
+// Copyright 2012 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Bank of sine partials for the additive shapes.
+//
+// The state is stored as one array per quantity, and the sine is computed by a
+// branchless polynomial rather than read from a table. Each partial is thus
+// processed by exactly the same sequence of arithmetic instructions, with no
+// data-dependent memory access, and a compiler targeting a CPU with SIMD
+// instructions can advance several partials at once. The capacity should be a
+// multiple of kAdditiveLaneSize, with the unused partials left silent.
+//
+// Harmonic series do not need one sine evaluation per partial: only the first
+// lane is evaluated, and the following lanes are obtained by the recurrence
+// cos((k + 4) x) = 2 cos(4 x) cos(k x) - cos((k - 4) x), which costs a single
+// multiplication per partial.
+//
+// This is a POD so that it can live in the DigitalOscillator state union.
+
+#ifndef BRAIDS_ADDITIVE_BANK_H_
+#define BRAIDS_ADDITIVE_BANK_H_
+
+#include "stmlib/stmlib.h"
+
+namespace braids {
+
+static const size_t kAdditiveLaneSize = 4;
+STATIC_ASSERT(kAdditiveLaneSize == 4, lane_sums_are_unrolled);
+
+// Coefficients of sin(pi / 2 * x) ~ x * (c1 + c3 * x^2 + c5 * x^4) on [-1, 1],
+// least-square fit in 14-bit fixed point. Max error is about 3.5e-4.
+static const int32_t kSineC1 = 25727;
+static const int32_t kSineC3 = -10530;
+static const int32_t kSineC5 = 1187;
+
+// Returns a 15-bit sine for a 32-bit phase. Like wav_sine, it starts at its
+// negative peak.
+inline int32_t Sine(uint32_t phase) {
+  // Fold the phase into a triangle in [-1, 1], in 15-bit fixed point.
+  int32_t t = static_cast<int32_t>(phase - (1UL << 31));
+  int32_t x = ((1L << 30) - (t ^ (t >> 31))) >> 15;
+  int32_t x2 = x * x >> 15;
+  int32_t y = (kSineC5 * x2 >> 15) + kSineC3;
+  y = (y * x2 >> 15) + kSineC1;
+  return y * x >> 14;
+}
+
+template<size_t capacity>
+struct AdditiveBank {
+  uint32_t phase[capacity];
+  uint32_t phase_increment[capacity];
+  int32_t amplitude[capacity];
+  int32_t target_amplitude[capacity];
+
+  inline void Reset(uint32_t initial_phase) {
+    for (size_t i = 0; i < capacity; ++i) {
+      phase[i] = initial_phase;
+    }
+  }
+
+  // Advances the first num_partials partials by one sample and returns the sum
+  // of the sines weighted by their amplitudes.
+  template<size_t num_partials, int32_t shift>
+  inline int32_t Render() {
+    int32_t lane[kAdditiveLaneSize] = { 0 };
+    for (size_t i = 0; i < num_partials; i += kAdditiveLaneSize) {
+      for (size_t j = 0; j < kAdditiveLaneSize; ++j) {
+        phase[i + j] += phase_increment[i + j];
+        lane[j] += Sine(phase[i + j]) * amplitude[i + j] >> shift;
+      }
+    }
+    return lane[0] + lane[1] + lane[2] + lane[3];
+  }
+  
+  // Same thing, with the amplitudes linearly interpolated towards their target
+  // (fade is 15-bit), and the individual partials written to partials.
+  template<size_t num_partials, int32_t shift>
+  inline int32_t RenderFaded(int32_t fade, int32_t* partials) {
+    int32_t lane[kAdditiveLaneSize] = { 0 };
+    for (size_t i = 0; i < num_partials; i += kAdditiveLaneSize) {
+      for (size_t j = 0; j < kAdditiveLaneSize; ++j) {
+        size_t k = i + j;
+        phase[k] += phase_increment[k];
+        int32_t a = amplitude[k] + \
+            ((target_amplitude[k] - amplitude[k]) * fade >> 15);
+        partials[k] = Sine(phase[k]) * a >> shift;
+        lane[j] += partials[k];
+      }
+    }
+    return lane[0] + lane[1] + lane[2] + lane[3];
+  }
+  
+  // Renders the first num_partials harmonics of a fundamental at the given
+  // phase, with each amplitude converging to its target through a one-pole
+  // low-pass filter. The phase arrays are not used.
+  //
+  // Each lane runs its own recurrence over harmonics j + 1, j + 5, j + 9...
+  // The lanes are processed one after the other so that the state of the
+  // recurrence stays in registers.
+  template<size_t num_partials, int32_t shift, int32_t smoothing>
+  inline int32_t RenderHarmonics(uint32_t phase) {
+    int32_t first[kAdditiveLaneSize + 1];
+    for (size_t j = 0; j <= kAdditiveLaneSize; ++j) {
+      first[j] = Sine(phase * j);
+    }
+    // Sine() reads -cos(x) with a peak of 32768, so 2 cos(4 x) in 14-bit fixed
+    // point is -first[4].
+    int32_t twice_cos = -first[4];
+    int32_t out = 0;
+    for (size_t j = 0; j < kAdditiveLaneSize; ++j) {
+      int32_t current = first[j + 1];
+      int32_t previous = first[kAdditiveLaneSize - 1 - j];
+      for (size_t k = j; k < num_partials; k += kAdditiveLaneSize) {
+        out += current * amplitude[k] >> shift;
+        amplitude[k] += (target_amplitude[k] - amplitude[k]) >> smoothing;
+        int32_t next = (twice_cos * current >> 14) - previous;
+        previous = current;
+        current = next;
+      }
+    }
+    return out;
+  }
+};
+
+}  // namespace braids
+
+#endif  // BRAIDS_ADDITIVE_BANK_H_
@@ -109,7 +109,7 @@ void DigitalOscillator::Render(
   RenderFn fn = fn_table_[shape_];
   
   if (shape_ != previous_shape_) {
-    Init();
+    Reset();
     previous_shape_ = shape_;
     init_ = true;
   }
@@ -165,21 +165,32 @@ void DigitalOscillator::RenderSawSwarm(
     const uint8_t* sync,
     int16_t* buffer,
     size_t size) {
+  PhaseSwarm* saws = &state_.saw.saws;
+  size_t num_saws = swarm_size_;
+  size_t num_lanes = (num_saws + kSwarmLaneSize - 1) / kSwarmLaneSize;
+  
+  // The outermost saws are always detuned by +/- 3 steps, the others are
+  // evenly spread in between.
   int32_t detune = parameter_[0] + 1024;
   detune = (detune * detune) >> 9;
-  uint32_t increments[7];
-  for (int16_t i = 0; i < 7; ++i) {
-    int32_t saw_detune = detune * (i - 3);
+  int32_t spread = num_saws - 1;
+  for (size_t i = 0; i < num_saws; ++i) {
+    int32_t saw_detune = detune * 3 * (2 * static_cast<int32_t>(i) - spread) / \
+        spread;
     int32_t detune_integral = saw_detune >> 16;
     int32_t detune_fractional = saw_detune & 0xffff;
     int32_t increment_a = ComputePhaseIncrement(pitch_ + detune_integral);
     int32_t increment_b = ComputePhaseIncrement(pitch_ + detune_integral + 1);
-    increments[i] = increment_a + \
+    saws->phase_increment[i] = increment_a + \
         (((increment_b - increment_a) * detune_fractional) >> 16);
   }
+  for (size_t i = num_saws; i < num_lanes * kSwarmLaneSize; ++i) {
+    saws->phase[i] = 0;
+    saws->phase_increment[i] = 0;
+  }
   if (strike_) {
-    for (size_t i = 0; i < 6; ++i) {
-      state_.saw.phase[i] = Random::GetWord();
+    for (size_t i = 1; i < num_saws; ++i) {
+      saws->phase[i] = Random::GetWord();
     }
     strike_ = false;
   }
@@ -200,31 +211,19 @@ void DigitalOscillator::RenderSawSwarm(
   int32_t bp = state_.saw.bp;
   int32_t lp = state_.saw.lp;
 
+  // Remove the DC offset of the saws, and scale their sum so that its peak
+  // value does not depend on the number of saws.
+  int32_t dc_offset = num_saws * 4096;
+  int32_t gain = swarm_gain_;
+  size_t num_phases = num_lanes * kSwarmLaneSize;
   while (size--) {
     if (*sync++) {
-      for (size_t i = 0; i < 6; ++i) {
-        state_.saw.phase[i] = 0;
-      }
+      saws->Reset();
     }
     int32_t notch, hp, sample;
     
-    phase_ += increments[0];
-    state_.saw.phase[0] += increments[1];
-    state_.saw.phase[1] += increments[2];
-    state_.saw.phase[2] += increments[3];
-    state_.saw.phase[3] += increments[4];
-    state_.saw.phase[4] += increments[5];
-    state_.saw.phase[5] += increments[6];
-    
-    // Compute a sample.
-    sample = -28672;
-    sample += phase_ >> 19;
-    sample += state_.saw.phase[0] >> 19;
-    sample += state_.saw.phase[1] >> 19;
-    sample += state_.saw.phase[2] >> 19;
-    sample += state_.saw.phase[3] >> 19;
-    sample += state_.saw.phase[4] >> 19;
-    sample += state_.saw.phase[5] >> 19;
+    sample = saws->Render<19>(num_phases) - dc_offset;
+    sample = (sample * gain) >> 12;
     sample = Interpolate88(ws_moderate_overdrive, sample + 32768);
     
     notch = sample - (bp * damp >> 15);
@@ -869,11 +868,12 @@ void DigitalOscillator::RenderStruckBell(
       kNumBellPartials);
   state_.add.current_partial = (first_partial + 3) % kNumBellPartials;
   
+  AdditiveBank<kMaxNumAdditivePartials>* partials = &state_.add.partials;
   if (strike_) {
     for (size_t i = 0; i < kNumBellPartials; ++i) {
-      state_.add.partial_amplitude[i] = kBellPartialAmplitudes[i];
-      state_.add.partial_phase[i] = (1L << 30);
+      partials->amplitude[i] = kBellPartialAmplitudes[i];
     }
+    partials->Reset(1L << 30);
     strike_ = false;
     first_partial = 0;
     last_partial = kNumBellPartials;
@@ -886,8 +886,7 @@ void DigitalOscillator::RenderStruckBell(
     } else {
       partial_pitch -= parameter_[1] >> 7;
     }
-    state_.add.partial_phase_increment[i] = \
-        ComputePhaseIncrement(partial_pitch) << 1;
+    partials->phase_increment[i] = ComputePhaseIncrement(partial_pitch) << 1;
   }
   
   // Allow a "droning" bell with no energy loss when the parameter is set to
@@ -899,19 +898,14 @@ void DigitalOscillator::RenderStruckBell(
       int16_t balance = (32767 - parameter_[0]) >> 8;
       balance = balance * balance >> 7;
       int32_t decay = decay_long - ((decay_long - decay_short) * balance >> 7);
-      state_.add.partial_amplitude[i] = \
-          state_.add.partial_amplitude[i] * decay >> 16;
+      partials->amplitude[i] = partials->amplitude[i] * decay >> 16;
     }
   }
   
+  // One silent partial completes the last lane.
   int16_t previous_sample = state_.add.previous_sample;
   while (size--) {
-    int32_t out = 0;
-    for (size_t i = 0; i < kNumBellPartials; ++i) {
-      state_.add.partial_phase[i] += state_.add.partial_phase_increment[i];
-      int32_t partial = Interpolate824(wav_sine, state_.add.partial_phase[i]);
-      out += partial * state_.add.partial_amplitude[i] >> 17;
-    }
+    int32_t out = partials->Render<kNumBellPartials + 1, 17>();
     CLIP(out)
     *buffer++ = (out + previous_sample) >> 1;
     *buffer++ = out; size--;
@@ -924,11 +918,11 @@ void DigitalOscillator::RenderHarmonics(
     const uint8_t* sync,
     int16_t* buffer,
     size_t size) {
+  AdditiveBank<kMaxNumAdditivePartials>* partials = &state_.add.partials;
   uint32_t phase = phase_;
   int16_t previous_sample = state_.add.previous_sample;
   uint32_t phase_increment = phase_increment_ << 1;
-  int32_t target_amplitude[kNumAdditiveHarmonics];
-  int32_t amplitude[kNumAdditiveHarmonics];
+  int32_t* target_amplitude = partials->target_amplitude;
   
   int32_t peak = (kNumAdditiveHarmonics * parameter_[0]) >> 7;
   int32_t second_peak = (peak >> 1) + kNumAdditiveHarmonics * 128;
@@ -959,21 +953,15 @@ void DigitalOscillator::RenderHarmonics(
     } else {
       target_amplitude[i] = target_amplitude[i] * attenuation >> 16;
     }
-    amplitude[i] = state_.hrm.amplitude[i];
   }
   
   while (size) {
-    int32_t out;
-    
     phase += phase_increment;
     if (*sync++ || *sync++) {
       phase = 0;
     }
-    out = 0;
-    for (size_t i = 0; i < kNumAdditiveHarmonics; ++i) {
-      out += Interpolate824(wav_sine, phase * (i + 1)) * amplitude[i] >> 15;
-      amplitude[i] += (target_amplitude[i] - amplitude[i]) >> 8;
-    }
+    int32_t out = partials->RenderHarmonics<kNumAdditiveHarmonics, 15, 8>(
+        phase);
     CLIP(out)
     *buffer++ = (out + previous_sample) >> 1;
     *buffer++ = out;
@@ -982,9 +970,6 @@ void DigitalOscillator::RenderHarmonics(
   }
   state_.add.previous_sample = previous_sample;
   phase_ = phase;
-  for (size_t i = 0; i < kNumAdditiveHarmonics; ++i) {
-    state_.hrm.amplitude[i] = amplitude[i];
-  }
 }
 
 void DigitalOscillator::RenderStruckDrum(
@@ -992,13 +977,13 @@ void DigitalOscillator::RenderStruckDrum(
     int16_t* buffer,
     size_t size) {
   
+  AdditiveBank<kMaxNumAdditivePartials>* partials = &state_.add.partials;
   if (strike_) {
-    bool reset_phase = state_.add.partial_amplitude[0] < 1024;
+    if (partials->amplitude[0] < 1024) {
+      partials->Reset(1L << 30);
+    }
     for (size_t i = 0; i < kNumDrumPartials; ++i) {
-      state_.add.target_partial_amplitude[i] = kDrumPartialAmplitude[i];
-      if (reset_phase) {
-        state_.add.partial_phase[i] = (1L << 30);
-      }
+      partials->target_amplitude[i] = kDrumPartialAmplitude[i];
     }
     strike_ = false;
   } else {
@@ -1009,15 +994,15 @@ void DigitalOscillator::RenderStruckDrum(
         int16_t balance = (32767 - parameter_[0]) >> 8;
         balance = balance * balance >> 7;
         int32_t decay = decay_long - ((decay_long - decay_short) * balance >> 7);
-        state_.add.target_partial_amplitude[i] = \
-            state_.add.partial_amplitude[i] * decay >> 16;
+        partials->target_amplitude[i] = \
+            partials->amplitude[i] * decay >> 16;
       }
     }
   }
   
   for (size_t i = 0; i < kNumDrumPartials; ++i) {
     int16_t partial_pitch = pitch_ + kDrumPartials[i];
-    state_.add.partial_phase_increment[i] = ComputePhaseIncrement(partial_pitch) << 1;
+    partials->phase_increment[i] = ComputePhaseIncrement(partial_pitch) << 1;
   }
   
   int16_t previous_sample = state_.add.previous_sample;
@@ -1039,7 +1024,6 @@ void DigitalOscillator::RenderStruckDrum(
   int32_t fade = 0;
   while (size--) {
     fade += fade_increment;
-    int32_t harmonics = 0;
 
     int32_t noise = Random::GetSample();
     if (noise > 16384) {
@@ -1052,20 +1036,14 @@ void DigitalOscillator::RenderStruckDrum(
     lp_state_1 += (lp_state_0 - lp_state_1) * f >> 15;
     lp_state_2 += (lp_state_1 - lp_state_2) * f >> 15;
 
-    int32_t partials[kNumDrumPartials];
-    for (size_t i = 0; i < kNumDrumPartials; ++i) {
-      AdditiveState* a = &state_.add;
-      a->partial_phase[i] += a->partial_phase_increment[i];
-      int32_t partial = Interpolate824(wav_sine, a->partial_phase[i]);
-      int32_t amplitude = a->partial_amplitude[i] + \
-          (((a->target_partial_amplitude[i] - a->partial_amplitude[i]) * fade) >> 15);
-      partial = partial * amplitude >> 16;
-      harmonics += partial;
-      partials[i] = partial;
-    }
-    int32_t sample = partials[0];
-    int32_t noise_mode_1 = partials[1] * lp_state_2 >> 8;
-    int32_t noise_mode_2 = partials[3] * lp_state_2 >> 9;
+    // Two silent partials complete the second lane.
+    int32_t partial[kNumDrumPartials + 2];
+    int32_t harmonics = partials->RenderFaded<kNumDrumPartials + 2, 16>(
+        fade,
+        partial);
+    int32_t sample = partial[0];
+    int32_t noise_mode_1 = partial[1] * lp_state_2 >> 8;
+    int32_t noise_mode_2 = partial[3] * lp_state_2 >> 9;
     sample += noise_mode_1 * (12288 - noise_mode_gain) >> 14;
     sample += noise_mode_2 * noise_mode_gain >> 14;
     sample += harmonics * harmonics_gain >> 14;
@@ -1079,9 +1057,8 @@ void DigitalOscillator::RenderStruckDrum(
   state_.add.lp_noise[0] = lp_state_0;
   state_.add.lp_noise[1] = lp_state_1;
   state_.add.lp_noise[2] = lp_state_2;
-  for (size_t i = 0; i < kNumBellPartials; ++i) {
-    AdditiveState* a = &state_.add;
-    a->partial_amplitude[i] = a->target_partial_amplitude[i];
+  for (size_t i = 0; i < kNumDrumPartials; ++i) {
+    partials->amplitude[i] = partials->target_amplitude[i];
   }
 }
 
@@ -1523,6 +1500,122 @@ static const WavetableDefinition wavetable_definitions[] = {
 { 4 , { 252, 253, 254, 255, 254 } },
 };
 
+void DigitalOscillator::LoadMipmaps(
+    const uint8_t* wave_index,
+    size_t num_waves,
+    const int16_t** mipmap) {
+  if (init_) {
+    for (size_t i = 0; i < kNumMipmapSlots; ++i) {
+      delay_lines_.mipmaps.wave_index[i] = 0xffff;
+    }
+    init_ = false;
+  }
+  
+  // First pass: find the waves which are already cached, and remember which
+  // slots are needed by this block so that they are not recycled.
+  bool in_use[kNumMipmapSlots] = { false, false, false, false };
+  for (size_t i = 0; i < num_waves; ++i) {
+    mipmap[i] = NULL;
+    for (size_t j = 0; j < kNumMipmapSlots; ++j) {
+      if (delay_lines_.mipmaps.wave_index[j] == wave_index[i]) {
+        mipmap[i] = delay_lines_.mipmaps.data[j];
+        in_use[j] = true;
+        break;
+      }
+    }
+  }
+  
+  // Second pass: build the missing ones into free slots, up to
+  // kMaxMipmapBuildsPerBlock of them.
+  size_t num_builds = 0;
+  for (size_t i = 0; i < num_waves; ++i) {
+    if (mipmap[i] || num_builds >= kMaxMipmapBuildsPerBlock) {
+      continue;
+    }
+    size_t slot = 0;
+    while (in_use[slot]) {
+      ++slot;
+    }
+    in_use[slot] = true;
+    delay_lines_.mipmaps.wave_index[slot] = wave_index[i];
+    uint8_t wave[kWaveStride];
+    BuildWavetableMipmap(
+        LoadWave(wave_index[i], wave),
+        delay_lines_.mipmaps.data[slot]);
+    mipmap[i] = delay_lines_.mipmaps.data[slot];
+    ++num_builds;
+    // The same wave might be requested twice in this block.
+    for (size_t j = i + 1; j < num_waves; ++j) {
+      if (wave_index[j] == wave_index[i]) {
+        mipmap[j] = mipmap[i];
+      }
+    }
+  }
+  
+  // Third pass: the waves which could not be built in this block are
+  // replaced by a neighbouring one until a following block builds them.
+  for (size_t i = 1; i < num_waves; ++i) {
+    if (!mipmap[i]) {
+      mipmap[i] = mipmap[i - 1];
+    }
+  }
+  for (size_t i = num_waves - 1; i > 0; --i) {
+    if (!mipmap[i - 1]) {
+      mipmap[i - 1] = mipmap[i];
+    }
+  }
+}
+
+// One interpolated read per wave: the integral and fractional parts of the
+// phase are shared by both waves.
+static inline int16_t CrossfadeMipmap(
+    const int16_t* wave_a,
+    const int16_t* wave_b,
+    uint32_t phase,
+    size_t shift,
+    uint16_t balance) {
+  uint32_t integral = phase >> shift;
+  int32_t fractional = (phase << (32 - shift)) >> 17;
+  int32_t a = wave_a[integral];
+  int32_t b = wave_b[integral];
+  a += (wave_a[integral + 1] - a) * fractional >> 15;
+  b += (wave_b[integral + 1] - b) * fractional >> 15;
+  return a + ((b - a) * static_cast<int32_t>(balance) >> 16);
+}
+
+// Same thing, with four waves arranged on a 2x2 grid.
+static inline int16_t CrossfadeMipmap(
+    const int16_t* const* wave,
+    uint32_t phase,
+    size_t shift,
+    uint16_t balance_x,
+    uint16_t balance_y) {
+  uint32_t integral = phase >> shift;
+  int32_t fractional = (phase << (32 - shift)) >> 17;
+  int32_t s[4];
+  for (size_t i = 0; i < 4; ++i) {
+    int32_t a = wave[i][integral];
+    s[i] = a + ((wave[i][integral + 1] - a) * fractional >> 15);
+  }
+  s[0] += (s[1] - s[0]) * static_cast<int32_t>(balance_y) >> 16;
+  s[2] += (s[3] - s[2]) * static_cast<int32_t>(balance_y) >> 16;
+  return Mix(static_cast<int16_t>(s[0]), static_cast<int16_t>(s[2]), balance_x);
+}
+
+// Deliberately aliased read of the full resolution wave, with the phase
+// quantized to num_bits bits.
+static inline int16_t CrossfadeSteps(
+    const int16_t* wave_a,
+    const int16_t* wave_b,
+    uint32_t phase,
+    size_t num_bits,
+    uint16_t balance) {
+  uint32_t index = (phase >> (32 - num_bits)) << (kWaveSizeBits - num_bits);
+  int32_t a = wave_a[index];
+  int32_t b = wave_b[index];
+  return a + ((b - a) * static_cast<int32_t>(balance) >> 16);
+}
+
 void DigitalOscillator::RenderWavetables(
     const uint8_t* sync,
     int16_t* buffer,
@@ -1538,28 +1631,28 @@ void DigitalOscillator::RenderWavetables(
   wavetable_index >>= 15;
   
   uint32_t wave_pointer;
-  const uint8_t* wave[2];
+  uint8_t wave_index[2];
+  const int16_t* mipmap[2];
   const WavetableDefinition& wt = wavetable_definitions[wavetable_index];
   
   wave_pointer = (parameter_[0] << 1) * wt.num_steps;
   for (size_t i = 0; i < 2; ++i) {
-    size_t wave_index = wt.wave_index[(wave_pointer >> 16) + i];
-    wave[i] = wt_waves + wave_index * 129;
+    wave_index[i] = wt.wave_index[(wave_pointer >> 16) + i];
   }
+  LoadMipmaps(wave_index, 2, mipmap);
+  
+  size_t level = ComputeMipmapLevel(phase_increment_);
+  size_t shift = MipmapPhaseShift(level);
+  const int16_t* wave_0 = MipmapLevel(mipmap[0], level);
+  const int16_t* wave_1 = MipmapLevel(mipmap[1], level);
+  uint16_t wave_xfade = wave_pointer;
 
-  uint32_t phase_increment = phase_increment_ >> 1;
   while (size--) {
-    int16_t sample;
-    // 2x naive oversampling.
-    phase_ += phase_increment;
+    phase_ += phase_increment_;
     if (*sync++) {
       phase_ = 0;
     }
-    
-    sample = Crossfade(wave[0], wave[1], phase_ >> 1, wave_pointer) >> 1;
-    phase_ += phase_increment;
-    sample += Crossfade(wave[0], wave[1], phase_ >> 1, wave_pointer) >> 1;
-    *buffer++ = sample;
+    *buffer++ = CrossfadeMipmap(wave_0, wave_1, phase_, shift, wave_xfade);
   }
 }
 
@@ -1580,35 +1673,32 @@ void DigitalOscillator::RenderWaveMap(
   wave_coordinate[0] = p[0] >> 11;
   wave_coordinate[1] = p[1] >> 11;
 
-  const uint8_t* wave[2][2];
+  uint8_t wave_index[4];
+  const int16_t* mipmap[4];
   
   for (size_t i = 0; i < 2; ++i) {
     for (size_t j = 0; j < 2; ++j) {
-      uint16_t wave_index = \
+      uint16_t map_index = \
           (wave_coordinate[0] + i) * 16 + (wave_coordinate[1] + j);
-      wave[i][j] = wt_waves + wt_map[wave_index] * 129;
+      wave_index[i * 2 + j] = wt_map[map_index];
     }
   }
+  LoadMipmaps(wave_index, 4, mipmap);
+
+  size_t level = ComputeMipmapLevel(phase_increment_);
+  size_t shift = MipmapPhaseShift(level);
+  const int16_t* wave[4];
+  for (size_t i = 0; i < 4; ++i) {
+    wave[i] = MipmapLevel(mipmap[i], level);
+  }
 
-  uint32_t phase_increment = phase_increment_ >> 1;
   while (size--) {
-    int16_t sample;
-    // 2x naive oversampling.
-    phase_ += phase_increment;
+    phase_ += phase_increment_;
     if (*sync++) {
       phase_ = 0;
     }
-    
-    sample = Mix(
-        Crossfade(wave[0][0], wave[0][1], phase_ >> 1, wave_xfade[1]),
-        Crossfade(wave[1][0], wave[1][1], phase_ >> 1, wave_xfade[1]),
-        wave_xfade[0]) >> 1;
-    phase_ += phase_increment;
-    sample += Mix(
-        Crossfade(wave[0][0], wave[0][1], phase_ >> 1, wave_xfade[1]),
-        Crossfade(wave[1][0], wave[1][1], phase_ >> 1, wave_xfade[1]),
-        wave_xfade[0]) >> 1;
-    *buffer++ = sample;
+    *buffer++ = CrossfadeMipmap(
+        wave, phase_, shift, wave_xfade[0], wave_xfade[1]);
   }
 }
 
@@ -1633,98 +1723,76 @@ void DigitalOscillator::RenderWaveLine(
   smoothed_parameter_ = (3 * smoothed_parameter_ + (parameter_[0] << 1)) >> 2;
 
   uint16_t scan = smoothed_parameter_;
-  const uint8_t* wave_0 = wt_waves + wave_line[previous_parameter_[0] >> 9] * 129;
-  const uint8_t* wave_1 = wt_waves + wave_line[scan >> 10] * 129;
-  const uint8_t* wave_2 = wt_waves + wave_line[(scan >> 10) + 1] * 129;
+  uint8_t wave_index[3];
+  const int16_t* mipmap[3];
+  wave_index[0] = wave_line[previous_parameter_[0] >> 9];
+  wave_index[1] = wave_line[scan >> 10];
+  wave_index[2] = wave_line[(scan >> 10) + 1];
+  LoadMipmaps(wave_index, 3, mipmap);
+  
+  // The rough component is deliberately aliased, and is always read from the
+  // full resolution wave.
+  const int16_t* rough_0 = mipmap[0];
+  const int16_t* rough_1 = mipmap[1];
+  const int16_t* rough_2 = mipmap[2];
+  
+  size_t level = ComputeMipmapLevel(phase_increment_);
+  size_t shift = MipmapPhaseShift(level);
+  const int16_t* wave_0 = MipmapLevel(mipmap[0], level);
+  const int16_t* wave_1 = MipmapLevel(mipmap[1], level);
+  const int16_t* wave_2 = MipmapLevel(mipmap[2], level);
 
   uint16_t smooth_xfade = scan << 6;
   uint16_t rough_xfade = 0;
-  uint16_t rough_xfade_increment = 32768 / size;
+  uint16_t rough_xfade_increment = 65535 / size;
   uint32_t balance = parameter_[1] << 3;
 
   uint32_t phase = phase_;
-  uint32_t phase_increment = phase_increment_ >> 1;
+  uint32_t phase_increment = phase_increment_;
   
   int16_t rough, smooth;
   
   if (parameter_[1] < 8192) {
     while (size--) {
+      phase += phase_increment;
       if (*sync++) {
         phase = 0;
       }
-      int32_t sample = 0;
-      
-      rough = Crossfade(wave_0, wave_1, (phase >> 1) & 0xfe000000, rough_xfade);
-      smooth = Crossfade(wave_0, wave_1, phase >> 1, rough_xfade);
-      sample += Mix(rough, smooth, balance);
-      phase += phase_increment;
-      rough_xfade += rough_xfade_increment;
-      
-      rough = Crossfade(wave_0, wave_1, (phase >> 1) & 0xfe000000, rough_xfade);
-      smooth = Crossfade(wave_0, wave_1, phase >> 1, rough_xfade);
-      sample += Mix(rough, smooth, balance);
-      phase += phase_increment;
+      rough = CrossfadeSteps(rough_0, rough_1, phase, 6, rough_xfade);
+      smooth = CrossfadeMipmap(wave_0, wave_1, phase, shift, rough_xfade);
+      *buffer++ = Mix(rough, smooth, balance);
       rough_xfade += rough_xfade_increment;
-      
-      *buffer++ = sample >> 1;
     }
   } else if (parameter_[1] < 16384) {
     while (size--) {
+      phase += phase_increment;
       if (*sync++) {
         phase = 0;
       }
-      int32_t sample = 0;
-      
-      rough = Crossfade(wave_0, wave_1, phase >> 1, rough_xfade);
-      smooth = Crossfade(wave_1, wave_2, phase >> 1, smooth_xfade);
-      sample += Mix(rough, smooth, balance);
-      phase += phase_increment;
+      rough = CrossfadeMipmap(wave_0, wave_1, phase, shift, rough_xfade);
+      smooth = CrossfadeMipmap(wave_1, wave_2, phase, shift, smooth_xfade);
+      *buffer++ = Mix(rough, smooth, balance);
       rough_xfade += rough_xfade_increment;
-      
-      rough = Crossfade(wave_0, wave_1, phase >> 1, rough_xfade);
-      smooth = Crossfade(wave_1, wave_2, phase >> 1, smooth_xfade);
-      sample += Mix(rough, smooth, balance);
-      phase += phase_increment;
-      rough_xfade += rough_xfade_increment;
-
-      *buffer++ = sample >> 1;
     }
   } else if (parameter_[1] < 24576) {
     while (size--) {
+      phase += phase_increment;
       if (*sync++) {
         phase = 0;
       }
-      int32_t sample = 0;
-      
-      smooth = Crossfade(wave_1, wave_2, phase >> 1, smooth_xfade);
-      rough = Crossfade(wave_1, wave_2, (phase >> 1) & 0xfe000000, smooth_xfade);
-      sample += Mix(smooth, rough, balance);
-      phase += phase_increment;
-
-      smooth = Crossfade(wave_1, wave_2, phase >> 1, smooth_xfade);
-      rough = Crossfade(wave_1, wave_2, (phase >> 1) & 0xfe000000, smooth_xfade);
-      sample += Mix(smooth, rough, balance);
-      phase += phase_increment;
-
-      *buffer++ = sample >> 1;
+      smooth = CrossfadeMipmap(wave_1, wave_2, phase, shift, smooth_xfade);
+      rough = CrossfadeSteps(rough_1, rough_2, phase, 6, smooth_xfade);
+      *buffer++ = Mix(smooth, rough, balance);
     }
   } else {
     while (size--) {
+      phase += phase_increment;
       if (*sync++) {
         phase = 0;
       }
-      int32_t sample = 0;
-      smooth = Crossfade(wave_1, wave_2, (phase >> 1) & 0xfe000000, smooth_xfade);
-      rough = Crossfade(wave_1, wave_2, (phase >> 1) & 0xf8000000, smooth_xfade);
-      sample += Mix(smooth, rough, balance);
-      phase += phase_increment;
-
-      smooth = Crossfade(wave_1, wave_2, (phase >> 1) & 0xfe000000, smooth_xfade);
-      rough = Crossfade(wave_1, wave_2, (phase >> 1) & 0xf8000000, smooth_xfade);
-      sample += Mix(smooth, rough, balance);
-      phase += phase_increment;
-
-      *buffer++ = sample >> 1;
+      smooth = CrossfadeSteps(rough_1, rough_2, phase, 6, smooth_xfade);
+      rough = CrossfadeSteps(rough_1, rough_2, phase, 4, smooth_xfade);
+      *buffer++ = Mix(smooth, rough, balance);
     }
   }
   phase_ = phase;
@@ -1757,9 +1825,13 @@ void DigitalOscillator::RenderWaveParaphonic(
     const uint8_t* sync,
     int16_t* buffer,
     size_t size) {
+  if (init_) {
+    delay_lines_.waves.Init();
+    init_ = false;
+  }
   if (strike_) {
     for (size_t i = 0; i < 4; ++i) {
-      state_.saw.phase[i] = Random::GetWord();
+      state_.saw.saws.phase[i] = Random::GetWord();
     }
     strike_ = false;
   }
@@ -1770,10 +1842,10 @@ void DigitalOscillator::RenderWaveParaphonic(
   uint32_t phase_increment_0;
 
   phase_increment_0 = phase_increment_;
-  phase_0 = state_.saw.phase[0];
-  phase_1 = state_.saw.phase[1];
-  phase_2 = state_.saw.phase[2];
-  phase_3 = state_.saw.phase[3];
+  phase_0 = state_.saw.saws.phase[0];
+  phase_1 = state_.saw.saws.phase[1];
+  phase_2 = state_.saw.saws.phase[2];
+  phase_3 = state_.saw.saws.phase[3];
   
   uint16_t chord_integral = parameter_[1] >> 11;
   uint16_t chord_fractional = parameter_[1] << 5;
@@ -1792,8 +1864,10 @@ void DigitalOscillator::RenderWaveParaphonic(
     phase_increment[i] = ComputePhaseIncrement(pitch_ + detune);
   }
 
-  const uint8_t* wave_1 = wt_waves + mini_wave_line[parameter_[0] >> 10] * 129;
-  const uint8_t* wave_2 = wt_waves + mini_wave_line[(parameter_[0] >> 10) + 1] * 129;
+  const uint8_t* wave_1 = delay_lines_.waves.Get(
+      mini_wave_line[parameter_[0] >> 10]);
+  const uint8_t* wave_2 = delay_lines_.waves.Get(
+      mini_wave_line[(parameter_[0] >> 10) + 1]);
   uint16_t wave_xfade = parameter_[0] << 6;
   
   while (size) {
@@ -1824,10 +1898,10 @@ void DigitalOscillator::RenderWaveParaphonic(
     size -= 2;
   }
   
-  state_.saw.phase[0] = phase_0;
-  state_.saw.phase[1] = phase_1;
-  state_.saw.phase[2] = phase_2;
-  state_.saw.phase[3] = phase_3;
+  state_.saw.saws.phase[0] = phase_0;
+  state_.saw.saws.phase[1] = phase_1;
+  state_.saw.saws.phase[2] = phase_2;
+  state_.saw.saws.phase[3] = phase_3;
 
 }
 
@@ -2465,7 +2539,9 @@ void DigitalOscillator::RenderCymbal(
   
   HatState* hat = &state_.hat;
 
-  uint32_t increments[7];
+  // Six square waves at inharmonic ratios, the last two phases of the swarm
+  // are left silent.
+  uint32_t* increments = hat->squares.phase_increment;
   int32_t note = (40 << 7) + (pitch_ >> 1);
   increments[0] = ComputePhaseIncrement(note);
   
@@ -2475,32 +2551,18 @@ void DigitalOscillator::RenderCymbal(
   increments[3] = root * 18417 >> 4;
   increments[4] = root * 22452 >> 4;
   increments[5] = root * 31858 >> 4;
-  increments[6] = increments[0] * 24;
+  uint32_t clock_increment = increments[0] * 24;
 
   int32_t xfade = parameter_[1];
   svf_[0].set_frequency(parameter_[0] >> 1);
   svf_[1].set_frequency(parameter_[0] >> 1);
   
   while (size--) {
-    phase_ += increments[6];
-    if (phase_ < increments[6]) {
+    phase_ += clock_increment;
+    if (phase_ < clock_increment) {
       hat->rng_state = hat->rng_state * 1664525L + 1013904223L;
     }
-    hat->phase[0] += increments[0];
-    hat->phase[1] += increments[1];
-    hat->phase[2] += increments[2];
-    hat->phase[3] += increments[3];
-    hat->phase[4] += increments[4];
-    hat->phase[5] += increments[5];
-    
-    int32_t hat_noise = 0;
-    hat_noise += hat->phase[0] >> 31;
-    hat_noise += hat->phase[1] >> 31;
-    hat_noise += hat->phase[2] >> 31;
-    hat_noise += hat->phase[3] >> 31;
-    hat_noise += hat->phase[4] >> 31;
-    hat_noise += hat->phase[5] >> 31;
-    hat_noise -= 3;
+    int32_t hat_noise = hat->squares.Render<31>(8) - 3;
     hat_noise *= 5461;
     hat_noise = svf_[0].Process(hat_noise);
     CLIP(hat_noise)
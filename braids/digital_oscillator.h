@@ -31,8 +31,12 @@
 
 #include "stmlib/stmlib.h"
 
+#include "braids/additive_bank.h"
+#include "braids/phase_swarm.h"
+#include "braids/wavetable_codec.h"
 #include "braids/excitation.h"
 #include "braids/svf.h"
+#include "braids/wavetable_mipmap.h"
 
 #include <cstring>
 
@@ -51,6 +55,16 @@ static const size_t kNumOverlappingFof = 3;
 static const size_t kNumBellPartials = 11;
 static const size_t kNumDrumPartials = 6;
 static const size_t kNumAdditiveHarmonics = 12;
+static const size_t kMaxNumAdditivePartials = 12;
+
+static const size_t kNumMipmapSlots = 4;
+// Decoding and filtering a wave costs about as much as 25 blocks of playback,
+// so a jump across the wavetable spreads its rebuilds over several blocks.
+static const size_t kMaxMipmapBuildsPerBlock = 1;
+static const size_t kNumWaveCacheSlots = 3;
+
+static const size_t kMinSwarmSize = 6;
+static const size_t kDefaultSwarmSize = 7;
 
 enum DigitalOscillatorShape {
   OSC_SHAPE_TRIPLE_RING_MOD,
@@ -117,22 +131,15 @@ struct VowelSynthesizerState {
 };
 
 struct SawSwarmState {
-  uint32_t phase[6];
+  PhaseSwarm saws;
   int32_t filter_state[2][2];
   int32_t dc_blocked;
   int32_t lp;
   int32_t bp;
 };
 
-struct HarmonicsState {
-  int32_t amplitude[kNumAdditiveHarmonics];
-};
-
 struct AdditiveState {
-  uint32_t partial_phase[kNumBellPartials];
-  uint32_t partial_phase_increment[kNumBellPartials];
-  int32_t partial_amplitude[kNumBellPartials];
-  int32_t target_partial_amplitude[kNumBellPartials];
+  AdditiveBank<kMaxNumAdditivePartials> partials;
   int16_t previous_sample;
   size_t current_partial;
   int32_t lp_noise[3];
@@ -212,7 +219,7 @@ struct ClockedNoiseState {
 };
 
 struct HatState {
-  uint32_t phase[6];
+  PhaseSwarm squares;
   uint32_t rng_state;
 };
 
@@ -232,7 +239,6 @@ union DigitalOscillatorState {
   DigitalModulationState dmd;
   ClockedNoiseState clk;
   HatState hat;
-  HarmonicsState hrm;
   uint32_t modulator_phase;
 };
 
@@ -244,6 +250,13 @@ class DigitalOscillator {
   ~DigitalOscillator() { }
   
   inline void Init() {
+    Reset();
+    set_swarm_size(kDefaultSwarmSize);
+  }
+  
+  // Clears the state of the current shape. Unlike Init(), this preserves the
+  // settings such as the swarm size.
+  inline void Reset() {
     memset(&state_, 0, sizeof(state_));
     pulse_[0].Init();
     pulse_[1].Init();
@@ -277,6 +290,14 @@ class DigitalOscillator {
     parameter_[1] = parameter_2;
   }
   
+  // Number of detuned saws in SAW_SWARM, from kMinSwarmSize to kMaxSwarmSize.
+  // The total detuning span does not depend on it.
+  inline void set_swarm_size(size_t swarm_size) {
+    swarm_size_ = swarm_size;
+    CONSTRAIN(swarm_size_, kMinSwarmSize, kMaxSwarmSize);
+    swarm_gain_ = kDefaultSwarmSize * 4096 / swarm_size_;
+  }
+  
   inline uint32_t phase_increment() const {
     return phase_increment_;
   }
@@ -332,6 +353,10 @@ class DigitalOscillator {
   
   uint32_t ComputePhaseIncrement(int16_t midi_pitch);
   uint32_t ComputeDelay(int16_t midi_pitch);
+  void LoadMipmaps(
+      const uint8_t* wave_index,
+      size_t num_waves,
+      const int16_t** mipmap);
   int16_t InterpolateFormantParameter(
       const int16_t table[][kNumFormants][kNumFormants],
       int16_t x,
@@ -348,6 +373,8 @@ class DigitalOscillator {
   int16_t pitch_;
   
   uint8_t active_voice_;
+  size_t swarm_size_;
+  int32_t swarm_gain_;
   
   bool init_;
   bool strike_;
@@ -371,6 +398,11 @@ class DigitalOscillator {
       int8_t jet[kWGJetLength];
       int8_t bore[kWGFBoreLength];
     } fluted;
+    struct {
+      uint16_t wave_index[kNumMipmapSlots];
+      int16_t data[kNumMipmapSlots][kMipmapSize];
+    } mipmaps;
+    WaveCache<kNumWaveCacheSlots> waves;
   } delay_lines_;
   
   static RenderFn fn_table_[];
@@ -77,6 +77,10 @@ class MacroOscillator {
     parameter_[1] = parameter_2;
   }
   
+  inline void set_swarm_size(size_t swarm_size) {
+    digital_oscillator_.set_swarm_size(swarm_size);
+  }
+  
   inline void Strike() {
     digital_oscillator_.Strike();
   }
@@ -0,0 +1,102 @@
+// Copyright 2012 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Bank of macro-oscillators rendering to float buffers.
+
+#include "braids/macro_oscillator_bank.h"
+
+#include <algorithm>
+
+namespace braids {
+
+using namespace std;
+
+static const float kInt16ToFloat = 1.0f / 32768.0f;
+
+void MacroOscillatorBank::Init(
+    MacroOscillatorBankVoice* voices,
+    size_t num_voices) {
+  voices_ = voices;
+  num_voices_ = num_voices;
+  for (size_t i = 0; i < num_voices; ++i) {
+    MacroOscillatorBankVoice* v = &voices[i];
+    v->osc.Init();
+    v->shape = MACRO_OSC_SHAPE_CSAW;
+    v->pitch = 60 << 7;
+    v->parameter[0] = 0;
+    v->parameter[1] = 0;
+    v->strike = false;
+    v->buffer_ptr = kBankBlockSize;
+  }
+}
+
+void MacroOscillatorBank::RenderVoice(
+    MacroOscillatorBankVoice* voice,
+    float* out,
+    size_t size) {
+  static const uint8_t no_sync[kBankBlockSize] = { 0 };
+  
+  // All the voice's state is touched repeatedly while it renders the whole
+  // buffer, rather than once per 24 samples for each voice in turn.
+  while (size) {
+    if (voice->buffer_ptr == kBankBlockSize) {
+      voice->osc.set_shape(voice->shape);
+      voice->osc.set_pitch(voice->pitch);
+      voice->osc.set_parameters(voice->parameter[0], voice->parameter[1]);
+      if (voice->strike) {
+        voice->osc.Strike();
+        voice->strike = false;
+      }
+      voice->osc.Render(no_sync, voice->buffer, kBankBlockSize);
+      voice->buffer_ptr = 0;
+    }
+    size_t available = kBankBlockSize - voice->buffer_ptr;
+    size_t n = min(size, available);
+    const int16_t* source = &voice->buffer[voice->buffer_ptr];
+    for (size_t i = 0; i < n; ++i) {
+      out[i] = static_cast<float>(source[i]) * kInt16ToFloat;
+    }
+    voice->buffer_ptr += n;
+    out += n;
+    size -= n;
+  }
+}
+
+void MacroOscillatorBank::Render(float** out, size_t size) {
+  Render(0, num_voices_, out, size);
+}
+
+void MacroOscillatorBank::Render(
+    size_t first_voice,
+    size_t num_voices,
+    float** out,
+    size_t size) {
+  for (size_t i = 0; i < num_voices; ++i) {
+    RenderVoice(&voices_[first_voice + i], out[i], size);
+  }
+}
+
+}  // namespace braids
@@ -0,0 +1,119 @@
+// Copyright 2012 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Runs many independent macro-oscillators and renders them, as floats, into
+// buffers of arbitrary size owned by the caller. Meant for host builds using
+// Braids as a polyphonic voice engine.
+//
+// The oscillators still run at 96kHz (all the pitch tables assume it), and
+// their native block size is 24 samples. Each voice keeps the tail of the last
+// block it rendered, so the caller can ask for any number of samples.
+//
+// The bank is not thread-safe, see Render().
+
+#ifndef BRAIDS_MACRO_OSCILLATOR_BANK_H_
+#define BRAIDS_MACRO_OSCILLATOR_BANK_H_
+
+#include "stmlib/stmlib.h"
+
+#include "braids/macro_oscillator.h"
+
+namespace braids {
+
+static const size_t kBankBlockSize = 24;
+
+struct MacroOscillatorBankVoice {
+  MacroOscillator osc;
+  MacroOscillatorShape shape;
+  int16_t pitch;
+  int16_t parameter[2];
+  bool strike;
+  // Samples rendered but not yet consumed by the caller.
+  int16_t buffer[kBankBlockSize];
+  size_t buffer_ptr;
+};
+
+class MacroOscillatorBank {
+ public:
+  MacroOscillatorBank() { }
+  ~MacroOscillatorBank() { }
+  
+  // The voice storage is owned by the caller. A voice is about 17kB, most of
+  // it being the delay lines of the physical models.
+  void Init(MacroOscillatorBankVoice* voices, size_t num_voices);
+  
+  inline void set_shape(size_t voice, MacroOscillatorShape shape) {
+    voices_[voice].shape = shape;
+  }
+  
+  inline void set_pitch(size_t voice, int16_t pitch) {
+    voices_[voice].pitch = pitch;
+  }
+  
+  inline void set_parameters(
+      size_t voice,
+      int16_t parameter_1,
+      int16_t parameter_2) {
+    voices_[voice].parameter[0] = parameter_1;
+    voices_[voice].parameter[1] = parameter_2;
+  }
+  
+  inline void set_swarm_size(size_t voice, size_t swarm_size) {
+    voices_[voice].osc.set_swarm_size(swarm_size);
+  }
+  
+  inline void Strike(size_t voice) {
+    voices_[voice].strike = true;
+  }
+  
+  inline size_t num_voices() const { return num_voices_; }
+  
+  // Renders size samples for each voice into out[voice]. Parameter changes
+  // take effect at the next 24-sample boundary of each voice.
+  void Render(float** out, size_t size);
+  
+  // Same thing, for a range of voices only. out[0] receives first_voice.
+  // This does not make the bank usable from several threads: the noise
+  // sources of all the voices draw from the global stmlib::Random state, so
+  // all the Render calls must be made from the same thread.
+  void Render(
+      size_t first_voice,
+      size_t num_voices,
+      float** out,
+      size_t size);
+  
+ private:
+  void RenderVoice(MacroOscillatorBankVoice* voice, float* out, size_t size);
+  
+  MacroOscillatorBankVoice* voices_;
+  size_t num_voices_;
+  
+  DISALLOW_COPY_AND_ASSIGN(MacroOscillatorBank);
+};
+
+}  // namespace braids
+
+#endif  // BRAIDS_MACRO_OSCILLATOR_BANK_H_
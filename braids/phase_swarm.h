@@ -0,0 +1,74 @@
+// Copyright 2012 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Bank of free-running phase accumulators, for the shapes summing many naive
+// oscillators (SAW_SWARM, HAT).
+//
+// The phases are processed in lanes, with the same layout as AdditiveBank. The
+// phases beyond the active count must be kept at zero with a zero increment,
+// so that they do not contribute to the sum.
+
+#ifndef BRAIDS_PHASE_SWARM_H_
+#define BRAIDS_PHASE_SWARM_H_
+
+#include "stmlib/stmlib.h"
+
+namespace braids {
+
+static const size_t kMaxSwarmSize = 32;
+static const size_t kSwarmLaneSize = 4;
+STATIC_ASSERT(kSwarmLaneSize == 4, lane_sums_are_unrolled);
+STATIC_ASSERT(kMaxSwarmSize % kSwarmLaneSize == 0, whole_number_of_lanes);
+
+struct PhaseSwarm {
+  uint32_t phase[kMaxSwarmSize];
+  uint32_t phase_increment[kMaxSwarmSize];
+  
+  // Advances the first size phases (rounded up to a whole number of lanes) by
+  // one sample, and returns the sum of their (32 - shift) most significant
+  // bits. A shift of 19 gives 13-bit saws, a shift of 31 gives 1-bit squares.
+  template<int32_t shift>
+  inline int32_t Render(size_t size) {
+    int32_t lane[kSwarmLaneSize] = { 0 };
+    for (size_t i = 0; i < size; i += kSwarmLaneSize) {
+      for (size_t j = 0; j < kSwarmLaneSize; ++j) {
+        phase[i + j] += phase_increment[i + j];
+        lane[j] += phase[i + j] >> shift;
+      }
+    }
+    return lane[0] + lane[1] + lane[2] + lane[3];
+  }
+  
+  inline void Reset() {
+    for (size_t i = 0; i < kMaxSwarmSize; ++i) {
+      phase[i] = 0;
+    }
+  }
+};
+
+}  // namespace braids
+
+#endif  // BRAIDS_PHASE_SWARM_H_
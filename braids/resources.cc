@@ -2830,8263 +2830,5407 @@ const int16_t* waveshaper_table[] = {
   ws_tri_fold,
 };
 
-const uint8_t wt_waves[] = {
-     104,    105,    107,    108,
-     110,    112,    115,    116,
-     118,    122,    124,    124,
-     126,    129,    131,    132,
-     135,    137,    138,    140,
-     143,    145,    145,    147,
-     148,    149,    148,    148,
-     148,    147,    146,    144,
-     142,    139,    137,    133,
-     127,    121,    116,    110,
-     101,     93,     88,     83,
-      78,     74,     73,     73,
-      75,     80,     86,     93,
-     104,    116,    130,    143,
-     158,    173,    188,    203,
-     218,    228,    236,    245,
-     255,    252,    248,    244,
-     240,    232,    222,    211,
-     200,    188,    177,    166,
-     153,    141,    132,    123,
-     114,    105,     98,     91,
-      85,     82,     78,     74,
-      72,     72,     73,     72,
-      72,     75,     78,     80,
-      83,     88,     92,     95,
-     100,    104,    108,    113,
-     117,    120,    122,    125,
-     126,    125,    125,    124,
-     122,    120,    118,    116,
-     113,    111,    110,    108,
-     107,    105,    105,    104,
-     103,    103,    104,    103,
-     104,    123,    122,    124,
-     120,    118,    117,    117,
-     118,    117,    113,    114,
-     115,    113,    110,    109,
-     109,    110,    110,    108,
-     110,    114,    116,    118,
-     122,    125,    131,    135,
-     136,    135,    139,    142,
-     141,    139,    138,    138,
-     138,    135,    131,    129,
-     127,    125,    119,    114,
-     111,    107,    100,     95,
-      90,     84,     82,     79,
-      80,     82,     87,     97,
-     111,    124,    140,    160,
-     182,    203,    218,    229,
-     241,    255,    246,    238,
-     231,    223,    208,    193,
-     180,    173,    166,    157,
-     150,    149,    149,    148,
-     145,    143,    143,    141,
-     138,    134,    131,    128,
-     125,    121,    116,    110,
-     105,    102,     97,     90,
-      86,     86,     85,     84,
-      82,     85,     90,     93,
-      95,     98,    105,    110,
-     111,    112,    114,    116,
-     115,    113,    111,    111,
-     112,    112,    112,    113,
-     117,    120,    122,    124,
-     124,    126,    127,    128,
-     125,    123,    149,    149,
-     148,    147,    148,    146,
-     143,    143,    142,    139,
-     138,    137,    136,    135,
-     134,    134,    133,    132,
-     132,    132,    130,    129,
-     127,    125,    121,    118,
-     114,    109,    105,    103,
-      99,     96,     95,     93,
-      92,     92,     91,     90,
-      88,     88,     86,     84,
-      82,     79,     77,     75,
-      73,     71,     70,     72,
-      74,     75,     78,     86,
-      93,    100,    113,    129,
-     141,    155,    175,    193,
-     203,    217,    236,    242,
-     245,    251,    255,    251,
-     245,    244,    238,    228,
-     219,    213,    203,    191,
-     184,    176,    165,    156,
-     148,    140,    129,    122,
-     115,    107,     98,     92,
-      85,     77,     70,     65,
-      58,     56,     55,     54,
-      55,     58,     63,     69,
-      76,     85,     92,     99,
-     108,    115,    119,    122,
-     127,    128,    128,    129,
-     130,    129,    128,    130,
-     130,    130,    131,    135,
-     137,    137,    141,    144,
-     145,    146,    149,    134,
-     129,    121,    119,    120,
-     118,    117,    123,    127,
-     125,    127,    128,    122,
-     116,    113,    109,    105,
-     108,    115,    123,    131,
-     144,    153,    156,    156,
-     153,    141,    127,    115,
-     105,     95,     93,     98,
-     104,    110,    125,    137,
-     140,    142,    147,    146,
-     135,    135,    139,    139,
-     142,    160,    173,    174,
-     185,    192,    174,    148,
-     133,    105,     60,     36,
-      38,     27,     28,     69,
-     116,    142,    183,    239,
-     255,    250,    254,    248,
-     204,    164,    149,    119,
-      80,     72,     78,     71,
-      70,     90,    102,     99,
-     110,    125,    129,    129,
-     147,    161,    162,    170,
-     182,    179,    167,    158,
-     147,    120,     97,     83,
-      69,     52,     51,     64,
-      74,     90,    118,    142,
-     156,    172,    185,    183,
-     170,    162,    146,    123,
-     105,     98,     87,     78,
-      83,     92,     96,    104,
-     120,    128,    131,    137,
-     143,    138,    134,    134,
-     148,    154,    158,    162,
-     163,    166,    166,    166,
-     164,    160,    156,    151,
-     142,    136,    128,    118,
-     110,    103,     96,     91,
-      87,     84,     83,     84,
-      86,     89,     92,     98,
-     103,    110,    116,    123,
-     129,    133,    137,    142,
-     144,    143,    142,    142,
-     139,    134,    130,    125,
-     120,    114,    107,    102,
-      95,     91,     85,     79,
-      75,     74,     72,     70,
-      73,     82,     90,    101,
-     121,    140,    155,    177,
-     203,    220,    230,    243,
-     254,    255,    248,    243,
-     235,    220,    202,    185,
-     168,    152,    136,    120,
-     106,     98,     90,     84,
-      77,     76,     77,     75,
-      75,     76,     79,     81,
-      84,     88,     92,     97,
-     105,    114,    121,    128,
-     138,    148,    155,    160,
-     164,    168,    168,    164,
-     158,    151,    143,    134,
-     123,    111,    104,     99,
-      92,     89,     90,     92,
-      94,    100,    106,    113,
-     121,    128,    135,    142,
-     148,    148,    163,    170,
-     171,    169,    162,    153,
-     144,    130,    115,    108,
-     105,     95,     81,     75,
-      75,     71,     69,     77,
-      96,    112,    126,    142,
-     154,    156,    155,    148,
-     132,    119,    113,    105,
-      90,     80,     76,     69,
-      60,     52,     54,     64,
-      75,     92,    116,    136,
-     150,    162,    163,    154,
-     143,    135,    132,    127,
-     121,    120,    121,    108,
-      80,     64,     62,     50,
-      43,     76,    112,    133,
-     172,    221,    239,    238,
-     247,    255,    240,    220,
-     214,    210,    194,    170,
-     151,    141,    127,    111,
-     105,    107,    113,    122,
-     137,    151,    164,    181,
-     195,    201,    202,    199,
-     197,    190,    172,    148,
-     121,     98,     74,     39,
-      14,     25,     45,     54,
-      71,    105,    139,    157,
-     166,    177,    184,    187,
-     185,    176,    168,    159,
-     145,    128,    108,     86,
-      74,     73,     67,     61,
-      70,     90,    103,    114,
-     130,    148,    178,    176,
-     172,    161,    160,    159,
-     143,    138,    137,    125,
-     121,    114,    106,    100,
-      95,     90,     84,     81,
-      80,     81,     70,     81,
-      78,     70,     75,     82,
-      80,     75,     79,     86,
-      87,     82,     89,     97,
-      89,     90,     96,     95,
-      90,     89,     95,     88,
-      85,     88,     87,     80,
-      82,     85,     79,     81,
-      84,     88,     83,     95,
-     102,     98,    104,    119,
-     126,    123,    141,    159,
-     154,    168,    190,    194,
-     201,    211,    224,    230,
-     232,    241,    248,    249,
-     253,    255,    255,    251,
-     250,    244,    236,    229,
-     224,    209,    193,    189,
-     179,    158,    148,    143,
-     119,    106,    100,     88,
-      75,     66,     58,     53,
-      47,     38,     39,     43,
-      40,     43,     46,     56,
-      59,     66,     79,     83,
-      94,    105,    110,    119,
-     134,    139,    143,    157,
-     164,    166,    169,    182,
-     181,    175,    183,    188,
-     183,    177,    178,    151,
-     153,    156,    144,    137,
-     143,    138,    126,    122,
-     129,    127,    115,    112,
-     116,    118,    113,    113,
-     118,    117,    118,    122,
-     130,    130,    128,    136,
-     142,    137,    143,    144,
-     134,    143,    153,    140,
-     128,    138,    145,    125,
-     113,    125,    119,     97,
-      90,    104,     99,     73,
-      67,     83,     77,     60,
-      65,     77,     64,     56,
-      82,     91,     72,     80,
-     107,    109,    102,    127,
-     146,    135,    143,    176,
-     187,    179,    186,    211,
-     220,    209,    218,    244,
-     238,    217,    233,    255,
-     230,    214,    232,    225,
-     197,    197,    201,    178,
-     156,    153,    149,    131,
-     112,    103,    100,     81,
-      63,     70,     64,     38,
-      38,     49,     34,     25,
-      46,     47,     33,     46,
-      63,     65,     65,     78,
-      94,    100,    101,    111,
-     126,    130,    131,    142,
-     153,    150,    150,    162,
-     166,    160,    159,    164,
-     163,    164,    160,    151,
-     183,    167,    151,    130,
-     125,    113,     83,     80,
-      89,     82,     80,    101,
-     122,    127,    133,    141,
-     157,    160,    148,    144,
-     143,    144,    131,    109,
-      99,     97,     84,     59,
-      53,     75,    105,    113,
-     117,    144,    166,    171,
-     144,    117,    119,    107,
-      65,     27,     46,     68,
-      39,     24,     55,     70,
-      68,     79,    103,    118,
-     122,    134,    136,    117,
-     120,    121,    103,     92,
-     116,    130,    106,    112,
-     150,    152,    132,    137,
-     168,    174,    153,    157,
-     188,    203,    195,    204,
-     222,    215,    209,    207,
-     186,    160,    158,    152,
-     120,    112,    145,    163,
-     162,    169,    187,    210,
-     207,    196,    194,    181,
-     160,    122,    101,     92,
-      85,     97,     77,     64,
-      97,    132,    152,    171,
-     210,    235,    228,    197,
-     149,    128,    112,     56,
-       1,     20,     62,     49,
-      30,     61,    102,    118,
-     134,    174,    208,    205,
-     183,    168,    158,    144,
-     129,    120,    116,    113,
-     114,    117,    124,    135,
-     140,    135,    135,    147,
-     152,    143,    141,    151,
-     160,    155,    152,    153,
-     142,    128,    117,    103,
-      84,     74,     83,     94,
-     101,    110,    130,    147,
-     150,    143,    134,    127,
-     112,     92,     71,     63,
-      61,     58,     54,     59,
-      71,     84,     95,    101,
-     102,    107,    114,    108,
-      91,     83,     84,     82,
-      74,     77,     84,    103,
-     146,    189,    201,    205,
-     232,    255,    229,    183,
-     163,    156,    132,    105,
-     103,    115,    125,    142,
-     162,    167,    165,    178,
-     187,    173,    155,    160,
-     174,    174,    167,    165,
-     170,    169,    156,    135,
-     113,    100,     89,     78,
-      71,     76,     92,    109,
-     128,    148,    163,    181,
-     192,    190,    177,    163,
-     139,    109,     85,     72,
-      51,     34,     44,     65,
-      75,     84,    114,    141,
-     153,    164,    182,    188,
-     178,    168,    120,    127,
-     135,    128,    123,    126,
-     125,    121,    124,    140,
-     158,    167,    160,    154,
-     168,    184,    184,    170,
-     159,    155,    146,    140,
-     140,    132,    116,    111,
-     113,    106,     95,    100,
-     119,    129,    115,    103,
-     111,    129,    132,    126,
-     114,     95,     79,     79,
-      94,     97,     75,     54,
-      51,     47,     34,     35,
-      52,     61,     53,     37,
-      20,     22,     53,     90,
-     102,     87,     73,     69,
-      94,    164,    244,    255,
-     202,    176,    217,    253,
-     243,    232,    241,    227,
-     179,    155,    160,    153,
-     139,    150,    161,    136,
-      99,     86,    108,    141,
-     167,    167,    149,    138,
-     141,    157,    176,    188,
-     181,    160,    151,    150,
-     134,    117,    131,    159,
-     149,    108,     84,     88,
-     101,    109,    120,    124,
-     108,     87,     86,    103,
-     113,    105,    100,    119,
-     134,    122,    112,    130,
-     144,    135,    128,    141,
-     148,    133,    120,    137,
-     136,    132,    142,    163,
-     167,    157,    157,    166,
-     170,    169,    170,    163,
-     154,    153,    155,    151,
-     141,    133,    129,    128,
-     127,    122,    111,    108,
-     113,    113,    105,    101,
-     102,    103,    104,    102,
-     101,    100,     95,     94,
-     101,     97,     79,     72,
-      83,     89,     72,     51,
-      50,     66,     69,     49,
-      33,     43,     61,     64,
-      51,     50,     65,     76,
-      80,     92,    117,    134,
-     123,    113,    149,    211,
-     216,    167,    157,    217,
-     255,    225,    191,    205,
-     227,    216,    194,    195,
-     203,    186,    156,    148,
-     166,    170,    137,    108,
-     115,    136,    135,    115,
-     102,    109,    124,    129,
-     122,    120,    129,    138,
-     138,    137,    141,    150,
-     152,    146,    146,    155,
-     159,    147,    136,    142,
-     149,    142,    124,    118,
-     123,    123,    112,    102,
-     105,    111,    104,     97,
-     104,    113,    110,    106,
-     113,    123,    131,    137,
-     173,    176,    164,    163,
-     190,    203,    190,    187,
-     197,    197,    198,    208,
-     206,    191,    186,    188,
-     191,    183,    174,    162,
-     149,    143,    149,    141,
-     115,    102,    101,     97,
-      87,     81,     67,     58,
-      50,     51,     50,     47,
-      33,     29,     27,     31,
-      35,     31,     20,     22,
-      24,     24,     35,     45,
-      26,     18,     35,     59,
-      58,     53,     50,     59,
-      75,     93,    106,    111,
-     123,    123,    120,    149,
-     210,    204,    156,    160,
-     231,    255,    226,    208,
-     237,    251,    237,    232,
-     251,    254,    234,    210,
-     212,    235,    242,    203,
-     168,    182,    203,    187,
-     161,    158,    154,    140,
-     129,    139,    138,    116,
-      98,    102,    103,    103,
-      97,     85,     76,     79,
-      82,     82,     85,     78,
-      68,     70,     88,     93,
-      83,     78,     92,     96,
-      93,    103,    118,    110,
-     104,    119,    134,    138,
-     137,    138,    143,    156,
-     173,    121,    124,    113,
-     110,    113,    122,    125,
-     116,    126,    130,    122,
-     143,    144,    128,    136,
-     142,    145,    141,    137,
-     135,    135,    140,    128,
-     134,    141,    101,    123,
-     147,    109,    104,    129,
-     136,    124,    126,    144,
-     146,    139,    160,    171,
-     134,    133,    163,    129,
-     117,    139,     94,     79,
-     100,     72,     55,     55,
-      37,     27,     34,     24,
-      19,     22,     38,     66,
-      51,     56,    112,    109,
-     101,    165,    183,    160,
-     189,    227,    231,    229,
-     231,    252,    255,    224,
-     230,    232,    203,    205,
-     189,    148,    153,    160,
-     113,     97,    112,     87,
-      74,     90,     80,     66,
-      76,     86,     87,     95,
-      97,     97,     95,    116,
-     129,     94,    105,    148,
-     123,    118,    143,    136,
-     144,    147,    147,    157,
-     148,    144,    156,    163,
-     148,    140,    155,    157,
-     142,    137,    137,    137,
-     133,    122,    126,    123,
-     111,    121,    172,    178,
-     185,    193,    193,    197,
-     210,    210,    205,    213,
-     216,    211,    209,    209,
-     207,    197,    194,    191,
-     185,    176,    169,    161,
-     149,    143,    139,    121,
-     114,    111,     96,     88,
-      85,     85,     67,     61,
-      62,     57,     48,     57,
-      48,     28,     39,     42,
-      33,     26,     42,     24,
-      24,     41,     38,     30,
-      38,     40,     44,     53,
-      54,     61,     71,     87,
-      97,     94,    116,    144,
-     135,    137,    187,    196,
-     172,    192,    236,    225,
-     219,    240,    253,    245,
-     246,    255,    252,    249,
-     247,    234,    228,    234,
-     222,    197,    196,    197,
-     177,    159,    165,    153,
-     126,    123,    129,    106,
-      93,     98,     89,     68,
-      75,     73,     54,     52,
-      63,     52,     46,     51,
-      48,     51,     58,     55,
-      55,     62,     69,     70,
-      77,     86,     88,     90,
-     102,    114,    115,    121,
-     134,    140,    139,    153,
-     166,    166,    172,    120,
-     102,     97,    114,    144,
-     171,    170,    151,    160,
-     185,    189,    196,    202,
-     172,    143,    137,    143,
-     150,    143,    119,    107,
-     115,    126,    135,    136,
-     123,    116,    121,    115,
-     107,    115,    122,     98,
-      68,     66,     81,     94,
-     102,     89,     62,     61,
-      87,    111,    112,    100,
-      86,     98,    110,     95,
-      93,    100,     85,     60,
-      43,     38,     63,     85,
-      82,     72,     73,     91,
-     107,    118,    163,    225,
-     233,    172,    131,    185,
-     255,    239,    168,    146,
-     167,    175,    166,    172,
-     185,    169,    143,    145,
-     177,    199,    193,    168,
-     140,    126,    147,    178,
-     162,    112,     90,    108,
-     128,    136,    136,    127,
-     111,    110,    113,    118,
-     137,    150,    128,     91,
-      79,    103,    134,    124,
-      85,     66,     80,    103,
-     118,    127,    122,    108,
-     111,    134,    154,    165,
-     162,    138,    112,    115,
-     143,    158,    144,    120,
-     104,    114,    124,    137,
-     148,    160,    170,    176,
-     181,    183,    184,    181,
-     179,    172,    164,    155,
-     145,    137,    127,    119,
-     112,    106,     98,     93,
-      88,     82,     81,     80,
-      82,     84,     88,     93,
-     100,    110,    120,    133,
-     142,    154,    163,    172,
-     179,    182,    186,    181,
-     177,    165,    157,    143,
-     128,    113,     96,     81,
-      66,     56,     50,     45,
-      46,     43,     45,     47,
-      55,     71,     91,    116,
-     137,    159,    177,    195,
-     215,    233,    247,    254,
-     255,    250,    239,    224,
-     208,    190,    170,    148,
-     126,    104,     84,     69,
-      59,     52,     49,     48,
-      50,     53,     59,     68,
-      80,     90,    102,    110,
-     118,    125,    134,    142,
-     148,    156,    162,    166,
-     169,    172,    174,    173,
-     174,    171,    168,    162,
-     153,    145,    135,    127,
-     116,    107,     97,     88,
-      80,     74,     72,     71,
-      74,     79,     87,     95,
-     104,    104,    102,    100,
-     100,    103,    108,    114,
-     121,    126,    136,    145,
-     152,    161,    161,    167,
-     165,    163,    158,    154,
-     147,    140,    133,    121,
-     113,    103,     95,     93,
-      91,     90,     89,     93,
-      98,    105,    116,    126,
-     136,    141,    148,    152,
-     159,    162,    163,    162,
-     156,    151,    136,    132,
-     122,    110,    100,     90,
-      79,     67,     63,     59,
-      59,     60,     58,     57,
-      56,     63,     75,     96,
-     122,    146,    167,    188,
-     208,    229,    246,    255,
-     255,    242,    232,    214,
-     200,    188,    177,    166,
-     154,    144,    139,    137,
-     137,    140,    140,    135,
-     130,    119,    110,    100,
-      92,     82,     70,     61,
-      49,     47,     45,     54,
-      63,     77,     89,    103,
-     119,    133,    150,    160,
-     168,    174,    172,    172,
-     167,    164,    155,    150,
-     142,    135,    131,    124,
-     122,    116,    117,    113,
-     111,    110,    108,    107,
-     105,    104,     52,     55,
-      65,     78,     99,    127,
-     152,    180,    202,    224,
-     236,    241,    239,    221,
-     206,    182,    163,    139,
-     120,    105,     91,     88,
-      80,     81,     78,     77,
-      78,     72,     72,     62,
-      63,     61,     65,     76,
-      88,    110,    130,    157,
-     178,    199,    216,    222,
-     228,    217,    205,    180,
-     159,    136,    112,     98,
-      82,     74,     66,     68,
-      73,     78,     87,     82,
-      79,     67,     62,     63,
-      69,     87,    100,    117,
-     132,    157,    185,    212,
-     233,    239,    242,    233,
-     221,    208,    194,    182,
-     162,    146,    129,    120,
-     117,    118,    123,    120,
-     117,    111,    107,    100,
-      92,     89,     79,     73,
-      63,     57,     49,     45,
-      54,     67,     92,    118,
-     154,    187,    215,    236,
-     245,    252,    255,    253,
-     233,    204,    175,    143,
-     120,     98,     85,     76,
-      71,     70,     66,     70,
-      69,     70,     67,     62,
-      57,     49,     52,     90,
-      91,     95,    102,    116,
-     130,    154,    170,    183,
-     193,    192,    181,    164,
-     142,    123,    103,     91,
-      80,     76,     76,     83,
-      99,    110,    121,    124,
-     126,    127,    122,    118,
-     110,    106,    105,    105,
-     112,    121,    138,    150,
-     161,    165,    166,    159,
-     149,    136,    120,    100,
-      76,     60,     51,     51,
-      59,     71,     84,     98,
-     113,    125,    137,    144,
-     138,    128,    112,    103,
-     103,    115,    134,    162,
-     183,    199,    210,    207,
-     198,    192,    183,    181,
-     180,    181,    188,    197,
-     212,    221,    230,    222,
-     208,    181,    151,    121,
-      90,     71,     56,     54,
-      56,     63,     83,    100,
-     119,    124,    122,    108,
-      85,     66,     57,     66,
-      83,    113,    142,    178,
-     204,    226,    245,    254,
-     255,    225,    185,    142,
-     100,     69,     49,     41,
-      38,     43,     53,     68,
-      92,    108,    119,    120,
-     117,    103,     95,     90,
-     116,    127,    136,    147,
-     159,    170,    180,    186,
-     191,    196,    196,    194,
-     191,    184,    179,    169,
-     159,    149,    139,    127,
-     118,    109,    103,     96,
-      89,     86,     86,     84,
-      86,     84,     88,     94,
-      96,    104,    103,    107,
-     106,    106,    104,    103,
-      98,     91,     87,     78,
-      74,     65,     64,     59,
-      59,     58,     61,     64,
-      70,     78,     88,    101,
-     116,    126,    134,    150,
-     158,    176,    186,    192,
-     206,    208,    210,    214,
-     219,    221,    224,    229,
-     231,    235,    233,    240,
-     241,    250,    248,    251,
-     246,    245,    236,    228,
-     219,    203,    192,    171,
-     154,    130,    108,     89,
-      72,     53,     38,     24,
-      15,      5,      1,      2,
-       9,     17,     28,     41,
-      55,     68,     78,     93,
-     104,    118,    124,    128,
-     131,    127,    128,    125,
-     122,    115,    113,    105,
-     100,     97,     93,     92,
-      93,     97,    100,    108,
-     116,     10,     15,     35,
-      61,     98,    130,    164,
-     193,    207,    208,    193,
-     170,    149,    126,    114,
-     112,    112,    123,    136,
-     153,    175,    183,    183,
-     169,    137,    107,     74,
-      44,     21,      2,      3,
-      20,     46,     91,    135,
-     178,    210,    228,    242,
-     240,    227,    204,    175,
-     145,    113,     81,     66,
-      58,     59,     62,     66,
-      72,     75,     81,     87,
-      99,    112,    115,    121,
-     140,    158,    195,    212,
-     213,    208,    174,    131,
-     115,    109,    119,    136,
-     159,    173,    198,    223,
-     247,    255,    242,    211,
-     157,    107,     69,     39,
-      29,     27,     34,     58,
-      91,    136,    175,    202,
-     218,    208,    183,    150,
-     113,     81,     46,     25,
-      16,     28,     62,    105,
-     147,    185,    195,    196,
-     181,    162,    143,    106,
-      73,     46,     28,     42,
-      67,    108,    151,    186,
-     213,    223,    227,    216,
-     181,    146,     97,     52,
-      25,     10,    128,    129,
-     125,    124,    122,    121,
-     117,    110,    101,     92,
-      84,     79,     79,     79,
-      86,     88,     94,     99,
-     104,    108,    114,    120,
-     123,    130,    131,    134,
-     137,    142,    145,    149,
-     155,    161,    162,    165,
-     166,    167,    168,    165,
-     164,    158,    150,    139,
-     126,    118,    109,    102,
-      93,     87,     81,     76,
-      76,     77,     82,     82,
-      84,     82,     82,     79,
-      83,     96,    114,    138,
-     156,    170,    179,    177,
-     172,    169,    171,    170,
-     169,    164,    163,    170,
-     187,    209,    233,    249,
-     255,    240,    218,    194,
-     168,    151,    138,    132,
-     127,    125,    120,    120,
-     118,    121,    120,    111,
-      98,     75,     53,     29,
-      18,     16,     28,     45,
-      68,     85,     99,    106,
-     108,    112,    112,    114,
-     111,    113,    111,    114,
-     124,    140,    160,    174,
-     190,    193,    192,    183,
-     170,    155,    144,    138,
-     132,    130,    128,    168,
-     171,    166,    165,    162,
-     163,    158,    155,    147,
-     144,    137,    131,    126,
-     122,    119,    114,    111,
-     106,    107,    103,    107,
-     105,    107,    105,    104,
-     101,    102,    101,    100,
-     100,    101,    104,    104,
-     109,    109,    115,    117,
-     122,    125,    129,    130,
-     129,    125,    122,    120,
-     112,    111,    105,    103,
-      96,     96,     96,     97,
-     104,    108,    120,    126,
-     127,    125,    128,    132,
-     143,    150,    161,    166,
-     167,    172,    181,    196,
-     212,    226,    236,    242,
-     249,    250,    255,    255,
-     255,    249,    236,    221,
-     208,    193,    179,    167,
-     155,    148,    132,    121,
-     107,     99,     88,     82,
-      71,     65,     52,     42,
-      30,     23,     20,     14,
-      15,     14,     19,     21,
-      26,     31,     43,     52,
-      66,     76,     88,     98,
-     105,    115,    125,    139,
-     143,    153,    154,    161,
-     162,    166,    165,    169,
-     170,    171,    170,    168,
-     105,    117,    127,    138,
-     143,    147,    145,    139,
-     130,    122,    115,    108,
-     109,    111,    120,    126,
-     131,    142,    144,    145,
-     136,    122,     99,     79,
-      60,     58,     72,    100,
-     140,    181,    217,    233,
-     230,    203,    165,    124,
-      91,     76,     82,    113,
-     154,    198,    229,    242,
-     227,    186,    133,     76,
-      32,      1,      5,     27,
-      66,    108,    137,    158,
-     154,    132,     99,     73,
-      51,     49,     59,     86,
-     114,    143,    169,    186,
-     196,    194,    189,    178,
-     171,    167,    165,    174,
-     181,    191,    195,    194,
-     187,    180,    164,    146,
-     131,    114,    101,     87,
-      82,     81,     87,     94,
-     106,    114,    114,    111,
-     101,     87,     73,     63,
-      59,     65,     79,     95,
-     119,    141,    158,    166,
-     165,    158,    139,    125,
-     110,    106,    109,    121,
-     137,    154,    167,    171,
-     169,    156,    142,    121,
-     107,     96,     94,     95,
-     105,    194,    198,    207,
-     201,    202,    189,    181,
-     167,    168,    164,    165,
-     154,    154,    139,    135,
-     120,    109,    107,    100,
-      97,     86,     82,     73,
-      73,     66,     70,     63,
-      66,     58,     66,     71,
-      88,     89,     91,     80,
-      78,     71,     76,     80,
-      91,    102,    103,    103,
-     103,    103,    101,    106,
-     102,    110,     96,    100,
-      96,    111,    124,    141,
-     156,    167,    153,    147,
-     141,    151,    172,    194,
-     211,    200,    191,    178,
-     186,    195,    219,    225,
-     229,    213,    206,    189,
-     198,    204,    215,    210,
-     197,    175,    161,    146,
-     139,    143,    141,    135,
-     113,    102,     81,     84,
-      74,     86,     77,     74,
-      56,     52,     38,     41,
-      49,     47,     49,     35,
-      16,      7,      1,     35,
-      72,     93,    109,     93,
-      88,     80,    100,    125,
-     158,    171,    180,    168,
-     166,    168,    184,    205,
-     218,    222,    214,    205,
-     190,    194,    129,    151,
-     182,    191,    195,    181,
-     171,    155,    155,    155,
-     168,    175,    189,    185,
-     178,    154,    131,    115,
-     117,    133,    150,    156,
-     144,    118,     88,     81,
-      83,    107,    122,    133,
-     117,     99,     75,     71,
-      79,    101,    113,    114,
-      98,     81,     71,     73,
-      86,    101,    113,    107,
-     103,     91,     92,     90,
-      99,    103,    119,    127,
-     142,    145,    145,    128,
-     118,    120,    134,    153,
-     159,    154,    136,    132,
-     150,    185,    204,    204,
-     181,    159,    151,    180,
-     212,    245,    240,    213,
-     173,    153,    158,    186,
-     209,    211,    189,    157,
-     132,    122,    133,    143,
-     153,    139,    129,    107,
-      97,     82,     81,     73,
-      78,     86,     95,     92,
-      71,     36,      7,      1,
-      33,     82,    114,    117,
-      75,     34,      7,     35,
-      87,    144,    166,    154,
-     107,     75,     70,    105,
-     155,    191,    195,    172,
-     143,    123,    129,     72,
-      66,     89,    126,    157,
-     167,    154,    123,     92,
-      78,     89,    113,    148,
-     170,    175,    155,    123,
-      96,     85,     97,    126,
-     156,    173,    165,    136,
-     103,     81,     81,    104,
-     138,    164,    170,    148,
-     115,     86,     77,     92,
-     124,    154,    168,    158,
-     134,    106,     93,    101,
-     125,    154,    171,    170,
-     148,    119,     98,     99,
-     116,    147,    176,    184,
-     166,    130,     89,     59,
-      48,     58,     95,    136,
-     171,    185,    165,    120,
-      75,     61,     91,    156,
-     226,    255,    238,    174,
-     108,     73,     93,    153,
-     220,    250,    224,    160,
-      90,     51,     58,    105,
-     155,    183,    173,    132,
-      80,     44,     37,     59,
-      99,    135,    152,    144,
-     116,     78,     46,     41,
-      66,    117,    167,    194,
-     183,    138,     89,     62,
-      80,    129,    187,    220,
-     212,    165,    109,     74,
-      77,    116,    163,    194,
-     189,    156,    108,     72,
-      76,     47,     48,     80,
-     136,    189,    213,    190,
-     135,     78,     52,     75,
-     142,    218,    255,    245,
-     177,    101,     52,     59,
-     117,    186,    232,    215,
-     159,     83,     32,     26,
-      66,    125,    166,    172,
-     139,     88,     45,     29,
-      48,     92,    132,    159,
-     160,    139,    109,     87,
-      86,    107,    145,    180,
-     200,    194,    163,    128,
-     105,    108,    139,    180,
-     211,    205,    170,    111,
-      60,     31,     39,     84,
-     132,    177,    190,    161,
-     101,     44,     25,     60,
-     133,    210,    241,    224,
-     161,     93,     59,     79,
-     142,    212,    250,    232,
-     175,    108,     66,     69,
-     108,    162,    194,    192,
-     158,    108,     66,     46,
-      61,     93,    131,    155,
-     153,    123,     82,     42,
-      28,     48,     98,    152,
-     182,    173,    131,     80,
-      52,     66,    118,    174,
-     213,    211,    169,    114,
-      78,     82,    119,    168,
-     199,    197,    170,    121,
-      76,     59,     42,     38,
-      46,     74,     92,    110,
-     118,    135,    175,    174,
-     229,    247,    255,    241,
-     232,    208,    188,    151,
-     126,    114,    101,    108,
-      84,     68,     33,     15,
-      22,     59,    113,    139,
-     139,    124,    105,    114,
-     143,    168,    190,    169,
-     133,    121,    119,    130,
-     124,    104,     82,     65,
-      81,    109,    130,    134,
-     109,    104,    119,    166,
-     223,    240,    206,    154,
-      96,     73,     64,     84,
-     112,    113,    127,    139,
-     137,    121,     84,     68,
-      70,    109,    186,    221,
-     236,    186,    119,     68,
-      71,    121,    197,    227,
-     202,    143,     73,     37,
-      41,    101,    154,    177,
-     167,    135,    106,     89,
-      94,    120,    136,    154,
-     166,    163,    155,    128,
-      83,     50,     37,     76,
-     128,    175,    182,    129,
-      64,     19,     35,    113,
-     183,    238,    227,    164,
-     107,     79,    112,    170,
-     210,    219,    183,    140,
-      92,     59,    184,    157,
-      84,      7,    109,    254,
-     193,     59,     87,    155,
-     124,    180,    203,    108,
-      31,    149,    236,    173,
-      92,    101,    116,    126,
-     190,    184,     86,     48,
-     138,    189,    141,    110,
-     114,    102,    116,    170,
-     159,     72,     70,    167,
-     182,    114,     94,    103,
-     101,    131,    183,    158,
-      64,     62,    132,    152,
-     154,    131,    106,     66,
-     103,    184,    198,    111,
-      83,     89,    110,    118,
-     187,    177,     94,     79,
-     147,    172,    123,    108,
-     124,    106,    102,    150,
-     144,    101,    116,    166,
-     128,     66,     89,    144,
-     160,    151,    144,     91,
-      72,    116,    168,    179,
-     130,     87,     72,    131,
-     205,    170,     69,     58,
-     158,    177,    134,    125,
-     107,     80,    139,    223,
-     141,     52,     90,    151,
-     146,    173,    191,     74,
-      11,    122,    255,    188,
-      96,     72,     52,    122,
-     253,    227,     43,      1,
-     137,    207,    184,    153,
-      93,    110,    120,    152,
-     124,     90,    124,    181,
-     155,     58,    125,    183,
-     150,     80,    131,    157,
-     144,    115,    110,    128,
-     149,    173,     93,    113,
-     118,    146,    124,    145,
-     117,    140,    116,    117,
-     129,    136,    144,    114,
-     126,    128,    117,    142,
-     134,    127,     97,    163,
-     163,     90,     67,    161,
-     149,    149,     95,    124,
-     137,    119,    122,    168,
-     142,     96,     89,    170,
-     119,    117,    142,    148,
-      52,     93,    194,    178,
-      58,     75,    150,    194,
-     107,     82,    102,    193,
-     151,    108,     57,    135,
-     220,    142,     31,    109,
-     232,    171,     24,     58,
-     239,    198,     51,     24,
-     179,    255,     92,     37,
-     102,    227,    141,     56,
-     110,    186,    152,     74,
-     118,    143,    148,    119,
-     114,    132,    156,    120,
-      91,    143,    140,    145,
-     119,    133,    152,     75,
-     101,    174,    188,     96,
-      82,    115,    182,    153,
-     118,     58,      1,     22,
-      51,     63,     40,     51,
-      87,    124,    133,    165,
-     194,    200,    185,    176,
-     160,    146,    130,    126,
-     132,    143,    134,    113,
-     120,    137,    141,    130,
-     129,    131,    129,    111,
-     100,     99,    106,    117,
-     110,    115,    121,    121,
-     125,    128,    129,    133,
-     143,    142,    119,    118,
-     135,    144,    151,    142,
-     137,    146,    154,    167,
-     173,    155,    128,    114,
-     132,    135,    123,     97,
-      75,     65,     85,    117,
-     118,    106,    109,    121,
-     136,    138,    137,    135,
-     139,    137,    131,    121,
-     116,    136,    138,    125,
-     135,    145,    144,    138,
-     143,    151,    139,    126,
-     124,    146,    153,    130,
-     106,     93,    108,    114,
-     114,    109,    106,    106,
-     116,    137,    131,    133,
-     150,    160,    152,    137,
-     119,    104,     98,     97,
-     121,    122,    119,    137,
-     167,    208,    214,    184,
-     171,    199,    208,    148,
-     118,     95,     66,      1,
-       2,     32,     50,     41,
-      56,     97,    138,    149,
-     166,    181,    186,    173,
-     165,    156,    149,    134,
-     122,    125,    138,    136,
-     123,    126,    140,    146,
-     136,    125,    120,    122,
-     118,    109,    102,    101,
-     107,    108,    110,    115,
-     120,    127,    132,    131,
-     134,    144,    146,    137,
-     137,    144,    144,    142,
-     139,    142,    147,    146,
-     143,    148,    147,    138,
-     129,    128,    122,    117,
-     111,    104,     94,    101,
-     114,    116,    112,    115,
-     122,    130,    132,    127,
-     123,    123,    122,    122,
-     115,    115,    126,    129,
-     123,    132,    144,    145,
-     140,    143,    151,    153,
-     143,    135,    137,    141,
-     133,    119,    108,    109,
-     111,    114,    113,    112,
-     112,    125,    139,    137,
-     132,    138,    138,    125,
-     110,    102,     98,     93,
-      95,    121,    147,    159,
-     164,    187,    229,    255,
-     220,    180,    192,    167,
-     113,     95,     94,     72,
-       1,     37,     86,    124,
-      92,     61,     71,     94,
-      94,    129,    170,    194,
-     167,    141,    133,    146,
-     149,    148,    153,    163,
-     152,    125,    110,    119,
-     131,    127,    116,    113,
-     118,    113,    105,    100,
-     105,    122,    126,    126,
-     120,    124,    127,    125,
-     126,    132,    143,    148,
-     139,    144,    154,    153,
-     148,    141,    146,    151,
-     147,    139,    134,    128,
-     124,    123,    128,    130,
-     133,    127,    117,     99,
-     103,    113,    121,    118,
-     113,    109,    109,    110,
-     109,    110,    120,    123,
-     125,    118,    120,    130,
-     133,    126,    140,    157,
-     163,    146,    129,    126,
-     131,    133,    136,    142,
-     149,    139,    127,    114,
-     118,    128,    141,    135,
-     119,    101,     97,     95,
-      89,     94,    121,    134,
-     130,    122,    137,    158,
-     153,    130,    152,    196,
-     215,    174,    181,    180,
-     146,    131,    130,    177,
-     173,    109,     94,    155,
-     118,      1,     15,     70,
-      93,     43,     12,     48,
-     118,    160,    171,    188,
-     200,    181,    171,    145,
-     131,    105,     97,    102,
-     103,     97,     93,    111,
-     147,    168,    159,    136,
-     130,    144,    152,    143,
-     123,     98,    103,    111,
-     111,    107,    104,    114,
-     121,    131,    136,    144,
-     153,    150,    164,    169,
-     162,    152,    140,    138,
-     127,    124,    118,    124,
-     130,    124,    128,    133,
-     138,    141,    137,    129,
-     108,    108,    109,    110,
-     105,     97,     92,    104,
-     123,    129,    123,    118,
-     114,    125,    129,    132,
-     137,    143,    133,    133,
-     140,    143,    137,    131,
-     128,    128,    123,    126,
-     135,    147,    145,    138,
-     124,    121,    123,    127,
-     114,     88,     66,     81,
-     107,    130,    139,    167,
-     192,    190,    170,    159,
-     178,    183,    133,     99,
-     103,     60,     59,    137,
-     196,    175,    126,    121,
-     195,    245,    192,    155,
-     149,    113,     27,     24,
-      64,     82,     52,     29,
-      56,    109,    146,    164,
-     175,    201,    218,    196,
-     154,    129,    101,     93,
-     106,    110,     98,     78,
-      85,    105,    127,    140,
-     144,    146,    158,    163,
-     149,    127,    115,    124,
-     132,    129,    120,    110,
-     116,    124,    131,    137,
-     145,    154,    154,    154,
-     145,    132,    125,    124,
-     128,    124,    118,    108,
-     110,    117,    119,    124,
-     128,    138,    143,    139,
-     133,    120,    118,    124,
-     133,    134,    127,    118,
-     118,    125,    127,    124,
-     126,    130,    135,    126,
-     113,    103,    109,    118,
-     125,    128,    123,    118,
-     121,    127,    139,    145,
-     149,    151,    156,    148,
-     132,    115,    107,    105,
-     115,    115,    101,     97,
-     128,    156,    162,    149,
-     164,    197,    212,    173,
-     136,    103,     58,     59,
-      75,     91,     70,     64,
-     112,    171,    189,    179,
-     180,    226,    255,    212,
-     149,    154,    122,     34,
-       1,     46,     77,     58,
-      26,     34,     75,    119,
-     152,    177,    192,    193,
-     174,    158,    154,    148,
-     132,    121,    108,     85,
-      81,    105,    133,    143,
-     138,    127,    124,    143,
-     160,    157,    134,    115,
-     111,    117,    121,    116,
-     113,    119,    123,    129,
-     131,    138,    146,    149,
-     150,    148,    140,    139,
-     135,    137,    129,    117,
-     106,    109,    122,    127,
-     122,    117,    118,    126,
-     132,    135,    132,    125,
-     125,    128,    130,    130,
-     128,    132,    139,    140,
-     131,    120,    114,    118,
-     116,    112,    100,    101,
-     105,    119,    131,    132,
-     130,    135,    145,    160,
-     157,    143,    135,    128,
-     125,    113,    104,    100,
-     103,    129,    148,    146,
-     131,    139,    178,    209,
-     201,    163,    156,    123,
-      82,     87,     90,     57,
-      30,     34,     68,     87,
-     109,    165,    224,    238,
-     207,    184,    215,    250,
-     221,    154,    177,    137,
-      65,      3,     35,     72,
-      77,     40,     25,     47,
-      85,    114,    136,    155,
-     167,    159,    153,    145,
-     139,    134,    135,    140,
-     159,    160,    145,    147,
-     148,    130,    120,    115,
-     123,    128,    126,    114,
-     101,    104,    120,    138,
-     143,    136,    130,    119,
-     106,    107,    121,    134,
-     135,    138,    146,    151,
-     146,    144,    145,    138,
-     129,    121,    112,    108,
-     107,    106,    108,    119,
-     136,    143,    145,    139,
-     138,    140,    137,    142,
-     145,    136,    125,    123,
-     123,    118,    113,    108,
-     108,    108,    111,    114,
-     114,    114,    121,    137,
-     136,    126,    130,    124,
-     114,    114,    112,    115,
-     127,    153,    174,    180,
-     171,    152,    161,    190,
-     203,    172,    134,    127,
-      89,     79,     94,    113,
-      98,     54,     54,     79,
-      77,     70,     79,    110,
-     124,    137,    174,    218,
-     232,    206,    176,    207,
-     255,    244,    177,    208,
-     145,     94,     36,     46,
-      74,     66,     36,     26,
-      53,     90,    117,    138,
-     155,    163,    157,    149,
-     143,    134,    127,    134,
-     144,    147,    135,    123,
-     142,    166,    175,    155,
-     129,    122,    124,    135,
-     131,    114,     99,    100,
-     105,    106,    111,    120,
-     124,    123,    124,    131,
-     139,    141,    141,    147,
-     144,    133,    124,    117,
-     120,    123,    117,    110,
-     112,    122,    134,    139,
-     139,    145,    150,    148,
-     142,    139,    142,    135,
-     126,    116,    111,    116,
-     121,    128,    125,    123,
-     128,    123,    122,    124,
-     125,    120,    109,    100,
-     102,    102,     94,     95,
-     105,    119,    137,    152,
-     171,    188,    199,    189,
-     187,    192,    190,    169,
-     141,    111,     63,     61,
-      92,     95,     78,     72,
-      96,    116,    112,    118,
-     130,    123,    101,     89,
-      96,    104,    110,    135,
-     178,    209,    201,    177,
-     194,    238,    255,    208,
-     231,    155,    102,     42,
-      38,     70,     72,     50,
-      28,     42,     81,    116,
-     138,    158,    176,    180,
-     173,    160,    145,    131,
-     121,    119,    117,    111,
-     111,    130,    151,    159,
-     148,    136,    143,    168,
-     176,    149,    119,     99,
-      95,    104,    105,    100,
-      98,    102,    106,    110,
-     117,    128,    139,    146,
-     151,    149,    141,    130,
-     124,    127,    129,    124,
-     117,    118,    129,    134,
-     132,    135,    149,    157,
-     153,    143,    135,    131,
-     132,    131,    119,    108,
-     116,    126,    129,    126,
-     120,    120,    114,    115,
-     120,    116,    101,     89,
-      85,     93,    105,    116,
-     138,    161,    170,    170,
-     169,    184,    210,    223,
-     191,    155,    110,     82,
-      98,    106,     93,     53,
-      48,     82,    114,    125,
-     130,    143,    154,    143,
-     138,    131,    115,     92,
-      78,     80,     92,     99,
-     124,    167,    205,    206,
-     179,    174,    215,    255,
-     231,    252,    166,    112,
-      42,     12,     55,     63,
-      37,     11,     31,     78,
-     118,    140,    164,    184,
-     188,    180,    169,    152,
-     136,    120,    120,    121,
-     115,    107,    117,    136,
-     147,    141,    135,    140,
-     162,    163,    144,    127,
-     123,    139,    139,    120,
-      96,     82,     94,    101,
-     100,     94,     96,    106,
-     120,    133,    146,    150,
-     149,    145,    147,    146,
-     139,    130,    133,    151,
-     159,    145,    133,    133,
-     145,    152,    143,    119,
-     103,    112,    121,    120,
-     111,    112,    126,    135,
-     132,    122,    113,     98,
-      89,     87,     89,     86,
-      90,    107,    140,    168,
-     170,    167,    181,    215,
-     234,    201,    159,    144,
-     121,    116,    116,     89,
-      58,     56,     78,     98,
-      86,     90,    124,    154,
-     158,    151,    149,    153,
-     141,    129,    121,    105,
-      81,     65,     70,     89,
-     101,    118,    155,    207,
-     228,    204,    183,    210,
-     255,    252,    255,    166,
-     114,     48,      5,     56,
-      79,     67,     35,     40,
-      78,    118,    142,    163,
-     177,    180,    170,    163,
-     153,    143,    127,    126,
-     126,    129,    126,    126,
-     136,    142,    129,    112,
-     104,    121,    138,    141,
-     127,    109,    110,    119,
-     119,    120,    132,    136,
-     118,    104,     97,    102,
-     123,    137,    139,    139,
-     139,    138,    139,    149,
-     155,    153,    138,    123,
-     128,    138,    134,    121,
-     112,    122,    141,    149,
-     140,    131,    135,    136,
-     129,    123,    127,    126,
-     115,     99,     82,     77,
-      85,    104,    127,    146,
-     143,    128,    128,    161,
-     208,    210,    170,    147,
-     121,    111,    124,    125,
-     116,     96,     95,    108,
-     107,    104,    120,    139,
-     145,    120,    107,    122,
-     141,    138,    127,    125,
-     134,    130,    128,    132,
-     130,    104,     77,     70,
-      91,    111,    128,    150,
-     186,    205,    187,    165,
-     193,    246,    255,    255,
-     181,    131,     75,     25,
-      67,     89,     76,     38,
-      38,     70,    111,    136,
-     161,    178,    181,    170,
-     164,    156,    149,    129,
-     119,    116,    120,    117,
-     119,    131,    143,    140,
-     131,    125,    129,    131,
-     119,    102,     86,     87,
-      99,    106,    110,    115,
-     124,    134,    144,    156,
-     165,    158,    152,    139,
-     137,    147,    144,    129,
-     110,    103,    110,    119,
-     123,    125,    130,    135,
-     140,    141,    143,    148,
-     153,    143,    128,    122,
-     117,    107,     95,     92,
-     100,    109,    118,    129,
-     149,    162,    158,    148,
-     160,    181,    183,    141,
-     113,    102,     79,     84,
-      99,    100,     89,     90,
-     107,    135,    151,    163,
-     167,    158,    139,    134,
-     136,    130,    105,     93,
-     102,    122,    127,    125,
-     132,    149,    149,    140,
-     131,    127,    111,     91,
-      74,     76,     88,    112,
-     141,    178,    193,    181,
-     162,    188,    235,    255,
-     255,    192,    135,     89,
-      28,     55,     80,     77,
-      51,     46,     76,    116,
-     138,    155,    171,    184,
-     180,    164,    145,    134,
-     119,    112,    111,    111,
-     109,    113,    127,    140,
-     139,    129,    126,    135,
-     147,    145,    125,    101,
-      94,     99,     98,     94,
-      95,    103,    119,    129,
-     135,    143,    158,    174,
-     184,    188,    172,    150,
-     139,    114,    102,    103,
-     104,    101,    102,    109,
-     120,    132,    140,    148,
-     155,    152,    133,    112,
-     105,    107,    109,    112,
-     127,    150,    161,    157,
-     147,    161,    184,    181,
-     149,    134,    103,     79,
-      84,     92,     93,     78,
-      79,    102,    119,    125,
-     132,    138,    145,    151,
-     158,    156,    140,    122,
-     123,    134,    140,    125,
-     110,    118,    138,    144,
-     133,    124,    131,    139,
-     137,    123,    110,     94,
-      81,     73,     78,     90,
-     112,    139,    174,    197,
-     193,    173,    184,    226,
-     255,    255,    213,    143,
-      96,     27,     35,     73,
-      82,     59,     44,     70,
-     111,    138,    151,    160,
-     168,    164,    153,    139,
-     130,    124,    119,    120,
-     119,    119,    129,    142,
-     148,    140,    122,    115,
-     125,    135,    133,    119,
-     101,     98,    108,    113,
-     111,    108,    109,    117,
-     123,    121,    121,    134,
-     156,    172,    173,    156,
-     145,    151,    166,    162,
-     136,    114,     97,    107,
-     120,    118,    107,     95,
-      97,    109,    124,    128,
-     126,    136,    157,    172,
-     164,    148,    154,    178,
-     195,    166,    133,    117,
-      89,     86,     99,     94,
-      71,     62,     78,     99,
-     107,    117,    136,    149,
-     150,    147,    144,    145,
-     147,    150,    147,    133,
-     117,    116,    127,    139,
-     127,    110,    109,    125,
-     142,    141,    130,    127,
-     129,    131,    124,    113,
-      96,     82,     76,     79,
-      87,    104,    136,    179,
-     214,    214,    189,    187,
-     221,    255,    255,    234,
-     160,    106,     41,     16,
-      50,     75,     66,     38,
-      43,     83,    122,    144,
-     158,    171,    178,    171,
-     155,    141,    127,    110,
-     102,    106,    108,    111,
-     119,    129,    132,    126,
-     125,    135,    146,    150,
-     142,    125,    113,    114,
-     117,    122,    124,    119,
-     115,    114,    113,    108,
-     107,    116,    130,    144,
-     148,    151,    153,    159,
-     162,    156,    145,    143,
-     143,    120,     96,     85,
-      81,    100,    131,    159,
-     164,    145,    137,    160,
-     200,    214,    180,    149,
-     127,    102,     98,    102,
-      99,     70,     55,     73,
-      90,     95,    101,    116,
-     124,    120,    125,    139,
-     144,    142,    138,    135,
-     138,    145,    154,    161,
-     156,    139,    123,    121,
-     128,    126,    119,    114,
-     117,    126,    123,    115,
-     115,    118,    125,    126,
-     110,     89,     76,     73,
-      81,    100,    125,    152,
-     184,    219,    230,    211,
-     194,    215,    255,    249,
-     255,    199,    133,     78,
-      21,     33,     62,     63,
-      44,     42,     73,    110,
-     133,    155,    173,    177,
-     164,    143,    128,    113,
-      98,     90,     95,    101,
-     107,    118,    131,    143,
-     148,    151,    151,    151,
-     154,    152,    145,    133,
-     119,    109,    104,    106,
-     111,    110,    106,    101,
-     104,    117,    132,    142,
-     147,    151,    153,    140,
-     126,    119,    120,    119,
-     119,    115,    108,    124,
-     157,    195,    206,    184,
-     169,    174,    193,    186,
-     144,    119,     89,     61,
-      79,    100,     95,     78,
-      84,    106,    109,    107,
-     117,    125,    125,    117,
-     115,    111,    107,    113,
-     128,    136,    137,    137,
-     141,    150,    157,    161,
-     162,    158,    145,    129,
-     121,    121,    114,    103,
-      96,     99,    109,    113,
-     116,    125,    132,    136,
-     136,    127,    118,    107,
-      96,     85,     86,    101,
-     122,    159,    198,    223,
-     212,    191,    207,    249,
-     183,    177,    165,    151,
-     137,    117,    105,     93,
-      85,     76,     71,     62,
-      52,     45,     38,     38,
-      38,     38,     35,     27,
-      19,      8,      2,      1,
-       7,     15,     26,     32,
-      36,     40,     43,     48,
-      58,     67,     78,     88,
-      96,    105,    116,    130,
-     145,    160,    173,    182,
-     186,    191,    198,    209,
-     222,    236,    245,    252,
-     252,    247,    243,    238,
-     235,    235,    235,    234,
-     232,    228,    222,    215,
-     207,    199,    188,    178,
-     164,    149,    139,    132,
-     124,    118,    111,     97,
-      83,     68,     58,     47,
-      43,     40,     36,     32,
-      26,     23,     20,     20,
-      26,     32,     39,     45,
-      51,     55,     60,     65,
-      74,     81,     90,     98,
-     104,    113,    125,    139,
-     153,    166,    178,    185,
-     190,    195,    204,    211,
-     219,    226,    226,    225,
-     218,    213,    210,    211,
-     215,    221,    223,    222,
-     215,    207,    197,    190,
-     183,    201,    199,    193,
-     181,    163,    143,    128,
-     115,    110,    107,    107,
-      99,     90,     76,     65,
-      56,     47,     42,     35,
-      25,     18,      9,      3,
-       1,      5,     11,     17,
-      20,     23,     25,     30,
-      35,     44,     49,     54,
-      56,     57,     59,     64,
-      74,     88,    101,    109,
-     112,    113,    113,    116,
-     127,    139,    153,    167,
-     177,    185,    190,    195,
-     202,    211,    218,    226,
-     230,    235,    239,    244,
-     247,    247,    242,    232,
-     218,    202,    186,    181,
-     178,    176,    174,    166,
-     153,    140,    125,    118,
-     114,    115,    114,    111,
-     101,     87,     76,     71,
-      68,     74,     80,     86,
-      90,     93,     98,    102,
-     108,    116,    119,    118,
-     116,    111,    111,    116,
-     126,    136,    144,    145,
-     140,    135,    130,    133,
-     143,    156,    172,    177,
-     178,    172,    168,    170,
-     179,    193,    209,    219,
-     224,    219,    211,    203,
-     199,    201,    115,    116,
-     117,    118,    115,    108,
-      99,     91,     84,     81,
-      81,     81,     79,     73,
-      64,     53,     42,     34,
-      29,     27,     26,     27,
-      26,     24,     22,     20,
-      19,     17,     16,     16,
-      16,     15,     16,     15,
-      17,     21,     27,     33,
-      40,     46,     53,     59,
-      65,     69,     75,     80,
-      87,     95,    104,    113,
-     120,    127,    135,    139,
-     143,    147,    149,    150,
-     151,    150,    152,    153,
-     158,    161,    166,    169,
-     169,    168,    164,    159,
-     157,    157,    158,    160,
-     164,    165,    167,    166,
-     167,    170,    175,    181,
-     188,    197,    203,    210,
-     216,    219,    225,    228,
-     233,    237,    242,    247,
-     251,    253,    255,    253,
-     246,    239,    228,    219,
-     211,    206,    201,    195,
-     189,    180,    171,    161,
-     154,    150,    147,    148,
-     145,    140,    133,    126,
-     121,    120,    122,    127,
-     133,    135,    132,    127,
-     120,    116,    115,    190,
-     185,    179,    173,    166,
-     159,    154,    149,    142,
-     136,    127,    118,    107,
-      97,     87,     78,     69,
-      60,     50,     40,     29,
-      19,     12,      5,      3,
-       1,      1,      3,      5,
-       8,     11,     13,     16,
-      18,     20,     23,     28,
-      34,     42,     50,     59,
-      65,     71,     76,     82,
-      89,     99,    110,    122,
-     133,    141,    147,    151,
-     154,    157,    161,    165,
-     168,    172,    174,    178,
-     181,    185,    187,    190,
-     190,    188,    186,    183,
-     181,    181,    181,    182,
-     183,    183,    180,    177,
-     172,    169,    167,    165,
-     165,    163,    162,    158,
-     155,    151,    147,    142,
-     138,    136,    133,    132,
-     132,    133,    134,    135,
-     135,    132,    131,    129,
-     128,    130,    131,    133,
-     135,    134,    134,    135,
-     137,    141,    147,    152,
-     159,    164,    169,    173,
-     178,    184,    190,    197,
-     201,    204,    204,    202,
-     199,    195,    192,    190,
-     146,    143,    139,    133,
-     123,    113,    102,     94,
-      86,     80,     75,     70,
-      65,     60,     53,     47,
-      41,     35,     30,     26,
-      21,     17,     13,      9,
-       5,      3,      1,      1,
-       1,      3,      5,      6,
-       6,      5,      5,      4,
-       4,      5,      8,     11,
-      14,     17,     19,     20,
-      21,     22,     23,     27,
-      33,     40,     48,     54,
-      60,     65,     69,     74,
-      80,     87,     97,    107,
-     119,    131,    143,    155,
-     165,    174,    181,    186,
-     190,    194,    200,    206,
-     214,    222,    230,    235,
-     237,    237,    236,    235,
-     236,    239,    241,    245,
-     246,    247,    245,    241,
-     236,    231,    229,    227,
-     226,    227,    229,    231,
-     232,    231,    228,    224,
-     217,    211,    205,    200,
-     197,    195,    193,    193,
-     194,    193,    191,    188,
-     184,    180,    176,    172,
-     170,    169,    170,    170,
-     169,    168,    165,    161,
-     156,    152,    149,    147,
-     146,    171,    166,    162,
-     155,    148,    139,    128,
-     117,    103,     92,     83,
-      77,     74,     71,     70,
-      68,     63,     57,     47,
-      37,     27,     18,     10,
-       5,      2,      1,      2,
-       5,      6,      9,     11,
-      12,     11,     12,     12,
-      15,     19,     24,     28,
-      30,     30,     27,     24,
-      22,     21,     25,     31,
-      41,     53,     64,     75,
-      83,     90,     95,    100,
-     107,    113,    120,    130,
-     139,    150,    160,    169,
-     176,    182,    186,    186,
-     187,    187,    187,    190,
-     193,    198,    202,    205,
-     204,    201,    199,    196,
-     195,    196,    198,    199,
-     200,    201,    199,    198,
-     194,    191,    189,    190,
-     190,    191,    193,    195,
-     199,    203,    205,    207,
-     206,    203,    198,    192,
-     186,    181,    178,    176,
-     175,    178,    178,    179,
-     176,    173,    171,    168,
-     167,    167,    170,    174,
-     178,    181,    184,    185,
-     185,    183,    181,    177,
-     174,    171,    189,    188,
-     189,    188,    188,    187,
-     185,    179,    170,    160,
-     150,    142,    136,    131,
-     129,    124,    118,    112,
-     104,     95,     86,     76,
-      65,     52,     40,     29,
-      22,     19,     19,     19,
-      19,     17,     12,      8,
-       6,      6,     10,     14,
-      17,     18,     17,     14,
-      13,     12,     17,     24,
-      32,     39,     46,     51,
-      57,     64,     72,     81,
-      89,     95,     98,     99,
-     101,    105,    112,    120,
-     130,    138,    144,    146,
-     147,    151,    158,    168,
-     179,    190,    199,    204,
-     206,    205,    206,    209,
-     215,    223,    233,    241,
-     247,    251,    252,    252,
-     253,    252,    253,    253,
-     255,    255,    254,    249,
-     242,    232,    220,    206,
-     193,    181,    169,    157,
-     145,    132,    119,    106,
-      96,     89,     85,     85,
-      86,     89,     90,     93,
-      97,    101,    105,    110,
-     115,    119,    122,    128,
-     137,    146,    158,    170,
-     179,    185,    189,    154,
-     160,    167,    173,    179,
-     184,    187,    187,    183,
-     179,    174,    172,    172,
-     174,    178,    180,    178,
-     177,    171,    165,    161,
-     157,    153,    149,    143,
-     134,    125,    115,    106,
-      97,     91,     83,     76,
-      69,     60,     54,     49,
-      45,     42,     39,     33,
-      27,     21,     16,     15,
-      17,     21,     25,     30,
-      33,     35,     36,     39,
-      42,     48,     55,     62,
-      67,     73,     79,     89,
-     100,    115,    129,    141,
-     151,    158,    164,    170,
-     177,    186,    195,    204,
-     212,    219,    222,    226,
-     230,    235,    239,    246,
-     250,    253,    255,    255,
-     253,    250,    245,    237,
-     227,    217,    206,    197,
-     187,    178,    169,    159,
-     146,    133,    121,    107,
-      96,     88,     79,     72,
-      66,     60,     55,     54,
-      53,     54,     58,     60,
-      65,     67,     71,     76,
-      82,     87,     94,    100,
-     105,    112,    118,    125,
-     133,    140,    148,    154,
-     109,    106,    104,    104,
-     102,     99,     93,     87,
-      79,     73,     68,     66,
-      63,     60,     58,     54,
-      50,     50,     52,     56,
-      62,     67,     70,     70,
-      68,     65,     64,     64,
-      66,     68,     69,     67,
-      64,     59,     55,     53,
-      53,     56,     58,     60,
-      59,     56,     52,     48,
-      46,     45,     44,     44,
-      44,     43,     42,     40,
-      40,     40,     42,     45,
-      48,     52,     58,     64,
-      73,     83,     93,    103,
-     111,    118,    123,    129,
-     136,    143,    153,    162,
-     171,    179,    185,    189,
-     194,    199,    207,    214,
-     223,    231,    236,    239,
-     240,    242,    243,    246,
-     249,    252,    255,    255,
-     254,    252,    251,    249,
-     248,    246,    243,    237,
-     230,    222,    215,    209,
-     204,    201,    199,    195,
-     191,    187,    182,    179,
-     178,    179,    178,    177,
-     173,    166,    157,    147,
-     139,    133,    130,    128,
-     127,    124,    119,    114,
-     109,    133,    118,    105,
-      94,     83,     73,     63,
-      53,     42,     32,     24,
-      19,     15,     12,     11,
-       7,      3,      2,      4,
-       8,     17,     27,     37,
-      43,     46,     49,     52,
-      57,     64,     70,     76,
-      80,     81,     80,     79,
-      80,     83,     88,     92,
-      97,     98,     98,     98,
-      98,    100,    102,    103,
-     104,    102,    100,     96,
-      93,     92,     93,     95,
-      96,     96,     97,    100,
-     104,    113,    123,    133,
-     142,    150,    156,    159,
-     163,    167,    170,    173,
-     175,    175,    173,    170,
-     166,    162,    159,    154,
-     150,    147,    144,    142,
-     141,    142,    143,    143,
-     143,    143,    142,    143,
-     145,    148,    152,    157,
-     162,    166,    168,    171,
-     176,    181,    188,    195,
-     202,    210,    218,    224,
-     230,    237,    243,    246,
-     249,    251,    254,    254,
-     255,    254,    249,    242,
-     231,    218,    206,    194,
-     185,    177,    167,    158,
-     146,    133,    187,    182,
-     180,    178,    172,    161,
-     145,    127,    108,     94,
-      84,     79,     72,     64,
-      55,     42,     29,     23,
-      22,     27,     36,     46,
-      54,     55,     54,     51,
-      50,     48,     48,     47,
-      45,     39,     31,     23,
-      19,     18,     20,     26,
-      31,     36,     41,     45,
-      53,     63,     77,     91,
-     105,    114,    121,    126,
-     128,    131,    138,    145,
-     152,    159,    165,    169,
-     173,    178,    189,    200,
-     214,    227,    238,    245,
-     247,    246,    242,    237,
-     232,    226,    216,    205,
-     191,    173,    155,    137,
-     120,    107,     98,     92,
-      88,     85,     81,     79,
-      77,     76,     77,     78,
-      78,     78,     76,     72,
-      70,     70,     72,     75,
-      79,     85,     90,     97,
-     108,    121,    138,    159,
-     180,    198,    212,    220,
-     224,    229,    234,    242,
-     249,    254,    255,    250,
-     240,    229,    217,    210,
-     207,    206,    206,    203,
-     197,    192,    187,    133,
-     128,    125,    120,    111,
-      95,     78,     60,     47,
-      39,     36,     37,     37,
-      34,     27,     17,      7,
-       1,      1,      7,     16,
-      27,     34,     36,     36,
-      33,     31,     30,     34,
-      38,     43,     45,     45,
-      42,     38,     35,     33,
-      34,     36,     37,     37,
-      36,     34,     33,     35,
-      37,     41,     43,     45,
-      44,     42,     42,     44,
-      50,     59,     68,     76,
-      80,     83,     83,     86,
-      94,    106,    123,    141,
-     157,    169,    177,    182,
-     186,    192,    199,    206,
-     213,    217,    218,    216,
-     213,    211,    209,    209,
-     208,    208,    207,    206,
-     206,    207,    209,    212,
-     212,    210,    206,    200,
-     196,    194,    196,    200,
-     203,    205,    204,    202,
-     200,    202,    206,    214,
-     223,    231,    236,    237,
-     237,    234,    235,    237,
-     241,    242,    242,    237,
-     229,    220,    211,    204,
-     198,    192,    184,    173,
-     161,    148,    139,    133,
-     135,    131,    128,    125,
-     119,    110,     98,     85,
-      73,     63,     56,     52,
-      48,     43,     39,     33,
-      28,     26,     26,     29,
-      34,     38,     40,     39,
-      36,     33,     30,     27,
-      25,     24,     22,     17,
-      12,      8,      4,      1,
-       1,      3,      6,      9,
-      12,     15,     17,     19,
-      23,     26,     30,     33,
-      36,     37,     39,     42,
-      46,     52,     59,     67,
-      75,     83,     90,     96,
-     106,    116,    127,    139,
-     150,    161,    168,    175,
-     180,    186,    192,    198,
-     204,    209,    210,    209,
-     207,    205,    204,    204,
-     208,    211,    214,    216,
-     218,    219,    221,    223,
-     226,    230,    230,    230,
-     226,    223,    217,    213,
-     211,    209,    209,    210,
-     211,    212,    214,    217,
-     221,    226,    230,    234,
-     235,    236,    235,    235,
-     233,    232,    228,    223,
-     214,    204,    195,    186,
-     179,    174,    171,    167,
-     162,    155,    148,    141,
-     135,    154,    150,    146,
-     140,    130,    114,     97,
-      81,     70,     63,     59,
-      56,     52,     46,     37,
-      27,     19,     14,     13,
-      15,     17,     18,     16,
-      11,      6,      2,      1,
-       2,      6,     11,     16,
-      18,     19,     21,     25,
-      32,     42,     55,     68,
-      79,     87,     90,     91,
-      93,     96,    101,    111,
-     121,    129,    134,    135,
-     134,    132,    132,    135,
-     139,    145,    149,    150,
-     147,    145,    142,    142,
-     145,    150,    155,    158,
-     158,    155,    152,    149,
-     149,    150,    153,    155,
-     154,    152,    147,    143,
-     141,    142,    144,    147,
-     148,    148,    147,    146,
-     146,    147,    151,    154,
-     156,    156,    156,    155,
-     153,    154,    156,    161,
-     168,    175,    183,    192,
-     200,    207,    212,    217,
-     220,    223,    228,    233,
-     240,    245,    248,    246,
-     242,    234,    226,    220,
-     217,    216,    214,    211,
-     205,    194,    181,    169,
-     159,    154,    107,    103,
-     100,     98,     94,     89,
-      82,     76,     71,     68,
-      66,     66,     65,     63,
-      59,     54,     48,     44,
-      42,     41,     41,     40,
-      37,     31,     26,     19,
-      15,     13,     12,     13,
-      13,     13,     11,     10,
-      10,     12,     17,     22,
-      27,     31,     33,     36,
-      38,     42,     47,     52,
-      58,     62,     64,     65,
-      65,     67,     69,     74,
-      79,     83,     86,     88,
-      90,     92,     98,    105,
-     113,    119,    125,    129,
-     129,    131,    133,    139,
-     145,    154,    162,    168,
-     172,    175,    179,    182,
-     189,    195,    202,    208,
-     212,    215,    216,    220,
-     224,    230,    236,    241,
-     244,    244,    243,    242,
-     241,    242,    245,    248,
-     250,    252,    253,    254,
-     254,    254,    255,    254,
-     252,    249,    244,    239,
-     233,    228,    224,    219,
-     213,    206,    196,    185,
-     175,    166,    158,    152,
-     147,    142,    135,    128,
-     120,    112,    107,     80,
-      78,     75,     71,     64,
-      56,     48,     40,     35,
-      33,     34,     35,     37,
-      38,     39,     37,     36,
-      38,     41,     47,     54,
-      61,     68,     71,     74,
-      76,     78,     81,     88,
-      94,    103,    109,    113,
-     114,    114,    112,    114,
-     117,    123,    128,    134,
-     137,    138,    136,    134,
-     131,    128,    124,    119,
-     112,    104,     97,     89,
-      82,     77,     70,     65,
-      60,     56,     54,     56,
-      61,     67,     73,     77,
-      79,     78,     78,     79,
-      84,     92,    101,    111,
-     119,    124,    127,    130,
-     134,    140,    146,    155,
-     162,    169,    175,    180,
-     187,    195,    204,    215,
-     222,    229,    231,    232,
-     232,    233,    235,    237,
-     239,    241,    244,    245,
-     247,    250,    252,    255,
-     255,    255,    253,    250,
-     246,    241,    235,    227,
-     216,    204,    190,    177,
-     163,    153,    144,    136,
-     129,    120,    110,    101,
-      92,     86,     81,     80,
-     200,    194,    180,    193,
-     171,    165,    153,    139,
-     129,    118,     96,     87,
-      76,     59,     64,     36,
-      34,     28,      1,     17,
-      11,      1,     17,     11,
-      22,     39,     37,     52,
-      69,     72,     93,     92,
-     110,    127,    116,    134,
-     156,    168,    206,    205,
-     236,    242,    233,    239,
-     248,    244,    246,    240,
-     231,    218,    184,    175,
-     165,    143,    139,    105,
-     112,     97,     65,     64,
-      57,     57,     66,     38,
-      48,     52,     39,     43,
-      54,     69,     80,    106,
-     119,    144,    133,    148,
-     159,    141,    158,    154,
-     163,    155,    136,    149,
-     125,    116,    134,    122,
-     138,    135,    128,    126,
-     114,    105,    111,    104,
-     101,    103,     83,     92,
-      88,     86,    116,    107,
-     140,    146,    149,    173,
-     182,    179,    198,    202,
-     202,    198,    178,    178,
-     165,    148,    168,    159,
-     171,    171,    165,    181,
-     172,    175,    199,    175,
-     200,    239,    237,    227,
-     238,    215,    198,    194,
-     175,    162,    143,    136,
-     118,    103,     90,     84,
-      70,     54,     36,     27,
-      11,      7,      1,     10,
-      23,     26,     46,     50,
-      58,     83,     66,     79,
-      78,     83,     86,     90,
-     103,    120,    122,    151,
-     154,    167,    185,    192,
-     197,    218,    216,    222,
-     211,    212,    197,    189,
-     189,    188,    183,    178,
-     167,    173,    154,    150,
-     149,    142,    131,    119,
-     103,     87,     87,     77,
-      64,     72,     79,     88,
-      91,     90,    105,    103,
-     106,    113,    116,    128,
-     124,    130,    118,    109,
-     115,    103,    101,    121,
-     109,    128,    129,    133,
-     128,    123,    116,    109,
-      92,     91,     88,     74,
-      81,     76,     77,     91,
-      85,     98,    109,    116,
-     135,    148,    144,    163,
-     171,    160,    159,    154,
-     149,    144,    138,    155,
-     155,    172,    181,    188,
-     201,    209,    208,    228,
-     219,    239,    250,    252,
-     252,    255,    240,    228,
-     212,    201,    190,    168,
-     156,    148,    136,    124,
-     108,    100,     81,     56,
-      41,     24,     14,      4,
-      12,     26,     27,     38,
-      50,     54,     67,     67,
-      67,     74,     77,     80,
-      87,     92,    110,    115,
-     122,    140,    153,    171,
-     182,    190,    213,    209,
-     205,    206,    197,    194,
-     188,    189,    197,    193,
-     191,    190,    182,    180,
-     170,    161,    161,    143,
-     132,    115,     87,     90,
-      78,     71,     79,     80,
-      87,     95,     89,     90,
-      89,     92,     96,    104,
-     119,    126,    122,    115,
-     111,    105,    101,    109,
-     121,    120,    126,    131,
-     127,    130,    117,    112,
-     108,     86,     83,     76,
-      66,     79,     73,     75,
-      83,     85,     90,     90,
-      96,    118,    125,    134,
-     147,    157,    158,    143,
-     140,    138,    120,    126,
-     135,    143,    160,    160,
-     178,    188,    191,    210,
-     220,    229,    250,    238,
-     248,    250,    255,    242,
-     233,    216,    204,    191,
-     171,    168,    161,    149,
-     146,    135,    123,    105,
-      85,     67,     42,     30,
-      25,     23,     30,     37,
-      44,     45,     59,     69,
-      67,     73,     84,     84,
-      83,     91,     98,    101,
-     108,    120,    126,    136,
-     157,    171,    176,    191,
-     200,    191,    186,    192,
-     190,    175,    184,    194,
-     192,    192,    205,    207,
-     195,    190,    187,    175,
-     157,    146,    129,    104,
-      90,     82,     69,     74,
-      80,     79,     82,     84,
-      88,     76,     82,     91,
-      89,    104,    114,    112,
-     106,    101,    103,     97,
-     100,    119,    120,    122,
-     135,    131,    132,    122,
-     124,    117,     90,     86,
-      84,     69,     75,     77,
-      82,     80,     84,     91,
-      88,     91,    109,    119,
-     128,    143,    156,    157,
-     148,    138,    133,    114,
-     116,    123,    125,    143,
-     148,    156,    167,    173,
-     191,    204,    215,    238,
-     232,    252,    255,    255,
-     242,    229,    210,    197,
-     177,    173,    166,    161,
-     155,    153,    141,    129,
-     116,     98,     75,     60,
-      46,     38,     29,     32,
-      35,     37,     40,     52,
-      55,     61,     70,     83,
-      85,     95,    104,    109,
-     110,    118,    122,    127,
-     138,    157,    167,    175,
-     189,    200,    188,    184,
-     181,    176,    166,    175,
-     185,    198,    207,    225,
-     226,    213,    204,    194,
-     173,    158,    145,    128,
-     103,     89,     74,     66,
-      68,     77,     78,     89,
-      90,     88,     80,     82,
-      79,     82,     90,    104,
-     101,     98,     96,     97,
-      92,    102,    114,    128,
-     137,    147,    148,    146,
-     134,    130,    113,     97,
-      87,     88,     79,     84,
-      87,     90,     89,     93,
-      92,     93,     99,    113,
-     120,    133,    144,    160,
-     154,    147,    135,    126,
-     107,    108,    107,    115,
-     123,    129,    131,    141,
-     148,    167,    189,    214,
-     232,    221,    251,    255,
-     242,    224,    198,    173,
-     158,    146,    153,    157,
-     155,    152,    148,    142,
-     128,    121,    111,     98,
-      84,     69,     56,     47,
-      43,     49,     57,     67,
-      72,     75,     76,     78,
-      83,     94,    105,    113,
-     116,    121,    124,    118,
-     117,    129,    143,    161,
-     177,    203,    215,    201,
-     186,    171,    152,    135,
-     143,    166,    191,    217,
-     230,    236,    217,    196,
-     182,    168,    161,    147,
-     123,    101,     75,     63,
-      66,     74,     82,     90,
-     105,    101,     90,     82,
-      80,     72,     75,     84,
-      99,     99,     92,     84,
-      81,     81,    100,    119,
-     141,    156,    165,    158,
-     154,    140,    128,    116,
-     102,     94,     96,     91,
-      96,    100,    103,    105,
-     111,    104,    103,    107,
-     115,    123,    139,    150,
-     162,    160,    152,    135,
-     123,    104,    101,    102,
-     108,    119,    125,    118,
-     120,    122,    137,    164,
-     194,    221,    209,    247,
-     255,    228,    197,    158,
-     119,     99,    105,    126,
-     137,    141,    135,    131,
-     124,    109,    113,    115,
-     109,     96,     85,     76,
-      68,     73,     77,     91,
-      95,     88,     81,     78,
-      72,     79,     98,    109,
-     118,    131,    133,    136,
-     115,    110,    123,    137,
-     155,    178,    218,    235,
-     213,    187,    159,    134,
-     103,    112,    149,    190,
-     221,    225,    227,    202,
-     172,    159,    157,    167,
-     154,    130,    110,     81,
-      69,     76,     93,    121,
-     139,    140,    122,    100,
-      71,     63,     65,     83,
-      94,    101,     95,     73,
-      53,     36,     46,     86,
-     112,    140,    158,    163,
-     147,    133,    128,    123,
-     117,    103,    103,    110,
-     107,    115,    126,    142,
-     134,    131,    132,    122,
-     119,    122,    139,    158,
-     167,    180,    187,    178,
-     144,    124,    109,    103,
-     105,    113,    141,    146,
-     124,    110,     95,    103,
-     119,    160,    209,    222,
-     255,    249,    216,    184,
-     141,    100,     89,    107,
-     128,    138,    137,    137,
-     132,    118,    104,    117,
-     117,    109,     95,     90,
-      76,     68,     75,     84,
-     102,    101,     92,     82,
-      74,     68,     82,    100,
-     110,    128,    142,    142,
-     134,    111,    109,    125,
-     140,    163,    197,    237,
-     245,    215,    185,    153,
-     125,     99,    121,    163,
-     209,    231,    236,    233,
-     199,    172,    161,    169,
-     170,    147,    120,     96,
-      70,     60,     70,     94,
-     123,    133,    125,    104,
-      82,     49,     46,     60,
-      76,     83,     91,     82,
-      58,     34,     25,     51,
-      94,    119,    149,    166,
-     164,    146,    137,    133,
-     127,    116,    109,    109,
-     117,    120,    131,    148,
-     159,    147,    144,    140,
-     125,    125,    129,    152,
-     167,    175,    188,    191,
-     169,    131,    115,    103,
-      99,    101,    119,    147,
-     136,    109,     87,     78,
-      89,    114,    166,    222,
-     242,    255,    236,    199,
-     155,    110,     84,     87,
-     103,    121,    127,    131,
-     129,    120,    109,    107,
-     111,    106,     96,     88,
-      77,     71,     72,     83,
-      94,    104,     96,     86,
-      74,     71,     75,     94,
-     109,    131,    143,    151,
-     139,    129,    116,    122,
-     136,    160,    194,    232,
-     254,    245,    211,    175,
-     138,    113,    110,    144,
-     190,    229,    248,    246,
-     226,    195,    175,    171,
-     170,    158,    131,    101,
-      73,     58,     59,     83,
-     106,    128,    124,    111,
-      83,     55,     33,     43,
-      56,     70,     76,     76,
-      56,     30,     11,     27,
-      58,    102,    132,    158,
-     163,    155,    141,    134,
-     125,    118,    112,    107,
-     109,    120,    130,    151,
-     161,    166,    161,    152,
-     139,    129,    133,    150,
-     168,    185,    197,    204,
-     187,    156,    124,    109,
-     100,    102,    120,    140,
-     140,    118,     86,     70,
-      69,     95,    142,    201,
-     242,    245,    243,    214,
-     161,    119,     88,     76,
-      80,     93,    109,    116,
-     119,    110,    103,    105,
-      99,     97,     93,     84,
-      72,     69,     66,     72,
-      93,     96,     98,     86,
-      77,     72,     77,     87,
-     106,    133,    149,    154,
-     150,    134,    131,    123,
-     139,    163,    204,    239,
-     254,    255,    236,    189,
-     153,    123,    128,    142,
-     183,    222,    251,    252,
-     236,    215,    196,    185,
-     171,    153,    136,     99,
-      75,     59,     62,     79,
-     101,    114,    116,    105,
-      81,     52,     42,     33,
-      41,     48,     57,     50,
-      40,     21,      6,     15,
-      40,     74,    118,    139,
-     156,    156,    150,    135,
-     125,    113,    107,    105,
-     107,    117,    136,    154,
-     169,    172,    178,    162,
-     151,    142,    142,    159,
-     175,    201,    218,    219,
-     201,    172,    145,    117,
-     109,    111,    129,    142,
-     131,    118,     90,     67,
-      64,     87,    136,    188,
-     230,    245,    238,    231,
-     193,    141,     96,     76,
-      66,     74,     86,    107,
-     115,    126,    114,    109,
-     103,     91,     80,     77,
-      67,     63,     66,     74,
-      83,    101,     90,     83,
-      70,     68,     73,     92,
-     107,    133,    157,    161,
-     151,    136,    120,    125,
-     128,    157,    187,    230,
-     253,    250,    235,    209,
-     165,    136,    118,    134,
-     153,    195,    228,    255,
-     251,    237,    220,    206,
-     194,    164,    127,    106,
-      72,     61,     54,     74,
-      98,    119,    121,    109,
-      88,     59,     38,     47,
-      45,     54,     56,     59,
-      38,     23,     10,      5,
-      32,     62,     93,    134,
-     147,    157,    153,    149,
-     130,    120,    103,    100,
-     101,    113,    129,    152,
-     173,    184,    178,    179,
-     152,    145,    146,    153,
-     174,    197,    219,    230,
-     211,    182,    150,    133,
-     115,    121,    126,    146,
-     146,    118,     92,     70,
-      56,     74,    107,    169,
-     210,    241,    238,    243,
-     242,    199,    144,     94,
-      52,     50,     57,     87,
-     122,    147,    165,    156,
-     131,     97,     73,     54,
-      52,     61,     66,     90,
-     100,    112,    116,     83,
-      71,     53,     58,     82,
-     102,    134,    161,    172,
-     162,    145,    115,     99,
-     103,    110,    147,    171,
-     215,    242,    236,    229,
-     192,    157,    133,    107,
-     101,    115,    158,    207,
-     249,    255,    252,    238,
-     208,    188,    139,    103,
-      83,     66,     80,     80,
-     101,    119,    128,    123,
-      97,     77,     58,     65,
-      69,     77,     88,     84,
-      91,     75,     52,     38,
-      21,     38,     66,    107,
-     146,    169,    177,    171,
-     153,    120,     96,     70,
-      70,     89,    106,    152,
-     171,    193,    191,    160,
-     135,    108,    110,    132,
-     157,    184,    207,    219,
-     202,    183,    146,    131,
-     130,    128,    145,    142,
-     150,    152,    125,    102,
-      64,     51,     66,    105,
-     153,    200,    236,    243,
-     252,    250,    219,    157,
-      97,     59,     49,     57,
-      93,    126,    154,    173,
-     164,    139,     99,     65,
-      50,     46,     57,     65,
-      84,    101,    106,    112,
-      89,     64,     54,     51,
-      67,     94,    125,    155,
-     172,    166,    146,    114,
-      95,     90,    100,    129,
-     162,    210,    244,    251,
-     238,    206,    168,    136,
-     115,     98,    104,    143,
-     191,    237,    255,    255,
-     243,    219,    198,    150,
-     109,     82,     67,     78,
-      82,    103,    124,    131,
-     127,    101,     73,     50,
-      54,     70,     83,     98,
-      96,     95,     84,     57,
-      38,     24,     32,     63,
-     108,    149,    174,    186,
-     176,    152,    121,     93,
-      69,     69,     86,    109,
-     145,    169,    191,    187,
-     161,    133,    105,    103,
-     120,    150,    179,    202,
-     218,    207,    177,    141,
-     124,    121,    133,    148,
-     149,    154,    153,    133,
-     109,     68,     50,     58,
-      95,    146,    195,    238,
-     252,    239,    224,    241,
-     204,    175,    154,    176,
-     161,    168,    165,    146,
-     142,    143,    143,    142,
-     126,    128,    111,    120,
-     108,     87,     92,    121,
-     157,    139,    142,    137,
-     131,    152,    172,    179,
-     175,    162,    134,    144,
-     157,    149,    159,    170,
-     207,    212,    214,    206,
-     188,    181,    198,    175,
-     183,    163,    151,    152,
-     169,    203,    224,    183,
-     167,    162,    158,    190,
-     170,    119,    123,    110,
-      77,     78,     84,     98,
-     122,    131,    128,     93,
-      60,     72,     63,     51,
-      44,      1,     15,     37,
-      29,     40,     20,     37,
-      53,     68,     93,     82,
-      34,     45,     69,     67,
-      74,     57,     30,     45,
-      41,     55,     61,     91,
-     106,    104,    117,    101,
-      65,     94,    113,    131,
-     146,    176,    147,    133,
-     127,    134,    125,    140,
-     136,    113,    108,    133,
-     106,    137,    142,    138,
-     144,    178,    193,    222,
-     243,    239,    226,    200,
-     199,    208,    212,    171,
-     153,    134,    145,    138,
-     119,    114,     97,    110,
-     133,    111,     99,     88,
-      62,     74,     83,     86,
-      88,     93,    107,    137,
-     122,     93,     75,     98,
-     141,    139,    123,     83,
-      98,     88,     89,     88,
-      93,    132,    149,    150,
-     150,    138,    116,    135,
-     122,    134,    119,    111,
-     113,    118,    148,    155,
-     107,     96,    120,    141,
-     172,    142,    111,    120,
-     123,    116,    106,    114,
-     128,    157,    175,    175,
-     151,    135,    135,    139,
-     118,    102,     90,     86,
-      99,    110,    106,     75,
-      81,    122,    174,    189,
-     163,    124,    117,    162,
-     156,    132,    112,    117,
-     126,    128,     85,     63,
-      94,    118,    134,    113,
-      78,     56,     77,    108,
-     130,    115,    117,    120,
-     135,    151,    156,    145,
-     124,    142,    157,    159,
-     121,    113,    147,    185,
-     171,    152,    151,    192,
-     254,    255,    226,    224,
-     232,    238,    227,    203,
-     174,    138,    158,    177,
-     149,    116,    129,    104,
-      83,     74,     46,     82,
-      85,     67,     60,     53,
-      56,     66,     72,     69,
-      79,     75,    103,     91,
-      88,     99,     99,    107,
-      69,    103,     79,     47,
-      83,    102,    112,    106,
-      75,     69,    113,     97,
-      88,     70,     89,     88,
-      78,     95,     52,     79,
-     111,     68,     79,     90,
-      91,    121,     92,     66,
-     105,    114,    113,     76,
-     104,    147,    149,    163,
-     151,    144,    192,    176,
-     169,    195,    162,    168,
-     194,    179,    179,    188,
-     150,    143,    170,    207,
-     217,    193,    200,    200,
-     244,    212,    174,    171,
-     180,    151,    151,    109,
-     101,    144,    105,     92,
-      85,     56,     60,     62,
-      55,     80,    111,    113,
-      97,    109,    123,    126,
-     133,    117,    129,    159,
-     191,    167,    168,    185,
-     188,    180,    183,    181,
-     209,    255,    246,    224,
-     237,    236,    240,    210,
-     205,    172,    156,    131,
-     147,    161,    155,    146,
-     113,     73,     63,     48,
-      68,     78,     72,     62,
-      50,     42,     61,     54,
-      36,     49,     77,    110,
-     114,     96,     95,    111,
-     137,    100,     78,     50,
-      56,    116,    129,     92,
-      64,     41,     54,     61,
-      48,     72,     33,     37,
-      45,     50,     55,     19,
-      32,     52,     37,     76,
-      75,     84,     89,     63,
-      61,     73,     74,     94,
-      71,     98,    111,    129,
-     137,    171,    170,    199,
-     214,    204,    234,    247,
-     239,    248,    254,    237,
-     254,    217,    196,    201,
-     212,    241,    248,    244,
-     242,    222,    223,    226,
-     198,    217,    164,    153,
-     140,    145,    171,    126,
-      97,     86,     50,     35,
-      50,     30,     47,     65,
-      91,     69,     73,     86,
-     115,    122,    114,    115,
-     134,    177,    182,    199,
-     201,    175,    169,    195,
-     195,    198,    236,    255,
-     237,    190,    198,    186,
-     157,    164,    142,    122,
-     113,    134,    148,    142,
-     150,    124,     83,     73,
-      53,     91,    121,     87,
-      72,     71,     67,     89,
-      75,     71,     80,     97,
-     127,    147,    117,    118,
-     120,    139,    105,     82,
-      79,     82,    128,    119,
-      77,     62,     41,     57,
-      80,     49,     35,     44,
-      57,     75,     51,     38,
-      22,     42,     67,     70,
-      73,     73,     77,     96,
-      69,     38,     56,     74,
-      94,     78,     84,    107,
-     123,    131,    149,    155,
-     207,    220,    213,    225,
-     211,    228,    255,    244,
-     224,    217,    214,    205,
-     217,    229,    243,    230,
-     229,    214,    219,    207,
-     189,    200,    202,    162,
-     167,    152,    160,    186,
-     150,    119,     98,     71,
-      84,     87,     67,     57,
-      70,     84,     87,    107,
-     128,    124,    137,    116,
-     110,    152,    182,    178,
-     171,    154,    152,    152,
-     150,    154,    166,    197,
-     200,    190,    166,    171,
-     179,    162,    155,    144,
-     139,    134,    137,    140,
-     124,    133,    137,    126,
-     115,     93,    100,     95,
-      88,     76,     84,     80,
-      96,     80,     80,     84,
-     106,    119,    138,    125,
-     135,    139,    150,    120,
-     111,    109,    109,    128,
-     105,     80,     77,     66,
-      77,     60,     45,     40,
-      43,     35,     48,     40,
-      39,     25,     50,     49,
-      55,     50,     48,     67,
-      84,     64,     45,     46,
-      55,     75,     60,     58,
-      73,    100,    108,    113,
-     133,    174,    188,    199,
-     209,    225,    226,    244,
-     255,    247,    247,    238,
-     239,    252,    252,    253,
-     246,    254,    252,    239,
-     225,    216,    208,    217,
-     213,    195,    173,    181,
-     186,    181,    152,    135,
-     111,    107,     90,     80,
-      63,     66,     75,     76,
-      72,     84,     95,    110,
-     114,    112,    121,    128,
-     132,    133,    144,    144,
-     139,    138,    144,    144,
-     155,    163,    166,    156,
-     151,    160,    157,    158,
-     141,    128,    125,    147,
-     152,    146,    157,    161,
-     146,    127,    117,    119,
-      99,    106,    107,    107,
-      99,    119,    111,    107,
-     108,    126,    138,    169,
-     165,    172,    165,    169,
-     152,    151,    144,    120,
-     126,    133,    133,    114,
-     102,    100,     77,     74,
-      64,     65,     44,     64,
-      64,     64,     57,     52,
-      43,     60,     67,     54,
-      55,     61,     56,     35,
-      48,     37,     39,     37,
-      50,     62,     88,    107,
-     102,    137,    167,    173,
-     184,    198,    205,    223,
-     239,    241,    229,    231,
-     234,    234,    255,    247,
-     243,    230,    242,    228,
-     215,    203,    207,    206,
-     202,    206,    180,    158,
-     175,    181,    157,    138,
-     124,     88,     82,     78,
-      63,     49,     46,     40,
-      58,     72,     68,     80,
-      98,     88,     81,     99,
-     115,    116,    113,    135,
-     136,    129,    115,    120,
-     127,    136,    147,    156,
-     151,    151,    147,    155,
-     145,    139,    136,    133,
-     148,    167,    151,    164,
-     164,    157,    157,    155,
-     156,    145,    151,    168,
-     157,    143,    147,    124,
-     125,    132,    153,    162,
-     157,    155,    149,    137,
-     144,    136,    129,    123,
-     117,    119,    114,    106,
-      91,     68,     75,     47,
-      46,     56,     44,     19,
-      37,     22,     18,     21,
-      29,     27,     35,     50,
-      41,     59,     67,     56,
-      64,     78,     67,     88,
-      97,    105,    102,    122,
-     151,    166,    199,    208,
-     201,    204,    220,    226,
-     242,    242,    253,    255,
-     247,    248,    251,    247,
-     245,    237,    219,    225,
-     211,    187,    162,    163,
-     157,    155,    153,    134,
-     114,    140,    146,    125,
-     109,     96,     66,     63,
-      69,     63,     54,     59,
-      51,     50,     60,     71,
-      78,     83,     86,     86,
-      94,    108,    111,    110,
-     125,    127,    123,    125,
-     129,    136,    156,    159,
-     151,    180,    188,    196,
-     204,    202,    214,    202,
-     208,    211,    213,    215,
-     195,    174,    181,    186,
-     182,    167,    148,    134,
-     138,    135,    118,    130,
-     102,    106,    126,    130,
-     110,    112,     97,     88,
-      83,     78,     78,     67,
-      38,     31,     42,     27,
-      22,     25,     21,     20,
-      10,     17,     24,     30,
-       1,     28,     21,     26,
-      56,     95,     85,     85,
-      82,     98,    119,    132,
-     122,    118,    118,    122,
-     155,    144,    148,    147,
-     178,    207,    232,    245,
-     230,    232,    233,    252,
-     255,    236,    208,    226,
-     241,    242,    226,    212,
-     205,    216,    211,    193,
-     195,    176,    149,    134,
-     144,    142,    150,    136,
-     110,    103,    116,    116,
-      99,     79,     56,     51,
-      54,     43,     42,     38,
-      46,     53,     52,     53,
-      68,     81,     84,    111,
-     113,     87,     86,     94,
-     116,    127,    133,    125,
-     138,    149,    168,    183,
-     193,    180,    218,    223,
-     211,    198,    193,    208,
-     199,    195,    191,    177,
-     155,    151,    127,    142,
-     136,    117,    122,    109,
-      96,     87,     73,     49,
-      50,     34,     40,     37,
-      57,     24,     34,     20,
-      16,      1,     41,     49,
-      41,     38,     41,     39,
-      71,     56,     70,     75,
-      85,     89,    126,    124,
-     125,    101,    127,    111,
-     133,    147,    168,    160,
-     149,    147,    162,    156,
-     161,    166,    161,    156,
-     158,    149,    138,    156,
-     151,    144,    159,    140,
-     146,    160,    167,    154,
-     163,    173,    151,    148,
-     167,    165,    172,    177,
-     164,    164,    164,    168,
-     159,    181,    165,    146,
-     126,    123,    126,    147,
-     140,    128,     98,    114,
-     129,    134,    117,    103,
-      87,     93,     86,    107,
-      98,     98,     81,     84,
-      84,    109,     92,     99,
-     120,    134,    118,    148,
-     136,    147,    160,    184,
-     172,    181,    191,    217,
-     228,    233,    218,    204,
-     211,    206,    200,    178,
-     175,    169,    153,    147,
-     135,    120,    117,    110,
-     105,     96,     80,     86,
-      59,     51,     35,     17,
-      15,     32,      4,      2,
-       1,     10,      4,     29,
-      32,     26,     16,     54,
-      81,     88,     76,     89,
-     100,    115,    134,    163,
-     165,    151,    148,    183,
-     200,    193,    165,    182,
-     181,    183,    199,    207,
-     184,    162,    177,    194,
-     185,    186,    168,    145,
-     152,    149,    134,    117,
-     108,     99,    103,    111,
-     107,     99,    106,    110,
-     111,    120,    124,    116,
-     118,    124,    123,    118,
-     141,    143,    131,    135,
-     139,    115,    141,    148,
-     120,    100,    115,    124,
-     129,    138,    124,     99,
-     112,    131,    133,    129,
-     110,     98,    123,    116,
-     116,     97,    104,     91,
-      85,    108,    133,    118,
-     134,    148,    155,    162,
-     188,    200,    189,    192,
-     212,    203,    223,    231,
-     224,    228,    216,    204,
-     181,    178,    173,    167,
-     153,    137,    128,    116,
-     109,     97,     86,     73,
-      68,     62,     54,     38,
-      38,     24,     19,     14,
-      11,      1,      8,      4,
-       7,      9,     20,     30,
-      43,     47,     59,     65,
-      89,     98,     99,    104,
-     116,    125,    149,    163,
-     165,    166,    174,    178,
-     189,    188,    185,    178,
-     177,    174,    175,    177,
-     172,    167,    158,    153,
-     156,    151,    141,    128,
-     117,    114,    111,    103,
-      90,     89,     90,     91,
-      93,     91,     91,    101,
-     111,    112,    112,    117,
-     115,    120,    122,    130,
-     132,    140,    144,    147,
-     146,    149,    144,    146,
-     150,    147,    137,    142,
-     148,    151,    154,    148,
-     136,    141,    150,    152,
-     146,    140,    136,    142,
-     141,    141,    131,    131,
-     134,    143,    154,    165,
-     170,    170,    181,    190,
-     196,    202,    206,    202,
-     210,    212,    208,    202,
-     206,    203,    198,    187,
-     181,    165,    156,    144,
-     142,    132,    118,    102,
-      90,     78,     71,     63,
-      57,     45,     36,     33,
-      18,     20,     13,     10,
-       9,      8,      1,      6,
-      10,     15,     22,     39,
-      49,     59,     74,     89,
-      94,    110,    117,    126,
-     130,    145,    159,    170,
-     181,    184,    187,    196,
-     194,    196,    195,    197,
-     190,    183,    181,    175,
-     169,    167,    161,    151,
-     147,    144,    128,    126,
-     118,    103,     94,     88,
-      80,     79,     88,     87,
-      79,     77,     77,     87,
-     101,    109,    104,    111,
-     109,    111,    116,    123,
-     129,    129,    139,    140,
-     136,    136,    144,    142,
-     140,    143,    144,    136,
-     143,    154,    152,    150,
-     145,    137,    143,    152,
-     153,    153,    146,    139,
-     144,    148,    151,    141,
-     153,    157,    162,    170,
-     183,    187,    192,    198,
-     207,    207,    213,    220,
-     220,    215,    216,    209,
-     199,    200,    194,    185,
-     173,    165,    166,    158,
-     146,    137,    126,    114,
-     102,     90,     79,     67,
-      56,     49,     40,     30,
-      24,     11,      9,      7,
-       4,      3,      3,      1,
-       3,      7,      9,     13,
-      19,     26,     39,     53,
-      63,     73,     84,     97,
-     106,    117,    133,    146,
-     156,    167,    171,    182,
-     186,    184,    190,    192,
-     195,    194,    190,    184,
-     181,    182,    177,    171,
-     162,    152,    144,    140,
-     129,    120,    109,     97,
-      90,     86,     81,     78,
-      78,     75,     73,     76,
-      83,     87,     95,    100,
-     103,    105,    109,    115,
-     123,    130,    134,    140,
-     142,    143,    145,    154,
-     156,    154,    156,    158,
-     154,    154,    159,    156,
-     157,    154,    150,    152,
-     159,    161,    163,    158,
-     153,    157,    163,    165,
-     163,    169,    168,    169,
-     178,    186,    188,    195,
-     203,    208,    214,    218,
-     219,    219,    222,    219,
-     215,    210,    202,    194,
-     191,    178,    166,    178,
-     171,    162,    153,    141,
-     128,    118,    106,     98,
-      87,     76,     70,     61,
-      51,     43,     33,     28,
-      23,     17,     11,      6,
-       1,      1,      3,      7,
-      10,     14,     21,     33,
-      44,     55,     65,     73,
-      83,     94,    103,    115,
-     126,    138,    148,    153,
-     163,    171,    174,    182,
-     185,    187,    188,    185,
-     184,    183,    183,    181,
-     177,    175,    169,    162,
-     157,    151,    141,    133,
-     121,    110,    105,    100,
-      95,     90,     86,     83,
-      84,     88,     89,     92,
-      97,    100,    101,    104,
-     105,    110,    119,    123,
-     127,    130,    134,    138,
-     144,    150,    149,    147,
-     149,    149,    152,    158,
-     157,    156,    155,    155,
-     157,    161,    163,    163,
-     160,    159,    159,    161,
-     161,    158,    159,    160,
-     163,    170,    176,    180,
-     184,    187,    190,    194,
-     200,    203,    203,    205,
-     204,    201,    200,    200,
-     195,    193,    185,    178,
-     193,    190,    184,    170,
-     155,    145,    141,    127,
-     119,    105,     92,     83,
-      80,     69,     58,     43,
-      36,     32,     31,     23,
-      10,      2,      1,      1,
-       7,      5,      4,      7,
-      20,     27,     36,     44,
-      46,     53,     67,     77,
-      89,     98,    108,    121,
-     127,    142,    152,    154,
-     161,    169,    175,    180,
-     180,    179,    180,    188,
-     189,    181,    181,    178,
-     172,    170,    161,    148,
-     137,    131,    117,    108,
-     102,     91,     83,     82,
-      78,     78,     85,     82,
-      81,     86,     93,     94,
-      99,    106,    110,    121,
-     133,    139,    145,    158,
-     161,    168,    178,    182,
-     181,    185,    182,    179,
-     187,    186,    182,    178,
-     175,    170,    174,    171,
-     162,    156,    153,    151,
-     150,    149,    144,    142,
-     143,    143,    150,    158,
-     158,    160,    166,    168,
-     173,    179,    186,    185,
-     187,    189,    194,    199,
-     203,    199,    199,    194,
-     193,    201,    194,    182,
-     167,    152,    137,    128,
-     120,    115,    113,    110,
-     107,    102,     97,     93,
-      88,     85,     84,     81,
-      75,     64,     49,     33,
-      18,      7,      1,      2,
-       9,     21,     33,     45,
-      56,     64,     71,     78,
-      84,     91,     99,    106,
-     111,    114,    118,    122,
-     125,    129,    136,    146,
-     156,    165,    175,    181,
-     186,    190,    193,    196,
-     201,    202,    201,    197,
-     190,    182,    176,    169,
-     163,    158,    152,    150,
-     145,    143,    140,    136,
-     129,    121,    112,    107,
-     102,    100,     99,     99,
-      97,     95,     92,     90,
-      91,     93,     96,    101,
-     105,    108,    109,    111,
-     113,    116,    116,    117,
-     115,    116,    117,    121,
-     125,    129,    133,    136,
-     138,    139,    141,    144,
-     150,    155,    163,    170,
-     175,    177,    177,    175,
-     172,    169,    166,    167,
-     172,    179,    190,    199,
-     207,    212,    211,    211,
-     206,    201,    200,    195,
-     188,    180,    170,    162,
-     156,    150,    145,    139,
-     130,    118,    104,     90,
-      78,     70,     66,     64,
-      62,     57,     47,     34,
-      23,     10,      3,      1,
-       3,     12,     21,     27,
-      34,     38,     39,     41,
-      43,     45,     46,     48,
-      51,     54,     57,     62,
-      68,     73,     77,     84,
-      94,    103,    112,    124,
-     135,    147,    157,    166,
-     175,    182,    185,    186,
-     187,    189,    192,    195,
-     198,    200,    200,    197,
-     195,    192,    189,    186,
-     181,    171,    160,    150,
-     143,    138,    137,    136,
-     136,    134,    131,    127,
-     123,    122,    122,    125,
-     128,    130,    129,    126,
-     121,    114,    109,    103,
-      98,     96,     96,    100,
-     104,    110,    115,    120,
-     125,    128,    131,    136,
-     142,    149,    156,    165,
-     174,    178,    181,    184,
-     190,    196,    201,    204,
-     207,    207,    205,    204,
-     205,    208,    210,    209,
-     208,    204,    200,    217,
-     230,    230,    212,    183,
-     148,    115,     97,     98,
-     114,    133,    142,    143,
-     129,    104,     87,     79,
-      82,     91,    102,    112,
-     113,    109,    102,     95,
-      86,     83,     88,     97,
-      89,     71,     47,     18,
-       1,      2,     16,     36,
-      56,     69,     73,     74,
-      74,     80,     82,     87,
-      97,    109,    123,    133,
-     151,    170,    186,    195,
-     203,    209,    207,    197,
-     186,    181,    185,    194,
-     207,    215,    216,    214,
-     205,    203,    200,    198,
-     191,    176,    147,    118,
-      90,     71,     55,     49,
-      55,     65,     68,     71,
-      79,     85,     96,    115,
-     141,    164,    176,    172,
-     162,    141,    121,    100,
-      84,     72,     65,     75,
-      93,    109,    118,    128,
-     131,    136,    139,    140,
-     136,    126,    109,     95,
-      94,    104,    115,    125,
-     143,    162,    174,    175,
-     170,    166,    157,    149,
-     156,    170,    184,    193,
-     192,    200,    206,    217,
-     163,    160,    155,    147,
-     138,    127,    115,    105,
-      99,     94,     91,     89,
-      85,     81,     76,     71,
-      66,     61,     57,     52,
-      47,     43,     41,     40,
-      40,     39,     36,     32,
-      26,     19,     13,      8,
-       4,      2,      1,      1,
-       2,      4,      8,     13,
-      18,     22,     25,     26,
-      27,     28,     33,     41,
-      49,     58,     66,     73,
-      80,     89,     99,    109,
-     117,    122,    128,    132,
-     136,    145,    152,    159,
-     165,    170,    175,    179,
-     183,    186,    188,    186,
-     185,    183,    183,    185,
-     188,    193,    196,    197,
-     196,    194,    192,    192,
-     195,    198,    201,    204,
-     207,    209,    211,    212,
-     212,    210,    206,    201,
-     196,    191,    187,    185,
-     183,    182,    183,    182,
-     181,    179,    176,    173,
-     170,    167,    164,    162,
-     163,    169,    178,    189,
-     197,    201,    201,    198,
-     194,    192,    190,    186,
-     182,    176,    171,    167,
-     163,    219,    210,    199,
-     186,    169,    150,    129,
-     112,     98,     89,     85,
-      84,     83,     80,     74,
-      66,     59,     53,     48,
-      46,     47,     52,     56,
-      59,     59,     56,     49,
-      42,     33,     23,     15,
-       8,      3,      1,      1,
-       4,      9,     15,     23,
-      30,     35,     38,     41,
-      42,     41,     42,     46,
-      50,     56,     62,     66,
-      69,     71,     76,     88,
-     106,    127,    147,    166,
-     179,    186,    190,    193,
-     194,    197,    199,    205,
-     209,    215,    219,    220,
-     215,    208,    200,    196,
-     191,    185,    181,    176,
-     169,    162,    158,    155,
-     155,    159,    164,    170,
-     177,    183,    187,    189,
-     188,    186,    183,    178,
-     172,    164,    151,    136,
-     120,    108,     98,     94,
-      92,     94,     95,     95,
-      94,     93,     96,    102,
-     113,    127,    148,    175,
-     200,    220,    235,    246,
-     251,    249,    251,    250,
-     248,    245,    240,    235,
-     228,    219,    159,    156,
-     152,    147,    139,    129,
-     117,    106,     96,     90,
-      86,     85,     84,     82,
-      79,     74,     67,     61,
-      55,     49,     45,     43,
-      41,     39,     37,     33,
-      29,     24,     19,     13,
-       9,      5,      3,      1,
-       1,      4,      8,     14,
-      21,     28,     34,     38,
-      42,     43,     42,     41,
-      41,     42,     44,     46,
-      48,     50,     52,     56,
-      66,     82,    101,    121,
-     139,    151,    157,    158,
-     157,    157,    159,    164,
-     172,    179,    186,    190,
-     192,    191,    191,    191,
-     193,    195,    196,    196,
-     193,    190,    185,    182,
-     180,    181,    184,    189,
-     195,    203,    210,    215,
-     219,    219,    218,    215,
-     212,    211,    211,    210,
-     208,    204,    197,    188,
-     178,    170,    164,    160,
-     157,    157,    157,    161,
-     166,    173,    180,    188,
-     195,    200,    202,    202,
-     201,    197,    192,    189,
-     185,    182,    178,    172,
-     167,    163,    159,    153,
-     149,    143,    137,    130,
-     122,    112,    101,     91,
-      82,     75,     70,     65,
-      61,     56,     50,     44,
-      39,     35,     31,     26,
-      23,     18,     15,     12,
-       9,      6,      4,      3,
-       2,      1,      1,      2,
-       2,      5,      6,      8,
-       9,     10,     10,     10,
-      11,     14,     18,     21,
-      24,     27,     29,     31,
-      33,     37,     43,     50,
-      58,     68,     82,     97,
-     110,    122,    133,    141,
-     147,    151,    155,    160,
-     165,    170,    175,    181,
-     186,    190,    194,    197,
-     200,    203,    205,    206,
-     206,    205,    203,    202,
-     202,    202,    203,    206,
-     209,    213,    218,    222,
-     226,    228,    228,    226,
-     224,    221,    218,    216,
-     215,    213,    211,    210,
-     207,    204,    202,    201,
-     201,    202,    203,    204,
-     205,    206,    207,    208,
-     211,    212,    212,    209,
-     206,    202,    197,    191,
-     186,    181,    176,    172,
-     167,    163,    158,    153,
-     173,    168,    163,    159,
-     154,    146,    134,    120,
-     106,     93,     84,     78,
-      74,     69,     63,     55,
-      48,     41,     37,     32,
-      29,     26,     22,     19,
-      16,     14,     11,      8,
-       5,      3,      1,      1,
-       1,      2,      5,      8,
-      12,     15,     19,     22,
-      25,     29,     35,     42,
-      48,     54,     59,     64,
-      70,     77,     85,     94,
-     101,    108,    115,    124,
-     135,    145,    156,    165,
-     170,    171,    170,    167,
-     167,    167,    170,    174,
-     179,    184,    187,    188,
-     189,    189,    190,    189,
-     188,    185,    180,    175,
-     169,    164,    161,    160,
-     162,    165,    169,    173,
-     177,    178,    178,    176,
-     173,    170,    166,    164,
-     162,    160,    159,    160,
-     162,    164,    171,    180,
-     191,    201,    210,    215,
-     215,    213,    210,    207,
-     206,    209,    211,    213,
-     212,    209,    204,    199,
-     194,    191,    188,    186,
-     185,    184,    181,    178,
-     173,    168,    159,    151,
-     146,    143,    137,    130,
-     119,    106,     92,     80,
-      69,     58,     49,     40,
-      32,     26,     21,     19,
-      15,     13,     13,     12,
-      12,     11,     10,      8,
-       5,      3,      1,      1,
-       2,      4,      9,     14,
-      19,     25,     31,     35,
-      38,     43,     50,     60,
-      71,     79,     87,     92,
-      97,    102,    107,    115,
-     124,    131,    137,    143,
-     149,    154,    158,    162,
-     166,    168,    168,    167,
-     164,    161,    160,    160,
-     161,    164,    166,    168,
-     168,    167,    166,    165,
-     164,    164,    163,    161,
-     157,    153,    150,    146,
-     143,    142,    142,    145,
-     149,    153,    154,    154,
-     152,    151,    149,    149,
-     154,    162,    168,    173,
-     178,    181,    182,    184,
-     190,    198,    207,    213,
-     218,    218,    218,    217,
-     217,    217,    220,    223,
-     224,    224,    222,    218,
-     214,    210,    208,    204,
-     201,    197,    193,    186,
-     178,    168,    152,    140,
-     130,    120,    113,    106,
-      97,     86,     75,     64,
-      53,     42,     32,     24,
-      16,     12,     12,     17,
-      22,     26,     28,     29,
-      26,     23,     20,     16,
-      13,     10,      8,      6,
-       4,      2,      1,      2,
-       6,     10,     12,     13,
-      13,     11,     10,     12,
-      19,     28,     38,     50,
-      60,     69,     76,     81,
-      83,     86,     88,     90,
-      93,     98,    105,    112,
-     118,    125,    129,    132,
-     134,    139,    147,    158,
-     171,    183,    192,    197,
-     199,    200,    201,    204,
-     207,    210,    212,    214,
-     212,    206,    198,    191,
-     182,    176,    172,    170,
-     170,    169,    169,    168,
-     167,    166,    163,    160,
-     158,    158,    163,    169,
-     179,    189,    198,    206,
-     214,    222,    229,    237,
-     245,    250,    253,    253,
-     251,    250,    248,    248,
-     247,    245,    242,    237,
-     230,    224,    217,    210,
-     204,    198,    191,    184,
-     175,    165,    152,    144,
-     135,    128,    120,    114,
-     105,     95,     85,     72,
-      63,     55,     48,     42,
-      37,     31,     26,     21,
-      19,     18,     17,     17,
-      18,     16,     13,      8,
-       4,      2,      1,      3,
-       4,      6,      7,      8,
-      10,     14,     18,     24,
-      32,     39,     45,     51,
-      57,     64,     71,     80,
-      87,     93,     97,     99,
-     100,     99,    100,    101,
-     102,    103,    106,    112,
-     121,    129,    136,    139,
-     140,    139,    137,    141,
-     147,    154,    161,    167,
-     171,    175,    178,    182,
-     184,    184,    183,    179,
-     174,    169,    163,    158,
-     155,    152,    150,    149,
-     148,    149,    149,    150,
-     152,    158,    165,    172,
-     179,    183,    187,    191,
-     194,    200,    209,    217,
-     224,    231,    237,    242,
-     245,    250,    253,    253,
-     251,    249,    245,    241,
-     238,    236,    233,    230,
-     228,    223,    217,    210,
-     201,    193,    185,    177,
-     169,    161,    154,    144,
-     127,    120,    115,    110,
-     106,    102,     96,     89,
-      81,     73,     66,     60,
-      54,     49,     41,     33,
-      26,     20,     17,     17,
-      17,     18,     18,     18,
-      15,     10,      7,      3,
-       2,      2,      3,      4,
-       7,     12,     19,     26,
-      36,     49,     60,     70,
-      79,     87,     93,     97,
-     101,    104,    106,    108,
-     110,    111,    111,    112,
-     111,    109,    107,    106,
-     107,    111,    115,    117,
-     116,    114,    113,    113,
-     117,    126,    134,    140,
-     144,    148,    154,    162,
-     170,    177,    182,    186,
-     184,    179,    174,    169,
-     163,    159,    155,    151,
-     148,    146,    146,    146,
-     148,    150,    154,    161,
-     172,    183,    193,    202,
-     209,    213,    216,    221,
-     226,    232,    238,    244,
-     248,    250,    254,    255,
-     255,    253,    251,    248,
-     244,    238,    232,    224,
-     217,    212,    206,    202,
-     196,    188,    178,    169,
-     159,    150,    141,    134,
-     127,    141,    132,    123,
-     116,    111,    105,     98,
-      92,     84,     77,     70,
-      64,     57,     48,     38,
-      27,     18,     12,     10,
-      13,     16,     19,     19,
-      18,     14,     10,      7,
-       5,      5,      5,      3,
-       2,      1,      3,      7,
-      14,     23,     32,     38,
-      44,     51,     56,     62,
-      70,     79,     89,     97,
-     106,    113,    118,    119,
-     121,    123,    126,    129,
-     133,    139,    144,    148,
-     150,    149,    148,    148,
-     148,    151,    153,    155,
-     154,    153,    152,    153,
-     155,    160,    162,    162,
-     162,    159,    155,    151,
-     147,    145,    145,    147,
-     148,    150,    150,    151,
-     149,    149,    148,    151,
-     156,    162,    169,    177,
-     183,    188,    192,    198,
-     208,    217,    226,    233,
-     239,    240,    240,    241,
-     242,    244,    245,    247,
-     248,    246,    243,    240,
-     235,    230,    224,    217,
-     212,    206,    198,    191,
-     185,    177,    169,    160,
-     151,    141,    148,    134,
-     119,    105,     97,     91,
-      89,     85,     81,     75,
-      67,     60,     53,     46,
-      38,     32,     26,     25,
-      26,     30,     33,     35,
-      33,     31,     28,     24,
-      21,     19,     17,     18,
-      20,     21,     24,     28,
-      33,     37,     44,     55,
-      68,     81,     95,    108,
-     119,    128,    135,    142,
-     150,    160,    169,    177,
-     181,    185,    186,    185,
-     183,    183,    186,    189,
-     193,    195,    196,    194,
-     190,    181,    169,    157,
-     146,    135,    126,    122,
-     121,    121,    120,    115,
-     108,     99,     90,     82,
-      77,     73,     74,     79,
-      84,     92,     97,    101,
-     102,     99,     95,     92,
-      92,     97,    107,    120,
-     133,    145,    154,    162,
-     169,    178,    189,    201,
-     213,    223,    231,    238,
-     244,    249,    253,    254,
-     255,    255,    253,    251,
-     248,    241,    233,    225,
-     216,    209,    203,    197,
-     192,    187,    182,    175,
-     167,    158,    148,    156,
-     150,    144,    135,    123,
-     111,     97,     83,     73,
-      66,     62,     63,     64,
-      63,     60,     56,     49,
-      43,     39,     37,     36,
-      36,     34,     33,     33,
-      33,     36,     38,     39,
-      39,     37,     33,     29,
-      26,     25,     26,     31,
-      41,     53,     66,     79,
-      90,     98,    105,    110,
-     118,    129,    143,    159,
-     172,    182,    191,    195,
-     197,    202,    208,    217,
-     224,    229,    231,    230,
-     225,    220,    213,    205,
-     199,    193,    186,    177,
-     171,    164,    156,    148,
-     138,    129,    118,    103,
-      88,     73,     60,     49,
-      44,     42,     45,     47,
-      48,     46,     40,     35,
-      30,     29,     33,     44,
-      61,     82,    102,    120,
-     136,    148,    161,    175,
-     191,    208,    223,    235,
-     243,    248,    248,    248,
-     249,    250,    253,    255,
-     254,    252,    246,    238,
-     229,    220,    213,    209,
-     203,    198,    192,    184,
-     176,    169,    162,    156,
-     135,    128,    123,    117,
-     110,    102,     93,     84,
-      78,     73,     70,     68,
-      65,     61,     55,     51,
-      48,     47,     49,     53,
-      56,     58,     60,     60,
-      59,     58,     56,     52,
-      47,     40,     32,     25,
-      20,     18,     16,     15,
-      14,     13,     13,     11,
-      11,     11,     13,     15,
-      19,     25,     34,     43,
-      52,     61,     68,     73,
-      78,     85,     97,    112,
-     128,    142,    154,    162,
-     168,    176,    187,    198,
-     209,    217,    221,    219,
-     214,    210,    206,    203,
-     201,    200,    200,    198,
-     194,    186,    176,    166,
-     157,    151,    148,    149,
-     148,    144,    138,    129,
-     120,    114,    111,    114,
-     121,    130,    140,    149,
-     155,    159,    163,    172,
-     182,    195,    209,    220,
-     228,    231,    231,    231,
-     234,    239,    245,    251,
-     255,    254,    248,    238,
-     228,    217,    208,    200,
-     194,    188,    183,    176,
-     168,    159,    150,    142,
-     135,    107,     95,     84,
-      72,     61,     52,     43,
-      34,     27,     21,     15,
-      12,      9,      7,      6,
-       7,     10,     14,     18,
-      23,     29,     34,     40,
-      43,     47,     51,     53,
-      55,     55,     55,     54,
-      51,     49,     45,     41,
-      36,     31,     26,     21,
-      18,     15,     11,     10,
-      10,     10,     11,     13,
-      16,     19,     23,     27,
-      33,     38,     43,     49,
-      57,     68,     77,     88,
-      99,    110,    123,    134,
-     147,    157,    167,    178,
-     186,    195,    203,    211,
-     218,    223,    228,    232,
-     234,    235,    235,    233,
-     232,    229,    225,    222,
-     219,    214,    209,    204,
-     199,    194,    191,    189,
-     188,    191,    193,    197,
-     202,    207,    213,    217,
-     224,    229,    234,    239,
-     243,    247,    250,    253,
-     254,    255,    255,    254,
-     254,    251,    249,    245,
-     239,    232,    224,    216,
-     207,    198,    188,    177,
-     166,    155,    144,    131,
-     120,    107,    118,    104,
-      89,     73,     59,     48,
-      40,     32,     24,     15,
-       7,      3,      1,      1,
-       4,      7,     11,     15,
-      19,     24,     31,     36,
-      43,     46,     50,     55,
-      59,     63,     62,     62,
-      61,     62,     61,     61,
-      58,     54,     45,     37,
-      31,     29,     29,     30,
-      31,     33,     29,     25,
-      22,     24,     29,     35,
-      41,     46,     47,     47,
-      47,     50,     57,     64,
-      72,     79,     90,    104,
-     118,    133,    143,    155,
-     165,    174,    185,    194,
-     207,    215,    221,    228,
-     233,    238,    242,    244,
-     242,    241,    234,    227,
-     224,    223,    223,    219,
-     212,    205,    195,    189,
-     187,    189,    194,    198,
-     203,    206,    209,    211,
-     213,    216,    217,    218,
-     221,    225,    232,    235,
-     238,    239,    240,    240,
-     240,    242,    243,    242,
-     238,    231,    224,    216,
-     210,    205,    199,    189,
-     179,    165,    154,    147,
-     139,    131,    118,    132,
-     113,     91,     69,     52,
-      43,     39,     35,     30,
-      18,      7,      1,      2,
-       7,     16,     23,     29,
-      29,     29,     31,     37,
-      45,     54,     56,     58,
-      62,     65,     66,     63,
-      60,     58,     59,     60,
-      62,     62,     55,     42,
-      28,     18,     17,     20,
-      28,     36,     40,     35,
-      25,     17,     16,     23,
-      35,     47,     55,     57,
-      52,     46,     45,     49,
-      54,     57,     62,     74,
-      91,    110,    128,    140,
-     151,    159,    164,    175,
-     188,    204,    216,    222,
-     230,    235,    241,    246,
-     249,    249,    246,    234,
-     223,    216,    216,    220,
-     219,    213,    201,    186,
-     177,    178,    186,    197,
-     206,    212,    215,    218,
-     219,    219,    219,    216,
-     212,    212,    215,    222,
-     226,    231,    236,    240,
-     244,    246,    247,    248,
-     246,    239,    230,    221,
-     212,    208,    205,    199,
-     189,    175,    159,    150,
-     148,    148,    145,    132,
-     146,    122,     94,     67,
-      46,     40,     44,     47,
-      47,     34,     20,     15,
-      19,     33,     50,     62,
-      67,     64,     57,     53,
-      58,     66,     76,     79,
-      77,     78,     77,     75,
-      69,     61,     57,     58,
-      59,     64,     63,     56,
-      40,     22,      6,      6,
-      12,     26,     40,     48,
-      42,     27,     12,     10,
-      19,     36,     57,     72,
-      75,     68,     58,     52,
-      50,     51,     51,     52,
-      63,     83,    106,    125,
-     137,    146,    150,    151,
-     160,    175,    196,    210,
-     218,    225,    228,    231,
-     237,    242,    242,    239,
-     221,    203,    192,    189,
-     198,    201,    196,    183,
-     166,    155,    161,    175,
-     192,    207,    215,    216,
-     219,    218,    219,    217,
-     209,    199,    196,    200,
-     209,    213,    220,    231,
-     244,    251,    255,    255,
-     254,    247,    236,    226,
-     215,    206,    200,    197,
-     193,    181,    163,    146,
-     139,    148,    157,    160,
-     146,    154,    127,     96,
-      69,     49,     46,     54,
-      64,     68,     58,     45,
-      41,     49,     69,     92,
-     108,    113,    105,     93,
-      86,     88,     97,    107,
-     109,    105,    102,     99,
-      93,     85,     74,     68,
-      68,     69,     73,     73,
-      65,     49,     28,     11,
-      10,     17,     34,     52,
-      60,     53,     33,     15,
-      11,     21,     41,     67,
-      87,     92,     86,     75,
-      66,     61,     57,     54,
-      52,     61,     81,    104,
-     124,    135,    141,    141,
-     138,    145,    161,    182,
-     197,    204,    209,    210,
-     211,    216,    221,    222,
-     217,    197,    175,    159,
-     155,    165,    172,    169,
-     157,    140,    129,    139,
-     158,    178,    196,    204,
-     204,    206,    206,    207,
-     203,    194,    183,    178,
-     181,    189,    195,    206,
-     222,    239,    251,    255,
-     253,    249,    239,    225,
-     214,    202,    192,    187,
-     185,    179,    165,    147,
-     130,    127,    140,    158,
-     165,    154,    157,    129,
-      97,     71,     52,     51,
-      64,     79,     87,     79,
-      68,     65,     76,    101,
-     128,    147,    151,    141,
-     126,    115,    115,    124,
-     134,    135,    128,    122,
-     116,    108,     98,     84,
-      76,     75,     75,     79,
-      77,     70,     52,     30,
-      11,     10,     17,     36,
-      55,     64,     56,     35,
-      14,      9,     20,     42,
-      71,     95,    103,     99,
-      89,     77,     71,     65,
-      59,     56,     64,     84,
-     108,    126,    136,    141,
-     138,    132,    137,    152,
-     174,    189,    195,    198,
-     197,    196,    199,    203,
-     204,    199,    175,    152,
-     134,    127,    138,    146,
-     145,    134,    119,    109,
-     121,    144,    166,    185,
-     194,    193,    195,    195,
-     196,    193,    184,    170,
-     165,    169,    178,    184,
-     197,    217,    238,    251,
-     255,    250,    245,    232,
-     215,    204,    192,    182,
-     176,    173,    166,    152,
-     132,    117,    116,    133,
-     155,    166,    157,    144,
-     117,     86,     61,     43,
-      45,     63,     84,     97,
-      92,     83,     84,    100,
-     126,    155,    175,    178,
-     167,    148,    133,    129,
-     136,    145,    145,    135,
-     126,    117,    106,     95,
-      79,     70,     67,     66,
-      68,     65,     57,     39,
-      18,      1,      1,     10,
-      31,     52,     64,     57,
-      37,     19,     18,     31,
-      55,     86,    112,    120,
-     117,    107,     92,     82,
-      72,     61,     53,     60,
-      81,    103,    121,    129,
-     132,    128,    123,    130,
-     147,    169,    187,    198,
-     204,    203,    201,    206,
-     212,    212,    204,    175,
-     148,    126,    115,    127,
-     136,    137,    128,    114,
-     104,    117,    142,    163,
-     180,    187,    185,    187,
-     186,    189,    189,    184,
-     171,    163,    162,    171,
-     177,    191,    212,    233,
-     249,    252,    245,    238,
-     226,    213,    205,    194,
-     183,    176,    172,    164,
-     147,    124,    106,    103,
-     118,    141,    152,    144,
-     117,     89,     64,     47,
-      31,     34,     55,     84,
-     102,    100,     96,    104,
-     126,    153,    178,    196,
-     196,    184,    163,    144,
-     136,    140,    145,    142,
-     128,    115,    107,     97,
-      88,     73,     65,     62,
-      58,     61,     58,     51,
-      35,     16,      1,      2,
-      11,     30,     53,     67,
-      64,     49,     35,     39,
-      54,     82,    113,    139,
-     147,    144,    132,    114,
-     100,     87,     72,     59,
-      61,     79,     97,    111,
-     115,    117,    114,    112,
-     124,    142,    162,    186,
-     206,    220,    222,    218,
-     228,    235,    231,    219,
-     185,    157,    131,    116,
-     125,    132,    134,    130,
-     118,    110,    122,    143,
-     161,    171,    177,    174,
-     174,    171,    176,    183,
-     181,    168,    156,    152,
-     158,    161,    171,    192,
-     212,    228,    232,    225,
-     221,    212,    205,    203,
-     195,    185,    177,    174,
-     167,    146,    118,     97,
-      89,     98,    114,    125,
-     117,     84,     61,     48,
-      40,     29,     31,     48,
-      78,    100,    105,    109,
-     124,    147,    171,    187,
-     195,    193,    181,    163,
-     142,    128,    128,    131,
-     125,    107,     94,     86,
-      79,     73,     63,     61,
-      63,     61,     63,     58,
-      52,     44,     33,     24,
-      24,     29,     45,     63,
-      76,     75,     69,     64,
-      71,     88,    113,    140,
-     161,    168,    167,    158,
-     139,    123,    106,     92,
-      77,     75,     88,     94,
-     103,    104,    102,    101,
-     101,    117,    134,    150,
-     176,    206,    229,    233,
-     231,    247,    255,    249,
-     236,    202,    179,    153,
-     133,    139,    141,    142,
-     142,    134,    128,    135,
-     151,    161,    160,    161,
-     156,    156,    155,    159,
-     173,    178,    165,    153,
-     144,    147,    144,    146,
-     160,    174,    188,    192,
-     187,    190,    186,    186,
-     191,    190,    183,    177,
-     176,    169,    147,    121,
-     100,     84,     83,     90,
-      94,     84,     69,     52,
-      46,     45,     37,     35,
-      45,     71,     93,    105,
-     116,    134,    154,    169,
-     175,    175,    168,    159,
-     145,    127,    113,    110,
-     110,    103,     86,     74,
-      69,     66,     64,     61,
-      63,     68,     71,     73,
-      68,     65,     66,     64,
-      62,     64,     67,     75,
-      83,     91,     91,     91,
-      94,    103,    119,    137,
-     156,    170,    176,    179,
-     173,    159,    145,    128,
-     114,    100,     96,    102,
-     100,    103,    102,     99,
-      98,    102,    120,    134,
-     141,    163,    193,    220,
-     225,    224,    244,    255,
-     251,    239,    212,    197,
-     176,    157,    158,    155,
-     155,    157,    150,    145,
-     146,    156,    160,    152,
-     150,    146,    145,    144,
-     148,    164,    170,    159,
-     146,    133,    133,    127,
-     124,    132,    139,    150,
-     154,    151,    156,    156,
-     161,    169,    170,    166,
-     162,    164,    162,    146,
-     127,    112,     95,     85,
-      81,     80,     69,     58,
-      44,     42,     42,     36,
-      33,     40,     61,     83,
-      99,    114,    133,    152,
-     161,    163,    160,    152,
-     145,    134,    119,    106,
-     100,     99,     92,     76,
-      66,     62,     62,     65,
-      67,     72,     80,     86,
-      88,     84,     81,     84,
-      87,     89,     91,     93,
-      96,     99,    103,    105,
-     110,    117,    126,    139,
-     153,    166,    174,    179,
-     183,    182,    173,    161,
-     146,    135,    124,    121,
-     124,    116,    115,    111,
-     105,    103,    109,    128,
-     138,    139,    157,    187,
-     215,    221,    220,    242,
-     255,    251,    237,    214,
-     202,    185,    166,    166,
-     160,    161,    164,    159,
-     154,    151,    156,    156,
-     142,    139,    135,    133,
-     131,    134,    152,    161,
-     155,    141,    127,    123,
-     117,    113,    117,    120,
-     127,    129,    126,    130,
-     132,    140,    149,    151,
-     149,    148,    152,    152,
-     139,    125,    113,     97,
-      82,     73,     68,     58,
-      59,     47,     44,     42,
-      37,     38,     43,     60,
-      80,     95,    108,    126,
-     147,    158,    158,    156,
-     152,    147,    135,    121,
-     108,    102,    101,     96,
-      82,     72,     65,     66,
-      70,     71,     76,     86,
-      94,     96,     91,     88,
-      89,     91,     95,     96,
-      94,     96,     98,    102,
-     103,    108,    117,    129,
-     142,    157,    170,    178,
-     183,    187,    188,    181,
-     172,    161,    152,    144,
-     144,    148,    140,    135,
-     127,    119,    118,    126,
-     147,    155,    150,    165,
-     195,    221,    224,    219,
-     242,    255,    249,    231,
-     205,    195,    177,    155,
-     156,    152,    151,    157,
-     153,    149,    146,    152,
-     153,    137,    131,    129,
-     129,    129,    135,    156,
-     170,    165,    149,    130,
-     118,    106,    102,    104,
-     103,    104,    106,    102,
-     101,    102,    113,    125,
-     131,    131,    134,    140,
-     140,    132,    123,    114,
-      99,     86,     76,     69,
-      59,     76,     67,     63,
-      60,     58,     61,     63,
-      71,     83,     95,    102,
-     119,    144,    163,    164,
-     161,    161,    155,    136,
-     121,    109,    104,    103,
-     100,     87,     73,     60,
-      59,     61,     61,     61,
-      72,     84,     85,     78,
-      70,     66,     65,     71,
-      75,     73,     75,     83,
-      92,     92,     96,    110,
-     131,    147,    168,    187,
-     196,    200,    202,    203,
-     197,    189,    182,    178,
-     171,    176,    183,    171,
-     161,    145,    135,    136,
-     148,    173,    178,    167,
-     177,    206,    233,    229,
-     220,    243,    255,    243,
-     218,    187,    176,    154,
-     128,    131,    130,    131,
-     143,    146,    146,    147,
-     158,    166,    146,    138,
-     142,    147,    152,    161,
-     188,    205,    195,    175,
-     146,    117,     92,     87,
-      88,     81,     72,     71,
-      63,     56,     51,     62,
-      79,     89,     92,    102,
-     114,    121,    122,    123,
-     122,    112,    105,     96,
-      87,     76,    107,    106,
-     107,    109,    113,    121,
-     120,    114,    110,    109,
-     109,    124,    155,    181,
-     187,    185,    187,    179,
-     150,    132,    124,    119,
-     116,    114,    100,     81,
-      59,     47,     47,     38,
-      26,     32,     44,     42,
-      27,     14,      2,      1,
-      14,     29,     34,     41,
-      63,     85,     88,     94,
-     116,    152,    176,    202,
-     228,    240,    239,    231,
-     225,    214,    207,    207,
-     207,    201,    205,    210,
-     194,    169,    141,    127,
-     132,    149,    175,    180,
-     163,    166,    192,    218,
-     207,    196,    222,    234,
-     220,    191,    157,    147,
-     125,     96,    106,    108,
-     106,    125,    136,    142,
-     147,    162,    177,    155,
-     141,    153,    161,    168,
-     183,    213,    232,    217,
-     198,    175,    131,     92,
-      88,     90,     77,     59,
-      59,     49,     29,     16,
-      20,     32,     41,     43,
-      56,     74,     89,    104,
-     120,    132,    135,    139,
-     134,    117,    107,    147,
-     152,    155,    158,    167,
-     174,    169,    154,    140,
-     129,    120,    124,    146,
-     170,    176,    175,    178,
-     170,    145,    133,    130,
-     129,    129,    128,    120,
-     104,     85,     75,     72,
-      60,     43,     43,     48,
-      41,     26,     14,      3,
-       1,     12,     29,     40,
-      48,     71,     92,     97,
-     102,    122,    154,    178,
-     202,    226,    234,    228,
-     214,    205,    195,    191,
-     196,    201,    198,    199,
-     200,    183,    158,    131,
-     119,    123,    134,    149,
-     151,    136,    134,    147,
-     160,    151,    142,    156,
-     165,    157,    140,    119,
-     118,    106,     88,     96,
-     101,    102,    116,    127,
-     135,    140,    154,    171,
-     157,    146,    156,    163,
-     168,    177,    197,    208,
-     196,    189,    179,    143,
-     112,    108,    111,    101,
-      85,     86,     79,     59,
-      45,     42,     43,     41,
-      38,     48,     63,     79,
-      99,    122,    143,    153,
-     162,    162,    151,    147,
-     173,    181,    185,    189,
-     199,    207,    198,    176,
-     154,    136,    122,    120,
-     136,    158,    164,    163,
-     165,    157,    131,    119,
-     119,    119,    120,    122,
-     118,    105,     90,     82,
-      79,     67,     52,     50,
-      54,     47,     31,     18,
-       6,      1,     12,     28,
-      37,     46,     65,     84,
-      87,     92,    112,    145,
-     172,    197,    222,    233,
-     225,    210,    200,    192,
-     191,    199,    207,    208,
-     209,    208,    191,    164,
-     135,    121,    123,    131,
-     140,    142,    129,    124,
-     128,    134,    125,    117,
-     125,    131,    126,    112,
-      97,     98,     93,     79,
-      87,     93,     94,    107,
-     118,    128,    138,    154,
-     177,    169,    160,    172,
-     180,    184,    191,    204,
-     212,    199,    195,    191,
-     156,    123,    118,    120,
-     108,     88,     89,     85,
-      65,     51,     43,     40,
-      32,     26,     35,     51,
-      68,     93,    125,    150,
-     167,    180,    182,    173,
-     173,    152,    160,    167,
-     161,    161,    184,    204,
-     199,    152,     92,     78,
-     104,    128,    147,    142,
-     151,    165,    178,    157,
-     145,    154,    154,    159,
-     147,    103,     68,     79,
-     113,    118,    100,     68,
-      84,    118,    132,     98,
-      79,     76,     85,    117,
-      99,     43,      9,     12,
-      46,     74,     83,     85,
-     113,    142,    188,    199,
-     165,    126,     84,     97,
-     107,    121,    119,    133,
-     156,    200,    255,    244,
-     196,    163,    120,    127,
-     160,    157,    145,    122,
-     140,    198,    232,    213,
-     215,    223,    201,    191,
-     166,    113,    103,     79,
-      68,     93,    117,    135,
-     169,    161,    139,    148,
-     166,    188,    143,     87,
-      79,     80,     63,     63,
-      98,    116,    124,    143,
-     156,    121,     70,     70,
-      92,     97,     70,     83,
-      82,     81,     83,     83,
-      99,    108,     94,     99,
-     120,    113,    103,    122,
-     162,    178,    174,    154,
-     141,    152,    159,    145,
-     116,    132,    154,    160,
-     154,    134,     88,     68,
-      67,     64,     70,    106,
-     156,    194,    198,    165,
-     118,    122,    166,    184,
-     186,    145,    109,     84,
-     118,    179,    202,    147,
-      73,     56,    108,    147,
-      90,     61,     47,     72,
-     108,    121,     82,     45,
-       6,     14,     61,    102,
-      97,     71,     87,    138,
-     170,    166,    127,     71,
-      80,    111,    141,    143,
-     140,    142,    181,    226,
-     233,    182,    126,     98,
-     123,    192,    204,    157,
-     106,    135,    218,    255,
-     207,    127,     88,    102,
-     154,    190,    179,    159,
-     110,     74,    102,    122,
-     122,    111,     91,     99,
-     139,    158,    171,    152,
-     155,    162,    145,    114,
-      92,    115,    148,    168,
-     192,    180,    101,     40,
-      61,     97,    105,     91,
-      97,    112,    140,    147,
-     131,    122,    108,     63,
-      55,     93,    128,    153,
-     158,    155,    163,    176,
-     179,    169,    159,    160,
-     162,    152,    149,    152,
-     148,    142,    125,    110,
-     103,    101,    103,    110,
-     121,    137,    159,    176,
-     188,    166,    153,    161,
-     179,    186,    168,    142,
-     108,    118,    134,    130,
-     115,     89,     79,     98,
-     113,     93,     73,     49,
-      50,     61,     68,     54,
-      42,     44,     54,     59,
-      65,     72,     80,     91,
-     104,    106,     90,     83,
-      92,    109,    132,    143,
-     144,    149,    159,    168,
-     183,    184,    164,    150,
-     148,    158,    163,    176,
-     187,    184,    194,    225,
-     255,    252,    233,    214,
-     188,    176,    180,    180,
-     175,    156,    135,    148,
-     167,    175,    165,    149,
-     141,    155,    168,    168,
-     143,    121,    114,    120,
-     120,    125,    123,    102,
-      86,    104,    115,     91,
-      63,     54,     53,     62,
-      64,     70,     71,     73,
-      79,     95,    105,    102,
-      95,     99,    117,    118,
-     120,    126,    133,    138,
-     136,    140,    144,    160,
-     147,    159,    148,    140,
-     131,    128,    128,    130,
-     114,     99,     99,    115,
-     129,    136,    143,    157,
-     184,    214,    222,    211,
-     202,    219,    233,    236,
-     212,    175,    168,    170,
-     162,    144,    115,     97,
-      99,    112,    108,     85,
-      60,     51,     48,     58,
-      51,     48,     44,     38,
-      33,     29,     34,     40,
-      54,     70,     74,     71,
-      71,     79,     93,    104,
-     109,    119,    131,    146,
-     163,    174,    173,    165,
-     164,    179,    193,    191,
-     190,    195,    207,    226,
-     241,    249,    255,    243,
-     235,    221,    201,    183,
-     172,    177,    179,    170,
-     168,    159,    152,    146,
-     135,    132,    145,    146,
-     133,    111,    111,    117,
-     126,    123,    114,    109,
-      87,     56,     44,     46,
-      39,     32,     43,     53,
-      57,     45,     48,     62,
-      78,     78,     80,     84,
-      93,     97,    104,    123,
-     127,    128,    131,    138,
-     142,    125,    116,    129,
-     147,    135,    158,    148,
-     144,    129,    108,    119,
-     122,    110,     88,     75,
-      97,    110,    128,    139,
-     133,    166,    202,    225,
-     220,    199,    210,    231,
-     230,    216,    179,    175,
-     167,    158,    140,    107,
-      90,     88,    103,    109,
-      96,     78,     71,     68,
-      78,     77,     83,     81,
-      61,     40,     35,     38,
-      37,     45,     65,     75,
-      75,     81,     98,    115,
-     112,    110,    118,    134,
-     143,    155,    162,    156,
-     151,    162,    174,    183,
-     183,    178,    182,    193,
-     213,    227,    238,    255,
-     255,    246,    233,    213,
-     195,    177,    174,    168,
-     154,    149,    143,    138,
-     140,    139,    142,    142,
-     137,    129,    116,    122,
-     134,    132,    116,    107,
-     113,     97,     56,     33,
-      30,     28,     26,     35,
-      55,     71,     68,     65,
-      73,     93,     95,     92,
-      90,    103,    117,    123,
-     126,    115,    118,    131,
-     141,    143,    126,    113,
-     124,    135,    119,    140,
-     135,    131,    113,     91,
-     100,    114,    112,     81,
-      69,     87,    109,    121,
-     124,    115,    149,    193,
-     225,    214,    191,    196,
-     233,    234,    216,    177,
-     164,    159,    156,    135,
-     112,     96,     90,    110,
-     122,    113,     89,     75,
-      68,     80,     88,    100,
-     101,     80,     53,     50,
-      56,     55,     56,     69,
-      83,     87,     90,    112,
-     131,    124,    115,    124,
-     141,    151,    159,    159,
-     149,    145,    161,    188,
-     204,    208,    202,    195,
-     206,    222,    228,    234,
-     248,    255,    247,    234,
-     226,    208,    192,    181,
-     175,    165,    157,    148,
-     138,    136,    143,    145,
-     146,    138,    127,    111,
-     113,    122,    124,    108,
-     106,    105,     96,     60,
-      32,     19,     23,     22,
-      26,     44,     61,     56,
-      53,     62,     88,     94,
-      89,     84,     97,    117,
-     129,    127,    106,    106,
-     116,    131,    126,    117,
-     105,    116,    119,    133,
-     148,    139,    130,    110,
-      83,     96,    117,    112,
-      84,     79,     98,    116,
-     131,    130,    122,    158,
-     204,    232,    228,    205,
-     213,    239,    244,    232,
-     196,    173,    165,    159,
-     144,    127,    107,     92,
-     108,    131,    122,     97,
-      72,     58,     71,     91,
-     108,    111,     87,     57,
-      51,     60,     58,     58,
-      66,     77,     78,     82,
-     106,    129,    121,    104,
-     115,    135,    150,    161,
-     154,    137,    134,    153,
-     185,    209,    215,    208,
-     199,    209,    226,    229,
-     227,    243,    255,    245,
-     235,    225,    205,    185,
-     180,    178,    170,    150,
-     136,    128,    130,    139,
-     140,    138,    133,    121,
-     102,    104,    115,    112,
-     101,     96,     93,     84,
-      54,     19,      7,     10,
-      11,     15,     35,     53,
-      48,     40,     54,     82,
-      95,     93,     85,     97,
-     121,    140,    136,    109,
-     106,    120,    136,    134,
-     115,    112,    119,    133,
-     129,    153,    151,    140,
-     114,     77,     84,    120,
-     118,     88,     71,     94,
-     122,    133,    131,    116,
-     142,    195,    240,    241,
-     212,    198,    234,    250,
-     241,    202,    172,    160,
-     159,    143,    121,    108,
-      94,    116,    130,    124,
-     100,     81,     68,     78,
-      93,    108,    115,    101,
-      72,     58,     65,     60,
-      60,     66,     84,     87,
-      89,    108,    130,    124,
-     109,    118,    135,    147,
-     153,    148,    130,    130,
-     144,    175,    205,    209,
-     198,    187,    197,    217,
-     214,    209,    229,    248,
-     240,    230,    218,    194,
-     175,    168,    169,    165,
-     145,    128,    116,    119,
-     133,    136,    134,    129,
-     118,     94,     96,    114,
-     113,    106,     92,     87,
-      84,     58,     21,      1,
-       4,     10,     13,     40,
-      55,     49,     45,     57,
-      95,    111,    106,     98,
-     113,    133,    152,    145,
-     121,    117,    123,    134,
-     137,    121,    123,    124,
-     129,     76,    122,    115,
-      84,     60,     22,     58,
-     125,    133,    107,    104,
-      82,     49,     34,     62,
-      75,    117,    145,    183,
-     176,    146,    114,    173,
-     181,    179,    127,    107,
-     111,    116,    107,    100,
-     134,    151,    190,    186,
-     152,    102,     91,     89,
-     121,    146,    141,    135,
-     126,    121,    130,    158,
-     155,    145,    136,    133,
-     125,    145,    189,    212,
-     183,    160,    175,    183,
-     170,    191,    190,    144,
-     113,     19,     46,    120,
-     183,    184,    218,    171,
-     146,    134,    156,    220,
-     255,    229,    190,    172,
-     130,    101,    130,    195,
-     234,    206,    157,    108,
-      86,     98,    124,    162,
-     177,    159,     90,     76,
-     102,    139,    170,    190,
-     176,    145,     82,     15,
-       6,     50,     82,     86,
-      96,     99,     65,     60,
-      66,    124,    139,    144,
-     119,    120,    104,     99,
-     105,    116,    142,    155,
-     137,     83,     55,     69,
-      56,     76,      3,      1,
-       4,     19,     34,     47,
-      80,    115,    127,    108,
-      67,     35,     22,     17,
-      23,     31,     53,     83,
-     117,    147,    161,    159,
-     147,    111,     80,     53,
-      42,     45,     61,     84,
-     106,    126,    142,    160,
-     165,    147,    112,     77,
-      55,     60,     82,    115,
-     150,    175,    191,    210,
-     232,    230,    196,    151,
-     122,    121,    139,    155,
-     160,    170,    192,    220,
-     244,    249,    239,    205,
-     157,    125,    125,    130,
-     145,    156,    171,    204,
-     230,    241,    246,    241,
-     231,    208,    181,    169,
-     163,    157,    162,    179,
-     206,    227,    231,    228,
-     215,    192,    160,    133,
-     120,    114,    105,     96,
-     108,    138,    170,    188,
-     189,    174,    146,    102,
-      69,     55,     59,     65,
-      68,     86,    116,    145,
-     161,    154,    141,    117,
-      87,     56,     46,     51,
-      58,     63,     75,    102,
-     129,    136,    122,     91,
-      64,     31,      3,      9,
-      17,     29,     44,     64,
-      89,    117,    134,    129,
-     104,     67,     36,     22,
-      22,     27,     33,     51,
-      88,    131,    155,    152,
-     131,    101,     70,     44,
-      30,     26,     34,     50,
-      75,    104,    131,    146,
-     151,    144,    125,     91,
-      55,     39,     51,     83,
-     114,    142,    170,    194,
-     211,    212,    193,    159,
-     125,    104,    102,    113,
-     126,    138,    157,    190,
-     228,    244,    231,    201,
-     163,    131,    111,    113,
-     115,    124,    144,    176,
-     217,    246,    255,    250,
-     237,    215,    189,    166,
-     155,    149,    149,    162,
-     187,    215,    237,    245,
-     242,    220,    183,    144,
-     119,    112,    112,    111,
-     118,    139,    170,    194,
-     203,    198,    177,    148,
-     114,     89,     80,     79,
-      87,    107,    140,    170,
-     186,    185,    168,    143,
-     114,     86,     65,     58,
-      60,     68,     83,    103,
-     127,    141,    138,    124,
-      94,     56,     22,      9,
-      18,     28,     39,     55,
-      80,    110,    134,    138,
-     116,     80,     47,     28,
-      24,     30,     37,     48,
-      68,     95,    121,    132,
-     118,     89,     58,     35,
-      24,     17,     16,     26,
-      47,     73,     99,    121,
-     129,    120,    101,     77,
-      56,     44,     48,     66,
-      91,    116,    141,    165,
-     183,    190,    178,    148,
-     116,     98,     96,    104,
-     118,    133,    148,    170,
-     193,    210,    211,    191,
-     164,    138,    121,    113,
-     116,    126,    142,    165,
-     196,    230,    251,    251,
-     241,    225,    204,    181,
-     165,    162,    168,    177,
-     192,    215,    240,    255,
-     252,    232,    203,    176,
-     151,    137,    136,    137,
-     136,    146,    173,    205,
-     219,    210,    188,    162,
-     140,    118,    103,    101,
-     108,    124,    149,    177,
-     198,    199,    185,    160,
-     135,    109,     85,     72,
-      72,     83,     97,    110,
-     126,    142,    144,    128,
-      99,     67,     42,     22,
-      18,     47,     56,     67,
-      83,    101,    113,    115,
-     102,     79,     52,     30,
-      25,     31,     46,     58,
-      66,     81,     97,    109,
-     105,     84,     54,     28,
-      14,     16,     28,     39,
-      48,     60,     73,     89,
-     102,     97,     78,     55,
-      38,     32,     38,     57,
-      77,     98,    115,    134,
-     152,    158,    152,    130,
-     104,     86,     84,     96,
-     112,    127,    140,    154,
-     173,    187,    190,    178,
-     155,    133,    118,    118,
-     127,    127,    141,    160,
-     187,    214,    237,    246,
-     238,    221,    198,    178,
-     169,    170,    179,    190,
-     198,    211,    229,    248,
-     255,    241,    215,    185,
-     167,    159,    159,    163,
-     166,    174,    188,    208,
-     223,    220,    204,    181,
-     162,    147,    138,    136,
-     139,    146,    159,    178,
-     194,    200,    193,    174,
-     144,    119,    102,     96,
-      99,    106,    111,    118,
-     128,    140,    145,    136,
-     109,     80,     56,     47,
-      45,     47,     75,     86,
-      93,    100,    106,    107,
-      98,     80,     56,     37,
-      28,     34,     48,     64,
-      77,     81,     85,     87,
-      85,     72,     52,     28,
-       7,      1,     11,     28,
-      44,     54,     63,     70,
-      76,     76,     65,     44,
-      24,     16,     22,     39,
-      62,     80,     94,    106,
-     119,    128,    130,    120,
-      99,     79,     72,     79,
-      98,    120,    137,    147,
-     155,    163,    164,    159,
-     147,    128,    111,    106,
-     114,    131,    146,    167,
-     184,    201,    216,    229,
-     230,    217,    196,    177,
-     170,    176,    190,    205,
-     217,    227,    238,    247,
-     249,    238,    217,    194,
-     174,    166,    171,    183,
-     194,    202,    209,    217,
-     225,    227,    215,    194,
-     170,    153,    149,    156,
-     169,    179,    185,    192,
-     199,    204,    201,    185,
-     161,    136,    121,    115,
-     119,    127,    133,    136,
-     143,    148,    149,    138,
-     117,     88,     65,     53,
-      54,     64,     75,     97,
-     108,    114,    112,    109,
-      99,     81,     62,     44,
-      35,     37,     51,     69,
-      87,     96,     97,     92,
-      83,     72,     53,     30,
-      11,      1,      7,     26,
-      48,     63,     68,     68,
-      62,     56,     50,     36,
-      20,     10,     12,     27,
-      50,     74,     94,    104,
-     109,    113,    108,    100,
-      87,     72,     65,     70,
-      85,    107,    131,    145,
-     151,    150,    147,    138,
-     127,    114,    100,     94,
-     100,    119,    146,    156,
-     179,    192,    200,    208,
-     211,    203,    186,    169,
-     160,    167,    185,    204,
-     224,    236,    242,    244,
-     243,    235,    218,    197,
-     179,    168,    170,    181,
-     199,    212,    221,    224,
-     222,    218,    212,    196,
-     178,    163,    156,    161,
-     176,    195,    207,    213,
-     215,    212,    208,    197,
-     176,    152,    131,    124,
-     129,    142,    156,    162,
-     161,    158,    151,    141,
-     122,     98,     74,     60,
-      59,     69,     84,     97,
-     114,    118,    113,    101,
-      88,     73,     57,     47,
-      42,     45,     56,     72,
-      87,     96,     95,     86,
-      71,     55,     40,     24,
-       9,      3,      5,     19,
-      39,     56,     61,     57,
-      48,     39,     28,     20,
-      11,      4,      6,     18,
-      39,     64,     84,     95,
-      98,     95,     88,     77,
-      67,     61,     60,     65,
-      81,    101,    120,    135,
-     143,    141,    133,    123,
-     109,     98,     92,     90,
-      97,    114,    141,    166,
-     178,    194,    201,    200,
-     197,    191,    182,    171,
-     164,    171,    190,    215,
-     235,    249,    255,    252,
-     245,    235,    222,    206,
-     188,    180,    182,    193,
-     209,    223,    231,    233,
-     228,    217,    204,    192,
-     179,    171,    169,    176,
-     190,    205,    220,    229,
-     229,    223,    212,    200,
-     185,    168,    153,    144,
-     149,    159,    172,    179,
-     177,    167,    154,    139,
-     123,    102,     85,     71,
-      68,     76,     91,    107,
-     114,    113,    111,    102,
-      88,     74,     60,     49,
-      47,     51,     61,     72,
-      82,     89,     89,     79,
-      61,     40,     25,     19,
-      16,     13,     15,     22,
-      36,     49,     56,     54,
-      42,     28,     16,      7,
-       6,      7,     12,     24,
-      42,     59,     73,     81,
-      80,     78,     72,     67,
-      58,     53,     55,     63,
-      77,     96,    111,    121,
-     128,    128,    120,    108,
-      97,     90,     91,     99,
-     109,    122,    140,    159,
-     172,    182,    188,    185,
-     179,    176,    175,    173,
-     172,    176,    189,    212,
-     233,    248,    255,    254,
-     244,    231,    219,    206,
-     195,    191,    197,    208,
-     219,    228,    234,    236,
-     233,    222,    208,    194,
-     184,    178,    179,    190,
-     202,    215,    225,    231,
-     232,    223,    211,    199,
-     190,    181,    170,    163,
-     161,    169,    178,    184,
-     183,    175,    160,    143,
-     125,    110,     95,     89,
-      87,     95,    105,    113,
-     115,    113,    106,     96,
-      85,     72,     63,     57,
-      57,     63,     69,     75,
-      80,     82,     79,     73,
-      59,     42,     28,     18,
-      16,     16,     18,     22,
-      29,     38,     41,     38,
-      27,     14,      6,      2,
-       1,      5,     11,     19,
-      33,     48,     60,     67,
-      68,     64,     60,     56,
-      54,     53,     56,     65,
-      77,     90,    102,    109,
-     112,    112,    107,     98,
-      89,     86,     88,     97,
-     109,    121,    134,    148,
-     162,    169,    176,    174,
-     169,    164,    165,    170,
-     177,    184,    195,    213,
-     234,    247,    249,    244,
-     236,    228,    220,    213,
-     208,    206,    209,    219,
-     229,    236,    239,    239,
-     234,    225,    213,    201,
-     194,    194,    199,    205,
-     214,    222,    230,    235,
-     235,    228,    215,    203,
-     194,    188,    185,    182,
-     181,    184,    190,    192,
-     188,    177,    162,    146,
-     131,    118,    109,    102,
-      99,    102,    109,    115,
-     118,    114,    106,     97,
-      87,     78,     70,     67,
-      67,     70,     74,     76,
-      79,     79,     74,     67,
-      56,     43,     32,     25,
-      21,     21,     22,     24,
-      27,     29,     30,     27,
-      21,     13,      4,      1,
-       1,      5,     13,     22,
-      31,     40,     48,     51,
-      55,     55,     53,     52,
-      51,     53,     58,     65,
-      74,     82,     90,     96,
-      97,     96,     94,     89,
-      86,     86,     90,     96,
-     104,    116,    126,    136,
-     146,    154,    155,    163,
-     161,    159,    161,    167,
-     176,    187,    200,    214,
-     227,    238,    242,    240,
-     235,    228,    223,    219,
-     217,    218,    221,    225,
-     232,    237,    238,    237,
-     232,    225,    215,    206,
-     202,    202,    207,    213,
-     219,    225,    230,    233,
-     231,    226,    219,    209,
-     203,    198,    196,    195,
-     195,    197,    197,    196,
-     190,    181,    168,    155,
-     141,    129,    121,    117,
-     114,    115,    116,    116,
-     116,    113,    107,     97,
-      94,     89,     84,     81,
-      81,     80,     79,     77,
-      73,     70,     65,     60,
-      53,     45,     38,     32,
-      29,     27,     25,     24,
-      21,     18,     15,     12,
-       9,      5,      3,      1,
-       2,      6,     10,     16,
-      21,     26,     30,     32,
-      35,     37,     39,     42,
-      44,     49,     54,     60,
-      65,     70,     74,     76,
-      78,     79,     79,     80,
-      81,     83,     88,     94,
-     102,    109,    115,    122,
-     128,    134,    140,    144,
-     152,    157,    163,    170,
-     180,    191,    201,    211,
-     218,    225,    229,    231,
-     231,    231,    230,    231,
-     231,    233,    236,    238,
-     239,    239,    239,    237,
-     234,    229,    225,    222,
-     221,    221,    223,    225,
-     228,    230,    229,    230,
-     229,    226,    222,    218,
-     214,    211,    209,    208,
-     207,    205,    201,    195,
-     189,    182,    174,    164,
-     156,    148,    142,    137,
-     133,    130,    127,    122,
-     118,    113,    108,    102,
-      94,    107,    103,    100,
-      96,     93,     90,     86,
-      80,     75,     71,     66,
-      62,     57,     51,     45,
-      40,     36,     30,     26,
-      20,     15,     11,      8,
-       5,      4,      2,      2,
-       1,      2,      3,      4,
-       7,      9,     12,     15,
-      17,     21,     26,     30,
-      33,     36,     40,     44,
-      48,     51,     53,     55,
-      57,     61,     64,     67,
-      71,     74,     77,     81,
-      85,     92,     95,    101,
-     107,    114,    121,    129,
-     136,    146,    152,    161,
-     169,    177,    185,    192,
-     199,    205,    210,    216,
-     221,    225,    228,    231,
-     233,    235,    236,    237,
-     237,    237,    236,    236,
-     237,    237,    237,    238,
-     238,    238,    239,    239,
-     239,    239,    239,    237,
-     238,    238,    237,    235,
-     232,    230,    227,    224,
-     221,    216,    210,    205,
-     199,    193,    187,    181,
-     175,    169,    163,    157,
-     151,    145,    139,    134,
-     128,    123,    118,    115,
-     112,    107,    118,    145,
-     115,    103,    137,    172,
-     138,    118,     93,    169,
-     152,    137,    134,    149,
-     145,     98,    107,    119,
-      93,     95,     70,     56,
-      47,     52,     80,     36,
-      55,     49,     64,     37,
-      22,     63,     39,     39,
-      34,     30,     45,     47,
-      43,     34,     37,     57,
-      97,    109,     98,     94,
-      90,     81,    104,    103,
-      82,    110,     98,     79,
-      70,     74,    127,     92,
-      86,     80,    113,    126,
-     118,     79,    199,    181,
-     201,    163,    192,    200,
-     176,    191,    189,    208,
-     220,    229,    213,    209,
-     232,    255,    213,    225,
-     218,    196,    214,    181,
-     216,    227,    235,    186,
-     215,    163,    195,    169,
-     173,    156,    200,    181,
-     129,    135,    129,    172,
-     149,    128,    137,    138,
-     118,    132,    143,    127,
-      75,    127,    118,    103,
-     105,    100,    130,    131,
-     109,    140,    156,    124,
-     128,    135,    160,    140,
-     138,    120,    118,    108,
-      77,     93,     91,     95,
-     100,     81,     85,     75,
-     111,     84,     68,     74,
-      65,     65,     50,     50,
-      79,     54,     37,     26,
-      45,      1,     33,     65,
-      33,     32,     16,     20,
-      29,     30,     52,     46,
-      41,     32,     43,     67,
-      94,     94,     68,     72,
-      69,    100,    158,    162,
-     150,    124,    103,    130,
-     138,    163,    176,    174,
-     146,    114,    146,    163,
-     150,    139,    133,    150,
-     171,    170,    139,    141,
-     155,    155,    153,    178,
-     173,    145,    141,    159,
-     163,    158,    163,    160,
-     162,    215,    248,    231,
-     221,    194,    175,    212,
-     210,    215,    239,    237,
-     210,    213,    189,    225,
-     206,    205,    203,    231,
-     207,    184,    164,    160,
-     196,    180,    159,    158,
-     159,    168,    179,    172,
-     159,    124,    148,    136,
-     141,    146,    128,    135,
-     121,    103,    105,    115,
-     105,    107,    117,    112,
-      91,     89,     86,    108,
-      90,     55,     83,     79,
-      62,     60,     57,     73,
-      77,     83,     52,     60,
-      49,     39,     42,     37,
-      39,     52,     41,     30,
-      25,     44,      1,     29,
-      44,     41,     48,     33,
-      26,     37,     46,     64,
-      50,     58,     52,     66,
-      91,    117,    124,     98,
-      82,     81,    113,    194,
-     197,    178,    150,    124,
-     146,    169,    198,    206,
-     199,    187,    154,    181,
-     205,    192,    154,    149,
-     174,    210,    215,    194,
-     122,    117,    131,    150,
-     190,    194,    158,    122,
-     129,    150,    163,    149,
-     153,    145,    206,    249,
-     239,    229,    198,    173,
-     198,    218,    232,    247,
-     234,    212,    205,    200,
-     222,    211,    214,    211,
-     229,    203,    199,    180,
-     171,    189,    177,    151,
-     145,    149,    162,    158,
-     147,    147,    122,    123,
-     111,    119,    139,    127,
-     114,     90,     94,     69,
-      69,     85,     98,    100,
-      76,     46,     48,     69,
-      90,     57,     29,     58,
-      68,     51,     40,     39,
-      53,     59,     53,     39,
-      69,     59,     34,     31,
-      28,     33,     46,     43,
-      38,     47,     43,      1,
-      23,     45,     53,     53,
-      44,     41,     44,     57,
-      73,     58,     80,     63,
-      72,    107,    142,    145,
-     114,     95,     98,    127,
-     223,    227,    210,    181,
-     148,    167,    196,    223,
-     229,    224,    217,    180,
-     194,    240,    222,    169,
-     149,    189,    238,    241,
-     217,    136,    100,    128,
-     144,    197,    214,    170,
-     123,    128,    161,    168,
-     142,    155,    137,    181,
-     235,    239,    225,    189,
-     157,    170,    209,    255,
-     251,    241,    216,    189,
-     195,    223,    219,    211,
-     201,    216,    188,    189,
-     178,    167,    174,    163,
-     143,    146,    150,    149,
-     115,    122,    128,    110,
-     106,     98,     98,    114,
-     105,     80,     70,     96,
-      67,     50,     64,     80,
-      80,     59,     33,     37,
-      65,     57,     37,     25,
-      47,     60,     52,     43,
-      42,     46,     52,     55,
-      61,     79,     70,     51,
-      45,     42,     40,     53,
-      62,     57,     57,     42,
-      23,     41,     53,     62,
-      66,     62,     60,     63,
-      77,     81,     77,     96,
-      87,     84,    114,    154,
-     159,    127,    110,    116,
-     147,    230,    236,    227,
-     211,    173,    175,    208,
-     236,    237,    232,    231,
-     210,    197,    239,    233,
-     188,    158,    191,    239,
-     248,    228,    140,     88,
-     117,    131,    181,    201,
-     162,    115,    120,    159,
-     145,    121,    154,    133,
-     153,    216,    231,    214,
-     173,    140,    150,    208,
-     255,    239,    228,    206,
-     180,    181,    210,    213,
-     199,    194,    199,    172,
-     170,    174,    157,    154,
-     145,    136,    137,    136,
-     126,     98,     97,    107,
-      98,     99,     97,     86,
-      89,     88,     77,     77,
-      88,     73,     55,     58,
-      69,     72,     60,     41,
-      41,     49,     37,     20,
-      17,     33,     46,     47,
-      43,     39,     37,     44,
-      57,     71,     86,     79,
-      63,     53,     45,     41,
-      55,     68,     64,     56,
-      40,     33,     46,     55,
-      63,     73,     72,     68,
-      71,     84,     89,     87,
-     101,    101,     96,    116,
-     159,    171,    145,    126,
-     131,    167,    235,    251,
-     250,    239,    202,    191,
-     220,    255,    254,    253,
-     251,    237,    215,    241,
-     251,    214,    172,    191,
-     236,    253,    229,    149,
-      85,    106,    121,    155,
-     183,    157,    107,    111,
-     146,    131,    108,    135,
-     131,    135,    194,    228,
-     210,    168,    133,    144,
-     204,    255,    242,    228,
-     210,    183,    177,    205,
-     211,    196,    193,    191,
-     167,    160,    167,    156,
-     142,    138,    132,    131,
-     127,    111,     82,     75,
-      82,     84,     90,     89,
-      75,     67,     70,     75,
-      80,     85,     74,     58,
-      49,     54,     59,     58,
-      45,     35,     31,     20,
-      27,     26,     38,     52,
-      61,     62,     57,     51,
-      55,     68,     82,     96,
-      95,     82,     67,     59,
-      58,     67,     76,     76,
-      69,     59,     56,     62,
-      72,     79,     86,     88,
-      84,     86,     94,    100,
-     103,    109,    111,    109,
-     121,    150,    168,    163,
-     146,    146,    171,    216,
-     245,    253,    240,    214,
-     199,    211,    240,    255,
-     254,    245,    234,    222,
-     230,    238,    217,    183,
-     180,    203,    220,    206,
-     158,    106,     99,    113,
-     130,    150,    144,    115,
-     104,    121,    122,    108,
-     113,    119,    126,    162,
-     198,    195,    168,    143,
-     145,    184,    225,    226,
-     212,    196,    179,    173,
-     186,    192,    185,    178,
-     172,    160,    156,    157,
-     148,    133,    125,    126,
-     125,    121,    104,     80,
-      70,     74,     82,     89,
-      88,     80,     71,     69,
-      76,     88,     91,     83,
-      70,     57,     52,     55,
-      60,     58,     51,     40,
-      27,     26,     23,     31,
-      46,     62,     69,     67,
-      60,     59,     67,     82,
-      97,     99,     88,     74,
-      62,     60,     67,     74,
-      76,     74,     67,     62,
-      68,     76,     83,     91,
-      96,     95,     96,    100,
-     107,    111,    115,    116,
-     118,    130,    153,    173,
-     176,    166,    163,    179,
-     213,    241,    254,    245,
-     226,    211,    213,    231,
-     249,    255,    246,    240,
-     234,    237,    240,    227,
-     199,    184,    191,    203,
-     198,    171,    125,    106,
-     110,    123,    138,    139,
-     123,    107,    110,    116,
-     112,    109,    110,    118,
-     146,    180,    191,    176,
-     158,    156,    179,    211,
-     223,    214,    199,    181,
-     171,    174,    183,    181,
-     174,    165,    157,    151,
-     151,    142,    127,    115,
-     114,    115,    111,     97,
-      78,     64,     64,     75,
-      86,     88,     82,     72,
-      66,     69,     80,     87,
-      82,     70,     53,     41,
-      41,     48,     52,     50,
-      39,     26,      1,      1,
-       5,     13,     22,     34,
-      45,     56,     64,     72,
-      77,     79,     77,     72,
-      66,     58,     52,     45,
-      40,     38,     37,     37,
-      40,     46,     55,     64,
-      72,     78,     85,     92,
-      98,    103,    107,    111,
-     116,    123,    131,    141,
-     152,    162,    171,    182,
-     192,    202,    207,    212,
-     214,    215,    215,    215,
-     214,    212,    210,    204,
-     199,    191,    183,    173,
-     162,    148,    135,    129,
-     125,    123,    122,    118,
-     121,    125,    129,    132,
-     131,    129,    127,    125,
-     124,    126,    130,    137,
-     146,    161,    180,    197,
-     210,    221,    231,    240,
-     246,    247,    245,    242,
-     237,    231,    225,    221,
-     217,    211,    204,    197,
-     189,    183,    173,    163,
-     151,    139,    127,    118,
-     110,    104,     99,     97,
-      98,    102,    106,    109,
-     112,    114,    116,    114,
-     109,    101,     91,     78,
-      64,     50,     36,     25,
-      13,      5,      1,      7,
-       1,      6,     20,     38,
-      59,     78,     94,    110,
-     125,    136,    143,    142,
-     134,    122,    107,     91,
-      75,     59,     46,     38,
-      34,     38,     46,     56,
-      67,     76,     84,     94,
-     106,    115,    120,    115,
-     106,     97,     91,     91,
-      98,    106,    113,    119,
-     126,    135,    149,    163,
-     177,    189,    194,    190,
-     181,    165,    146,    123,
-      99,     81,     67,     57,
-      46,     36,     24,     22,
-      34,     65,    105,    147,
-     173,    191,    197,    202,
-     210,    219,    227,    231,
-     225,    208,    186,    166,
-     158,    162,    176,    195,
-     209,    215,    215,    216,
-     219,    225,    230,    235,
-     237,    233,    222,    209,
-     197,    185,    179,    173,
-     169,    165,    159,    150,
-     139,    128,    119,    116,
-     116,    116,    114,    112,
-     114,    118,    124,    129,
-     137,    144,    152,    158,
-     160,    157,    148,    135,
-     116,     98,     79,     63,
-      49,     34,     19,      7,
-      78,     68,     70,     83,
-     101,    119,    134,    148,
-     161,    171,    178,    184,
-     184,    178,    168,    155,
-     139,    119,    100,     82,
-      73,     70,     75,     84,
-      94,    101,    106,    110,
-     118,    129,    140,    149,
-     149,    140,    124,    106,
-      93,     91,    100,    116,
-     130,    141,    147,    153,
-     161,    175,    191,    208,
-     219,    218,    200,    167,
-     123,     81,     51,     39,
-      39,     42,     37,     20,
-       2,      1,     30,     85,
-     150,    201,    228,    231,
-     220,    208,    204,    210,
-     220,    220,    199,    162,
-     117,     81,     62,     65,
-      83,    103,    116,    118,
-     117,    114,    116,    122,
-     134,    149,    159,    157,
-     146,    129,    115,    108,
-     108,    116,    125,    133,
-     136,    134,    128,    125,
-     127,    133,    138,    141,
-     141,    139,    136,    131,
-     128,    129,    134,    142,
-     149,    154,    156,    152,
-     145,    136,    127,    120,
-     113,    108,    101,     91,
-      78,    117,    113,    110,
-     107,    103,    100,     97,
-      94,     92,     89,     88,
-      87,     86,     85,     85,
-      85,     85,     86,     87,
-      88,     89,     90,     92,
-      93,     94,     95,     96,
-      95,     95,     95,     94,
-      92,     90,     87,     85,
-      81,     77,     74,     69,
-      65,     61,     56,     52,
-      49,     46,     43,     41,
-      39,     38,     39,     39,
-      42,     45,     48,     53,
-      59,     66,     74,     83,
-      92,    102,    112,    124,
-     136,    148,    159,    171,
-     182,    193,    203,    213,
-     221,    230,    237,    242,
-     247,    251,    253,    255,
-     255,    254,    253,    249,
-     245,    241,    235,    229,
-     222,    215,    207,    200,
-     192,    185,    178,    170,
-     164,    157,    152,    147,
-     143,    139,    136,    133,
-     131,    130,    129,    129,
-     129,    130,    131,    132,
-     133,    134,    136,    136,
-     137,    138,    138,    138,
-     138,    137,    135,    134,
-     132,    129,    127,    124,
-     121,    117,    124,    119,
-     113,    108,    104,     99,
-      95,     91,     88,     86,
-      84,     83,     83,     83,
-      84,     86,     88,     91,
-      94,     98,    101,    105,
-     109,    112,    115,    117,
-     119,    121,    122,    122,
-     121,    120,    117,    114,
-     110,    105,     99,     93,
-      87,     80,     72,     65,
-      58,     51,     45,     39,
-      34,     30,     26,     24,
-      23,     24,     25,     28,
-      33,     38,     45,     53,
-      63,     73,     85,     97,
-     110,    123,    137,    150,
-     164,    176,    189,    201,
-     212,    222,    231,    239,
-     245,    249,    253,    255,
-     255,    254,    252,    249,
-     244,    238,    231,    224,
-     216,    207,    197,    188,
-     179,    170,    162,    154,
-     147,    140,    134,    130,
-     126,    123,    121,    119,
-     119,    120,    121,    123,
-     125,    128,    131,    135,
-     138,    142,    145,    148,
-     151,    153,    155,    156,
-     156,    155,    154,    152,
-     149,    147,    143,    139,
-     134,    129,    124,    129,
-     129,    129,    128,    128,
-     127,    126,    124,    121,
-     119,    115,    112,    109,
-     105,    102,     99,     96,
-      94,     93,     92,     92,
-      92,     93,     95,     98,
-     101,    104,    108,    112,
-     116,    119,    122,    125,
-     125,    126,    125,    123,
-     120,    115,    109,    101,
-      94,     85,     76,     66,
-      56,     46,     37,     29,
-      22,     16,     13,     10,
-      10,     12,     16,     23,
-      32,     42,     54,     69,
-      85,    101,    118,    136,
-     153,    169,    185,    201,
-     215,    226,    236,    244,
-     250,    254,    255,    255,
-     252,    248,    242,    235,
-     227,    218,    208,    198,
-     188,    179,    170,    162,
-     155,    149,    143,    140,
-     137,    135,    134,    134,
-     135,    136,    138,    140,
-     142,    144,    145,    147,
-     147,    148,    148,    147,
-     147,    145,    144,    142,
-     140,    137,    135,    133,
-     131,    129,    128,    127,
-     126,    126,    126,    126,
-     127,    127,    128,    129,
-     155,    151,    139,    122,
-     110,    106,    110,    120,
-     129,    135,    133,    126,
-     117,    110,    105,    103,
-     101,     99,     97,     95,
-      97,    100,    105,    109,
-     109,    107,    103,    102,
-     107,    117,    128,    138,
-     141,    135,    124,    111,
-     103,    103,    109,    118,
-     122,    119,    106,     87,
-      65,     48,     35,     29,
-      27,     27,     28,     28,
-      30,     32,     34,     34,
-      32,     29,     29,     35,
-      52,     78,    109,    138,
-     160,    171,    173,    172,
-     174,    183,    199,    219,
-     238,    251,    255,    252,
-     246,    239,    233,    228,
-     222,    214,    205,    195,
-     187,    182,    177,    171,
-     162,    150,    138,    130,
-     127,    131,    139,    145,
-     146,    141,    131,    121,
-     117,    122,    135,    150,
-     164,    168,    165,    154,
-     142,    132,    128,    129,
-     133,    137,    141,    143,
-     145,    145,    143,    138,
-     129,    117,    107,    102,
-     106,    118,    134,    149,
-     155,    146,    163,    167,
-     157,    139,    123,    115,
-     118,    128,    139,    146,
-     146,    141,    133,    127,
-     122,    118,    113,    105,
-      96,     89,     88,     93,
-     103,    111,    114,    108,
-      98,     88,     86,     93,
-     108,    123,    131,    129,
-     116,     99,     86,     80,
-      85,     95,    102,    102,
-      92,     74,     55,     38,
-      27,     21,     19,     16,
-      15,     16,     21,     30,
-      41,     50,     52,     49,
-      42,     42,     53,     78,
-     114,    151,    180,    196,
-     198,    193,    188,    190,
-     201,    219,    238,    251,
-     255,    252,    246,    240,
-     234,    229,    220,    208,
-     194,    182,    176,    175,
-     178,    180,    176,    165,
-     149,    135,    130,    134,
-     147,    161,    169,    168,
-     156,    142,    132,    132,
-     141,    156,    169,    175,
-     170,    158,    143,    132,
-     124,    122,    121,    119,
-     117,    117,    120,    125,
-     131,    132,    126,    114,
-      98,     87,     87,     99,
-     122,    146,    143,    185,
-     207,    203,    181,    153,
-     134,    131,    144,    164,
-     181,    189,    187,    178,
-     167,    158,    148,    136,
-     118,     97,     79,     70,
-      75,     89,    104,    109,
-      99,     75,     50,     34,
-      35,     54,     82,    105,
-     112,     98,     74,     48,
-      35,     41,     58,     80,
-      93,     93,     78,     57,
-      37,     23,     16,     14,
-      11,      9,     11,     20,
-      37,     58,     76,     81,
-      70,     49,     31,     29,
-      50,     94,    149,    196,
-     223,    225,    208,    186,
-     171,    174,    192,    218,
-     240,    253,    255,    250,
-     244,    239,    234,    225,
-     210,    192,    177,    172,
-     179,    195,    212,    219,
-     210,    189,    163,    148,
-     150,    170,    197,    220,
-     225,    211,    185,    159,
-     145,    147,    163,    182,
-     192,    189,    171,    146,
-     123,    105,     95,     88,
-      81,     74,     71,     75,
-      87,    103,    115,    115,
-      99,     73,     49,     41,
-      57,     94,    143,    132,
-     163,    178,    172,    152,
-     135,    133,    149,    177,
-     200,    205,    189,    160,
-     132,    119,    126,    144,
-     159,    158,    137,    104,
-      74,     61,     69,     90,
-     109,    113,     98,     72,
-      49,     42,     56,     83,
-     108,    116,    103,     78,
-      55,     48,     60,     83,
-     104,    107,     90,     60,
-      32,     20,     29,     50,
-      70,     73,     58,     31,
-       9,      4,     21,     51,
-      81,     96,     91,     76,
-      65,     70,     96,    136,
-     171,    190,    189,    175,
-     162,    164,    185,    217,
-     245,    255,    243,    217,
-     193,    184,    194,    216,
-     235,    237,    218,    187,
-     160,    149,    159,    183,
-     203,    209,    195,    169,
-     147,    141,    156,    183,
-     207,    214,    201,    174,
-     150,    142,    152,    174,
-     192,    193,    173,    140,
-     110,     95,    100,    118,
-     134,    134,    114,     84,
-      57,     48,     60,     87,
-     112,    121,    113,     93,
-      76,     77,     98,    132,
-     128,    146,    162,    178,
-     193,    205,    216,    224,
-     230,    234,    234,    232,
-     229,    223,    215,    205,
-     195,    184,    172,    160,
-     149,    139,    130,    122,
-     115,    110,    106,    103,
-     102,    103,    104,    105,
-     107,    109,    111,    112,
-     113,    112,    110,    107,
-     102,     96,     89,     80,
-      71,     60,     50,     40,
-      30,     21,     13,      7,
-       3,      2,      2,      5,
-      10,     18,     29,     42,
-      57,     74,     91,    110,
-     130,    149,    167,    185,
-     202,    217,    229,    239,
-     247,    252,    255,    255,
-     253,    248,    242,    234,
-     225,    216,    205,    195,
-     185,    175,    167,    160,
-     154,    149,    147,    145,
-     144,    144,    145,    147,
-     149,    151,    153,    154,
-     154,    152,    150,    146,
-     140,    133,    125,    116,
-     105,     94,     82,     70,
-      59,     49,     40,     32,
-      26,     22,     21,     22,
-      26,     32,     41,     51,
-      64,     79,     95,    111,
-     128,    129,    150,    170,
-     190,    208,    223,    235,
-     245,    252,    255,    255,
-     252,    246,    237,    226,
-     213,    200,    185,    171,
-     156,    143,    131,    121,
-     113,    107,    103,    102,
-     102,    105,    109,    115,
-     121,    128,    136,    142,
-     148,    152,    154,    154,
-     153,    149,    143,    134,
-     124,    112,     99,     84,
-      69,     55,     41,     29,
-      18,     10,      4,      1,
-       1,      5,     12,     22,
-      34,     50,     68,     87,
-     108,    129,    150,    170,
-     190,    208,    223,    235,
-     245,    252,    255,    255,
-     252,    246,    237,    226,
-     213,    200,    185,    171,
-     156,    143,    131,    121,
-     113,    107,    103,    102,
-     102,    105,    109,    115,
-     121,    128,    136,    142,
-     148,    152,    154,    155,
-     153,    149,    143,    134,
-     124,    112,     99,     84,
-      70,     55,     41,     29,
-      18,     10,      4,      1,
-       1,      5,     12,     22,
-      34,     50,     68,     87,
-     108,    129,    123,    149,
-     167,    173,    171,    169,
-     173,    188,    209,    228,
-     236,    230,    213,    193,
-     180,    177,    180,    184,
-     179,    164,    141,    120,
-     109,    110,    121,    133,
-     138,    130,    116,    101,
-      95,    100,    114,    127,
-     133,    128,    114,    101,
-      95,    101,    114,    124,
-     126,    114,     92,     69,
-      54,     49,     54,     59,
-      57,     46,     28,     14,
-      10,     20,     40,     62,
-      78,     82,     80,     78,
-      85,    104,    131,    158,
-     177,    185,    184,    182,
-     188,    204,    226,    246,
-     255,    250,    233,    215,
-     202,    200,    204,    208,
-     205,    189,    167,    146,
-     136,    137,    148,    160,
-     165,    158,    143,    128,
-     122,    127,    140,    153,
-     159,    153,    139,    125,
-     118,    123,    135,    145,
-     145,    133,    110,     86,
-      69,     64,     67,     71,
-      68,     55,     37,     21,
-      15,     24,     43,     64,
-      78,     82,     78,     75,
-      80,     97,    123,    116,
-     146,    168,    179,    179,
-     168,    152,    136,    124,
-     119,    124,    136,    152,
-     167,    177,    179,    172,
-     158,    138,    117,     99,
-      85,     79,     79,     84,
-      94,    105,    114,    120,
-     121,    118,    109,     99,
-      86,     76,     69,     67,
-      71,     80,     92,    103,
-     111,    111,    103,     88,
-      65,     41,     19,      5,
-       1,      8,     24,     45,
-      65,     80,     86,     82,
-      72,     59,     48,     46,
-      56,     78,    110,    147,
-     181,    210,    227,    232,
-     226,    213,    201,    192,
-     190,    197,    210,    227,
-     242,    252,    253,    246,
-     230,    209,    187,    166,
-     151,    143,    142,    147,
-     155,    166,    175,    181,
-     182,    179,    172,    162,
-     152,    142,    137,    137,
-     143,    153,    166,    179,
-     187,    189,    181,    165,
-     142,    116,     93,     76,
-      70,     73,     84,    100,
-     114,    123,    122,    113,
-      95,     74,     57,     47,
-      49,     63,     88,    116,
-     117,    142,    159,    163,
-     154,    135,    110,     87,
-      72,     69,     78,     98,
-     121,    143,    158,    165,
-     160,    149,    134,    121,
-     112,    109,    113,    121,
-     131,    141,    147,    149,
-     148,    143,    136,    127,
-     116,    105,     93,     82,
-      73,     67,     66,     69,
-      75,     82,     86,     84,
-      76,     60,     41,     20,
-       6,      1,      8,     26,
-      50,     78,     99,    111,
-     112,    101,     84,     67,
-      58,     61,     78,    108,
-     144,    177,    204,    218,
-     218,    206,    186,    169,
-     158,    159,    170,    189,
-     213,    234,    247,    249,
-     241,    225,    205,    185,
-     171,    163,    162,    165,
-     170,    175,    178,    178,
-     174,    167,    160,    151,
-     142,    133,    125,    118,
-     113,    112,    116,    125,
-     137,    149,    158,    161,
-     156,    145,    129,    111,
-      97,     92,     98,    113,
-     134,    156,    171,    177,
-     169,    150,    123,     97,
-      77,     69,     75,     93,
-     117,    121,    162,    185,
-     184,    161,    125,     90,
-      68,     61,     69,     85,
-     103,    119,    132,    145,
-     154,    159,    155,    141,
-     121,    100,     90,     94,
-     113,    138,    159,    169,
-     163,    146,    129,    117,
-     116,    121,    124,    118,
-     102,     79,     58,     50,
-      56,     73,     92,    102,
-      97,     79,     52,     27,
-       8,      1,      3,     10,
-      22,     37,     57,     79,
-     100,    114,    112,     96,
-      68,     43,     33,     47,
-      87,    140,    191,    227,
-     237,    224,    197,    171,
-     155,    154,    167,    186,
-     205,    222,    235,    245,
-     251,    251,    242,    222,
-     195,    168,    151,    148,
-     159,    178,    194,    198,
-     188,    168,    148,    136,
-     134,    139,    144,    142,
-     129,    111,     96,     93,
-     105,    129,    155,    172,
-     175,    162,    141,    120,
-     105,    100,    103,    111,
-     122,    134,    149,    167,
-     182,    187,    176,    150,
-     112,     75,     53,     55,
-      81,    121,    126,    177,
-     206,    202,    170,    123,
-      83,     61,     62,     79,
-     100,    119,    129,    135,
-     142,    151,    161,    162,
-     152,    132,    109,     95,
-      97,    116,    142,    160,
-     159,    139,    107,     79,
-      70,     82,    109,    134,
-     143,    128,     97,     62,
-      39,     37,     52,     74,
-      88,     84,     65,     38,
-      15,      2,      2,      9,
-      17,     24,     31,     45,
-      67,     94,    117,    123,
-     108,     76,     41,     22,
-      32,     75,    138,    198,
-     238,    245,    222,    185,
-     152,    138,    145,    167,
-     193,    213,    226,    233,
-     240,    248,    255,    254,
-     240,    216,    189,    170,
-     167,    182,    202,    216,
-     212,    188,    153,    124,
-     113,    124,    151,    177,
-     188,    176,    147,    116,
-      97,     99,    119,    145,
-     164,    166,    150,    127,
-     106,     96,     97,    105,
-     112,    118,    123,    132,
-     150,    170,    186,    185,
-     162,    120,     74,     44,
-      44,     75,    126,    134,
-     184,    215,    219,    199,
-     163,    128,    104,     96,
-      99,    106,    112,    114,
-     116,    120,    128,    136,
-     138,    129,    113,     93,
-      80,     81,     96,    118,
-     137,    144,    136,    119,
-     104,    100,    112,    133,
-     153,    161,    153,    132,
-     109,     95,     94,    106,
-     120,    126,    117,     97,
-      70,     47,     34,     32,
-      36,     42,     47,     50,
-      56,     67,     81,     92,
-      91,     77,     52,     29,
-      20,     37,     81,    141,
-     200,    241,    255,    242,
-     215,    187,    170,    166,
-     174,    184,    192,    195,
-     196,    200,    205,    209,
-     207,    194,    172,    146,
-     128,    122,    132,    148,
-     162,    164,    151,    131,
-     113,    108,    118,    139,
-     160,    171,    165,    147,
-     129,    119,    124,    141,
-     161,    173,    171,    156,
-     134,    115,    106,    107,
-     114,    122,    126,    129,
-     133,    141,    150,    156,
-     149,    127,     94,     61,
-      44,     51,     85,    134,
-      24,     25,     27,     28,
-      29,     31,     32,     33,
-      34,     36,     37,     38,
-      40,     41,     42,     44,
-      45,     47,     48,     49,
-      51,     52,     54,     55,
-      57,     58,     60,     61,
-      63,     64,     66,     67,
-      69,     70,     72,     73,
-      75,     76,     78,     80,
-      81,     83,     84,     86,
-      88,     89,     91,     93,
-      94,     96,     98,     99,
-     101,    103,    104,    106,
-     108,    110,    111,    113,
-     115,    117,    119,    120,
-     122,    124,    126,    128,
-     130,    131,    133,    135,
-     137,    139,    141,    143,
-     145,    147,    149,    151,
-     153,    154,    156,    158,
-     160,    162,    164,    167,
-     169,    171,    173,    175,
-     177,    179,    181,    183,
-     185,    187,    189,    192,
-     194,    196,    198,    200,
-     202,    205,    207,    209,
-     211,    213,    216,    218,
-     220,    222,    225,    227,
-     229,    232,    234,    236,
-     238,    241,    243,    245,
-     248,    250,    253,    255,
-      24,      2,      2,      2,
-       2,      2,      2,      2,
-       2,      2,      2,      2,
-       2,      2,      2,      2,
-       2,      2,      2,      2,
-       2,      2,      2,      2,
-       2,      2,      2,      2,
-       2,      2,      2,      2,
-       2,      2,      2,      2,
-       2,      2,      2,      2,
-       2,      2,      2,      2,
-       2,      2,      2,      2,
-       2,      2,      2,      2,
-       2,      2,      2,      2,
-       2,      2,      2,      2,
-       2,      2,      2,      2,
-       2,    128,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,      2,      0,      6,
-      13,     19,     25,     31,
-      38,     44,     50,     55,
-      61,     67,     72,     77,
-      82,     87,     92,     96,
-     100,    104,    108,    111,
-     114,    117,    120,    122,
-     124,    126,    127,    128,
-     129,    129,    130,    129,
-     129,    128,    127,    126,
-     124,    122,    120,    117,
-     114,    111,    108,    104,
-     100,     96,     92,     87,
-      82,     77,     72,     67,
-      61,     55,     50,     44,
-      38,     31,     25,     19,
-      13,      6,      0,    253,
-     246,    240,    234,    228,
-     221,    215,    209,    204,
-     198,    192,    187,    182,
-     177,    172,    167,    163,
-     159,    155,    151,    148,
-     145,    142,    139,    137,
-     135,    133,    132,    131,
-     130,    130,    130,    130,
-     130,    131,    132,    133,
-     135,    137,    139,    142,
-     145,    148,    151,    155,
-     159,    163,    167,    172,
-     177,    182,    187,    192,
-     198,    204,    209,    215,
-     221,    228,    234,    240,
-     246,    253,      0,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    176,
-     176,    176,    176,    176,
-     176,    176,    176,    218,
-     218,    218,    218,    218,
-     218,    218,    218,    245,
-     245,    245,    245,    245,
-     245,    245,    245,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    245,
-     245,    245,    245,    245,
-     245,    245,    245,    218,
-     218,    218,    218,    218,
-     218,    218,    218,    176,
-     176,    176,    176,    176,
-     176,    176,    176,    128,
-     128,    128,    128,    128,
-     128,    128,    128,     79,
-      79,     79,     79,     79,
-      79,     79,     79,     37,
-      37,     37,     37,     37,
-      37,     37,     37,     10,
-      10,     10,     10,     10,
-      10,     10,     10,      0,
-       0,      0,      0,      0,
-       0,      0,      0,     10,
-      10,     10,     10,     10,
-      10,     10,     10,     37,
-      37,     37,     37,     37,
-      37,     37,     37,     79,
-      79,     79,     79,     79,
-      79,     79,     79,    128,
-     127,    134,    140,    146,
-     152,    158,    165,    170,
-     176,    182,    188,    193,
-     198,    203,    208,    213,
-     218,    222,    226,    230,
-     234,    237,    240,    243,
-     245,    248,    250,    251,
-     253,    254,    254,    255,
-     255,    255,    254,    254,
-     253,    251,    250,    248,
-     245,    243,    240,    237,
-     234,    230,    226,    222,
-     218,    213,    208,    203,
-     198,    193,    188,    182,
-     176,    170,    165,    158,
-     152,    146,    140,    134,
-     128,    121,    115,    109,
-     103,     97,     90,     85,
-      79,     73,     67,     62,
-      57,     52,     47,     42,
-      37,     33,     29,     25,
-      21,     18,     15,     12,
-      10,      7,      5,      4,
-       2,      1,      1,      0,
-       0,      0,      1,      1,
-       2,      4,      5,      7,
-      10,     12,     15,     18,
-      21,     25,     29,     33,
-      37,     42,     47,     52,
-      57,     62,     67,     73,
-      79,     85,     90,     97,
-     103,    109,    115,    121,
-     127,    128,    128,    128,
-     128,    128,    129,    131,
-     132,    135,    137,    141,
-     145,    149,    154,    160,
-     166,    173,    179,    186,
-     194,    201,    208,    215,
-     222,    228,    234,    239,
-     244,    248,    251,    253,
-     255,    255,    255,    253,
-     251,    248,    244,    239,
-     234,    228,    222,    215,
-     208,    201,    194,    186,
-     179,    173,    166,    160,
-     154,    149,    145,    141,
-     137,    135,    132,    131,
-     129,    128,    128,    128,
-     128,    128,    127,    127,
-     127,    127,    126,    124,
-     123,    120,    118,    114,
-     110,    106,    101,     95,
-      89,     82,     76,     69,
-      61,     54,     47,     40,
-      33,     27,     21,     16,
-      11,      7,      4,      2,
-       0,      0,      0,      2,
-       4,      7,     11,     16,
-      21,     27,     33,     40,
-      47,     54,     61,     69,
-      76,     82,     89,     95,
-     101,    106,    110,    114,
-     118,    120,    123,    124,
-     126,    127,    127,    127,
-     127,    128,    128,    128,
-     128,    128,    128,    128,
-     128,    128,    129,    129,
-     130,    132,    134,    137,
-     141,    145,    150,    156,
-     163,    170,    178,    187,
-     196,    204,    213,    222,
-     230,    237,    243,    248,
-     252,    254,    255,    254,
-     252,    248,    243,    237,
-     230,    222,    213,    204,
-     196,    187,    178,    170,
-     163,    156,    150,    145,
-     141,    137,    134,    132,
-     130,    129,    129,    128,
-     128,    128,    128,    128,
-     128,    128,    128,    127,
-     127,    127,    127,    127,
-     127,    127,    126,    126,
-     125,    123,    121,    118,
-     114,    110,    105,     99,
-      92,     85,     77,     68,
-      59,     51,     42,     33,
-      25,     18,     12,      7,
-       3,      1,      0,      1,
-       3,      7,     12,     18,
-      25,     33,     42,     51,
-      59,     68,     77,     85,
-      92,     99,    105,    110,
-     114,    118,    121,    123,
-     125,    126,    126,    127,
-     127,    127,    127,    127,
-     127,    127,    128,      0,
-       4,      8,     12,     16,
-      20,     24,     28,     32,
-      36,     40,     45,     49,
-      53,     57,     61,     65,
-      69,     73,     77,     81,
-      85,     89,     93,     97,
-     101,    105,    109,    113,
-     117,    121,    125,    130,
-     134,    138,    142,    146,
-     150,    154,    158,    162,
-     166,    170,    174,    178,
-     182,    186,    190,    194,
-     198,    202,    206,    210,
-     215,    219,    223,    227,
-     231,    235,    239,    243,
-     247,    251,    255,    255,
-     251,    247,    243,    239,
-     235,    231,    227,    223,
-     219,    215,    210,    206,
-     202,    198,    194,    190,
-     186,    182,    178,    174,
-     170,    166,    162,    158,
-     154,    150,    146,    142,
-     138,    134,    130,    125,
-     121,    117,    113,    109,
-     105,    101,     97,     93,
-      89,     85,     81,     77,
-      73,     69,     65,     61,
-      57,     53,     49,     45,
-      40,     36,     32,     28,
-      24,     20,     16,     12,
-       8,      4,      0,      0,
-      24,     26,     29,     32,
-      34,     37,     40,     42,
-      45,     48,     51,     54,
-      57,     60,     63,     66,
-      69,     72,     75,     78,
-      81,     85,     88,     91,
-      95,     98,    102,    105,
-     109,    112,    116,    119,
-     123,    127,    131,    134,
-     138,    142,    146,    150,
-     154,    158,    162,    166,
-     170,    174,    178,    182,
-     187,    191,    195,    200,
-     204,    209,    213,    218,
-     222,    227,    231,    236,
-     241,    245,    250,    255,
-      24,     26,     29,     32,
-      34,     37,     40,     42,
-      45,     48,     51,     54,
-      57,     60,     63,     66,
-      69,     72,     75,     78,
-      81,     85,     88,     91,
-      95,     98,    102,    105,
-     109,    112,    116,    119,
-     123,    127,    131,    134,
-     138,    142,    146,    150,
-     154,    158,    162,    166,
-     170,    174,    178,    182,
-     187,    191,    195,    200,
-     204,    209,    213,    218,
-     222,    227,    231,    236,
-     241,    245,    250,    255,
-      24,      4,      4,      4,
-       4,      4,      4,      4,
-       4,      4,      4,      4,
-       4,      4,      4,      4,
-       4,      4,      4,      4,
-       4,      4,      4,      4,
-       4,      4,      4,      4,
-       4,      4,      4,      4,
-       4,    129,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,      4,      4,      4,
-       4,      4,      4,      4,
-       4,      4,      4,      4,
-       4,      4,      4,      4,
-       4,      4,      4,      4,
-       4,      4,      4,      4,
-       4,      4,      4,      4,
-       4,      4,      4,      4,
-       4,    129,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,    255,    255,    255,
-     255,      4,      0,     13,
-      26,     38,     50,     62,
-      73,     83,     93,    102,
-     109,    116,    122,    126,
-     129,    131,    132,    131,
-     129,    126,    122,    116,
-     109,    102,     93,     83,
-      73,     62,     50,     38,
-      26,     13,      0,    250,
-     238,    225,    213,    201,
-     190,    180,    170,    161,
-     154,    147,    142,    137,
-     134,    132,    132,    132,
-     134,    137,    142,    147,
-     154,    161,    170,    180,
-     190,    201,    213,    225,
-     238,    250,      0,     13,
-      26,     38,     50,     62,
-      73,     83,     93,    102,
-     109,    116,    122,    126,
-     129,    131,    132,    131,
-     129,    126,    122,    116,
-     109,    102,     93,     83,
-      73,     62,     50,     38,
-      26,     13,      0,    250,
-     238,    225,    213,    201,
-     190,    180,    170,    161,
-     154,    147,    142,    137,
-     134,    132,    132,    132,
-     134,    137,    142,    147,
-     154,    161,    170,    180,
-     190,    201,    213,    225,
-     238,    250,      0,    128,
-     128,    128,    128,    176,
-     176,    176,    176,    218,
-     218,    218,    218,    245,
-     245,    245,    245,    255,
-     255,    255,    255,    245,
-     245,    245,    245,    218,
-     218,    218,    218,    176,
-     176,    176,    176,    128,
-     128,    128,    128,     79,
-      79,     79,     79,     37,
-      37,     37,     37,     10,
-      10,     10,     10,      0,
-       0,      0,      0,     10,
-      10,     10,     10,     37,
-      37,     37,     37,     79,
-      79,     79,     79,    128,
-     128,    128,    128,    176,
-     176,    176,    176,    218,
-     218,    218,    218,    245,
-     245,    245,    245,    255,
-     255,    255,    255,    245,
-     245,    245,    245,    218,
-     218,    218,    218,    176,
-     176,    176,    176,    128,
-     128,    128,    128,     79,
-      79,     79,     79,     37,
-      37,     37,     37,     10,
-      10,     10,     10,      0,
-       0,      0,      0,     10,
-      10,     10,     10,     37,
-      37,     37,     37,     79,
-      79,     79,     79,    128,
-     128,    140,    152,    165,
-     176,    188,    198,    208,
-     218,    226,    234,    240,
-     245,    250,    253,    254,
-     255,    254,    253,    250,
-     245,    240,    234,    226,
-     218,    208,    198,    188,
-     176,    165,    152,    140,
-     128,    115,    103,     90,
-      79,     67,     57,     47,
-      37,     29,     21,     15,
-      10,      5,      2,      1,
-       0,      1,      2,      5,
-      10,     15,     21,     29,
-      37,     47,     57,     67,
-      79,     90,    103,    115,
-     128,    140,    152,    165,
-     176,    188,    198,    208,
-     218,    226,    234,    240,
-     245,    250,    253,    254,
-     255,    254,    253,    250,
-     245,    240,    234,    226,
-     218,    208,    198,    188,
-     176,    165,    152,    140,
-     128,    115,    103,     90,
-      79,     67,     57,     47,
-      37,     29,     21,     15,
-      10,      5,      2,      1,
-       0,      1,      2,      5,
-      10,     15,     21,     29,
-      37,     47,     57,     67,
-      79,     90,    103,    115,
-     128,    128,    128,    128,
-     131,    135,    141,    149,
-     160,    173,    186,    201,
-     215,    228,    239,    248,
-     253,    255,    253,    248,
-     239,    228,    215,    201,
-     186,    173,    160,    149,
-     141,    135,    131,    128,
-     128,    128,    127,    127,
-     124,    120,    114,    106,
-      95,     82,     69,     54,
-      40,     27,     16,      7,
-       2,      0,      2,      7,
-      16,     27,     40,     54,
-      69,     82,     95,    106,
-     114,    120,    124,    127,
-     127,    128,    128,    128,
-     131,    135,    141,    149,
-     160,    173,    186,    201,
-     215,    228,    239,    248,
-     253,    255,    253,    248,
-     239,    228,    215,    201,
-     186,    173,    160,    149,
-     141,    135,    131,    128,
-     128,    128,    127,    127,
-     124,    120,    114,    106,
-      95,     82,     69,     54,
-      40,     27,     16,      7,
-       2,      0,      2,      7,
-      16,     27,     40,     54,
-      69,     82,     95,    106,
-     114,    120,    124,    127,
-     127,    128,    128,    128,
-     128,    128,    129,    130,
-     134,    141,    150,    163,
-     178,    196,    213,    230,
-     243,    252,    255,    252,
-     243,    230,    213,    196,
-     178,    163,    150,    141,
-     134,    130,    129,    128,
-     128,    128,    128,    127,
-     127,    127,    126,    125,
-     121,    114,    105,     92,
-      77,     59,     42,     25,
-      12,      3,      0,      3,
-      12,     25,     42,     59,
-      77,     92,    105,    114,
-     121,    125,    126,    127,
-     127,    127,    128,    128,
-     128,    128,    129,    130,
-     134,    141,    150,    163,
-     178,    196,    213,    230,
-     243,    252,    255,    252,
-     243,    230,    213,    196,
-     178,    163,    150,    141,
-     134,    130,    129,    128,
-     128,    128,    128,    127,
-     127,    127,    126,    125,
-     121,    114,    105,     92,
-      77,     59,     42,     25,
-      12,      3,      0,      3,
-      12,     25,     42,     59,
-      77,     92,    105,    114,
-     121,    125,    126,    127,
-     127,    127,    128,      0,
-       8,     16,     24,     32,
-      40,     49,     57,     65,
-      73,     81,     89,     97,
-     105,    113,    121,    130,
-     138,    146,    154,    162,
-     170,    178,    186,    194,
-     202,    210,    219,    227,
-     235,    243,    251,    255,
-     247,    239,    231,    223,
-     215,    206,    198,    190,
-     182,    174,    166,    158,
-     150,    142,    134,    125,
-     117,    109,    101,     93,
-      85,     77,     69,     61,
-      53,     45,     36,     28,
-      20,     12,      4,      0,
-       8,     16,     24,     32,
-      40,     49,     57,     65,
-      73,     81,     89,     97,
-     105,    113,    121,    130,
-     138,    146,    154,    162,
-     170,    178,    186,    194,
-     202,    210,    219,    227,
-     235,    243,    251,    255,
-     247,    239,    231,    223,
-     215,    206,    198,    190,
-     182,    174,    166,    158,
-     150,    142,    134,    125,
-     117,    109,    101,     93,
-      85,     77,     69,     61,
-      53,     45,     36,     28,
-      20,     12,      4,      0,
-     122,    110,     98,     84,
-      71,     59,     49,     39,
-      28,     18,     12,     10,
-       8,      6,      2,      3,
-       7,     14,     19,     24,
-      28,     35,     42,     49,
-      56,     64,     72,     77,
-      81,     85,     88,     91,
-      93,     94,     93,     90,
-      86,     82,     77,     72,
-      67,     61,     55,     47,
-      41,     34,     28,     25,
-      21,     17,     15,     14,
-      15,     20,     24,     30,
-      37,     45,     55,     64,
-      77,     91,    105,    119,
-     135,    147,    162,    175,
-     188,    201,    211,    220,
-     229,    237,    244,    249,
-     252,    255,    255,    253,
-     249,    245,    242,    238,
-     232,    224,    214,    207,
-     201,    195,    189,    181,
-     175,    170,    166,    162,
-     160,    161,    164,    165,
-     167,    170,    174,    180,
-     188,    196,    202,    208,
-     212,    217,    225,    231,
-     234,    236,    237,    236,
-     236,    233,    230,    225,
-     219,    211,    199,    187,
-     176,    166,    153,    138,
-     122,    133,    117,    100,
-      84,     70,     55,     42,
-      30,     19,     10,      4,
-       2,      1,      3,      5,
-      10,     19,     31,     43,
-      55,     68,     83,     98,
-     112,    127,    142,    156,
-     167,    178,    188,    197,
-     202,    205,    207,    206,
-     204,    198,    191,    183,
-     174,    162,    149,    137,
-     122,    108,     93,     79,
-      66,     54,     44,     34,
-      27,     22,     20,     19,
-      21,     26,     32,     40,
-      50,     63,     78,     93,
-     109,    125,    141,    158,
-     174,    188,    203,    215,
-     227,    236,    243,    249,
-     253,    255,    253,    249,
-     244,    236,    227,    216,
-     203,    190,    175,    159,
-     144,    130,    116,    102,
-      88,     77,     67,     59,
-      52,     48,     47,     48,
-      51,     55,     63,     72,
-      83,     95,    109,    123,
-     136,    149,    163,    178,
-     191,    202,    211,    219,
-     226,    231,    234,    235,
-     233,    230,    223,    214,
-     204,    193,    180,    165,
-     150,    133,    123,    110,
-      95,     79,     66,     53,
-      42,     30,     19,     12,
-       5,      1,      1,      4,
-       5,      8,     16,     31,
-      42,     53,     63,     77,
-      92,    105,    118,    133,
-     149,    160,    170,    180,
-     190,    196,    199,    202,
-     202,    204,    199,    195,
-     189,    181,    171,    160,
-     151,    140,    126,    112,
-      98,     86,     75,     66,
-      59,     52,     46,     43,
-      42,     44,     47,     51,
-      59,     68,     80,     93,
-     107,    122,    137,    149,
-     164,    180,    193,    205,
-     215,    225,    234,    241,
-     248,    252,    255,    253,
-     248,    245,    238,    229,
-     217,    207,    196,    182,
-     167,    153,    139,    125,
-     110,     96,     85,     74,
-      64,     57,     52,     52,
-      52,     52,     54,     59,
-      67,     77,     88,     99,
-     110,    121,    131,    144,
-     159,    171,    181,    188,
-     193,    200,    206,    210,
-     210,    210,    208,    203,
-     195,    187,    178,    167,
-     152,    137,    123,     58,
-      62,     54,     37,     30,
-      29,     28,     18,     10,
-       9,      5,      1,      7,
-      23,     25,     18,     29,
-      59,     80,     83,     85,
-     104,    123,    127,    126,
-     145,    179,    190,    196,
-     204,    219,    227,    224,
-     221,    228,    242,    241,
-     241,    239,    232,    222,
-     217,    221,    216,    204,
-     186,    176,    173,    164,
-     159,    159,    157,    143,
-     135,    135,    141,    143,
-     140,    145,    150,    159,
-     165,    181,    198,    208,
-     203,    208,    226,    235,
-     238,    230,    229,    236,
-     239,    245,    251,    252,
-     239,    227,    222,    219,
-     205,    189,    181,    177,
-     168,    150,    136,    126,
-     109,     81,     65,     56,
-      47,     36,     26,     20,
-      26,     24,     13,      9,
-       8,     17,     31,     44,
-      46,     46,     48,     50,
-      63,     78,     92,     96,
-      89,     85,     88,    103,
-     105,    103,    107,    115,
-     116,    108,    106,    105,
-      99,     78,     61,     58,
-      89,    104,    103,     92,
-      95,    106,    118,    114,
-     111,    116,    116,    114,
-     117,    131,    135,    123,
-     133,    165,    186,    182,
-     167,    164,    170,    161,
-     153,    173,    219,    232,
-     230,    224,    223,    220,
-     213,    208,    216,    233,
-     229,    226,    220,    215,
-     207,    204,    203,    198,
-     185,    174,    178,    185,
-     179,    171,    167,    160,
-     145,    140,    147,    159,
-     160,    151,    144,    139,
-     139,    138,    153,    167,
-     168,    155,    155,    177,
-     192,    186,    161,    145,
-     139,    139,    151,    167,
-     175,    162,    139,    127,
-     122,    110,    100,    103,
-     114,    115,    104,     96,
-      92,     78,     54,     43,
-      39,     38,     40,     41,
-      43,     55,     47,     24,
-       8,      1,     16,     42,
-      63,     61,     53,     44,
-      34,     39,     46,     60,
-      69,     64,     59,     64,
-      79,     85,     81,     85,
-      92,     99,     94,     98,
-     111,    114,     98,     86,
-      89,     76,     76,     69,
-      64,     76,     92,    111,
-     110,    104,    103,     95,
-      92,     86,     86,     94,
-      99,    128,    163,    181,
-     169,    131,     90,     59,
-      38,     42,     82,    142,
-     174,    176,    151,    121,
-      97,     97,    105,    120,
-     138,    132,    133,    129,
-     140,    148,    144,    127,
-     106,     88,     93,    119,
-     146,    151,    133,    104,
-      77,     67,     82,    114,
-     150,    165,    156,    141,
-     123,    125,    130,    147,
-     166,    175,    182,    198,
-     231,    255,    254,    217,
-     179,    148,    143,    173,
-     210,    243,    252,    231,
-     208,    184,    165,    161,
-     170,    188,    196,    200,
-     202,    201,    186,    163,
-     143,    129,    125,    145,
-     170,    185,    190,    157,
-     103,     61,     47,     79,
-     131,    171,    172,    148,
-     104,     66,     50,     44,
-      58,     68,     66,     66,
-      67,     82,     94,     91,
-      91,     76,     66,     57,
-      58,     75,     87,     90,
-      86,     76,    124,    128,
-     127,    120,    116,    111,
-     104,     91,     75,     59,
-      48,     45,     45,     53,
-      67,     81,    104,    118,
-     120,    108,     81,     47,
-      20,      1,      1,     16,
-      37,     52,     55,     46,
-      36,     28,     34,     41,
-      46,     53,     46,     47,
-      43,     48,     45,     39,
-      23,      9,      4,     15,
-      39,     61,     76,     77,
-      71,     64,     68,     80,
-      95,    110,    112,    101,
-      90,     80,     85,     98,
-     117,    137,    156,    174,
-     195,    218,    232,    234,
-     213,    192,    166,    157,
-     167,    187,    211,    230,
-     234,    235,    229,    225,
-     227,    233,    244,    251,
-     253,    250,    244,    230,
-     217,    204,    197,    199,
-     216,    237,    251,    255,
-     240,    212,    190,    177,
-     186,    203,    214,    207,
-     189,    163,    143,    138,
-     141,    150,    157,    162,
-     167,    170,    174,    173,
-     166,    152,    130,    112,
-      95,     86,     89,     97,
-     107,    120,    124,    176,
-     193,    200,    196,    181,
-     158,    131,    101,     76,
-      57,     50,     56,     69,
-      90,    113,    133,    150,
-     158,    155,    141,    121,
-      98,     78,     60,     49,
-      43,     43,     44,     46,
-      47,     49,     56,     65,
-      75,     81,     87,     83,
-      79,     69,     57,     43,
-      28,     13,      4,      1,
-       7,     21,     36,     53,
-      68,     80,     92,    104,
-     110,    111,    106,     94,
-      82,     71,     67,     72,
-      85,    105,    127,    147,
-     167,    183,    197,    202,
-     199,    184,    167,    146,
-     133,    128,    132,    144,
-     159,    173,    187,    199,
-     207,    217,    224,    229,
-     228,    222,    209,    194,
-     175,    162,    153,    152,
-     160,    175,    193,    208,
-     221,    223,    217,    207,
-     194,    182,    172,    159,
-     145,    135,    128,    129,
-     137,    147,    160,    171,
-     178,    184,    185,    182,
-     178,    168,    155,    139,
-     122,    108,    101,    104,
-     114,    132,    154,    176,
-     205,    232,    241,    231,
-     208,    176,    142,    105,
-      72,     51,     48,     60,
-      82,    111,    141,    163,
-     179,    186,    182,    171,
-     153,    134,    120,    101,
-      82,     66,     60,     54,
-      51,     50,     50,     58,
-      67,     79,     92,    102,
-     101,     95,     79,     62,
-      41,     26,     17,     11,
-       1,      1,     16,     35,
-      54,     69,     87,    109,
-     127,    131,    132,    127,
-     112,     94,     79,     74,
-      77,     88,    107,    130,
-     151,    170,    184,    198,
-     202,    192,    172,    150,
-     124,    107,    101,    103,
-     112,    127,    140,    159,
-     177,    188,    200,    211,
-     218,    215,    203,    183,
-     162,    139,    122,    111,
-     113,    125,    144,    167,
-     186,    203,    207,    201,
-     188,    170,    154,    140,
-     124,    108,    101,    104,
-     116,    134,    151,    164,
-     179,    188,    195,    198,
-     193,    186,    173,    156,
-     137,    119,    104,     98,
-     106,    120,    145,    175,
-     205,    186,    220,    228,
-     208,    186,    165,    151,
-     133,    100,     81,     90,
-     106,    128,    162,    188,
-     194,    204,    215,    210,
-     201,    191,    179,    186,
-     170,    128,    107,    109,
-     104,     95,     86,     70,
-      58,     53,     61,     80,
-      86,     78,     79,     59,
-      35,     12,     27,     86,
-      92,     29,      1,     33,
-      75,     97,     85,     93,
-     144,    173,    162,    173,
-     185,    174,    156,    136,
-     140,    145,    140,    152,
-     168,    171,    170,    170,
-     190,    204,    183,    150,
-     123,     90,     70,     78,
-      93,    102,    107,    107,
-     117,    131,    129,    129,
-     150,    172,    166,    151,
-     139,    116,     98,     88,
-      71,     74,     84,     92,
-     117,    135,    150,    151,
-     136,    119,    103,     99,
-     120,    122,     98,     86,
-      90,    105,    140,    157,
-     153,    172,    176,    175,
-     186,    178,    166,    158,
-     140,    130,    122,    111,
-     105,    110,    123,    138,
-     155,    186,    151,    172,
-     170,    174,    166,    164,
-     178,    179,    164,    150,
-     168,    178,    186,    226,
-     242,    218,    217,    243,
-     225,    213,    233,    217,
-     230,    225,    168,    155,
-     162,    160,    145,    131,
-     108,     63,     47,     49,
-      59,     66,     52,     61,
-      54,     22,      1,     48,
-     168,    192,     86,     36,
-      79,    124,    152,    132,
-     116,    174,    208,    166,
-     170,    202,    192,    176,
-     177,    187,    181,    163,
-     168,    164,    150,    139,
-     117,    128,    144,    117,
-      91,     76,     55,     53,
-      69,     91,     96,     82,
-      73,     69,     75,     70,
-      59,     87,    111,    102,
-      91,    103,     91,     68,
-      78,     66,     56,     64,
-      64,     76,     76,    106,
-      95,     59,     83,     62,
-      57,    121,    138,    118,
-     108,    118,    123,    150,
-     175,    146,    147,    147,
-     138,    150,    143,    140,
-     142,    124,    132,    143,
-     135,    130,    129,    131,
-     129,    126,    151,    197,
-     211,    174,    218,    219,
-     189,    217,    217,    208,
-     192,    213,    210,    192,
-     226,    229,    193,    181,
-     226,    192,    153,    221,
-     179,    154,    188,    144,
-     119,    117,    123,     91,
-      80,     78,     39,     39,
-      31,     18,     36,     29,
-      24,     32,     31,     20,
-      38,     96,    109,     59,
-      60,     89,     73,    103,
-     122,     84,    116,    155,
-     114,    125,    165,    151,
-     136,    178,    180,    139,
-     168,    191,    156,    162,
-     194,    164,    159,    189,
-     172,    151,    156,    160,
-     150,    141,    158,    158,
-     131,    148,    134,    126,
-     147,    120,    128,    140,
-     130,    108,    115,    125,
-      73,     92,    110,     62,
-      58,     97,     76,     23,
-     119,     83,      1,    119,
-      67,     21,    106,     95,
-      79,     70,    111,     98,
-      72,    140,    113,     94,
-     121,    122,    121,    112,
-     126,    137,    116,    118,
-     156,    146,    132,    169,
-     167,    169,    169,    197,
-     213,    230,    195,    239,
-     245,    206,    239,    245,
-     228,    220,    239,    230,
-     213,    229,    232,    211,
-     187,    232,    205,    147,
-     228,    186,    138,    190,
-     158,    129,    120,    126,
-      98,     74,     80,     56,
-      41,     35,     19,     28,
-      24,     13,     23,     30,
-      25,     25,     48,     56,
-      30,     40,     59,     38,
-      56,     74,     45,     66,
-      92,     59,     76,    107,
-      91,     82,    132,    130,
-      89,    142,    162,    121,
-     138,    184,    156,    142,
-     186,    183,    157,    167,
-     195,    165,    149,    195,
-     172,    139,    191,    159,
-     140,    182,    147,    148,
-     162,    157,    130,    130,
-     161,    101,    100,    147,
-      95,     65,    134,    109,
-      20,    139,    106,      1,
-     136,     86,     31,    103,
-      87,     78,     57,    107,
-     100,     44,    121,    113,
-      74,    112,    116,    106,
-     108,    116,    136,    125,
-     122,    168,    156,    143,
-     189,    184,    185,    195,
-     213,    167,    178,    151,
-     205,    190,    126,    206,
-     209,    175,    183,    206,
-     168,    169,    202,    198,
-     155,    130,    197,    186,
-      86,    216,    161,    111,
-     192,    140,    153,    111,
-     113,    128,     83,     62,
-     100,     51,     37,      2,
-      60,     71,      3,     90,
-      50,     38,     93,     71,
-     133,     98,     49,    101,
-     103,     92,     95,     92,
-     108,    109,     41,    119,
-     125,     54,    101,    161,
-      95,     84,    175,    121,
-     113,    139,    159,    148,
-     105,    194,    191,    108,
-     143,    217,    108,    110,
-     209,    126,    124,    192,
-     130,    104,    201,    155,
-     131,    198,    189,    123,
-     114,    215,    146,     90,
-     206,    150,     49,    195,
-     201,      1,    163,    193,
-       2,    177,    117,     76,
-     131,     90,    163,     70,
-      98,    162,     71,    109,
-     172,    113,     87,    114,
-     120,    106,     78,    125,
-     106,    118,    134,    107,
-     136,    147,    146,    116,
-     171,    167,    125,    125,
-     163,    156,    129,     76,
-     157,    199,    134,    150,
-     194,    125,    102,    161,
-     174,     90,     77,    144,
-     167,     35,    163,    129,
-      65,    150,    105,    177,
-      87,     93,    170,     69,
-      49,    146,     63,     66,
-       1,     96,    126,      5,
-     153,     63,     64,    149,
-      80,    186,    147,     93,
-     141,    150,    133,    139,
-     135,    153,    154,     26,
-     165,    163,     42,    142,
-     183,     80,    117,    208,
-      94,    136,    152,    115,
-     174,     75,    185,    214,
-      71,    128,    227,     71,
-      76,    204,     99,    122,
-     180,     98,     75,    199,
-     159,     98,    213,    192,
-      90,     80,    229,    172,
-      75,    220,    177,     48,
-     208,    226,     17,    131,
-     213,     54,    164,    111,
-     124,    137,     74,    199,
-      92,     87,    194,    123,
-      94,    208,    176,     60,
-     116,    153,    124,     60,
-     113,    128,    160,    108,
-      98,    160,    115,    138,
-      71,    189,    125,    115,
-     116,    114,    109,    102,
-      96,     90,     83,     74,
-      67,     62,     60,     60,
-      60,     57,     50,     43,
-      36,     30,     24,     21,
-      19,     19,     21,     22,
-      23,     21,     17,     10,
-       4,      1,      1,      2,
-       5,      9,     14,     19,
-      21,     20,     17,     15,
-      16,     20,     28,     34,
-      40,     47,     53,     56,
-      57,     58,     58,     60,
-      63,     73,     84,     94,
-     101,    106,    108,    111,
-     112,    114,    122,    131,
-     141,    151,    159,    169,
-     175,    177,    176,    177,
-     178,    183,    190,    198,
-     207,    214,    220,    224,
-     225,    224,    224,    225,
-     228,    232,    237,    243,
-     248,    250,    250,    247,
-     244,    242,    240,    239,
-     242,    247,    249,    250,
-     246,    240,    233,    227,
-     223,    220,    218,    219,
-     221,    223,    221,    214,
-     204,    194,    186,    179,
-     173,    171,    172,    172,
-     168,    162,    155,    146,
-     135,    124,    118,    115,
-     155,    157,    157,    159,
-     162,    169,    176,    183,
-     185,    186,    186,    187,
-     188,    192,    197,    199,
-     198,    194,    190,    186,
-     182,    180,    180,    181,
-     179,    173,    164,    153,
-     141,    134,    128,    125,
-     119,    110,     99,     89,
-      78,     67,     59,     53,
-      49,     47,     42,     35,
-      25,     16,     14,     16,
-      21,     24,     26,     26,
-      23,     22,     28,     38,
-      51,     66,     80,     89,
-      97,    103,    111,    126,
-     147,    167,    183,    194,
-     203,    209,    214,    218,
-     226,    234,    244,    252,
-     255,    254,    246,    238,
-     233,    233,    233,    232,
-     227,    216,    202,    187,
-     175,    165,    158,    152,
-     145,    134,    122,    106,
-      92,     82,     77,     74,
-      72,     69,     62,     54,
-      46,     41,     40,     41,
-      47,     55,     61,     64,
-      62,     59,     60,     66,
-      75,     86,     99,    107,
-     111,    112,    114,    118,
-     125,    134,    143,    151,
-     155,    134,    126,    120,
-     116,    114,    113,    112,
-     110,    104,     98,     93,
-      90,     90,     92,     92,
-      90,     87,     82,     79,
-      77,     76,     76,     78,
-      79,     78,     74,     67,
-      62,     58,     57,     56,
-      55,     53,     47,     40,
-      34,     29,     25,     23,
-      22,     20,     18,     13,
-       9,      4,      2,      2,
-       5,      9,     13,     15,
-      17,     17,     19,     26,
-      35,     47,     59,     70,
-      78,     85,     93,    103,
-     119,    136,    154,    168,
-     177,    186,    193,    200,
-     207,    218,    228,    238,
-     245,    247,    249,    248,
-     247,    249,    252,    255,
-     255,    253,    248,    241,
-     233,    229,    225,    224,
-     222,    218,    214,    208,
-     199,    191,    187,    186,
-     186,    186,    184,    179,
-     173,    169,    167,    167,
-     169,    171,    173,    174,
-     172,    168,    163,    161,
-     162,    165,    167,    167,
-     165,    158,    153,    149,
-     147,    147,    146,    145,
-     141,    134,    133,    125,
-     119,    117,    116,    115,
-     115,    117,    121,    125,
-     126,    126,    123,    118,
-     109,     96,     80,     66,
-      58,     54,     55,     58,
-      60,     61,     64,     67,
-      69,     69,     68,     69,
-      71,     73,     73,     70,
-      66,     60,     55,     49,
-      43,     37,     36,     39,
-      45,     50,     52,     52,
-      51,     50,     48,     45,
-      41,     37,     31,     26,
-      21,     14,      7,      2,
-       2,      7,     18,     36,
-      66,    106,    151,    191,
-     221,    241,    252,    255,
-     251,    241,    230,    220,
-     215,    213,    214,    214,
-     215,    217,    220,    222,
-     222,    221,    219,    218,
-     217,    216,    213,    208,
-     200,    191,    185,    181,
-     178,    175,    175,    179,
-     185,    188,    190,    191,
-     192,    193,    193,    192,
-     192,    191,    191,    191,
-     187,    178,    166,    154,
-     144,    138,    134,    131,
-     132,    135,    139,    142,
-     143,    144,    144,    143,
-     142,    140,    133,    133,
-     130,    126,    128,    133,
-     138,    137,    137,    142,
-     150,    156,    158,    159,
-     159,    153,    140,    124,
-     110,    104,    104,    108,
-     113,    115,    115,    117,
-     121,    124,    125,    127,
-     132,    138,    142,    143,
-     145,    146,    142,    132,
-     118,    105,     95,     91,
-      95,    102,    106,    105,
-     102,     96,     88,     79,
-      72,     69,     65,     56,
-      47,     41,     35,     26,
-      16,      8,      7,     11,
-      23,     51,     96,    147,
-     191,    223,    244,    255,
-     254,    243,    228,    216,
-     207,    201,    195,    189,
-     187,    187,    187,    184,
-     178,    170,    165,    161,
-     158,    158,    159,    159,
-     154,    142,    126,    111,
-     104,    102,    104,    107,
-     112,    119,    125,    129,
-     132,    135,    138,    140,
-     140,    138,    138,    141,
-     145,    145,    139,    126,
-     112,    102,     97,     98,
-     100,    105,    112,    116,
-     119,    121,    125,    129,
-     131,    132,    133,    133,
-     125,    148,    134,    127,
-     159,    184,    152,     96,
-      85,    117,    135,    127,
-     138,    180,    202,    163,
-      89,     35,     32,     74,
-     130,    159,    135,     93,
-      92,    128,    142,    104,
-      67,     78,    107,    106,
-      94,    121,    182,    213,
-     189,    143,    104,     72,
-      54,     77,    135,    176,
-     173,    149,    128,     95,
-      51,     34,     65,     96,
-      74,     30,     37,     98,
-     142,    130,     99,     81,
-      55,     12,      1,     70,
-     176,    231,    217,    196,
-     207,    210,    163,    104,
-     105,    169,    225,    219,
-     180,    167,    190,    209,
-     200,    172,    140,    107,
-      82,     86,    124,    172,
-     198,    190,    153,    101,
-      55,     49,     89,    136,
-     154,    149,    157,    179,
-     180,    151,    124,    132,
-     156,    156,    127,    105,
-     123,    175,    221,    219,
-     162,     92,     63,     79,
-     102,    115,    137,    173,
-     179,    133,     82,     86,
-     122,    127,     96,     90,
-     125,    107,    156,    149,
-     126,    148,    184,    164,
-     101,     71,     95,    119,
-     116,    125,    163,    184,
-     146,     70,     16,     15,
-      61,    119,    143,    112,
-      66,     69,    111,    121,
-      75,     38,     59,     94,
-      84,     62,     97,    175,
-     212,    174,    115,     79,
-      54,     34,     51,    113,
-     166,    167,    139,    111,
-      75,     26,      5,     40,
-      84,     64,      8,      6,
-      81,    148,    142,     95,
-      65,     50,     24,     15,
-      71,    168,    226,    218,
-     200,    213,    218,    167,
-     100,    104,    186,    255,
-     244,    192,    179,    216,
-     244,    228,    190,    154,
-     119,     89,     95,    145,
-     201,    221,    207,    178,
-     132,     74,     50,     91,
-     161,    189,    172,    167,
-     197,    212,    181,    141,
-     147,    181,    185,    148,
-     117,    135,    190,    238,
-     238,    182,    110,     76,
-      93,    119,    130,    147,
-     182,    190,    138,     75,
-      77,    126,    134,     85,
-      62,    107,    103,    148,
-     144,    119,    127,    155,
-     146,     97,     65,     77,
-      94,     94,     96,    120,
-     133,    105,     50,     10,
-      11,     43,     83,     96,
-      70,     37,     40,     71,
-      75,     39,     12,     31,
-      59,     48,     28,     55,
-     119,    148,    116,     69,
-      45,     31,     17,     27,
-      73,    118,    121,    100,
-      79,     54,     18,      1,
-      30,     68,     58,     15,
-      11,     71,    130,    132,
-      93,     68,     63,     56,
-      53,     88,    153,    197,
-     198,    188,    200,    205,
-     170,    122,    128,    194,
-     251,    243,    202,    195,
-     229,    254,    241,    210,
-     184,    159,    137,    144,
-     185,    229,    241,    229,
-     213,    184,    138,    112,
-     142,    201,    227,    208,
-     199,    224,    241,    217,
-     183,    185,    212,    216,
-     185,    159,    170,    209,
-     242,    241,    202,    150,
-     123,    132,    150,    156,
-     163,    185,    190,    149,
-      97,     97,    135,    140,
-      95,     68,    103,    110,
-     136,    132,    112,    112,
-     127,    122,     91,     68,
-      70,     78,     76,     75,
-      85,     89,     71,     38,
-      15,     15,     32,     52,
-      57,     40,     20,     21,
-      37,     38,     16,      1,
-      12,     28,     22,      8,
-      25,     63,     79,     60,
-      33,     21,     16,      9,
-      15,     42,     70,     74,
-      64,     53,     40,     21,
-      13,     33,     58,     55,
-      33,     31,     69,    109,
-     113,     92,     79,     81,
-      82,     84,    104,    142,
-     171,    175,    173,    183,
-     188,    171,    146,    152,
-     194,    231,    228,    206,
-     204,    228,    245,    239,
-     222,    208,    196,    185,
-     191,    217,    243,    250,
-     244,    237,    223,    196,
-     179,    196,    231,    247,
-     235,    228,    242,    254,
-     240,    218,    217,    232,
-     233,    214,    197,    201,
-     221,    237,    236,    214,
-     182,    163,    166,    175,
-     174,    174,    183,    184,
-     158,    125,    122,    143,
-     143,    112,     92,    110,
-     120,    125,    119,    108,
-     103,    104,     99,     87,
-      75,     72,     70,     64,
-      60,     60,     58,     49,
-      35,     26,     24,     28,
-      30,     29,     22,     14,
-      13,     16,     14,      6,
-       1,      4,      9,      6,
-       2,      7,     19,     24,
-      19,     12,     10,     10,
-      10,     13,     23,     34,
-      38,     37,     36,     34,
-      31,     32,     42,     53,
-      57,     53,     57,     73,
-      89,     95,     92,     92,
-      96,    101,    107,    117,
-     134,    148,    155,    159,
-     166,    171,    170,    166,
-     172,    189,    205,    208,
-     204,    207,    218,    228,
-     229,    226,    224,    223,
-     221,    225,    235,    245,
-     249,    248,    248,    245,
-     238,    233,    238,    249,
-     254,    250,    247,    251,
-     254,    249,    241,    239,
-     241,    239,    232,    224,
-     223,    226,    228,    226,
-     216,    204,    194,    191,
-     190,    186,    182,    180,
-     176,    164,    150,    146,
-     149,    145,    130,    118,
-     120,    120,    117,    113,
-     109,    105,    103,    100,
-      97,     93,     91,     89,
-      86,     83,     80,     79,
-      77,     74,     71,     69,
-      68,     66,     63,     61,
-      58,     56,     54,     52,
-      49,     47,     45,     43,
-      40,     37,     34,     31,
-      28,     24,     20,     16,
-      12,      8,      6,      5,
-       5,      3,      2,      2,
-       1,      2,      4,      9,
-      14,     19,     25,     31,
-      40,     49,     58,     66,
-      75,     85,     95,    106,
-     119,    132,    144,    156,
-     166,    176,    186,    194,
-     202,    211,    219,    227,
-     233,    238,    242,    246,
-     250,    253,    253,    253,
-     253,    251,    251,    251,
-     250,    249,    246,    243,
-     240,    236,    233,    230,
-     227,    223,    220,    215,
-     212,    209,    206,    203,
-     200,    198,    196,    193,
-     190,    189,    188,    188,
-     186,    183,    181,    179,
-     177,    175,    171,    167,
-     164,    160,    154,    149,
-     145,    141,    136,    130,
-     124,    120,    117,    118,
-     120,    121,    121,    120,
-     119,    117,    114,    112,
-     110,    109,    108,    107,
-     106,    105,    105,    105,
-     106,    107,    106,    105,
-     103,    100,     98,     96,
-      93,     91,     88,     85,
-      82,     79,     75,     71,
-      67,     61,     54,     46,
-      37,     30,     24,     20,
-      17,     14,     11,      9,
-       6,      3,      3,      3,
-       5,      8,     11,     16,
-      22,     28,     34,     41,
-      47,     55,     64,     76,
-      93,    114,    135,    154,
-     171,    184,    194,    202,
-     208,    215,    221,    227,
-     232,    237,    241,    245,
-     249,    253,    255,    255,
-     253,    249,    244,    240,
-     237,    233,    229,    224,
-     217,    210,    202,    196,
-     192,    190,    188,    186,
-     182,    178,    173,    168,
-     164,    160,    157,    154,
-     150,    147,    145,    145,
-     146,    148,    151,    153,
-     154,    155,    155,    154,
-     152,    149,    146,    141,
-     136,    131,    127,    122,
-     119,    117,    117,    117,
-     128,    137,    142,    143,
-     142,    138,    133,    128,
-     125,    125,    129,    133,
-     138,    142,    145,    147,
-     151,    154,    158,    159,
-     158,    154,    149,    143,
-     138,    135,    131,    127,
-     124,    121,    121,    120,
-     118,    112,    102,     89,
-      75,     62,     51,     42,
-      35,     30,     25,     19,
-      14,      9,      7,      5,
-       5,      6,      9,     13,
-      19,     27,     35,     40,
-      41,     38,     34,     32,
-      39,     61,     97,    139,
-     176,    203,    217,    219,
-     217,    213,    213,    216,
-     222,    228,    232,    235,
-     239,    245,    251,    255,
-     255,    252,    246,    238,
-     229,    221,    216,    211,
-     204,    193,    179,    164,
-     152,    144,    142,    143,
-     145,    144,    140,    134,
-     126,    120,    116,    112,
-     109,    103,     98,     95,
-      96,     98,    102,    108,
-     113,    119,    124,    129,
-     132,    133,    132,    130,
-     126,    120,    115,    110,
-     107,    105,    108,    117,
-     115,    130,    142,    146,
-     144,    141,    138,    135,
-     133,    134,    137,    142,
-     145,    147,    151,    154,
-     158,    162,    166,    170,
-     172,    168,    162,    153,
-     145,    140,    137,    136,
-     135,    136,    137,    136,
-     134,    128,    118,    105,
-      91,     79,     70,     65,
-      62,     59,     54,     46,
-      37,     29,     25,     22,
-      21,     20,     19,     17,
-      15,     17,     25,     34,
-      40,     39,     29,     14,
-       1,      3,     29,     78,
-     140,    197,    236,    254,
-     251,    237,    223,    215,
-     215,    222,    229,    232,
-     231,    230,    231,    234,
-     237,    237,    235,    229,
-     219,    208,    199,    195,
-     194,    192,    187,    178,
-     166,    152,    140,    132,
-     129,    128,    127,    126,
-     123,    119,    114,    110,
-     106,    100,     93,     86,
-      83,     83,     87,     92,
-      99,    106,    111,    115,
-     118,    121,    124,    128,
-     129,    128,    123,    115,
-     107,    101,     98,    103,
-     115,    116,    131,    142,
-     143,    137,    132,    131,
-     133,    137,    143,    148,
-     149,    144,    140,    139,
-     139,    142,    146,    150,
-     154,    154,    150,    143,
-     137,    132,    129,    129,
-     132,    137,    142,    143,
-     140,    132,    120,    107,
-      95,     87,     85,     86,
-      89,     93,     98,    100,
-      96,     89,     84,     82,
-      82,     80,     75,     69,
-      62,     53,     47,     49,
-      56,     60,     55,     40,
-      20,      3,      1,     23,
-      74,    138,    199,    239,
-     255,    250,    233,    214,
-     199,    195,    200,    205,
-     205,    198,    189,    182,
-     178,    176,    175,    175,
-     172,    166,    158,    154,
-     157,    163,    169,    172,
-     173,    172,    165,    153,
-     140,    129,    122,    118,
-     117,    119,    122,    123,
-     120,    117,    113,    108,
-     102,     98,     98,    102,
-     109,    116,    122,    123,
-     122,    117,    115,    116,
-     122,    129,    132,    130,
-     123,    115,    107,    102,
-     104,    116,    109,    131,
-     148,    151,    153,    163,
-     175,    177,    172,    169,
-     163,    148,    130,    122,
-     127,    129,    122,    116,
-     121,    127,    126,    123,
-     130,    146,    159,    164,
-     167,    171,    172,    167,
-     158,    150,    141,    127,
-     109,     94,     86,     82,
-      78,     72,     74,     88,
-     104,    111,    112,    120,
-     138,    153,    148,    127,
-     108,     96,     83,     67,
-      61,     65,     66,     52,
-      32,     20,     10,      1,
-      10,     61,    142,    213,
-     242,    242,    238,    236,
-     225,    204,    190,    193,
-     200,    195,    177,    159,
-     142,    122,    106,    104,
-     121,    139,    143,    139,
-     144,    163,    180,    182,
-     172,    170,    175,    171,
-     154,    134,    122,    114,
-     101,     87,     84,     89,
-      92,     89,     91,    105,
-     122,    128,    123,    119,
-     124,    132,    138,    139,
-     140,    138,    129,    113,
-      99,     94,     93,     88,
-      83,     88,    102,    111,
-     107,    100,    109,    109,
-     131,    148,    154,    163,
-     182,    197,    196,    187,
-     180,    171,    149,    122,
-     113,    119,    121,    111,
-     104,    110,    115,    112,
-     110,    126,    153,    172,
-     178,    182,    190,    191,
-     180,    164,    155,    145,
-     129,    107,     91,     84,
-      79,     71,     62,     64,
-      83,    107,    119,    121,
-     132,    161,    186,    183,
-     153,    124,    110,     96,
-      76,     64,     67,     66,
-      47,     24,     16,     15,
-       3,      1,     49,    144,
-     226,    252,    240,    233,
-     240,    234,    210,    190,
-     192,    196,    186,    165,
-     147,    126,     97,     71,
-      71,     98,    126,    134,
-     132,    142,    169,    190,
-     191,    178,    173,    176,
-     174,    154,    131,    117,
-     109,     94,     74,     65,
-      71,     78,     77,     79,
-      99,    127,    142,    138,
-     131,    135,    145,    148,
-     146,    146,    146,    135,
-     112,     90,     80,     76,
-      67,     60,     69,     94,
-     111,    109,    101,    109,
-      82,     80,     81,     82,
-      86,     89,     93,     95,
-      97,     99,    100,    101,
-     101,    100,     99,     96,
-      94,     94,     95,     98,
-     104,    113,    120,    125,
-     126,    124,    120,    117,
-     117,    117,    116,    119,
-     123,    128,    133,    139,
-     143,    146,    146,    143,
-     137,    128,    117,    105,
-      93,     83,     77,     70,
-      66,     60,     55,     50,
-      46,     41,     37,     33,
-      29,     26,     26,     31,
-      41,     56,     79,    111,
-     146,    178,    206,    227,
-     239,    247,    250,    250,
-     247,    242,    235,    227,
-     220,    212,    206,    196,
-     186,    172,    159,    143,
-     125,    107,     90,     77,
-      67,     61,     57,     58,
-      59,     62,     67,     76,
-      85,     99,    112,    126,
-     140,    154,    168,    181,
-     196,    213,    229,    243,
-     251,    255,    253,    246,
-     235,    224,    211,    197,
-     182,    169,    154,    142,
-     131,    122,    114,    107,
-     102,     96,     91,     86,
-      82,     76,     82,     91,
-      94,     93,     89,     82,
-      75,     75,     78,     83,
-      89,     95,     97,    102,
-     108,    115,    131,    143,
-     152,    159,    162,    162,
-     159,    154,    146,    140,
-     131,    122,    113,    100,
-      91,     90,     90,     89,
-      89,     84,     81,     78,
-      77,     81,     88,     95,
-     100,    102,    101,    100,
-      99,     99,     98,     95,
-      86,     79,     70,     62,
-      58,     59,     61,     67,
-      73,     75,     79,     90,
-     105,    133,    157,    176,
-     192,    199,    199,    201,
-     203,    206,    208,    208,
-     200,    191,    177,    166,
-     159,    156,    153,    157,
-     155,    147,    139,    131,
-     123,    119,    117,    110,
-     104,     90,     72,     63,
-      60,     62,     79,     95,
-     109,    125,    138,    149,
-     165,    185,    206,    229,
-     245,    252,    255,    252,
-     246,    243,    242,    238,
-     228,    212,    190,    167,
-     147,    128,    118,    106,
-      96,     91,     82,     74,
-      74,     76,     91,     93,
-     102,    101,     89,     76,
-      58,     39,     36,     36,
-      37,     46,     48,     45,
-      48,     55,     67,    100,
-     128,    151,    176,    189,
-     195,    203,    207,    209,
-     217,    211,    200,    189,
-     168,    148,    143,    137,
-     133,    132,    119,    105,
-      95,     85,     84,     95,
-     103,    110,    113,    104,
-      92,     83,     77,     77,
-      80,     70,     60,     48,
-      31,     25,     32,     40,
-      57,     76,     82,     91,
-     105,    120,    150,    181,
-     204,    222,    228,    218,
-     213,    210,    207,    212,
-     216,    206,    194,    177,
-     154,    144,    143,    140,
-     149,    155,    146,    138,
-     129,    116,    114,    113,
-     104,     97,     81,     53,
-      34,     23,     15,     29,
-      44,     52,     64,     75,
-      79,    100,    130,    158,
-     198,    227,    240,    248,
-     249,    245,    249,    255,
-     253,    250,    238,    212,
-     189,    169,    150,    147,
-     140,    128,    124,    109,
-      92,     90,     91,    120,
-     116,    123,    120,    104,
-      91,     69,     45,     39,
-      35,     29,     32,     27,
-      16,     14,     17,     26,
-      58,     89,    115,    146,
-     164,    175,    191,    204,
-     214,    230,    234,    230,
-     228,    213,    197,    197,
-     192,    189,    189,    176,
-     160,    147,    133,    125,
-     131,    134,    134,    131,
-     116,     96,     82,     69,
-      65,     66,     55,     44,
-      30,      9,      1,      7,
-      16,     35,     59,     72,
-      87,    106,    122,    153,
-     185,    208,    229,    237,
-     227,    220,    218,    213,
-     217,    224,    217,    207,
-     192,    167,    155,    152,
-     144,    149,    154,    141,
-     131,    120,    104,    100,
-     101,     93,     89,     79,
-      52,     33,     21,      8,
-      13,     24,     26,     34,
-      40,     41,     61,     89,
-     117,    157,    187,    200,
-     211,    214,    209,    216,
-     226,    228,    231,    227,
-     208,    194,    181,    169,
-     171,    169,    161,    159,
-     145,    126,    123,    120,
-     150,    143,    144,    142,
-     130,    120,    104,     87,
-      84,     85,     84,     88,
-      83,     67,     59,     57,
-      64,     93,    123,    149,
-     176,    192,    198,    207,
-     210,    209,    214,    207,
-     196,    185,    168,    151,
-     150,    149,    149,    152,
-     143,    134,    127,    118,
-     109,    112,    112,    111,
-     108,     97,     82,     72,
-      68,     72,     81,     76,
-      65,     49,     23,      6,
-       1,      1,     13,     31,
-      42,     57,     78,     98,
-     133,    171,    201,    225,
-     237,    229,    225,    226,
-     228,    237,    248,    247,
-     241,    231,    211,    200,
-     194,    183,    183,    183,
-     167,    150,    134,    115,
-     110,    112,    110,    113,
-     110,     92,     78,     64,
-      47,     43,     43,     34,
-      30,     24,     17,     28,
-      50,     75,    108,    130,
-     137,    141,    139,    133,
-     137,    145,    148,    155,
-     158,    151,    149,    151,
-     154,    171,    181,    184,
-     188,    177,    160,    156,
-     150,    166,    153,    148,
-     144,    138,    137,    134,
-     131,    139,    151,    161,
-     169,    164,    148,    135,
-     129,    134,    157,    181,
-     202,    221,    230,    231,
-     229,    222,    211,    199,
-     180,    157,    134,    110,
-      91,     87,     86,     88,
-      91,     91,     92,     95,
-      95,     88,     86,     80,
-      73,     67,     58,     49,
-      47,     55,     74,     93,
-      99,     95,     79,     54,
-      32,     17,      8,     12,
-      22,     31,     46,     67,
-      91,    127,    166,    201,
-     226,    237,    233,    230,
-     232,    237,    247,    255,
-     254,    252,    248,    237,
-     230,    224,    214,    209,
-     203,    184,    161,    139,
-     119,    111,    114,    120,
-     132,    141,    141,    136,
-     125,    110,     97,     85,
-      65,     48,     29,     13,
-      13,     27,     44,     64,
-      76,     74,     67,     62,
-      57,     58,     61,     63,
-      68,     73,     77,     86,
-     101,    121,    151,    176,
-     191,    199,    195,    185,
-     177,    166,    169,    152,
-     139,    134,    135,    141,
-     149,    160,    178,    198,
-     217,    228,    226,    214,
-     200,    192,    196,    210,
-     227,    242,    252,    255,
-     253,    244,    230,    213,
-     189,    162,    132,     99,
-      70,     49,     40,     37,
-      39,     42,     49,     60,
-      71,     79,     75,     67,
-      55,     44,     32,     25,
-      21,     26,     45,     73,
-     100,    115,    117,    105,
-      84,     61,     40,     28,
-      25,     28,     36,     50,
-      68,     94,    128,    165,
-     201,    226,    236,    235,
-     233,    235,    241,    246,
-     248,    247,    245,    243,
-     242,    240,    235,    229,
-     222,    211,    191,    163,
-     137,    118,    109,    112,
-     124,    142,    161,    174,
-     178,    172,    159,    142,
-     122,     97,     71,     45,
-      24,     16,     21,     31,
-      39,     41,     33,     21,
-      14,     11,     11,      9,
-       9,     11,     15,     23,
-      36,     58,     90,    129,
-     163,    188,    200,    200,
-     195,    184,    169,    174,
-     154,    140,    133,    133,
-     138,    146,    159,    179,
-     206,    231,    246,    246,
-     232,    215,    202,    201,
-     211,    226,    240,    249,
-     252,    249,    240,    225,
-     206,    182,    154,    125,
-      95,     71,     54,     45,
-      39,     37,     37,     43,
-      55,     69,     78,     75,
-      65,     47,     30,     14,
-       4,      1,      6,     28,
-      61,     92,    113,    120,
-     112,     91,     68,     45,
-      30,     23,     22,     27,
-      40,     61,     93,    134,
-     176,    215,    238,    247,
-     243,    241,    243,    248,
-     254,    254,    252,    249,
-     245,    244,    243,    240,
-     237,    233,    227,    210,
-     185,    159,    137,    125,
-     125,    133,    150,    169,
-     181,    184,    175,    160,
-     139,    116,     87,     60,
-      33,     13,      7,     15,
-      28,     38,     38,     30,
-      17,     10,      7,      8,
-       6,      4,      2,      1,
-       7,     19,     42,     76,
-     117,    153,    181,    198,
-     204,    201,    191,    174,
-     185,    163,    143,    133,
-     128,    131,    141,    158,
-     182,    211,    239,    255,
-     254,    237,    214,    197,
-     192,    199,    211,    224,
-     232,    233,    227,    214,
-     196,    176,    154,    134,
-     119,    109,    104,    101,
-      96,     87,     75,     66,
-      62,     67,     77,     85,
-      82,     74,     57,     40,
-      25,     14,      9,     13,
-      32,     61,     91,    115,
-     128,    126,    113,     93,
-      72,     52,     39,     30,
-      28,     38,     60,     96,
-     140,    180,    210,    222,
-     220,    210,    204,    206,
-     215,    225,    229,    227,
-     221,    212,    205,    197,
-     193,    195,    202,    210,
-     211,    200,    180,    157,
-     136,    125,    127,    139,
-     155,    168,    171,    162,
-     145,    122,     95,     67,
-      43,     26,     20,     27,
-      46,     63,     74,     71,
-      57,     39,     25,     22,
-      23,     26,     28,     29,
-      29,     32,     37,     50,
-      70,     98,    126,    155,
-     181,    199,    207,    201,
-     185,    197,    175,    152,
-     136,    126,    125,    133,
-     152,    180,    211,    240,
-     255,    252,    233,    207,
-     186,    176,    179,    188,
-     198,    205,    205,    198,
-     184,    164,    142,    123,
-     113,    116,    129,    147,
-     162,    164,    154,    135,
-     114,     97,     91,     90,
-      92,     90,     85,     76,
-      67,     59,     54,     49,
-      47,     55,     71,     93,
-     117,    134,    142,    137,
-     125,    108,     86,     65,
-      45,     32,     36,     58,
-      97,    143,    179,    198,
-     193,    176,    153,    141,
-     142,    153,    169,    181,
-     185,    181,    167,    151,
-     133,    125,    129,    146,
-     171,    194,    203,    195,
-     172,    142,    120,    109,
-     113,    125,    137,    141,
-     136,    121,     99,     74,
-      51,     34,     29,     39,
-      60,     90,    114,    126,
-     120,    100,     74,     54,
-      45,     46,     54,     64,
-      72,     78,     81,     81,
-      81,     81,     86,     98,
-     122,    154,    184,    205,
-     209,    197,    195,    172,
-     147,    130,    119,    114,
-     115,    130,    156,    185,
-     209,    225,    230,    220,
-     204,    195,    196,    202,
-     208,    217,    228,    229,
-     223,    211,    195,    173,
-     148,    129,    123,    125,
-     130,    136,    136,    127,
-     110,     95,     84,     79,
-      76,     79,     87,     93,
-      93,     98,    105,    107,
-     101,     95,     95,     99,
-     103,    111,    120,    120,
-     112,    101,     85,     61,
-      36,     14,      1,      4,
-      25,     68,    119,    160,
-     186,    190,    183,    167,
-     157,    159,    172,    186,
-     196,    203,    200,    181,
-     154,    129,    116,    112,
-     120,    139,    158,    166,
-     156,    140,    122,    107,
-      99,    106,    122,    140,
-     150,    155,    152,    137,
-     113,     92,     76,     67,
-      66,     77,     96,    106,
-     106,     97,     80,     53,
-      29,     22,     26,     36,
-      48,     63,     81,     93,
-      97,    102,    109,    118,
-     127,    145,    172,    195,
-     208,    207,    195,    159,
-     138,    116,    105,    100,
-      96,     92,    101,    123,
-     144,    159,    175,    191,
-     194,    194,    200,    216,
-     226,    224,    225,    231,
-     230,    219,    206,    194,
-     175,    147,    123,    110,
-     104,     97,     93,     93,
-      91,     84,     83,     88,
-      91,     91,     98,    116,
-     130,    137,    148,    162,
-     166,    154,    141,    133,
-     122,    105,     96,     94,
-      83,     69,     59,     48,
-      30,     12,      2,      1,
-       6,     23,     61,    108,
-     144,    169,    183,    191,
-     185,    181,    186,    200,
-     207,    207,    207,    202,
-     179,    146,    116,    104,
-      97,     97,    105,    121,
-     126,    121,    118,    120,
-     121,    121,    132,    152,
-     170,    181,    191,    194,
-     181,    156,    135,    122,
-     108,     93,     89,     91,
-      84,     71,     61,     52,
-      34,     16,     16,     32,
-      49,     62,     83,    107,
-     123,    126,    133,    146,
-     157,    161,    167,    179,
-     186,    182,    173,    159,
-     119,    101,     83,     79,
-      83,     83,     76,     81,
-      97,    111,    119,    134,
-     159,    175,    187,    205,
-     231,    243,    234,    224,
-     223,    217,    200,    188,
-     181,    167,    140,    113,
-      98,     87,     73,     63,
-      63,     66,     70,     82,
-     103,    117,    122,    131,
-     151,    168,    173,    184,
-     196,    197,    179,    162,
-     149,    129,    101,     82,
-      71,     54,     35,     25,
-      19,      9,      1,      4,
-      14,     23,     36,     69,
-     110,    139,    159,    178,
-     195,    198,    199,    206,
-     219,    217,    203,    196,
-     189,    167,    135,    109,
-     100,     92,     85,     87,
-      97,    100,    100,    108,
-     125,    139,    148,    165,
-     187,    202,    209,    217,
-     221,    207,    181,    161,
-     150,    133,    108,     93,
-      84,     66,     44,     34,
-      32,     25,     15,     25,
-      53,     77,     90,    109,
-     133,    150,    151,    157,
-     172,    183,    182,    177,
-     177,    168,    152,    134,
-     119,    104,    118,    119,
-     108,     93,     67,     42,
-      54,     91,    125,    153,
-     162,    157,    148,    141,
-     153,    199,    232,    234,
-     222,    198,    163,    138,
-     134,    149,    171,    167,
-     140,    113,     79,     53,
-      58,     79,    108,    133,
-     137,    130,    121,    105,
-     114,    159,    197,    214,
-     224,    204,    170,    141,
-     123,    132,    147,    132,
-     109,     84,     35,      1,
-       5,     16,     34,     51,
-      44,     30,     14,      4,
-      38,     97,    144,    180,
-     196,    187,    168,    155,
-     161,    197,    222,    222,
-     214,    185,    135,     95,
-      79,     93,    119,    133,
-     131,    122,     98,     80,
-      94,    130,    165,    191,
-     202,    194,    182,    172,
-     177,    201,    213,    201,
-     181,    149,    104,     66,
-      57,     65,     77,     78,
-      66,     50,     25,      3,
-      21,     70,    117,    149,
-     162,    158,    147,    131,
-     133,    169,    204,    214,
-     207,    181,    141,    112,
-      99,    104,    114,    162,
-     172,    154,    125,     71,
-      39,     62,    101,    148,
-     185,    171,    136,    105,
-      78,     90,    147,    188,
-     202,    192,    142,     93,
-      74,     78,    120,    174,
-     186,    170,    138,     84,
-      60,     81,    111,    160,
-     196,    176,    144,    114,
-      78,     94,    154,    196,
-     224,    227,    176,    125,
-      99,     88,    124,    173,
-     170,    151,    115,     45,
-      13,     31,     55,    102,
-     133,    109,     75,     32,
-       1,     35,     91,    140,
-     188,    188,    153,    125,
-     102,    110,    168,    210,
-     220,    217,    168,    105,
-      79,     75,    107,    163,
-     184,    171,    146,    100,
-      70,     93,    134,    177,
-     213,    202,    162,    131,
-     104,    108,    155,    188,
-     193,    184,    134,     74,
-      46,     42,     69,    115,
-     127,    111,     87,     44,
-      18,     49,    103,    157,
-     199,    195,    161,    132,
-     101,    107,    159,    200,
-     216,    211,    163,    107,
-      87,     85,    114,    130,
-     202,    213,    191,    154,
-      80,     46,     78,    114,
-     165,    209,    174,    117,
-      75,     31,     46,    113,
-     152,    174,    166,     97,
-      42,     30,     40,    102,
-     178,    196,    188,    155,
-      87,     69,    104,    135,
-     196,    236,    195,    145,
-     103,     53,     76,    146,
-     188,    223,    221,    149,
-      94,     75,     69,    126,
-     195,    199,    184,    141,
-      58,     33,     61,     93,
-     158,    192,    152,    107,
-      45,      1,     39,     88,
-     137,    191,    174,    121,
-      93,     65,     77,    154,
-     203,    219,    221,    159,
-      90,     78,     82,    124,
-     199,    218,    196,    165,
-     100,     64,     97,    133,
-     176,    216,    186,    125,
-      86,     49,     56,    122,
-     165,    179,    178,    116,
-      52,     38,     41,     80,
-     149,    164,    145,    115,
-      57,     31,     74,    126,
-     183,    232,    211,    157,
-     119,     77,     85,    148,
-     188,    208,    206,    143,
-      84,     77,     83,    130,
-      90,     82,     58,     65,
-      78,     72,     93,    140,
-     157,    158,    177,    178,
-     153,    154,    175,    174,
-     164,    170,    161,    128,
-     119,    139,    148,    151,
-     170,    167,    134,    116,
-     114,    101,    106,    133,
-     135,    120,    120,     99,
-      56,     56,     85,     91,
-     112,    169,    183,    147,
-     143,    159,    131,    123,
-     185,    211,    168,    160,
-     155,     68,      7,     42,
-      47,     22,     73,    105,
-      42,     13,     41,     28,
-      37,    123,    176,    188,
-     230,    236,    183,    174,
-     188,    162,    167,    210,
-     192,    140,    124,     89,
-      25,     20,     59,     70,
-      87,    130,    137,    113,
-     116,    128,    130,    166,
-     221,    242,    251,    255,
-     220,    173,    157,    140,
-     118,    127,    129,     93,
-      66,     54,     22,      6,
-      37,     67,     83,    120,
-     156,    158,    159,    178,
-     189,    196,    212,    217,
-     201,    185,    160,    120,
-      98,     93,     80,     76,
-      90,    108,     89,     71,
-      90,     90,     70,     87,
-     111,    106,    120,    150,
-     148,    142,    165,    173,
-     164,    173,    178,    158,
-     150,    163,    166,    168,
-     179,    169,    138,    114,
-      97,     78,     79,     97,
-     102,     95,     91,     76,
-      52,     45,     60,     83,
-     112,    149,    174,    179,
-     167,    151,    146,    151,
-     158,    177,    193,    171,
-     128,     91,     43,      1,
-       9,     35,     44,     63,
-      78,     49,     19,     33,
-      56,     86,    147,    200,
-     214,    221,    214,    181,
-     159,    167,    169,    170,
-     183,    173,    130,     92,
-      65,     39,     36,     73,
-     109,    126,    145,    155,
-     142,    131,    143,    163,
-     189,    224,    247,    247,
-     232,    200,    162,    142,
-     132,    125,    131,    126,
-     103,     90,     83,     58,
-      51,     67,     63,     59,
-      93,    121,    126,    152,
-     177,    170,    176,    197,
-     190,    182,    202,    194,
-     161,    156,    148,    110,
-      97,    108,    140,    128,
-     105,     96,     82,     53,
-      34,     41,     62,     88,
-     109,    124,    131,    128,
-     127,    141,    159,    169,
-     184,    199,    203,    201,
-     198,    186,    163,    138,
-     113,     95,     80,     65,
-      58,     49,     27,     15,
-      15,     11,     21,     56,
-      88,    112,    146,    173,
-     180,    175,    158,    143,
-     147,    156,    170,    203,
-     210,    163,    115,     80,
-      37,     21,     49,     78,
-      95,    108,     80,     20,
-       1,     23,     47,     90,
-     152,    194,    213,    217,
-     188,    152,    151,    168,
-     182,    209,    223,    182,
-     118,     80,     53,     36,
-      57,     98,    124,    145,
-     154,    130,     98,     99,
-     118,    143,    183,    224,
-     248,    251,    221,    176,
-     155,    158,    156,    163,
-     183,    180,    147,    116,
-      93,     69,     51,     43,
-      47,     75,    114,    132,
-     131,    132,    142,    157,
-     173,    190,    213,    238,
-     237,    210,    187,    165,
-     142,    135,    140,    176,
-     161,    143,    131,    112,
-      98,    101,    110,    113,
-     111,    105,     92,     80,
-      77,     88,    106,    124,
-     138,    147,    148,    147,
-     151,    163,    172,    175,
-     171,    159,    135,    109,
-      93,     79,     64,     57,
-      57,     45,     28,     23,
-      24,     28,     47,     85,
-     120,    140,    149,    149,
-     138,    131,    142,    170,
-     197,    211,    205,    176,
-     129,     82,     57,     56,
-      67,     79,     86,     75,
-      41,     13,     11,     23,
-      52,    106,    162,    192,
-     200,    198,    182,    167,
-     172,    193,    213,    225,
-     217,    184,    136,     92,
-      61,     53,     68,     94,
-     115,    126,    122,    104,
-      91,     97,    120,    158,
-     208,    245,    255,    248,
-     229,    199,    175,    174,
-     180,    179,    175,    164,
-     135,    103,     88,     88,
-      95,    107,    121,    127,
-     122,    115,    115,    121,
-     133,    144,    153,    163,
-     163,    151,    146,    154,
-     156,    157,    170,    176,
-     172,    147,    130,    115,
-      90,     82,     87,     87,
-      94,    109,    106,     97,
-     105,    110,    103,    109,
-     120,    109,     92,     94,
-     101,    105,    124,    147,
-     150,    144,    142,    138,
-     135,    143,    150,    147,
-     139,    122,     84,     51,
-      36,     25,     21,     42,
-      68,     71,     68,     74,
-      65,     56,     82,    122,
-     150,    183,    214,    204,
-     170,    147,    127,    110,
-     115,    128,    124,    107,
-      79,     35,      1,      1,
-      13,     36,     87,    131,
-     144,    151,    162,    152,
-     152,    189,    222,    231,
-     246,    247,    200,    152,
-     134,    110,     89,    104,
-     122,    113,    105,    101,
-      83,     75,     98,    130,
-     162,    202,    230,    235,
-     235,    231,    215,    205,
-     209,    208,    195,    184,
-     167,    131,    103,     96,
-      90,     90,    111,    120,
-     106,    107,    115,    105,
-     112,    150,    164,    161,
-     183,    193,    166,    156,
-     171,    164,    157,    172,
-     172,    155,    149,    143,
-     145,    139,    126,    123,
-     128,    132,    131,    130,
-     127,    111,     96,     98,
-      97,     88,     92,     95,
-      79,     79,    100,    106,
-     115,    145,    156,    153,
-     175,    187,    167,    163,
-     171,    152,    135,    127,
-     101,     74,     76,     65,
-      36,     39,     59,     52,
-      51,     76,     92,     98,
-     128,    162,    170,    186,
-     207,    195,    182,    192,
-     179,    147,    145,    136,
-     100,     88,     74,     37,
-      45,     66,     35,     35,
-      88,     83,     60,    117,
-     155,    139,    178,    224,
-     202,    210,    255,    229,
-     184,    191,    173,    125,
-     118,    110,     68,     63,
-      83,     58,     35,     72,
-     108,    105,    124,    163,
-     175,    187,    219,    213,
-     190,    212,    227,    191,
-     178,    192,    158,    120,
-     125,    115,     88,    106,
-     128,    117,    116,    125,
-     112,    114,    134,    128,
-     118,    139,    147,    125,
-     118,    127,    121,    118,
-     139,    155,    129,    127,
-     122,    126,    124,    109,
-      99,    100,     92,     84,
-      87,     83,     68,     68,
-      74,     66,     70,     91,
-      93,     85,    100,    108,
-      94,    102,    119,    101,
-      87,    108,    104,     68,
-      58,     55,     29,     25,
-      37,     16,      1,     25,
-      34,     26,     42,     52,
-      41,     63,     98,     90,
-      84,    113,    123,    110,
-     119,    126,    115,    122,
-     128,     99,     82,     93,
-      81,     62,     75,     80,
-      69,     89,    110,     96,
-     102,    135,    135,    133,
-     168,    182,    172,    194,
-     207,    179,    182,    211,
-     192,    165,    177,    171,
-     143,    146,    149,    126,
-     134,    163,    153,    142,
-     175,    198,    191,    199,
-     218,    220,    231,    248,
-     235,    219,    226,    215,
-     186,    186,    193,    174,
-     169,    180,    167,    153,
-     170,    177,    170,    184,
-     195,    186,    189,    200,
-     184,    164,    169,    171,
-     154,    142,    141,    135,
-     126,    124,    129,    150,
-     169,    148,    129,    127,
-     116,    104,    101,     91,
-      89,     94,     85,     83,
-     107,    112,     89,     97,
-     109,     76,     54,     70,
-      63,     35,     42,     55,
-      34,     20,     30,     26,
-      12,     13,     18,      9,
-       3,      2,      2,      6,
-      14,     19,     30,     44,
-      34,     20,     31,     40,
-      23,     28,     58,     58,
-      45,     70,     87,     73,
-      85,    108,     93,     84,
-     106,    103,     87,    101,
-     112,    106,    120,    136,
-     132,    140,    144,    126,
-     127,    149,    144,    141,
-     174,    188,    173,    188,
-     211,    196,    184,    202,
-     209,    203,    213,    224,
-     217,    204,    204,    202,
-     192,    196,    214,    224,
-     216,    214,    223,    227,
-     223,    226,    240,    244,
-     234,    230,    239,    240,
-     232,    241,    255,    251,
-     247,    255,    251,    229,
-     213,    210,    197,    175,
-     165,    161,    139,    112,
-     103,     97,     74,     71,
-     103,    120,    123,    150,
-     131,    115,    109,    122,
-     114,    100,    108,    114,
-     105,    106,     99,     71,
-      56,     60,     48,     40,
-      63,     74,     55,     60,
-      75,     60,     56,     89,
-     102,     97,    115,    127,
-     102,     85,     79,     59,
-      40,     41,     38,     25,
-      22,     20,      8,      4,
-      11,     19,     33,     58,
-      78,     87,     99,    109,
-     109,    113,    131,    138,
-     137,    146,    142,    112,
-      95,     90,     68,     57,
-      74,     78,     73,     92,
-     102,     93,    104,    124,
-     131,    150,    185,    199,
-     200,    212,    212,    193,
-     190,    199,    189,    176,
-     179,    167,    137,    130,
-     135,    122,    123,    152,
-     163,    160,    184,    205,
-     200,    207,    229,    235,
-     238,    254,    255,    240,
-     227,    211,    189,    179,
-     178,    169,    170,    177,
-     167,    156,    166,    170,
-     163,    177,    202,    199,
-     192,    206,    201,    173,
-     177,    186,    160,    143,
-     158,    144,    113,    118,
-     131,    142,    142,    135,
-     122,    110,     97,     88,
-      85,     84,     81,     73,
-      63,     53,     47,     44,
-      42,     40,     34,     21,
-      11,      5,      2,      7,
-      19,     28,     33,     34,
-      30,     24,     22,     21,
-      23,     29,     31,     28,
-      22,     15,      5,      1,
-       2,      7,     15,     22,
-      28,     32,     34,     36,
-      43,     55,     67,     81,
-      94,    101,    103,    103,
-      99,     96,    100,    104,
-     109,    113,    113,    111,
-     108,    106,    108,    116,
-     126,    138,    152,    162,
-     167,    172,    178,    183,
-     191,    202,    212,    217,
-     216,    212,    207,    200,
-     195,    197,    200,    202,
-     205,    206,    202,    201,
-     204,    211,    220,    230,
-     242,    250,    253,    252,
-     252,    249,    246,    248,
-     253,    250,    244,    239,
-     228,    214,    206,    205,
-     203,    203,    205,    205,
-     197,    189,    185,    183,
-     184,    189,    194,    194,
-     185,    174,    163,    151,
-     143,    142,    142,    149,
-     151,    146,    136,    119,
-     103,     91,     86,     87,
-      84,     73,     64,     63,
-      59,     57,     63,     63,
-      47,     29,     17,      5,
-       1,     11,     27,     37,
-      41,     39,     34,     27,
-      21,     27,     42,     53,
-      59,     63,     58,     41,
-      30,     28,     29,     34,
-      45,     54,     55,     48,
-      41,     40,     43,     52,
-      72,     95,    107,    112,
-     115,    108,     99,    104,
-     117,    127,    138,    145,
-     143,    131,    117,    109,
-     111,    119,    132,    148,
-     158,    155,    151,    151,
-     151,    156,    176,    199,
-     212,    216,    216,    207,
-     193,    186,    190,    198,
-     203,    210,    211,    199,
-     184,    178,    178,    180,
-     192,    210,    223,    225,
-     222,    219,    214,    212,
-     219,    235,    245,    245,
-     242,    233,    212,    194,
-     193,    194,    194,    198,
-     201,    190,    171,    160,
-     154,    150,    156,    172,
-     182,    180,    173,    164,
-     150,    139,    142,    146,
-     144,    142,    141,    141,
-     138,    133,    128,    122,
-     110,     92,     76,     61,
-      53,     52,     53,     51,
-      45,     33,     21,     11,
-       4,      1,      3,      6,
-       6,      8,      9,      7,
-       7,      5,      4,     11,
-      20,     30,     43,     52,
-      52,     51,     49,     45,
-      44,     50,     54,     59,
-      60,     55,     50,     48,
-      44,     48,     60,     72,
-      83,     96,     99,     99,
-     106,    112,    118,    132,
-     147,    153,    157,    156,
-     148,    142,    140,    142,
-     149,    155,    155,    157,
-     158,    152,    149,    157,
-     168,    180,    194,    204,
-     209,    211,    208,    207,
-     209,    213,    221,    228,
-     226,    220,    213,    203,
-     195,    192,    195,    201,
-     207,    210,    211,    208,
-     203,    205,    214,    222,
-     230,    242,    245,    239,
-     232,    225,    216,    213,
-     213,    211,    205,    197,
-     185,    171,    157,    150,
-     150,    151,    153,    156,
-     157,    152,    147,    146,
-     121,    121,    118,    117,
-     121,    122,    121,    122,
-     121,    117,    109,     98,
-      89,     82,     72,     63,
-      57,     46,     36,     33,
-      31,     27,     24,     23,
-      21,     19,     20,     22,
-      21,     17,     11,      6,
-       2,      1,      6,     16,
-      26,     37,     45,     51,
-      53,     56,     60,     67,
-      75,     80,     83,     84,
-      79,     71,     69,     69,
-      67,     74,     84,     85,
-      86,     93,     96,     99,
-     110,    125,    136,    149,
-     160,    164,    166,    165,
-     164,    168,    171,    173,
-     175,    176,    169,    161,
-     158,    157,    157,    162,
-     172,    180,    183,    186,
-     193,    195,    199,    210,
-     219,    223,    227,    230,
-     227,    220,    215,    211,
-     209,    207,    205,    204,
-     199,    192,    188,    189,
-     191,    193,    203,    211,
-     213,    216,    220,    218,
-     215,    218,    219,    214,
-     210,    205,    195,    184,
-     173,    163,    154,    146,
-     140,    137,    131,    124,
-     121,    156,    155,    145,
-     135,    129,    123,    117,
-     117,    119,    114,    101,
-      87,     73,     58,     49,
-      46,     44,     40,     40,
-      39,     33,     24,     16,
-       9,      5,      8,     17,
-      24,     25,     23,     16,
-       7,      1,      1,      7,
-      15,     27,     38,     47,
-      54,     56,     52,     48,
-      48,     51,     55,     66,
-      76,     78,     76,     77,
-      73,     69,     78,     92,
-     101,    112,    128,    132,
-     128,    130,    135,    138,
-     144,    156,    164,    165,
-     164,    160,    155,    151,
-     151,    156,    165,    169,
-     167,    170,    171,    165,
-     166,    179,    186,    189,
-     200,    209,    204,    200,
-     203,    203,    200,    205,
-     211,    211,    209,    204,
-     197,    193,    190,    190,
-     197,    202,    202,    206,
-     210,    204,    200,    207,
-     211,    210,    217,    225,
-     220,    212,    211,    205,
-     193,    191,    194,    190,
-     183,    181,    176,    165,
-     156,    154,    153,    152,
-     152,    156,    163,    152,
-     138,    131,    133,    132,
-     127,    121,    113,     96,
-      76,     64,     59,     55,
-      55,     57,     51,     37,
-      26,     19,     14,     14,
-      17,     17,     14,     11,
-       8,      5,      3,      3,
-       7,      8,      4,      1,
-       4,      9,     18,     31,
-      45,     53,     48,     38,
-      35,     38,     42,     54,
-      75,     87,     85,     84,
-      85,     80,     79,     93,
-     110,    121,    130,    137,
-     131,    120,    120,    125,
-     132,    144,    156,    161,
-     157,    149,    143,    144,
-     145,    151,    167,    180,
-     180,    176,    176,    170,
-     163,    171,    189,    198,
-     202,    207,    205,    192,
-     186,    190,    194,    198,
-     207,    213,    210,    203,
-     196,    191,    190,    195,
-     205,    217,    220,    213,
-     209,    207,    199,    200,
-     213,    220,    217,    221,
-     220,    205,    194,    195,
-     195,    193,    200,    206,
-     200,    189,    181,    175,
-     170,    171,    179,    184,
-     179,    170,    163,    155,
-     155,    147,    135,    126,
-     120,    110,    102,    104,
-     103,     93,     85,     78,
-      67,     56,     52,     49,
-      45,     41,     39,     37,
-      30,     17,      8,      5,
-       1,      2,     13,     18,
-      14,     10,      8,      4,
-       2,      9,     19,     24,
-      29,     36,     43,     44,
-      46,     53,     59,     58,
-      60,     71,     79,     82,
-      88,     96,     95,     93,
-      98,    103,    104,    109,
-     119,    125,    126,    128,
-     131,    135,    135,    139,
-     148,    154,    155,    160,
-     165,    162,    158,    164,
-     169,    169,    172,    179,
-     180,    175,    174,    179,
-     180,    180,    187,    194,
-     193,    193,    195,    195,
-     192,    196,    202,    206,
-     207,    207,    208,    207,
-     199,    198,    205,    207,
-     204,    209,    212,    205,
-     200,    202,    199,    195,
-     200,    206,    205,    203,
-     201,    199,    195,    190,
-     192,    195,    192,    190,
-     191,    188,    177,    170,
-     168,    162,    156,    155,
-     170,    194,    214,    229,
-     240,    245,    243,    231,
-     213,    189,    162,    132,
-     107,     89,     79,     76,
-      77,     80,     83,     84,
-      84,     81,     73,     62,
-      53,     50,     49,     51,
-      54,     58,     63,     65,
-      65,     65,     65,     65,
-      65,     68,     72,     80,
-      87,     97,    106,    114,
-     120,    125,    132,    138,
-     142,    145,    149,    151,
-     149,    143,    133,    120,
-     105,     92,     82,     78,
-      82,     96,    119,    149,
-     180,    209,    233,    248,
-     255,    252,    243,    229,
-     213,    195,    177,    162,
-     150,    139,    128,    117,
-     108,    102,     98,     98,
-     100,    104,    110,    115,
-     116,    114,    110,    105,
-      99,     93,     90,     90,
-      95,    100,    108,    117,
-     124,    126,    126,    127,
-     126,    125,    124,    128,
-     137,    148,    160,    172,
-     184,    189,    188,    183,
-     173,    159,    142,    126,
-     113,    105,    101,    104,
-     111,    121,    132,    148,
-     170,    145,    168,    191,
-     211,    228,    242,    248,
-     244,    227,    201,    169,
-     136,    107,     88,     82,
-      86,     97,    111,    122,
-     130,    133,    131,    123,
-     114,    108,    106,    106,
-     108,    109,    111,    113,
-     112,    109,    105,    102,
-      97,     92,     89,     87,
-      88,     92,     99,    108,
-     119,    130,    138,    144,
-     147,    147,    143,    140,
-     136,    132,    127,    119,
-     105,     88,     70,     53,
-      40,     38,     48,     74,
-     111,    153,    194,    227,
-     248,    255,    249,    233,
-     214,    194,    175,    162,
-     152,    144,    136,    127,
-     116,    106,    100,     97,
-     100,    108,    120,    131,
-     140,    143,    142,    137,
-     129,    119,    111,    105,
-     102,    103,    104,    107,
-     111,    114,    114,    113,
-     111,    110,    107,    105,
-     105,    109,    118,    131,
-     146,    162,    173,    177,
-     172,    158,    135,    109,
-      83,     62,     51,     49,
-      57,     71,     88,    105,
-     123,    145,    135,    157,
-     179,    200,    221,    239,
-     250,    249,    233,    206,
-     171,    137,    106,     85,
-      77,     83,     98,    114,
-     130,    140,    146,    145,
-     139,    131,    126,    125,
-     126,    128,    130,    132,
-     133,    131,    126,    121,
-     114,    106,     97,     90,
-      87,     87,     92,    101,
-     113,    128,    141,    150,
-     154,    154,    149,    142,
-     135,    129,    125,    120,
-     113,    100,     82,     61,
-      40,     25,     19,     28,
-      55,     96,    142,    189,
-     225,    248,    255,    247,
-     229,    207,    186,    168,
-     156,    148,    143,    136,
-     127,    115,    105,     97,
-      93,     96,    106,    120,
-     135,    148,    156,    157,
-     154,    145,    134,    124,
-     115,    110,    107,    106,
-     106,    109,    111,    111,
-     110,    110,    109,    106,
-     102,    101,    103,    113,
-     126,    143,    161,    174,
-     179,    173,    154,    127,
-      95,     64,     41,     28,
-      28,     40,     58,     78,
-      97,    115,    135,    125,
-     141,    161,    182,    207,
-     230,    247,    255,    247,
-     225,    190,    147,    104,
-      68,     44,     35,     40,
-      55,     76,     97,    115,
-     125,    129,    128,    126,
-     126,    131,    140,    151,
-     163,    171,    170,    159,
-     138,    112,     86,     66,
-      56,     60,     77,    106,
-     140,    173,    199,    214,
-     217,    208,    191,    171,
-     152,    137,    128,    122,
-     117,    108,     92,     71,
-      46,     23,      6,      1,
-      12,     41,     84,    134,
-     182,    220,    244,    253,
-     246,    228,    205,    182,
-     163,    150,    142,    138,
-     131,    119,    103,     82,
-      62,     44,     35,     40,
-      59,     88,    122,    155,
-     181,    196,    197,    184,
-     163,    137,    114,     95,
-      87,     90,     99,    109,
-     119,    124,    126,    125,
-     122,    122,    128,    142,
-     162,    184,    205,    219,
-     221,    210,    184,    147,
-     104,     64,     31,     12,
-       7,     15,     32,     54,
-      75,     94,    109,    125,
+const uint8_t wt_compressed_waves[] = {
+       0,      4,      0,     10,
+      59,      4,      0,     26,
+     119,      4,      0,     26,
+     179,      4,      0,     28,
+      13,      5,      0,     26,
+      75,      5,      0,     27,
+     161,      5,      0,     11,
+     246,      5,      6,     20,
+      82,      6,      6,     21,
+     187,      6,      0,     12,
+      22,      7,      9,     28,
+     122,      7,      0,      4,
+     218,      7,     11,     20,
+      52,      8,      0,      4,
+     154,      8,      0,      4,
+     246,      8,     14,     21,
+      96,      9,      0,     10,
+     164,      9,     16,     26,
+     229,      9,     16,     27,
+      50,     10,     16,     27,
+     132,     10,     16,     26,
+     205,     10,      0,     12,
+      42,     11,      0,     11,
+     120,     11,      0,     11,
+     195,     11,     23,     28,
+      30,     12,     23,     20,
+     120,     12,     23,     28,
+     222,     12,      0,     13,
+      76,     13,     27,     28,
+     167,     13,     27,     28,
+      15,     14,      0,      6,
+     143,     14,      0,      6,
+      13,     15,      0,      4,
+     113,     15,     32,     19,
+     199,     15,     32,     20,
+      39,     16,     32,     20,
+     141,     16,     32,     20,
+     240,     16,      0,     12,
+      84,     17,     37,     28,
+     179,     17,      0,     12,
+      19,     18,     39,     27,
+     107,     18,     39,     28,
+     204,     18,     39,     20,
+      47,     19,      0,     12,
+     143,     19,     43,     27,
+     231,     19,     43,     28,
+      71,     20,      0,     12,
+     166,     20,      0,     12,
+       3,     21,      0,     10,
+      69,     21,     48,     26,
+     131,     21,      0,     10,
+     194,     21,      0,      9,
+     249,     21,     51,     25,
+      46,     22,     51,     25,
+     100,     22,     51,     25,
+     157,     22,     51,     25,
+     214,     22,      0,     10,
+      18,     23,     56,     25,
+      70,     23,     56,     26,
+     131,     23,     56,     25,
+     188,     23,     56,     25,
+     238,     23,     56,     26,
+      42,     24,     56,     25,
+      88,     24,     56,     25,
+     142,     24,     56,     20,
+     240,     24,      0,      4,
+      76,     25,     65,     19,
+     159,     25,     65,     19,
+     243,     25,      0,     11,
+      70,     26,     68,     19,
+     148,     26,     68,     28,
+     242,     26,     68,     28,
+      83,     27,     68,     28,
+     176,     27,     68,     28,
+      15,     28,      0,     12,
+     111,     28,     74,     20,
+     203,     28,     74,     28,
+      40,     29,      0,      4,
+     144,     29,     77,     20,
+     250,     29,      0,      5,
+     101,     30,     79,     21,
+     206,     30,     79,     20,
+      52,     31,      0,      4,
+     147,     31,     82,     20,
+     237,     31,     82,     20,
+      73,     32,     82,     20,
+     169,     32,      0,      4,
+      10,     33,     86,     20,
+     103,     33,      0,     11,
+     184,     33,     88,     19,
+       2,     34,      0,     10,
+      75,     34,     90,     18,
+     135,     34,     90,     19,
+     209,     34,      0,     10,
+      13,     35,     93,     25,
+      67,     35,     93,     27,
+     148,     35,      0,     10,
+     206,     35,     96,     26,
+      11,     36,     96,     25,
+      65,     36,     96,     25,
+     117,     36,     96,     25,
+     170,     36,     96,     25,
+     228,     36,     96,     26,
+      32,     37,     96,     26,
+      91,     37,     96,     26,
+     152,     37,     96,     26,
+     212,     37,     96,     26,
+      18,     38,     96,     26,
+      78,     38,     96,     26,
+     138,     38,      0,     10,
+     197,     38,    109,     25,
+     251,     38,    109,     26,
+      64,     39,    109,     27,
+     144,     39,    109,     27,
+     228,     39,    109,     27,
+      59,     40,    109,     27,
+     147,     40,    109,     27,
+     235,     40,    109,     27,
+      65,     41,    109,     27,
+     147,     41,    109,     27,
+     228,     41,      0,     11,
+      54,     42,    120,     26,
+     122,     42,    120,     27,
+     208,     42,    120,     27,
+      39,     43,      0,     12,
+     129,     43,    124,     21,
+     236,     43,    124,     21,
+      93,     44,    124,     28,
+     186,     44,      0,     12,
+      22,     45,    128,     19,
+     103,     45,    128,     20,
+     193,     45,    128,     20,
+      30,     46,    128,     20,
+     126,     46,    128,     21,
+     238,     46,      0,     12,
+      77,     47,    134,     27,
+     160,     47,      0,     12,
+     251,     47,    136,     27,
+      74,     48,      0,     11,
+     158,     48,    138,     26,
+     229,     48,      0,     11,
+      55,     49,    140,     26,
+     124,     49,      0,     11,
+     199,     49,    142,     26,
+       3,     50,      0,      9,
+      60,     50,    144,     25,
+     108,     50,    144,     21,
+     217,     50,    144,     20,
+      64,     51,    144,     20,
+     169,     51,      0,      5,
+      22,     52,    149,     19,
+     108,     52,    149,     20,
+     204,     52,      0,     12,
+      43,     53,    152,     19,
+     118,     53,      0,      9,
+     172,     53,    154,     26,
+     240,     53,      0,     11,
+      69,     54,      0,      9,
+     124,     54,    157,     24,
+     165,     54,    157,     25,
+     210,     54,    157,     27,
+      28,     55,    157,     27,
+     107,     55,    157,     28,
+     201,     55,    157,     28,
+      44,     56,    157,     25,
+      98,     56,    157,     26,
+     158,     56,    157,     27,
+     245,     56,    157,     27,
+      70,     57,    157,     27,
+     151,     57,    157,     28,
+     243,     57,    157,     28,
+      85,     58,    157,     28,
+     178,     58,      0,      8,
+     214,     58,      0,      1,
+      22,     59,      0,      8,
+      51,     59,      0,      3,
+     133,     59,      0,      9,
+     187,     59,    176,     24,
+     221,     59,    176,     24,
+       5,     60,      0,      8,
+      26,     60,      0,      9,
+      71,     60,      0,      2,
+     151,     60,      0,      9,
+     197,     60,      0,      4,
+      37,     61,      0,     10,
+      97,     61,    184,     25,
+     153,     61,    184,     26,
+     216,     61,      0,      8,
+     250,     61,      0,     10,
+      55,     62,    188,     25,
+     103,     62,    188,     25,
+     154,     62,    188,     19,
+     240,     62,      0,      4,
+      75,     63,    192,     28,
+     166,     63,      0,     11,
+     255,     63,      0,     11,
+      77,     64,    195,     26,
+     141,     64,    195,     20,
+     236,     64,      0,      5,
+      87,     65,    198,     21,
+     196,     65,      0,      5,
+      56,     66,    200,     22,
+     177,     66,    200,     22,
+      55,     67,      0,     10,
+     118,     67,    203,     26,
+     182,     67,    203,     26,
+     243,     67,    203,     26,
+      51,     68,    203,     26,
+     120,     68,    203,     29,
+     236,     68,    203,     22,
+     101,     69,    203,     21,
+     215,     69,    203,     20,
+      60,     70,    203,     19,
+     134,     70,      0,      9,
+     189,     70,    213,     25,
+     233,     70,    213,     26,
+      39,     71,    213,     26,
+     108,     71,    213,     27,
+     182,     71,    213,     27,
+      13,     72,    213,     28,
+     107,     72,    213,     26,
+     169,     72,    213,     26,
+     241,     72,    213,     27,
+      69,     73,    213,     27,
+     154,     73,    213,     27,
+     238,     73,    213,     27,
+      63,     74,    213,     27,
+     145,     74,      0,     11,
+     230,     74,    227,     26,
+      39,     75,    227,     27,
+     122,     75,    227,     27,
+     205,     75,    227,     27,
+      35,     76,      0,     12,
+     125,     76,    232,     28,
+     225,     76,    232,     29,
+      83,     77,    232,     30,
+     205,     77,    232,     21,
+      58,     78,    232,     20,
+     162,     78,    232,     28,
+       8,     79,      0,     12,
+     102,     79,    239,     20,
+     196,     79,      0,      5,
+      47,     80,    241,     20,
+     142,     80,      0,      4,
+     239,     80,      0,      4,
+      81,     81,      0,     10,
+     154,     81,    245,     26,
+     226,     81,    245,     26,
+      41,     82,      0,     10,
+     111,     82,    248,     26,
+     181,     82,    248,     27,
+       0,     83,    248,     26,
+      74,     83,      0,     10,
+     147,     83,    252,     26,
+     206,     83,    252,     26,
+      16,     84,    252,     27,
+       0,      0,      0,      0,
+       0,      0,    144,    118,
+      77,     95,    249,    165,
+     155,    108,    237,     46,
+     203,    155,    101,     89,
+     255,    116,     86,     77,
+     170,     21,    109,     73,
+     101,    146,     36,    236,
+      45,    176,     37,    254,
+     101,    205,    171,     73,
+      36,    213,     69,    164,
+     175,    102,    149,     77,
+     150,    110,    235,    223,
+      45,    201,    218,    117,
+     178,    180,      7,      0,
+     122,     97,    109,    212,
+      24,     42,    236,     42,
+     203,    180,    147,     68,
+     227,     71,    102,    147,
+     200,    214,     42,    187,
+     204,     55,    235,    213,
+      68,    169,     41,    145,
+     237,     41,     92,     58,
+      19,     69,    106,      2,
+     137,    191,    226,    251,
+      27,    179,    107,    217,
+     137,     90,    163,    250,
+      11,     29,     19,    221,
+      19,    105,     22,    242,
+     124,    242,     29,      0,
+       0,     64,    247,    214,
+      78,    239,     68,    190,
+     138,     85,    102,    210,
+     175,    125,    245,     34,
+     137,     54,    215,    206,
+     214,    217,    150,    253,
+     196,     74,    212,      5,
+      81,    174,     36,    215,
+     123,     16,    102,    209,
+     155,    204,    100,    241,
+     118,    214,     55,     59,
+     146,    171,     70,    218,
+      85,    109,    173,    165,
+     121,    197,     26,    226,
+      35,     55,      1,    200,
+     247,    245,    180,    130,
+     178,    126,     46,    198,
+     136,    225,      8,     53,
+     140,    124,    254,     89,
+     123,    165,     22,    148,
+     158,    134,     54,    140,
+      19,    151,     37,    196,
+     151,    196,    235,    246,
+     137,    227,     73,    182,
+      79,     67,     50,     69,
+      16,     52,    150,     44,
+      99,    241,     20,      7,
+      78,     70,    178,     63,
+     178,    108,     85,    210,
+     183,    229,    100,     77,
+     125,    153,     53,    249,
+      59,     77,    191,     10,
+     231,     80,    196,    147,
+     181,    101,    180,    103,
+      26,    113,    223,    170,
+     189,    166,    182,    215,
+      20,    231,    181,    225,
+      53,      0,      0,     64,
+     168,    213,    197,    197,
+      92,    202,    101,    139,
+     180,     17,     18,    169,
+     200,    116,    178,     77,
+     103,    147,    216,    151,
+     123,     61,    182,    139,
+      85,    145,     41,    148,
+      28,     81,    194,    245,
+     156,    171,    113,    175,
+     196,     34,    200,    229,
+     170,    150,    181,    121,
+      68,    182,    182,    102,
+     169,    177,    244,    217,
+     168,     76,     85,     70,
+      47,    253,      4,      0,
+       8,     36,     99,    222,
+     108,    186,     37,     37,
+      99,     40,    237,    154,
+      38,    127,    132,     99,
+     246,    185,     38,    206,
+      41,    253,    209,    164,
+      78,     74,     90,    119,
+      60,    102,     43,    247,
+     170,    240,     56,     18,
+     201,     41,      0,    130,
+     192,     64,     81,    112,
+     112,    228,    192,     46,
+      58,     89,     70,    209,
+     198,    144,    132,     40,
+     121,    175,    150,    179,
+     166,     29,    206,     93,
+      47,     71,      3,     36,
+     201,    106,    200,    194,
+     114,    226,    204,    187,
+      26,    115,    191,     52,
+     249,      7,     65,    251,
+     213,      0,      0,    184,
+      59,     75,      6,    150,
+      22,     44,    177,    147,
+      21,    211,    153,     60,
+      72,    156,     65,     37,
+     179,     84,     59,    135,
+      40,     60,    165,    236,
+      11,    141,     17,    242,
+      29,     85,     12,     81,
+     197,     64,     25,    150,
+     164,     60,      7,     42,
+     192,     66,     19,    112,
+     221,    109,     95,    159,
+     235,    187,    111,    115,
+     149,    220,     32,     28,
+      75,     43,     88,     90,
+     187,     17,    213,    179,
+     100,     91,     25,    218,
+      10,    201,    232,    112,
+      66,    114,     67,     90,
+      83,     36,    206,     32,
+     151,     27,     88,    177,
+     143,    219,    181,    189,
+     104,    105,     86,    169,
+     135,     44,    132,    160,
+     175,    150,    219,     88,
+     218,     98,      8,     58,
+     143,     71,    202,     56,
+      22,    101,    226,      5,
+     202,    199,     40,    178,
+      97,     53,    133,    177,
+     228,    100,     39,    113,
+     190,     94,    238,    213,
+     186,    189,    196,    102,
+       6,    218,    198,    144,
+     201,     76,     27,    161,
+      48,     43,    109,    115,
+      58,    229,    187,    186,
+     100,     94,     98,    227,
+      84,    202,    117,     40,
+     145,     33,    245,    177,
+     131,     56,    157,    154,
+     173,    215,    151,    115,
+      20,     99,    214,    117,
+     115,      2,    213,    253,
+     158,    207,    122,     39,
+     105,    149,    136,    213,
+     109,     91,    203,    178,
+     117,     74,    207,    243,
+     222,    199,    213,    115,
+     246,    234,    122,    209,
+     200,     35,      6,    103,
+     183,    242,    219,    101,
+      26,    239,    167,    142,
+     163,     82,    213,    150,
+     193,    180,     47,    183,
+     241,    203,     30,    203,
+      39,     56,    172,    147,
+      36,    176,     77,    194,
+     252,    237,     36,    203,
+      20,    205,    150,    166,
+     252,     31,     90,    186,
+      50,     38,     37,    106,
+     138,    246,    153,     25,
+     246,    224,     11,     13,
+     191,     92,    169,    136,
+     165,     42,      7,     39,
+      38,    183,     29,     51,
+     214,    138,    102,    119,
+      73,     72,    101,     33,
+      13,     93,      3,      0,
+     124,    231,    141,     92,
+      75,     76,     49,     94,
+     167,    138,    219,    237,
+     226,    112,     83,    244,
+      86,     91,     83,    161,
+     165,    151,    180,    229,
+      58,     39,    253,     57,
+     212,     60,    134,    210,
+     203,    153,     51,     38,
+     211,     82,    148,    117,
+     181,     40,     34,      4,
+     236,     79,    127,    192,
+     224,     33,    169,    140,
+     133,     34,    159,    222,
+     236,    173,     63,    246,
+     163,     43,    238,    174,
+     253,    122,    127,     40,
+      41,     68,     81,     43,
+     169,    204,    182,     77,
+     107,     56,     55,    107,
+      63,    162,    105,    214,
+     160,     46,    123,    116,
+     207,      7,    224,     83,
+     170,    251,    218,    220,
+      85,     57,    235,     62,
+      65,     57,     76,     67,
+      80,     74,    138,     83,
+     144,    158,    185,    196,
+     137,     99,    208,     17,
+     230,    254,     69,    160,
+      36,     14,     63,     41,
+     223,     33,     80,     23,
+     211,     17,    145,    137,
+     139,    203,    116,     50,
+     133,     42,    193,      5,
+     126,      4,    232,     32,
+     226,     96,    245,    139,
+      61,    116,    199,     37,
+     235,    152,     88,    136,
+     128,    164,    227,    194,
+     122,    178,    146,    149,
+     106,    153,     45,    219,
+     147,    214,     96,    195,
+      32,     64,    201,    137,
+      16,     89,     21,     73,
+     228,     56,     99,    217,
+     126,    235,    227,     55,
+      53,     95,      0,    192,
+      30,     79,    162,     70,
+      39,     40,    113,    148,
+     109,    140,    244,    156,
+     255,    198,    152,    214,
+     170,    225,    191,     82,
+     202,     25,     99,    142,
+     254,     56,     91,    203,
+      12,    230,     32,     52,
+     158,     47,    145,    154,
+      57,    116,     45,    138,
+      40,     20,    203,    129,
+       8,    200,     21,     24,
+      14,     32,     66,    198,
+     133,     35,    147,     45,
+     110,     17,     24,    184,
+     159,     20,     97,     96,
+     118,    234,    224,    153,
+      93,    175,    251,     40,
+      74,     24,     81,     73,
+      55,     40,    209,    179,
+     114,    223,    156,     91,
+     131,    229,    180,    188,
+     119,     87,    214,    235,
+     146,      0,     16,    227,
+     183,    178,    178,     86,
+     121,     73,    169,    247,
+     133,    158,    198,    247,
+     166,    214,    216,    156,
+      17,    239,    182,    157,
+     155,     66,     50,    173,
+      68,    214,    108,      6,
+     141,     94,    102,     47,
+      66,    207,     79,     56,
+     183,    202,    133,     55,
+     181,    190,    135,     85,
+     100,    205,     45,      4,
+     253,     47,     10,    105,
+     174,     44,    213,    118,
+     111,     15,    246,    149,
+      44,     76,    159,     82,
+     176,    177,     98,    122,
+     182,    187,    218,    125,
+     122,    244,     39,     10,
+     253,     57,    178,    222,
+     187,     50,    138,    144,
+     123,    187,    179,      2,
+       0,    128,    210,    172,
+     213,    148,    102,     72,
+     241,     83,    139,     47,
+     228,    246,    222,      9,
+     213,    203,     29,     62,
+      25,      1,    238,     68,
+     233,     94,     34,    165,
+      77,    213,     96,     14,
+     100,     56,     30,     25,
+      76,    155,    138,    199,
+       8,     28,    167,     59,
+     179,     17,     16,    237,
+      10,      8,    235,      3,
+       4,     18,     27,     21,
+     114,     60,    137,    218,
+     176,    115,    194,     76,
+      62,     24,    181,    131,
+     237,    235,     24,     38,
+     193,    113,     37,    169,
+       8,     41,     28,    170,
+      10,     75,      3,     13,
+      99,    162,    108,    161,
+       5,    201,    120,     98,
+     183,    191,    158,    236,
+      25,    194,    179,    226,
+     242,      0,      0,    188,
+     220,    133,     16,    213,
+      48,    133,     54,     79,
+      56,    206,     90,    215,
+     216,    223,    187,    143,
+     179,    151,    253,     87,
+     224,    220,     50,     13,
+     197,    224,    105,    205,
+     216,      4,     78,    160,
+     172,     47,    164,    168,
+     148,     46,     17,    164,
+      69,     70,     52,     18,
+     144,     20,     62,     17,
+      68,    235,     82,    213,
+      95,    148,    181,    142,
+     121,    179,    135,     49,
+      10,    143,    147,     61,
+     172,    149,    217,    102,
+      53,    152,    253,    176,
+     142,    102,    221,    186,
+      90,     95,    161,    247,
+     210,    149,    148,     68,
+     177,    100,     53,     15,
+      89,     13,    120,    124,
+     111,     41,    215,    221,
+     150,     92,     81,    196,
+     161,    219,     26,    149,
+     233,    176,     79,      2,
+      93,     95,     85,     65,
+      88,      6,    109,    119,
+     249,     22,    145,    108,
+     120,    182,     87,     71,
+      17,    122,    163,    120,
+     122,    179,    193,     96,
+     118,     94,    146,    216,
+     226,    137,    158,     87,
+      68,     27,     15,     76,
+     152,     83,     80,    156,
+     224,    101,     81,    119,
+     142,     82,    112,    207,
+     161,    148,     68,    227,
+      51,    103,    116,    202,
+     199,    102,    137,    105,
+      85,     83,     80,    125,
+     149,     80,    149,    172,
+     118,    131,     86,    108,
+     224,    177,    116,    130,
+      60,    185,    255,    162,
+      13,    211,    145,    201,
+      31,    229,    201,     13,
+       0,      0,      0,      0,
+       0,      0,     16,    144,
+     232,    123,    159,    205,
+     203,    182,    201,    165,
+     189,    102,     52,     26,
+     169,    104,    212,    213,
+     114,     47,    172,     56,
+     225,    203,     37,    148,
+      20,    113,     26,      4,
+      66,    168,    215,     35,
+     119,    140,    115,    238,
+     251,    159,      8,    165,
+      74,     68,    171,    170,
+      23,    207,    100,    151,
+     127,    153,    137,    199,
+     172,     23,    147,    181,
+      66,     74,     68,      3,
+       1,    207,    104,    149,
+      14,     18,    169,    163,
+      88,    153,    178,    205,
+     122,    109,     30,     77,
+      58,    219,    162,     23,
+      35,     57,    154,    137,
+     216,    212,    149,    213,
+      35,     70,     35,     78,
+     182,    251,     49,    232,
+      33,    170,     82,    161,
+     181,    115,    216,     97,
+     245,    177,    180,     32,
+     133,     22,    117,     66,
+     166,    188,    238,    114,
+     138,     33,    140,    244,
+     132,     81,     88,    205,
+      62,      0,    240,     86,
+       7,     41,     71,    155,
+     102,    214,    179,    194,
+      75,    171,     51,    200,
+     149,    223,    107,    155,
+     163,     94,    136,    210,
+      41,     54,    206,    142,
+      63,     19,     34,    200,
+     144,    161,    102,    142,
+      91,    166,    174,    244,
+     116,    146,     85,    231,
+     219,    117,    135,    112,
+     114,      8,     49,    195,
+     190,    153,    255,    228,
+     164,     35,     78,    209,
+      10,     57,    136,    121,
+     203,    150,     27,     56,
+     215,     79,     15,     34,
+      85,    191,    100,    202,
+     255,     46,     56,    166,
+     131,     26,    196,     95,
+     112,    206,    134,      8,
+     106,    168,    148,    196,
+     174,     15,    231,    238,
+      51,     71,    164,    154,
+     255,    117,    245,    210,
+       8,    129,     34,      9,
+      57,    245,    118,     88,
+     134,    113,     85,     68,
+     162,    252,     24,    252,
+     107,    129,    210,      4,
+     217,    196,     39,    140,
+     195,    122,    243,     68,
+     146,    157,    164,     19,
+     248,    229,    125,    210,
+      32,     36,    186,      8,
+     110,    131,    127,    192,
+     218,      8,     20,    133,
+     110,     74,      8,    205,
+      59,    156,    195,     73,
+      64,    250,    233,    155,
+     168,    203,    171,    222,
+     139,    203,    168,    135,
+     254,    117,     82,    174,
+      48,    217,    219,    139,
+      16,    162,     68,    144,
+      33,     87,    187,    248,
+      48,      8,    112,      1,
+     135,      1,      1,     70,
+     100,    163,     80,    133,
+       4,     40,      3,    129,
+     161,     56,    129,     59,
+     135,     23,    188,    248,
+     178,      8,    165,     33,
+       8,    100,    148,    200,
+      14,    225,     40,     94,
+     193,     81,    174,     28,
+     193,     36,     76,     94,
+     167,     82,    213,    179,
+      54,    211,    180,     77,
+     255,    167,    163,     73,
+      73,     75,    177,    186,
+     223,    229,    164,    213,
+     122,     36,     18,     20,
+     218,     24,    150,    251,
+     124,    203,    185,    227,
+       4,     74,     87,     82,
+      73,    171,    133,     92,
+     156,    166,     14,     26,
+     207,    191,    152,      6,
+     154,     68,    232,    217,
+     208,    194,    240,    153,
+      28,    118,     20,      5,
+     162,    160,     80,     20,
+     241,    122,     22,    142,
+     253,     95,     93,    178,
+      72,     37,     43,    227,
+     225,     25,    254,     11,
+     156,    152,     21,      8,
+      26,     33,    253,    207,
+     184,     54,     63,    184,
+     145,      4,      0,      0,
+       0,    128,     47,    211,
+      83,    187,     23,    213,
+      42,    180,     17,     19,
+     147,    177,    194,    101,
+     228,     85,    134,    201,
+     139,    248,     52,    183,
+     167,     38,    175,    163,
+      84,      9,    147,    159,
+     171,     41,     37,    221,
+      27,    118,     83,    109,
+     188,     32,     72,    149,
+     158,      3,     99,    239,
+      40,    161,    171,     87,
+     157,    122,    255,     92,
+      29,    138,     66,     42,
+     233,    214,    154,    252,
+      52,    234,    149,    150,
+     194,     37,    230,    253,
+     159,     80,     33,      0,
+       0,      0,    224,    219,
+     139,     19,     46,    141,
+     250,    170,    170,    203,
+     147,    134,    112,    226,
+     235,    196,     69,     85,
+     174,     50,    242,    251,
+     106,    111,    171,    156,
+      54,    194,    232,     40,
+     185,    132,     51,    171,
+      74,    191,    112,     47,
+     132,    172,    251,     47,
+      39,     76,     56,    123,
+     121,    149,    161,     24,
+     181,    114,    149,     81,
+     182,     79,    137,    213,
+      39,    183,     67,    175,
+     250,    188,    237,     16,
+     156,    100,    164,    107,
+     163,     54,     14,    128,
+     173,    228,    245,    102,
+     184,    233,    213,    209,
+      67,     30,     75,    176,
+      35,    167,    152,     61,
+     208,     68,    130,     24,
+      46,    215,    199,    188,
+     134,    168,    211,     17,
+     212,    234,    176,     48,
+     121,    172,    162,    144,
+      16,     73,    132,    229,
+     248,     44,    243,    167,
+     166,     18,    212,     94,
+     183,    105,    154,    227,
+       8,     73,    232,    173,
+     133,    244,    206,     94,
+     229,     12,     33,    246,
+      18,     67,     49,    163,
+     115,    102,     80,    154,
+     244,    180,     57,    253,
+     107,    253,     86,    228,
+     168,      4,    205,      9,
+     222,    124,     39,    101,
+     165,      2,     72,     69,
+     158,    209,     93,    150,
+      50,    132,     89,    173,
+     225,    252,    246,    139,
+     125,    172,    116,    251,
+     143,     91,    136,    114,
+      89,    214,     55,     66,
+     233,     82,    138,     45,
+     229,    156,    164,     29,
+     159,    156,    213,     86,
+     237,    103,    100,     73,
+     207,    190,    195,     25,
+      87,    248,    151,    235,
+     114,     98,    214,     74,
+     216,     35,    116,    130,
+      84,    110,    216,     90,
+      33,    165,     54,    243,
+     145,    180,     88,     76,
+     190,    101,    161,    162,
+     136,      9,    135,    193,
+      81,    117,    250,    168,
+     220,     53,    117,    138,
+      28,     12,    199,      5,
+     176,    105,     20,    156,
+     197,    149,     62,    117,
+      82,    118,    102,     61,
+     123,     40,     34,    109,
+      79,    174,     51,     81,
+      42,    130,     49,    241,
+     222,    210,     41,    194,
+     117,    237,     35,    201,
+     114,    121,    222,     92,
+      74,    138,     83,    115,
+      37,     94,    243,    164,
+     174,     29,    195,    222,
+      36,    146,    202,    229,
+      49,     43,      9,    162,
+     178,     96,    112,     55,
+      26,     26,    117,    113,
+     113,    156,    132,     64,
+      72,    151,     57,    118,
+      79,    218,     20,     70,
+     100,    249,     60,    133,
+       8,     89,    114,    225,
+     128,     49,      8,    128,
+      68,    173,    176,    249,
+      96,     32,     80,     65,
+      22,     13,    152,    252,
+     171,      1,     16,     94,
+     234,    252,     50,    217,
+      28,    129,     66,     89,
+     183,    179,    193,    248,
+      86,      2,    157,    162,
+     152,    141,    166,    167,
+     149,    233,    218,    207,
+     227,     93,     35,    145,
+      80,    113,    252,    190,
+     251,    233,     85,    130,
+     234,    117,    152,    182,
+      80,     38,    200,     15,
+     147,    211,     49,    181,
+      26,    149,     54,    186,
+      76,     28,    198,     64,
+      79,     76,     83,     49,
+     114,    179,     31,    122,
+     116,    132,     29,     19,
+      62,    174,     75,     79,
+      78,    216,    184,    184,
+     236,    171,     64,    173,
+     150,     60,     22,    163,
+     231,    204,    180,    114,
+     233,     96,    227,    226,
+     120,    100,    212,    250,
+     210,    200,    200,     54,
+     170,    200,    136,    194,
+     159,    199,    187,      3,
+     145,     93,     40,    200,
+     164,    139,    137,    207,
+     202,     16,    161,    144,
+     185,     92,    112,     77,
+      13,     10,     36,    201,
+     129,    203,    241,    101,
+      58,     93,    112,    108,
+     107,    199,    174,      9,
+     167,    157,     63,    119,
+     200,    162,    210,     38,
+     199,    115,     36,     89,
+     212,     44,    139,    181,
+      26,     65,     26,    205,
+     250,    183,    117,    169,
+     141,    121,    202,    106,
+     163,    133,     26,    198,
+     187,    227,    137,     33,
+     142,    249,    119,     30,
+      82,     29,    127,    204,
+      17,     99,     29,    163,
+     204,    178,    250,     20,
+     194,    120,     39,    173,
+     120,     90,    219,    166,
+     229,     31,     36,    141,
+      46,     40,     25,    224,
+     128,      6,    126,    155,
+     200,    107,    192,    176,
+     222,    129,    114,     81,
+     237,    220,    122,    230,
+      93,    181,     35,      4,
+      60,     30,     24,      5,
+       8,      8,     20,    124,
+      88,    156,      0,     42,
+     178,    236,    192,     60,
+     145,     36,    178,     48,
+     194,     64,    152,      2,
+      11,    155,     70,     35,
+     106,     76,      7,     39,
+      65,     25,     72,     28,
+     219,     30,    157,    102,
+     148,     56,    219,     37,
+      56,    191,     42,    242,
+     219,     31,     47,    171,
+     146,    110,    240,    109,
+       7,     73,     38,     29,
+     156,    127,      8,    232,
+      12,      9,    195,    212,
+       5,    186,    133,     99,
+      27,     84,      9,    124,
+     214,    140,    152,     33,
+     131,    157,     57,    210,
+     113,     34,    123,    225,
+      46,    123,    102,    200,
+     210,    181,    103,     88,
+     234,    165,      8,     92,
+     112,    112,     33,    173,
+     233,    183,    143,    188,
+     114,    178,     43,    182,
+       7,     20,    122,     60,
+     158,    165,     67,     94,
+     116,    204,    253,     64,
+      38,    154,    216,    142,
+     125,     84,     40,    230,
+     216,    190,     51,    213,
+      16,    149,     19,    203,
+      29,    145,    178,    225,
+      46,    120,    124,      8,
+      94,    172,    122,    146,
+      46,    238,     93,    221,
+     224,    104,     99,    186,
+      20,     19,    109,     25,
+      90,    237,    180,     73,
+      89,     96,    178,     66,
+     164,    105,     53,     58,
+     174,    181,    137,    114,
+     100,     44,    163,     62,
+     105,     39,     49,    181,
+      71,     15,    107,     22,
+     188,    191,     79,     50,
+     152,    159,      9,     57,
+     225,     75,      6,    216,
+     120,     23,     83,      2,
+     111,      7,      9,    229,
+      51,      6,     52,    164,
+      13,    184,    104,    166,
+     103,    243,     73,    178,
+      26,    230,     23,    173,
+     196,    175,    213,    119,
+     247,     91,    136,    117,
+      66,    247,     88,     98,
+      85,    254,    108,    238,
+      36,      2,    140,    182,
+     228,     95,      1,    215,
+     122,    237,    216,    144,
+      59,    187,    109,     40,
+      90,     30,    202,     25,
+     254,     74,    168,    252,
+     240,     45,    210,     18,
+      99,     59,    142,    210,
+     118,    178,    178,     36,
+      71,    149,     27,    118,
+     228,    208,     54,     71,
+      77,    130,    149,     17,
+     106,    107,     76,    136,
+      81,    183,    165,    128,
+      58,     87,    166,    178,
+     196,     28,    184,    137,
+     149,     43,    243,     73,
+      50,    236,     49,     23,
+      93,     84,    206,    185,
+      38,    179,     52,    165,
+      28,    239,    155,      2,
+      13,      0,     64,      6,
+      60,    192,    160,    162,
+     138,    108,     13,     34,
+      84,      5,      2,    106,
+     182,     13,    223,    245,
+      95,    214,     12,    102,
+     167,     68,    107,    164,
+     195,    177,     70,    215,
+     118,    205,     33,    182,
+      18,    165,    193,     30,
+      20,    165,     27,     83,
+      17,    212,    204,    193,
+     114,     73,    205,    195,
+     225,     58,     68,      8,
+     197,    107,    162,    158,
+     198,    137,    231,     58,
+     147,    152,     76,     73,
+      26,    183,     10,    158,
+     121,    200,    157,    205,
+      55,    245,     28,    230,
+      10,     18,    245,     38,
+     138,    244,    109,    142,
+     125,      7,     66,     89,
+      36,    100,     80,     50,
+     174,    137,    168,      0,
+      30,     96,      1,    237,
+     225,     75,     34,    133,
+      18,    137,    197,     77,
+     150,    214,    229,     55,
+      53,    241,    155,    197,
+      89,    129,     76,    231,
+      13,    177,    163,     58,
+     111,    162,    145,    197,
+      49,    140,     36,    158,
+     193,     15,     20,    164,
+     130,    101,     52,      8,
+     116,     96,     96,    139,
+       8,     99,    227,    239,
+      75,    182,     98,     74,
+      79,    102,     93,     32,
+     219,    193,     47,    154,
+      76,    220,    183,    200,
+     104,     43,     44,    203,
+     153,     32,    233,    234,
+       4,     10,    141,    177,
+       5,    194,      0,    139,
+       7,     56,      9,    124,
+     200,    174,     78,     68,
+      50,    192,    193,    113,
+     141,     38,    146,     60,
+     134,    128,     70,    107,
+      99,    156,    203,    253,
+      66,    119,    102,     87,
+     219,     59,     89,    155,
+      94,     28,     51,    164,
+     146,    229,    188,     29,
+      47,     73,    207,     99,
+      90,     34,     93,     53,
+     135,     78,     20,    191,
+     207,    237,    202,    247,
+     237,     17,     90,    174,
+      66,    235,     78,    201,
+     177,    119,    139,    107,
+      81,    244,    234,      7,
+      85,     12,     86,     84,
+     135,    201,    113,    217,
+     161,     73,     45,    118,
+      40,     16,     11,    247,
+     128,     70,      6,     44,
+      54,     56,    240,    117,
+     145,    102,     62,     80,
+     233,    128,    183,    145,
+      52,     44,    112,      2,
+      20,     40,     76,     47,
+     191,    225,      4,    231,
+      13,    167,     81,     52,
+      26,     37,    113,     63,
+       1,     41,    177,    240,
+     175,     62,    157,    149,
+     163,     82,    142,     68,
+     212,     61,    159,    177,
+      26,    207,     98,      5,
+       4,     42,    201,     76,
+      58,     89,    182,    120,
+     216,    161,     91,    140,
+      69,    233,    207,     56,
+      20,     89,    176,     99,
+     115,     86,     12,    150,
+      37,     10,    213,    172,
+      84,    202,    224,    188,
+     248,    217,    220,     90,
+      81,    187,    166,    231,
+     217,     33,    105,    192,
+       0,    156,      6,    159,
+       5,      4,     18,     22,
+      75,      0,     25,    148,
+      14,    232,      8,    152,
+     124,     45,    111,     56,
+       6,      1,    209,    229,
+      16,     33,    152,     56,
+     150,    247,    250,     94,
+      37,     52,     18,     66,
+      13,     50,    125,     49,
+      89,     71,    255,    182,
+     147,    106,     78,     71,
+     162,     23,     28,    174,
+      43,     40,    166,    203,
+     126,     40,    168,     52,
+     183,     83,    200,    132,
+     197,    197,     17,     84,
+     135,    105,    215,     54,
+      78,    214,    202,    199,
+     141,    228,    181,     95,
+      57,      7,    129,    150,
+     121,     71,     23,     30,
+     251,     75,    213,    122,
+     212,     46,    218,    135,
+      78,    231,    179,     56,
+     176,    211,    215,     57,
+     124,     18,     73,     36,
+     202,     36,     34,      5,
+       0,    112,    241,    129,
+      15,    116,      0,    217,
+       5,    142,      9,      2,
+     148,    102,    125,    199,
+     229,     53,    241,     56,
+     245,     56,     52,    196,
+     200,    177,    175,     64,
+      62,     60,     94,    212,
+     165,     99,     36,    229,
+     164,     87,    203,     60,
+     235,    246,    149,    157,
+      87,    100,    233,     59,
+      33,    247,    179,    238,
+     235,    109,    156,    147,
+     219,    117,     78,    149,
+     238,    249,    106,    147,
+     142,    181,    122,    173,
+      28,     43,    151,    104,
+     180,    218,    233,    155,
+     105,    210,    209,     63,
+     108,     92,    116,    156,
+      15,    242,    129,    151,
+     209,    145,    237,      6,
+     169,    129,      9,    166,
+       0,    228,      8,    248,
+     244,    143,      0,     38,
+     129,     70,    194,    228,
+      68,     53,    149,    222,
+     195,    112,    163,     86,
+      50,      2,     76,    240,
+      84,    202,    147,    151,
+      49,     84,    105,    150,
+      22,    159,    251,    215,
+      35,      9,    103,     71,
+     161,     49,    242,     74,
+      41,    216,     83,    147,
+      90,     27,    255,     28,
+     229,    125,     37,     56,
+      63,     11,     53,    205,
+     153,    171,    224,    175,
+     165,    221,    219,    109,
+       3,     81,     25,    130,
+      20,     57,     60,     70,
+      69,    171,    216,    184,
+     129,     13,    208,    128,
+     142,    245,    153,      7,
+      77,    177,    236,    127,
+     158,     19,    245,    234,
+     117,    181,      2,    224,
+       3,    182,    184,      1,
+      34,      9,     30,    151,
+       8,     85,    114,    238,
+      51,    220,    147,     86,
+     146,    219,    182,      3,
+     122,    181,     49,     47,
+      77,     81,    108,     51,
+      17,    226,    139,    113,
+     206,    148,    203,     61,
+     217,    248,     41,     73,
+     193,     24,    138,    144,
+     246,    204,     99,    191,
+     150,    157,     51,    170,
+      20,    146,     83,    186,
+      19,    219,    184,     55,
+     105,    231,     43,     74,
+     140,     43,    158,    203,
+      20,    250,    102,    237,
+     195,      1,     25,     10,
+      30,     79,     67,    126,
+     124,     41,    179,    108,
+     137,     86,     14,    141,
+     228,    193,    246,     65,
+      65,    195,      2,    160,
+      49,    116,    240,    144,
+     242,    224,      7,     45,
+     109,    234,     96,    124,
+      13,    167,     52,     45,
+     249,     77,     82,      5,
+       5,     28,     60,     73,
+       4,    245,    220,    208,
+     234,    182,    229,    249,
+      76,    211,     51,     57,
+     147,     62,     72,    101,
+     204,    205,    161,    131,
+     123,     42,     25,    241,
+      35,    186,    188,    161,
+     100,     73,    157,     30,
+      14,    147,      8,    148,
+       5,    207,    227,    129,
+       0,      0,    244,    192,
+      50,    172,      4,    114,
+      96,    192,    101,    190,
+      39,    137,     89,    106,
+      39,    116,    242,    176,
+     208,     64,      2,     32,
+     178,    137,      6,     30,
+     208,    139,    199,     83,
+      40,    205,    203,    245,
+      56,    115,     13,     87,
+      21,    132,     99,    198,
+      46,    230,     47,    224,
+      78,     93,    139,     60,
+     219,    200,    232,    193,
+     177,    186,    156,    183,
+      50,    246,    124,    171,
+     141,    214,     61,    187,
+     103,     53,    121,    156,
+       4,     45,     25,    102,
+      80,    247,    249,     55,
+     166,     88,    139,    170,
+     213,    197,    113,      5,
+       2,     11,     24,     38,
+     234,    129,    190,    224,
+      52,     32,    160,      7,
+      23,    119,     33,     92,
+      46,    134,     36,     56,
+      71,    235,     39,    169,
+     211,     77,    104,      2,
+      38,     92,     42,    168,
+     160,    227,    140,     15,
+      76,     58,     58,    137,
+     203,     45,    106,    139,
+      89,     57,     99,     44,
+     182,    181,    116,    133,
+     229,    174,    174,     12,
+      61,    247,    182,     66,
+      28,    175,      5,    134,
+     237,     46,    154,    252,
+     154,     38,      8,    189,
+     197,    207,    152,    199,
+      48,    237,     74,    149,
+     175,    167,     73,    109,
+     140,    203,     49,    109,
+      71,     37,     82,     73,
+     233,     41,    232,    160,
+      75,     96,    192,    128,
+     143,    119,     56,     56,
+     216,    138,    126,      7,
+      84,    208,     33,    210,
+      45,    159,     32,     79,
+      28,     43,    252,     95,
+     159,    237,    170,    242,
+     103,     86,    180,     12,
+     219,    135,      8,      3,
+     192,     65,    184,     25,
+       0,    145,      7,     11,
+       3,     50,      4,    197,
+      15,    223,    117,    235,
+      41,    166,    212,    251,
+     174,     82,    176,    111,
+     147,    142,     59,     11,
+      69,    155,    171,    196,
+      18,    210,    242,    203,
+     214,     68,    211,    123,
+     162,    156,    230,    105,
+      33,    188,    210,    130,
+      61,    149,     50,    143,
+     162,    149,    144,    148,
+     205,    184,    100,    133,
+       5,    158,     76,    241,
+      16,     37,    215,     19,
+       9,    154,    247,    190,
+     233,    200,    253,    179,
+      84,    170,    102,    111,
+      69,     98,     24,    161,
+     122,    175,    209,     36,
+     177,     10,     92,    172,
+      13,     42,     21,     65,
+     195,     65,    129,    121,
+      72,    157,     48,     93,
+     103,     52,    189,     48,
+     163,    169,     27,    167,
+      42,    166,     86,    164,
+      10,    140,    137,    154,
+      16,    173,    157,     83,
+     160,    163,     96,      0,
+     175,     65,    115,     53,
+      87,    178,     69,    197,
+      60,     55,    173,      8,
+     213,    189,     24,    172,
+      71,     67,     48,     96,
+      13,     48,     64,      2,
+       0,     80,     44,    248,
+     231,     17,     68,    177,
+      48,     28,    173,    102,
+       8,    213,    125,    152,
+     172,    226,    172,    132,
+      28,    254,     41,    157,
+     110,     47,    130,     12,
+       6,     71,      2,      1,
+       2,    240,     80,    241,
+     108,     32,    229,    141,
+     171,    228,    228,     70,
+      53,    121,     35,     18,
+     140,     97,      8,    117,
+     239,    242,    132,    158,
+     210,    158,     39,    133,
+     119,     66,     62,     78,
+      69,     21,     10,     14,
+      46,     13,     85,    197,
+     134,    151,     36,    212,
+      96,     27,     77,    237,
+      45,    142,     38,     13,
+      38,     67,    163,    108,
+     240,     77,    132,    138,
+     126,    177,     10,     32,
+     105,    222,    192,     25,
+      66,    240,    253,    173,
+     214,    148,    132,     82,
+     149,    201,    153,    153,
+      96,    177,     14,     89,
+      49,    140,    220,    171,
+      51,    151,    212,    228,
+     207,    225,    234,    131,
+       9,     76,    162,      5,
+       2,    160,     25,    112,
+      88,     80,    160,     13,
+     198,     31,    215,     53,
+      82,     88,    138,    120,
+      74,     77,    219,    168,
+      90,    217,    158,     81,
+     213,    148,    214,     46,
+      45,    188,     40,    213,
+     224,    140,     17,    151,
+      49,    149,    196,     30,
+     106,    167,    139,    139,
+     205,    215,    208,     41,
+      56,    224,     55,    101,
+      81,    133,    141,     35,
+      67,     25,     94,     81,
+     182,    167,     40,    198,
+      62,     37,    199,    116,
+      60,    175,    200,    138,
+      49,    147,    144,    189,
+      41,    180,    120,     25,
+      83,    144,     52,     45,
+     167,    218,    248,    184,
+       9,     50,     59,      3,
+     174,    163,     29,    128,
+      74,    193,    227,     81,
+     160,    100,    119,     60,
+     151,    241,    115,      8,
+      93,     45,    161,    166,
+     177,    207,     10,    109,
+     206,    121,     98,    237,
+     237,    174,     33,     72,
+     105,    206,    113,    236,
+     209,    133,     83,    222,
+     162,     83,     42,     22,
+     140,     78,    148,    113,
+      96,     81,    102,      2,
+     185,    225,    120,    116,
+       2,    107,    138,    231,
+     255,    124,    130,    164,
+     236,     61,     98,     61,
+     107,     77,     99,      9,
+     194,    126,     81,    234,
+     119,    228,    179,    158,
+      17,     78,      8,    162,
+     156,      9,    201,    133,
+     231,     64,      5,      0,
+       0,      0,      0,     48,
+     206,     31,     14,      9,
+      25,    241,    105,    208,
+     196,     88,    140,     82,
+      84,    148,     61,     19,
+      58,    217,     43,    218,
+     220,     89,    133,     72,
+     217,     49,    214,    137,
+     102,    251,    183,     88,
+     125,     84,     39,    195,
+      50,     58,    180,    203,
+      53,    138,    164,    203,
+      27,    114,    217,     85,
+      37,     27,    123,    200,
+      59,    108,     92,    132,
+     168,    184,    241,     93,
+       1,      0,     66,    196,
+      57,     49,     33,     58,
+      15,    174,     44,    164,
+     162,    253,     22,     19,
+      25,    249,    236,    111,
+      42,     58,    155,    190,
+     100,    165,    167,     50,
+      13,    171,     73,    117,
+     103,    103,     82,    100,
+     114,     38,    153,    146,
+     219,    176,      7,    153,
+     102,     27,    185,    220,
+     120,     38,    162,     25,
+     159,    132,     64,    133,
+     184,     45,     68,     37,
+     191,     95,     10,      0,
+       0,      0,      0,      0,
+       0,      0,    218,    196,
+     253,     45,    209,    220,
+     237,     81,    213,    202,
+     151,    116,    109,     38,
+      87,    145,    116,     93,
+      46,    147,     54,     79,
+      61,    249,    114,     29,
+     185,    220,    102,     83,
+     105,    197,    106,     34,
+     210,    138,    117,    166,
+      38,    107,    246,     56,
+     139,     75,     53,    139,
+     101,    170,     37,    254,
+      71,    136,    106,    157,
+     253,     10,      0,      0,
+       0,      0,      0,      0,
+       0,      0,    134,    239,
+      40,    139,    179,     82,
+     221,     66,    129,     34,
+      74,    173,     19,    137,
+      18,    183,    132,    164,
+     217,     62,    181,     76,
+     203,     98,    183,     40,
+      53,    103,     82,    100,
+     177,    110,    209,     36,
+     213,     76,     11,    173,
+      88,     18,    209,    228,
+     150,     18,    207,    126,
+       1,      0,      0,      0,
+       0,      0,    152,     50,
+     199,    136,      4,     69,
+     187,     34,     21,      7,
+     147,     75,    229,    228,
+     171,    209,     61,    147,
+       8,    138,     58,     17,
+      81,    154,    152,    114,
+     151,     82,     28,     79,
+      73,    109,    183,    180,
+     234,    197,    142,     73,
+      66,    138,    153,     51,
+     133,    210,     70,    147,
+     136,      2,      0,      0,
+      28,    177,    140,    155,
+      64,      8,     52,    153,
+     231,    148,     17,     83,
+      89,    199,    104,     58,
+      54,     23,      5,    141,
+      20,     90,    167,    137,
+      84,    206,    178,     90,
+     233,     54,     98,    209,
+      26,     97,     98,     74,
+     221,    212,      8,    158,
+     177,     34,     40,    132,
+       7,    107,     17,     81,
+      25,     77,    233,      0,
+      67,    200,     52,    227,
+     141,      8,     10,    225,
+     123,     25,     27,    139,
+       8,    221,    152,     72,
+      52,    155,     69,      2,
+     201,    126,      8,     33,
+     154,    249,     32,    145,
+     226,    133,     32,     58,
+     198,    142,     32,    137,
+     112,    156,    201,    200,
+     205,     48,    179,    135,
+     214,    220,      1,     17,
+     161,     59,    148,    122,
+       3,     65,      8,     36,
+      99,      0,      0,      0,
+       0,     24,      0,    209,
+      26,    179,     39,      4,
+     137,     24,     11,    135,
+     230,    128,    217,    172,
+     209,    201,    116,    135,
+      81,    132,    232,    155,
+       4,      9,    213,     17,
+      17,     18,    235,     85,
+     125,    139,     54,    130,
+     101,    113,     54,    187,
+      92,     27,     61,    149,
+     132,     66,    167,     53,
+      81,     38,     19,     34,
+      68,      5,      0,      0,
+       0,      0,      0,      0,
+      64,    173,    242,     89,
+      46,    213,    165,     15,
+      17,    145,    221,     62,
+     169,    100,    182,     87,
+      68,     23,    251,     34,
+      77,    179,     76,     34,
+      77,     37,    218,    228,
+     123,     27,     93,    246,
+      55,     58,    153,    253,
+     157,     36,    177,    173,
+     235,    102,     91,     91,
+     233,    147,    137,    200,
+      99,    246,    137,    104,
+     251,      7,      0,      0,
+       0,      1,     96,     69,
+     132,    210,    138,    164,
+      91,     33,    162,    151,
+     213,    146,    187,     78,
+      75,    245,    179,     76,
+     209,    190,     68,    181,
+     190,    231,    188,    180,
+      96,     90,     16,    130,
+     206,     77,     16,     81,
+     242,      4,     18,    250,
+     204,    164,    109,    126,
+     233,     24,    207,     84,
+     136,      1,      0,      0,
+       0,      0,    128,     92,
+     126,    255,    171,     42,
+     219,     31,     85,     34,
+      18,    207,    242,     44,
+     155,    104,    219,     68,
+      75,     69,     22,    254,
+     153,     72,    190,    217,
+     171,    211,    197,    204,
+     125,     22,    207,    190,
+     156,     10,    161,    218,
+     118,    146,    233,     86,
+     173,      8,    141,    106,
+      85,     54,    231,    182,
+     183,    159,     89,     76,
+     219,    108,      5,      0,
+       0,      0,     89,    216,
+      96,     26,     16,    130,
+      20,    195,     23,      4,
+       9,    217,    249,     80,
+     212,    251,    163,     73,
+      73,     19,    231,     81,
+     144,     30,    102,     14,
+     130,     64,    104,    195,
+     248,     41,     61,    222,
+      42,     72,     20,     45,
+     182,     70,      2,    169,
+      74,     72,    104,    143,
+      55,    221,     59,    169,
+     153,    177,      4,      1,
+       0,      0,      0,    116,
+     222,    141,    162,    116,
+     233,     84,    149,    252,
+      42,    161,    215,     20,
+     162,    202,    114,    139,
+     166,    107,     94,     75,
+     146,    103,    177,    202,
+      57,     19,    133,     68,
+      38,     75,     24,     49,
+      97,     36,     33,     72,
+     170,     54,    113,    143,
+     255,      9,    169,    182,
+     163,      0,      0,      0,
+      64,     55,     63,    147,
+     162,     34,    207,    189,
+      50,    233,    179,    136,
+     180,    109,     19,    109,
+     155,     62,    182,    174,
+     116,    191,    207,    164,
+      17,     99,    254,    171,
+     146,    198,     61,     70,
+     170,    221,    237,     90,
+      33,    233,    187,    234,
+     100,    125,     68,      8,
+     173,    228,    247,     37,
+     210,    184,    219,    167,
+     132,    196,    220,    121,
+      84,      0,    190,     75,
+      66,    117,    179,    118,
+      95,    161,    165,     41,
+      52,     42,    177,     22,
+     138,     94,    236,     70,
+      70,    246,    118,     74,
+     166,    173,     33,    134,
+      62,    181,     58,     41,
+      82,    237,    210,     72,
+      10,     37,     31,    182,
+      92,    207,     58,     66,
+     116,    158,     73,      1,
+       0,      0,      0,    176,
+     204,    135,      2,    137,
+     152,    126,    189,     22,
+      77,     57,     26,    234,
+     141,    201,    208,    208,
+     179,    157,    127,     98,
+     197,    244,     36,     82,
+     125,     65,    145,    190,
+     181,     52,    146,     68,
+      19,    206,     21,     45,
+      65,     83,     14,    190,
+     143,     49,     44,     67,
+       4,     68,     15,     59,
+       2,      9,      0,    104,
+     203,     83,    121,    235,
+     254,     51,     25,    251,
+     187,    157,    159,     46,
+     166,    232,    217,    234,
+      85,    137,     67,    215,
+      11,    177,     80,    201,
+     155,     72,     86,     32,
+      46,      8,    202,    148,
+     180,    213,    174,    225,
+     193,    216,     14,    247,
+     194,    140,     44,    184,
+     219,    119,      6,    220,
+     180,     56,     39,     10,
+     133,     18,     41,     12,
+      45,    179,     21,     43,
+     248,    124,      9,    195,
+     162,    216,    234,    117,
+     142,    181,    251,     60,
+     145,    161,    183,     12,
+     117,     65,     86,     42,
+     162,     90,     16,    122,
+     153,    172,     98,     56,
+     168,    133,    152,     23,
+     233,    103,     84,     22,
+     140,    227,    104,    108,
+     198,     99,    153,    172,
+     205,    177,    205,    235,
+     250,     28,    195,    127,
+      87,     81,     27,     49,
+      10,     40,     12,    117,
+     212,     22,     85,     74,
+      66,    109,     42,    169,
+      87,    234,    201,     86,
+     177,    127,     24,    115,
+      90,    153,    245,    198,
+     182,     60,    223,     15,
+     142,     41,    116,    165,
+      13,    253,    180,    222,
+     196,    151,     61,     35,
+     123,    135,    232,    209,
+      74,    156,    115,    111,
+     198,     88,    110,    159,
+      69,    190,    170,    214,
+     105,    234,    163,      9,
+     214,    152,    115,     94,
+      74,    160,     40,     93,
+      21,      6,    209,      0,
+     180,     32,     61,    161,
+     120,     34,    215,    144,
+      93,    156,     92,    235,
+     198,    253,    212,     49,
+     196,    243,     80,     24,
+     226,    162,    125,     53,
+      56,    116,    132,    232,
+      60,     14,    193,     33,
+     178,    168,    106,     18,
+       7,    229,    188,    182,
+      53,    124,    159,     12,
+     119,    202,    224,     42,
+      86,     53,    205,     41,
+     197,     19,    164,    167,
+      49,    194,     19,     62,
+     219,    220,     11,     57,
+     229,      8,    207,     78,
+      59,    148,     75,      4,
+      46,     27,    131,    240,
+      68,     48,    244,     26,
+      16,     28,     36,    131,
+      64,     56,    146,    192,
+     232,     24,     65,     55,
+     105,    242,    142,     97,
+     124,    177,     78,     96,
+      86,     98,    209,     22,
+      97,     94,     56,    156,
+     130,    233,    109,     29,
+     142,    198,     74,    133,
+     178,     20,    221,     10,
+     136,    215,    115,    198,
+     214,     48,    184,    140,
+      29,     46,    154,    229,
+      58,     77,     35,    189,
+      20,     47,    213,    160,
+      96,     16,     94,     26,
+      42,    184,    173,     25,
+      45,    240,    164,    195,
+     253,     44,    234,     21,
+     194,    155,    192,     17,
+      92,    214,    215,     29,
+     180,      5,      1,    224,
+      65,    192,     44,     38,
+     156,    180,     16,    155,
+      35,    184,     24,     99,
+     136,    146,    131,    136,
+      41,    138,    233,     22,
+      44,     49,    255,    250,
+      75,     18,    204,    201,
+       5,     75,    212,     25,
+     232,    234,    167,     96,
+     112,     98,     88,    153,
+     239,    233,    209,    164,
+     246,     36,    183,    142,
+      52,     82,     73,    152,
+     168,    118,    232,     76,
+      83,    204,    114,      4,
+     166,     36,    205,     33,
+      47,     94,    153,     84,
+     132,    149,    167,    192,
+     141,    105,     14,    196,
+      81,    113,     79,     44,
+     162,     27,     44,     89,
+      24,    131,    113,     71,
+     208,    116,    247,    201,
+     147,      4,     89,     99,
+     194,    182,    212,     54,
+     140,    245,     84,    205,
+       9,    195,    185,     50,
+       4,    129,    168,     99,
+     121,    156,     29,     20,
+       2,    202,     40,    199,
+     191,     38,    198,     54,
+     223,    180,     28,     45,
+      12,     19,    111,    162,
+     170,    223,    189,    162,
+      52,     33,    199,    223,
+     121,    149,     89,     34,
+      42,     58,    221,    157,
+     171,    142,     23,     99,
+      54,     62,    175,    131,
+     241,    230,    149,      2,
+     108,    146,    137,    175,
+     252,    172,     66,     25,
+     219,     48,     78,    255,
+     196,    182,    236,    242,
+      82,     25,    154,    197,
+      83,    202,     85,    232,
+     254,     16,    246,    229,
+     233,    226,     86,    187,
+     198,    243,    189,     85,
+       7,     21,    173,     92,
+     120,    186,    105,    144,
+     200,     25,     99,    139,
+      60,    146,     24,    226,
+     193,     50,    198,    208,
+     116,    201,    115,    162,
+      95,      2,     20,    221,
+      15,    211,    245,     42,
+     237,    139,    134,    240,
+     194,    170,    149,     23,
+      20,     51,     29,    234,
+     251,    131,     96,    243,
+      52,    221,    146,     22,
+     145,    201,     14,     73,
+     171,    100,    142,    202,
+     229,    203,    150,    128,
+       0,    209,    252,    102,
+      50,     74,     64,    252,
+     203,     21,    236,    222,
+     146,    196,     99,      8,
+      99,     16,    116,     95,
+       9,    142,    109,     17,
+      69,    131,    162,      6,
+      76,    251,    175,    220,
+      81,    105,    133,    135,
+     163,     48,     26,      5,
+     217,    196,      9,    154,
+      73,     81,    227,    177,
+     240,     86,    154,     68,
+     242,    115,    103,    176,
+     135,      8,     74,    226,
+     181,    207,    219,    162,
+     238,      8,    173,    172,
+     122,    133,    203,    138,
+     209,    148,     30,    146,
+      59,    131,    200,    183,
+     104,    178,     39,    116,
+       9,    166,    183,      8,
+     130,    134,      0,    210,
+     182,    237,     60,     80,
+     232,     68,    215,    120,
+     211,     18,    148,    254,
+     194,    125,     67,     56,
+      33,    176,    172,    158,
+     163,    214,    135,     17,
+     252,     89,     72,     41,
+     209,     50,     23,    239,
+      56,     71,     70,     35,
+     105,    142,    143,     59,
+      90,    167,    200,     12,
+      70,    145,     18,    133,
+      96,    125,     14,    107,
+      54,    145,     44,     76,
+     211,     91,     55,     67,
+     160,     30,    255,    250,
+     110,    147,    132,     43,
+     135,    114,    148,    101,
+     204,    107,    148,    162,
+      84,     97,     47,    231,
+     152,     81,     38,     24,
+     164,    205,    227,     93,
+     129,    164,    147,     20,
+      42,    215,     97,     34,
+     104,     40,     18,    193,
+     188,    215,     58,    180,
+      95,     91,    176,    132,
+      43,     53,     78,    176,
+     175,    218,     83,    165,
+     177,    156,    249,    243,
+     160,     39,    165,    113,
+     120,    140,    217,     42,
+      84,     89,     88,     38,
+      31,     71,     36,    196,
+     211,     39,    151,     66,
+      16,    244,    195,    226,
+      76,    118,     37,    247,
+      30,     31,    211,     16,
+      34,     93,    213,     39,
+     198,    245,    118,     16,
+     132,     67,    105,    233,
+      40,     12,    167,    113,
+      66,    239,    162,     65,
+     177,     93,    190,    214,
+      34,    133,    248,     22,
+     140,     99,     42,     34,
+     170,     28,     76,    156,
+     141,    237,    118,     20,
+     137,     20,     21,    179,
+     177,    251,    184,     69,
+     216,    185,    215,    162,
+      96,    198,    171,    117,
+     249,    105,    135,    231,
+     206,     65,     61,     72,
+      69,    229,    225,    120,
+      22,     71,    215,     32,
+      53,    186,    113,    177,
+     157,    213,     18,    103,
+      19,     76,    122,     68,
+     139,    139,    229,     26,
+      95,     64,    182,    180,
+      93,    248,     57,      9,
+      16,     90,    145,    240,
+     150,     27,    108,    101,
+     203,     81,    139,    253,
+      56,    140,    142,     71,
+      20,    178,    156,    134,
+     133,    235,     44,    125,
+      32,     12,    157,    135,
+     151,    162,      0,     65,
+      71,    101,     58,     53,
+     207,     53,    185,    194,
+      32,    201,    148,    222,
+     120,    120,    222,     47,
+      52,    133,    154,    154,
+     203,    157,    179,    211,
+      10,    165,    152,    238,
+     182,    195,    136,    194,
+      45,    113,      9,    150,
+      82,     63,    119,     22,
+     130,     46,    105,    205,
+     255,    172,     82,     40,
+      40,    189,     92,    111,
+     187,     69,     66,    156,
+      82,    186,    177,    254,
+     225,     57,     71,     58,
+     210,     57,    174,    235,
+      26,    141,     84,    145,
+      95,     49,     49,    112,
+     130,     66,     37,    229,
+     224,    224,    133,     79,
+      33,     16,    180,    239,
+     165,    210,    252,    178,
+     178,    155,     43,    114,
+      77,    140,    185,     72,
+       1,    193,     19,    188,
+     201,    118,     69,     82,
+      35,     27,    113,    155,
+      63,     92,    234,     19,
+     151,    224,     89,     43,
+     108,    121,     83,    118,
+      75,    121,    252,     47,
+      26,      1,    151,     40,
+     145,     98,    251,    134,
+      93,     12,    249,    160,
+      52,    203,    121,    150,
+     240,    187,     74,    227,
+       8,    134,     19,    100,
+     110,     94,     14,     81,
+     117,     69,    231,    187,
+     194,    213,     36,    117,
+      42,    172,    224,     79,
+       3,     49,    107,    221,
+     254,    215,    215,     34,
+     121,     16,    152,    166,
+      37,     43,    151,    169,
+      95,    217,    166,     69,
+      12,    155,      2,     19,
+     147,     73,    182,    251,
+      98,    189,     18,    134,
+     159,     24,    138,    199,
+     172,    168,     16,     57,
+     109,     94,     42,    177,
+      63,     19,     79,     82,
+     191,    164,     65,    173,
+     233,    115,     54,    133,
+      45,    240,    188,     66,
+     129,     68,      5,    195,
+     159,     15,      2,     15,
+      88,    209,    132,     81,
+     178,    140,    160,     44,
+      88,     48,     68,    195,
+     219,     96,    201,    228,
+     175,    241,     40,      4,
+      29,    197,      2,     95,
+      67,     56,    157,    129,
+     165,     63,     57,     35,
+     235,     71,    245,    225,
+     161,    210,     72,     58,
+      50,    166,    123,    187,
+     161,     63,    246,     68,
+     193,     66,    175,     47,
+      67,    210,     81,    169,
+     166,    197,      1,     25,
+      10,     15,    254,    139,
+      47,     12,    142,    138,
+     112,    221,     12,     11,
+       1,    249,     96,     97,
+      67,     64,    115,    216,
+     176,     27,    196,    180,
+     188,    202,     86,    172,
+     155,    196,     33,    100,
+      59,     73,    177,    198,
+     226,     61,    119,     87,
+      84,    148,    225,     16,
+      43,      1,    201,     74,
+     161,     42,     77,    163,
+     120,    170,     97,    160,
+     115,     12,    154,    109,
+      89,     40,     80,     29,
+      91,    225,     80,     31,
+     246,    130,    112,     51,
+      96,    224,     21,    133,
+       4,    135,     37,    127,
+      49,    226,    226,     65,
+      64,     37,    159,      3,
+     143,     12,    185,      3,
+      54,    173,     65,    113,
+      48,     96,     33,     65,
+     225,      1,    254,     48,
+      91,    125,    102,     30,
+     145,    198,    203,     80,
+      27,     77,    163,    151,
+     168,    113,    108,     91,
+     147,    102,     75,    250,
+     136,    223,    165,     13,
+      66,     46,     18,    159,
+     159,     72,    147,     94,
+     246,    139,    248,     31,
+      29,    154,    225,     84,
+     176,    106,      9,     88,
+     219,    182,    144,    155,
+     157,    116,    229,    192,
+      36,    166,     77,    242,
+     119,     67,    240,    111,
+      82,    134,     76,    186,
+       7,     37,    215,    166,
+     165,     74,    125,     93,
+      64,    236,    231,     90,
+      74,    115,    192,    249,
+     209,    178,    205,    155,
+      57,     74,     54,    165,
+      62,    249,    227,    188,
+     233,    254,     88,     78,
+     224,     43,     20,    205,
+     215,     28,     98,    242,
+      17,    245,    120,     88,
+      52,    143,    136,    121,
+      33,    213,    186,     62,
+     203,     80,    255,     93,
+     188,     76,    107,     57,
+     239,     13,     65,     37,
+     216,     95,    129,    164,
+     192,    247,    144,      9,
+      47,    118,     87,    168,
+      97,    106,     40,     76,
+     123,    217,    191,    221,
+     253,    138,    197,    111,
+     104,    108,    132,    214,
+      79,    149,     15,    110,
+     193,     69,    158,     89,
+     244,     75,     68,    126,
+      27,     84,    134,    176,
+     184,     93,     78,    141,
+     126,     61,    240,     83,
+      80,     26,     83,    223,
+     170,    174,     13,    215,
+     255,    108,    150,    122,
+     254,    102,    225,    245,
+      13,    210,     32,     92,
+     215,     86,     45,    216,
+     205,    137,     46,     49,
+     126,     98,    112,      2,
+     135,    131,    222,      9,
+     152,      9,     36,    180,
+      57,    120,     67,     72,
+     104,    254,    207,     91,
+     228,    141,     65,     77,
+      16,    176,    156,    164,
+      69,    192,    160,     66,
+     147,    240,    128,    103,
+      72,    100,    166,     61,
+     209,     46,    205,    197,
+      69,    219,     27,    228,
+     111,     53,     43,     77,
+     166,     66,    165,    114,
+     121,    242,     69,     86,
+      35,    106,    112,    105,
+      90,    137,     60,     31,
+     218,    177,     49,    162,
+     246,    109,    216,     68,
+     162,    188,    173,    138,
+      70,     96,     52,    142,
+     155,    148,     98,    194,
+     226,    136,     52,    161,
+     239,     60,     57,    226,
+      33,    126,     56,     83,
+     152,    217,    183,     69,
+       0,     56,     85,     96,
+     108,    107,    206,    214,
+     124,     37,     90,     22,
+     183,    207,    237,      9,
+     143,    224,    135,     72,
+      86,    105,    166,     20,
+      53,     92,    227,      4,
+      26,     27,     99,     89,
+      26,    195,    158,    237,
+     171,    127,    184,     40,
+      35,    207,     67,    163,
+     240,     88,     69,     33,
+     218,     71,     71,     19,
+      42,     17,     20,     89,
+     147,      8,    133,    164,
+     253,     96,     20,     53,
+     148,     45,     28,    211,
+      53,    190,    242,     56,
+      92,    161,     78,     76,
+       6,    255,     49,     28,
+      70,     83,    202,     19,
+      53,     61,     30,    165,
+     199,    162,    133,     57,
+     114,    208,      4,    142,
+      83,    100,    225,    254,
+      68,     75,     82,     10,
+     239,    139,    211,    150,
+     213,    255,    162,    240,
+     214,     27,    162,    178,
+     172,    173,     10,    147,
+     111,     34,    163,    248,
+     195,    188,    226,     60,
+     102,     23,     74,    199,
+     253,    154,    104,    113,
+      44,    253,    136,     60,
+     142,    170,    175,    161,
+      57,    186,    245,     67,
+      52,     40,    199,    120,
+      73,     28,    194,    159,
+      55,    122,     33,    169,
+     221,     20,    126,     80,
+      10,     75,    106,    222,
+      81,    103,    187,     54,
+     133,    228,    151,    230,
+      78,     69,     89,     79,
+      43,    199,     28,    253,
+      52,    246,    244,     80,
+      86,     77,     73,     36,
+     132,    248,    162,     70,
+     188,     87,     69,    101,
+      57,    222,     46,    109,
+      60,    190,    230,    251,
+     143,    156,    222,    101,
+     144,     40,    158,    247,
+      44,     89,    183,     25,
+     117,     47,     10,     99,
+      36,    226,     30,    134,
+     130,    166,    242,     10,
+     130,    196,    217,     84,
+      73,    197,    103,    254,
+     236,    232,    156,     32,
+     125,     41,     49,    142,
+      97,     29,    207,    178,
+     164,    100,    165,    145,
+      72,    197,     87,    227,
+      45,    244,     40,     36,
+     198,    145,    199,    115,
+      70,     26,    125,    156,
+     152,     74,     59,     93,
+     153,    114,     11,     40,
+     149,    190,    181,     48,
+      72,    152,     24,     36,
+       2,    137,    235,    110,
+     130,    101,     62,     47,
+      18,     56,     48,     24,
+     135,    101,    248,    200,
+       7,    107,    127,    129,
+     152,    187,    215,    201,
+      98,     99,    202,     37,
+     131,     40,     27,     55,
+     145,    210,    147,    244,
+      49,    213,    152,    253,
+      72,     37,    110,    224,
+     123,    142,     98,    242,
+     192,    237,    244,    178,
+     109,    158,    118,    173,
+     203,    112,      7,     45,
+      15,    231,    235,    117,
+     122,    202,    165,    245,
+     172,    168,    245,    156,
+     218,    146,     71,    143,
+     176,    126,    164,    134,
+     188,    228,     74,    139,
+       9,    112,    171,    103,
+      78,    221,    120,    207,
+     229,     62,    190,    126,
+      89,    213,     52,     13,
+     151,     95,    252,    188,
+     136,     48,     36,    247,
+     217,     32,      8,    127,
+     181,      3,    193,    150,
+     171,     20,    161,    158,
+     194,     71,    242,    201,
+      50,    245,     91,     71,
+     191,    181,    206,    153,
+      12,    139,     52,    183,
+     206,    202,    114,     55,
+      21,    137,    187,    104,
+     167,     87,     51,    132,
+     104,    144,    125,     22,
+     111,     53,    234,    246,
+     112,      9,    122,    101,
+     184,    126,    222,     84,
+      35,     48,     90,     64,
+      97,    116,    170,    236,
+      35,    123,    154,    138,
+     224,     41,     18,    146,
+      86,      1,    110,    234,
+     157,    193,    105,    222,
+      73,    189,     80,    120,
+     171,     21,    183,    238,
+      71,     38,    120,     63,
+      89,    104,     58,    229,
+     212,     67,    211,     13,
+      73,    101,     64,    210,
+      23,    127,     31,    218,
+     127,    134,    206,     75,
+     166,    109,     81,    210,
+     122,    108,    142,     56,
+     239,    197,    122,    218,
+     214,    221,    189,    228,
+     112,    229,    106,     22,
+     143,    164,    123,     49,
+     216,    145,    110,      4,
+      82,    246,      9,    167,
+     174,    184,    212,     25,
+     105,    129,    233,    244,
+     104,    208,     67,     82,
+     246,    166,     63,      4,
+     174,    243,    154,    118,
+      96,    108,      6,      0,
+       0,    236,    222,    248,
+     211,    171,     76,     29,
+      49,    231,     33,    112,
+      84,    164,    133,     98,
+     245,     80,    211,     12,
+     225,     32,    177,     94,
+     232,     69,    115,    252,
+     232,    215,    252,    189,
+      60,     81,     54,     94,
+      16,    222,    108,     18,
+      97,     12,     34,    163,
+      62,    201,     96,     70,
+      89,    189,    210,    201,
+     159,     23,     94,    167,
+     181,    232,    218,     96,
+      28,    148,    176,     62,
+     146,    180,    197,    145,
+      45,     51,    156,    161,
+     111,    227,     60,    194,
+     185,     35,    237,     57,
+     120,    103,    133,     72,
+      27,     70,    181,    182,
+     171,     42,    117,    138,
+     236,     35,     82,    201,
+      88,    186,    199,     31,
+      49,    173,     48,     91,
+      89,    142,      9,     21,
+     174,    172,    239,    153,
+     114,     44,    161,    222,
+     109,     32,    200,     99,
+      62,     73,    113,     78,
+      91,     17,    234,     46,
+     215,    150,    234,     31,
+     145,    169,    140,     41,
+      81,     49,    114,    118,
+      84,      7,    162,    126,
+     115,    148,      9,     23,
+      45,     48,    179,    191,
+     251,      3,      0,      0,
+       0,      0,      0,    112,
+     220,    245,     75,    186,
+     146,    143,     96,    160,
+     153,    244,     68,     46,
+      82,    164,    158,    138,
+      11,     53,     43,    134,
+      98,     28,    226,    117,
+     187,     18,     62,    155,
+      16,     76,     62,    170,
+      19,    181,     82,     98,
+     196,     62,     17,    153,
+     137,    175,     40,    230,
+      36,    156,     80,    156,
+     248,     16,    202,    130,
+       5,     42,    238,     16,
+      76,     32,    227,    180,
+     214,    219,    148,    111,
+      22,     10,      7,     64,
+     170,    217,     36,    218,
+      52,    185,    154,     25,
+      99,    246,    203,    158,
+      89,     99,     38,    247,
+     203,     58,     66,    165,
+     147,     82,    153,     10,
+      74,     58,     58,    141,
+      47,    103,    219,    205,
+      88,    178,     49,    147,
+     188,     42,     70,    234,
+      33,     90,    185,    144,
+      88,     46,    196,    253,
+      99,     34,    191,     24,
+     251,     69,     50,     41,
+     129,    104,     41,     64,
+      43,    105,     62,    137,
+     235,    187,    147,     99,
+     206,     92,     90,    140,
+     219,     23,    206,    126,
+     216,     57,    198,    169,
+     249,    143,     76,     33,
+      69,    201,    150,     66,
+       9,     45,    143,    210,
+     153,    249,     33,    173,
+      25,    239,    243,     54,
+      44,     19,     98,    170,
+      94,     16,     33,     16,
+     117,    132,    220,    172,
+     237,     52,     83,    118,
+      13,     59,    233,    236,
+     174,    207,    185,     56,
+     115,     59,     41,    103,
+      20,     69,     34,     68,
+      19,      0,      0,      0,
+      24,    198,     44,     65,
+     170,    186,     60,    157,
+     200,    141,    249,     74,
+      40,    138,    208,    100,
+     182,    172,    221,    223,
+     172,    170,     89,    125,
+      91,    196,    111,     54,
+      89,     59,     98,    186,
+     217,     70,    162,    237,
+     179,    106,     43,    219,
+     155,     90,     77,    163,
+      73,    182,    181,     58,
+     221,    237,     95,     66,
+     136,    144,    207,    120,
+      25,     19,     34,     19,
+     222,    216,     92,      2,
+      81,     84,     66,     76,
+     177,     96,    150,    163,
+     228,    136,     72,    202,
+     181,      8,    209,    133,
+      11,     65,    100,    153,
+     205,    196,    218,    209,
+     164,    235,     46,    114,
+     142,     45,     10,    104,
+     136,    233,    180,    148,
+     181,    152,      8,    164,
+     141,    129,     49,     67,
+     136,    208,      4,     16,
+      32,     60,    150,    117,
+     143,    132,     64,      8,
+     206,     97,    121,     74,
+      83,    132,     18,    230,
+     255,    237,    228,    192,
+     112,    230,     80,    144,
+      72,     53,    206,    206,
+     201,    205,    156,     92,
+     173,    206,    197,    113,
+      95,     20,     66,    230,
+     251,    119,    157,    247,
+     150,    173,     84,    173,
+     233,     54,     33,     55,
+     181,     52,     28,    246,
+     249,     58,    162,      9,
+      36,     97,    108,    217,
+     158,    113,    150,     19,
+      36,    162,    147,    108,
+     199,    186,    101,    134,
+     166,    234,    158,    104,
+       0,      0,      0,      0,
+       0,    192,    236,    182,
+      79,     72,    165,    207,
+     146,    116,    169,    180,
+     251,    190,    182,    210,
+     182,    210,    108,     79,
+     136,    166,     91,    164,
+     185,    245,    161,    207,
+     150,    101,    243,     78,
+     164,    242,    127,     17,
+      77,    146,    101,    251,
+     151,     84,     82,    121,
+     182,     36,    169,     82,
+      21,    115,    183,     73,
+     158,    183,      0,      0,
+       0,     16,    158,     90,
+      38,     35,     42,    242,
+     191,     13,     81,    181,
+     251,    223,    164,    105,
+      43,     77,    254,     53,
+     151,    153,    108,     89,
+      17,    132,    202,    157,
+     227,    189,    134,     76,
+     246,     91,    196,    158,
+      70,     72,    219,    182,
+     219,    159,     38,    103,
+     102,    164,    132,    144,
+     100,     33,     74,     34,
+     234,     95,    140,    139,
+     117,    153,      1,     56,
+     145,    123,     70,     17,
+     157,    173,     69,    242,
+      79,     81,     90,     22,
+     165,    127,    237,    216,
+      90,     42,     16,     16,
+       8,     98,     12,      6,
+     112,     66,     16,     42,
+     175,    148,    205,     83,
+      72,    154,     68,     63,
+      23,     33,    109,    204,
+     204,     16,     33,     66,
+      65,     18,     99,    140,
+      35,     84,    141,    174,
+       0,      0,     62,    148,
+     102,     46,    145,     58,
+     165,    133,    181,    136,
+     144,     46,     38,    206,
+     118,    132,    208,     97,
+     220,      8,    105,     65,
+      72,     22,      3,     23,
+      41,    169,     32,    203,
+     108,    150,     16,    245,
+      73,    203,     79,    146,
+     100,    139,    141,     68,
+      84,     53,     51,    204,
+      65,    136,     58,    146,
+      50,      0,    100,    130,
+     154,     49,    142,      8,
+      58,     43,    138,    230,
+      38,    137,    104,    189,
+     206,     59,     66,    232,
+      96,     86,     68,    246,
+       4,     81,     97,    128,
+      51,     36,     68,    210,
+     116,    227,    113,     36,
+     162,    146,    202,     31,
+       9,     85,    105,      4,
+      81,     97,    216,    255,
+     216,     17,     33,     21,
+      18,    241,     32,     48,
+       2,     66,      7,      6,
+     187,    136,     36,     18,
+      77,    226,     44,    133,
+     164,    210,     55,     54,
+      33,      8,    113,    192,
+     220,     16,    153,     79,
+      52,     25,     88,     22,
+      18,     81,     34,    203,
+     142,     21,    209,     47,
+     164,    252,     36,      8,
+       8,    217,     54,     15,
+      68,    228,    225,    142,
+     205,    152,    136,    144,
+      50,    154,    176,      1,
+      96,     48,    162,     68,
+     230,    190,     79,    165,
+     132,    208,    229,    231,
+      91,    180,    218,     45,
+     145,    217,    205,     74,
+      16,     82,    225,    126,
+     187,    236,     17,    162,
+      87,    227,     85,     66,
+      36,    102,    215,    233,
+     255,    255,    145,    119,
+      34,    107,    210,    137,
+      42,    173,    126,    191,
+      76,    106,    183,    199,
+     205,     77,     68,     72,
+      94,    153,    216,      1,
+       0,    198,    137,    232,
+     114,     76,     23,    109,
+      26,     77,     27,    118,
+      19,     34,     52,    249,
+     214,    181,    246,     84,
+      68,    206,    216,     63,
+     205,     39,     20,    121,
+      29,    203,     80,    109,
+     183,    106,    230,    230,
+      38,     85,    205,     30,
+      89,    133,     72,    101,
+     205,    164,    251,    187,
+     233,    237,     49,    243,
+     155,    210,     74,    188,
+      18,     89,      0,      0,
+       0,    238,     68,     69,
+     102,    108,    139,    244,
+     105,    133,     36,     54,
+      31,      9,    149,    172,
+     233,     68,    252,    203,
+     146,     49,    203,     35,
+     183,    149,     32,    139,
+     113,     45,     69,    182,
+      87,    145,    197,     13,
+      99,     34,    213,    252,
+     149,     72,    133,     80,
+     105,    110,     79,    114,
+     249,    212,    246,    220,
+      49,    115,    130,     40,
+     157,     95,    167,     43,
+       0,    156,     11,    213,
+     102,     60,     79,    159,
+     137,     42,    146,    177,
+     123,     85,     72,     45,
+     107,    165,     99,    235,
+     132,    180,    252,     55,
+     147,    108,     37,    242,
+      24,    211,    144,    228,
+     169,     82,    185,    223,
+      77,    132,    168,    216,
+      95,    147,     16,     21,
+     213,    109,    149,    205,
+     203,     34,    233,    122,
+     206,    205,     85,    149,
+     198,    171,    151,     15,
+     128,    129,    149,    160,
+     132,    186,    155,     71,
+      18,      9,     45,    217,
+     249,     30,     21,     33,
+     121,    151,    139,    102,
+     205,    242,    216,    118,
+     171,    249,    133,    106,
+      50,     60,    236,    109,
+       5,     33,    244,    230,
+     190,     81,     69,    105,
+     202,    103,     62,     81,
+       4,    161,     18,    219,
+      35,    121,    158,    108,
+     150,     51,    230,     92,
+     136,     82,    121,     37,
+     249,      1,    152,     73,
+      46,    123,    164,     68,
+     190,     89,    171,    141,
+      39,    165,    105,    204,
+     182,     86,     73,    146,
+     189,    215,     69,    252,
+      97,     46,    165,    181,
+      25,     76,     30,     77,
+      78,    162,    219,    156,
+      93,      8,     65,     85,
+     125,    230,     45,     65,
+      32,     16,     36,     63,
+      91,    187,    152,    157,
+     165,    169,    227,    206,
+     171,    132,     18,    111,
+      47,     25,      0,    224,
+      78,     36,    205,    151,
+     164,    155,     84,     68,
+     247,    219,    219,    117,
+      79,    187,    108,     51,
+     169,    138,    200,     44,
+     219,     18,    162,     90,
+     251,    141,    166,    119,
+     102,     82,     26,    153,
+      27,    143,     40,     81,
+      97,    118,     11,     81,
+     148,     18,    141,    125,
+      90,    217,    204,     31,
+     149,    142,    193,    113,
+     174,    138,     16,    125,
+     179,     46,      0,      0,
+       0,      0,      0,      0,
+     160,    224,     93,     37,
+     145,     70,    211,    138,
+      52,    237,    106,    205,
+     243,    236,    125,    150,
+      68,     50,    109,    218,
+     166,    145,    165,    162,
+     151,     68,     46,    150,
+      90,    151,     61,    251,
+     246,    126,    205,    147,
+      68,     90,     50,    105,
+     122,    125,    178,     44,
+     207,     86,    235,    191,
+     101,    217,    146,     92,
+       0,      0,    200,     78,
+      66,    217,     18,    137,
+     252,    165,    117,     82,
+     172,     32,     70,     28,
+      44,     34,     34,     14,
+     124,     16,     42,    230,
+     151,    232,     33,    209,
+      38,     38,     13,    225,
+      52,    181,    195,     66,
+     132,     48,    199,    132,
+     208,    205,    153,     92,
+      68,    136,    171,     36,
+     226,     87,     68,    179,
+      48,    130,    100,      0,
+      80,    204,     75,     16,
+      26,    195,     43,    168,
+     170,     27,    150,    170,
+     198,     39,    253,     35,
+     116,    122,    206,     71,
+      80,    130,     24,    131,
+     241,     34,     16,     18,
+     206,    176,    171,    168,
+      11,    170,    196,    108,
+      30,    170,    106,     46,
+     215,    108,    142,    137,
+     162,      8,     99,    220,
+       8,     20,    217,    152,
+     199,    106,     27,     33,
+     228,    149,    117,     87,
+     183,    180,     84,    204,
+     236,     40,     74,     24,
+       0,    154,     55,    169,
+      80,    228,     24,    220,
+      72,    138,     74,    203,
+      48,    159,    132,    168,
+     119,     29,    115,    167,
+     244,     72,    103,    152,
+      75,    164,    164,    214,
+     226,    184,     65,    208,
+      90,    120,    150,    251,
+      44,    181,     69,    106,
+     229,    126,     93,    104,
+      45,    221,    207,    166,
+     136,    125,     76,     73,
+       2,    233,    188,    127,
+       1,    161,    103,     24,
+     159,     70,    184,     63,
+      77,    168,    111,    153,
+     230,     76,    218,    235,
+     232,     22,     99,     77,
+     145,     16,    233,      1,
+       0,    104,    172,     81,
+      18,     77,    167,    199,
+     174,     68,    208,    201,
+      96,    112,     47,      8,
+      34,    140,    173,    220,
+      88,     73,    132,    122,
+     235,    141,     64,     18,
+     244,    177,     88,     92,
+     161,    144,    148,    244,
+      56,    214,     69,    245,
+      20,     77,     41,    227,
+     140,     13,    138,     84,
+     198,    221,    166,    170,
+     179,    152,     81,      8,
+     136,    229,     24,     35,
+      64,     16,     59,     60,
+     147,    219,    126,     79,
+      82,    106,    148,    174,
+     183,    182,    236,    169,
+     104,     37,    222,    110,
+      33,     33,     52,      6,
+       0,    144,    120,    163,
+      37,      4,     50,     25,
+     152,     85,     72,     84,
+     113,     48,     88,    211,
+      36,     25,    142,    169,
+     188,    120,     77,    133,
+     116,    207,    126,     67,
+      16,    168,    101,     97,
+     112,    131,    134,     32,
+     181,    197,    242,    246,
+      59,    175,    105,     82,
+     122,     99,    152,     32,
+     105,    237,    236,    110,
+     170,     28,     11,    147,
+     130,      6,    177,     12,
+     247,     13,    138,     52,
+     199,    179,    189,    109,
+     223,     80,    164,     58,
+      77,    149,    245,     92,
+      51,     71,     68,     11,
+     241,    206,     40,     36,
+     164,    198,      0,      0,
+      10,    107,    180,    132,
+     132,    104,     14,    246,
+      53,    154,     74,     22,
+      22,    235,    155,     68,
+     148,     99,     43,     47,
+      13,     65,    148,     50,
+     207,    173,     64,     83,
+     168,    229,     96,    113,
+       5,    129,     36,    181,
+     133,     97,    189,    205,
+     220,     70,     35,    218,
+      89,    227,    147,    166,
+     213,     26,    227,    138,
+     200,    103,     96,     91,
+     208,     64,    173,    231,
+      76,    130,    164,    253,
+     242,    156,    120,    233,
+     214,     43,    130,     60,
+     130,    138,    231,    217,
+     118,    165,    175,    132,
+     120,    111,     20,     26,
+     146,    196,      1,     36,
+      62,    169,    128,    130,
+      36,     48,     96,    142,
+      66,    138,    101,    224,
+      49,     76,    145,    168,
+      48,    124,    233,    107,
+      71,    232,    163,    220,
+      50,     43,    144,      4,
+      93,     28,     12,     38,
+     160,    104,     68,     91,
+      24,    150,    243,    213,
+     159,    104,    100,     58,
+     123,     78,    160,    116,
+     170,    115,    236,    163,
+     143,     97,    224,    117,
+     209,     64,    158,    113,
+      62,    161,      9,    107,
+      29,    215,     79,    142,
+     101,    139,     34,     79,
+     163,    102,     89,     94,
+      58,    161,    205,    164,
+     124,    140,    211,     40,
+      40,    202,      2,     96,
+      89,     74,     62,    141,
+      70,    113,    112,     67,
+      16,    193,    112,     60,
+     235,     94,    162,    211,
+      97,    148,    174,    126,
+      74,     26,    105,    227,
+      54,    181,     66,    140,
+     195,    185,    160,     73,
+     157,     30,    227,     25,
+      62,    170,      6,    133,
+      50,    101,     54,      4,
+      58,    135,    150,     22,
+     238,    161,     45,    239,
+      97,     17,     47,      1,
+     241,     51,     62,     16,
+       4,    199,    133,     85,
+     167,    181,    133,     43,
+     129,     48,     10,     25,
+     197,    112,    180,    151,
+     218,    152,    146,     14,
+     183,     74,    161,     73,
+       3,      0,    206,    144,
+     210,     11,      4,    132,
+      99,     71,    164,    227,
+      60,    179,    198,     52,
+      34,    159,     85,     84,
+     246,     72,    181,    101,
+      91,    108,    100,    201,
+      29,     63,    169,    116,
+     149,    181,    203,    113,
+      59,     21,     36,    225,
+     122,    174,      8,    212,
+      90,      8,    114,    193,
+      60,     72,    143,     97,
+      48,     40,    155,     32,
+     191,    147,      9,     69,
+     112,    172,    216,     30,
+      77,    121,    152,     43,
+     148,    105,    212,     40,
+     231,    105,    167,    149,
+     251,    208,    143,     57,
+     113,    154,     40,      0,
+      48,     71,    183,     45,
+      18,     57,    118,     42,
+      88,    111,    109,    188,
+      41,     66,     44,     39,
+       9,    161,     70,    168,
+      61,    151,     50,    230,
+      34,     55,     46,    171,
+      68,    140,    189,    113,
+     156,    155,     12,     66,
+      48,     42,    174,    105,
+     132,    103,     32,    145,
+       7,    198,      0,    225,
+     177,    172,     69,    184,
+       3,    229,    116,    250,
+      43,    205,     96,    168,
+     203,    209,      8,    139,
+     245,     69,     78,    146,
+     163,    222,    145,     75,
+     180,    219,    146,    207,
+      71,    126,     17,      9,
+       0,     64,    243,     84,
+     173,     20,    136,     54,
+     167,    154,     99,    239,
+     198,     94,    105,    245,
+     140,    104,    162,     87,
+     168,    115,     54,     69,
+     229,    174,    136,     92,
+      33,    186,    242,    204,
+     206,    250,    187,     44,
+      66,    240,    189,    161,
+      41,     20,      6,      3,
+       2,    253,     96,     61,
+      32,     56,     88,    222,
+      67,    248,      7,    109,
+      90,    115,     81,    148,
+     129,     33,     69,    134,
+      68,     91,     88,    118,
+     117,     16,    114,    179,
+      92,     39,     89,    206,
+     117,     59,     63,    225,
+     178,     27,      0,     85,
+      15,     25,    227,    165,
+      70,     41,    193,     78,
+      25,     71,     36,    147,
+     177,    147,    212,     17,
+     101,    179,      8,    173,
+       5,     25,     15,     66,
+     184,    134,    125,    210,
+     104,    157,     28,    155,
+      33,     68,    130,     89,
+     137,    224,     74,    198,
+      38,    196,    130,    116,
+     164,    150,     10,    152,
+      64,    150,    171,    225,
+     229,     24,      1,     18,
+     230,    232,     30,    132,
+     110,    100,    149,    222,
+     202,     12,      0,     16,
+     180,     13,    117,     24,
+     152,     33,    154,     68,
+      41,    198,     73,      6,
+     135,    162,    126,    213,
+      50,     46,     41,    103,
+      81,    132,    119,    177,
+      36,     66,    217,     67,
+      31,    126,     16,     52,
+      38,    146,    225,    156,
+     106,     73,    157,    205,
+     101,    248,     64,     34,
+     250,     61,     19,    132,
+     192,     17,    212,    219,
+     109,    226,     23,     98,
+      45,     50,    205,    149,
+     130,     63,    144,    110,
+      50,     30,    171,      7,
+     120,      5,    116,    240,
+      22,    234,     49,     74,
+     235,     30,     34,    155,
+     200,    223,    225,    177,
+       0,      0,     64,     64,
+     177,     67,    121,     60,
+     184,     35,      4,    129,
+      70,     88,     35,     57,
+      14,     77,    152,    239,
+     228,     93,      9,    199,
+      32,    180,    155,     90,
+     130,    166,    214,    162,
+      31,    243,     52,    197,
+      92,    178,    172,     37,
+      52,     65,     31,    243,
+     239,    216,     66,     83,
+     199,    196,    219,     16,
+      69,     24,    149,     45,
+     196,     94,    167,    149,
+     122,     63,      8,    156,
+     133,     50,    119,    127,
+      15,     17,      0,    163,
+     160,    139,    243,     16,
+     135,     23,    213,    173,
+     200,    212,      8,    113,
+     102,    121,     28,      0,
+      44,    225,    133,    124,
+      24,    102,    136,     81,
+      36,    101,    127,     55,
+     135,     35,    139,    161,
+     148,    107,    156,     94,
+     141,    165,    102,    203,
+     104,    165,     19,    234,
+      14,     82,    240,    147,
+     174,    222,     19,     92,
+     214,    174,    169,     43,
+      97,    135,    227,     59,
+      71,     39,    228,    178,
+     109,     65,     73,    118,
+      33,     28,    203,     24,
+     132,    107,    144,    207,
+      20,    207,      8,    185,
+      99,     15,    234,    123,
+      45,     79,    166,     18,
+     176,     19,     98,    119,
+      63,    117,    250,     57,
+     215,    153,    244,     94,
+     132,    190,    255,    179,
+      44,    166,    160,     57,
+     207,     94,    173,     48,
+     114,      6,    226,    112,
+      89,    211,     88,     85,
+       5,    101,     16,    221,
+     124,     46,     41,    105,
+     120,     25,     36,    114,
+     149,    227,     42,    115,
+      21,      7,     12,    172,
+     127,    175,    140,     28,
+      83,    162,    186,    153,
+     237,     86,    157,    164,
+      63,     51,     25,     45,
+     194,    204,    244,    152,
+      43,    229,    123,    159,
+      58,    100,    226,     51,
+      13,    188,    211,    202,
+     181,     90,     26,    133,
+      68,    161,    178,    248,
+     135,    100,     96,     98,
+     247,    108,    166,     77,
+     150,    170,    116,    138,
+     192,     81,    137,     20,
+      91,    220,    104,      4,
+     161,     70,    241,     61,
+     149,    143,    101,    238,
+       7,    131,    235,      1,
+     183,    139,     33,    142,
+     143,     38,    241,     29,
+     245,    112,    230,    196,
+     116,    137,    209,     36,
+      32,    150,     20,    172,
+     254,     23,      5,     84,
+      82,     86,    172,     59,
+       2,    114,    198,    255,
+     144,     43,     23,    126,
+     110,    156,     43,     49,
+     145,     17,    235,     42,
+     237,    118,     59,    163,
+     134,     78,    127,    173,
+       5,     25,    185,    208,
+     103,    189,    117,    168,
+      27,     12,     92,     36,
+     208,    235,    217,    224,
+      99,     15,     81,     34,
+     137,     76,    188,     46,
+      81,     62,    248,    236,
+     135,    188,     57,    215,
+     120,     50,    178,    152,
+      83,     37,    133,    248,
+     227,    245,     74,     73,
+      68,     89,    165,     65,
+     160,    250,    174,    139,
+     205,     32,    147,      4,
+      86,    239,     24,     20,
+       3,    230,    253,     61,
+      76,     61,    165,     88,
+     190,    121,    168,    234,
+     175,    254,     84,     36,
+      15,    231,     20,    144,
+       7,    198,    249,    141,
+     222,    113,    214,     36,
+      93,    195,     77,     81,
+     208,    134,    235,     41,
+     209,    122,    136,    244,
+      22,     89,    172,     40,
+      14,     33,     89,    194,
+     122,     86,    175,    165,
+     138,    139,    195,    240,
+      39,     10,    202,     98,
+     254,     46,     10,     23,
+     247,     41,    228,    205,
+     203,    241,     82,     78,
+      50,     93,     36,    148,
+     253,    174,     81,     16,
+      10,     35,     80,     78,
+     180,    254,    125,    157,
+     179,    151,    144,     23,
+      69,      3,      0,     96,
+     138,    236,     54,    114,
+      75,    156,    162,     19,
+     206,     14,     93,    109,
+      92,     86,     66,     90,
+      22,    150,    137,    172,
+      56,    142,    165,     17,
+      53,      6,    235,     16,
+     178,    202,    136,    227,
+     148,    162,     20,     33,
+     121,    187,      9,    121,
+     221,    154,     90,    186,
+     222,    238,    132,    225,
+     151,    220,    251,    219,
+     135,     19,    239,     77,
+     157,    176,    172,    190,
+      83,    153,      2,    193,
+     115,     13,    114,    110,
+     222,    141,     12,    131,
+      38,     27,    129,     52,
+     174,    175,    107,    201,
+      79,    169,    206,     38,
+     218,     43,    197,    197,
+      20,    200,     60,     93,
+     194,    193,    209,     37,
+      44,     70,     14,     45,
+     224,    165,     68,     75,
+     222,    233,     39,    163,
+     185,    137,    175,     79,
+     146,    212,     25,     33,
+     169,    196,    225,    231,
+     172,     19,    178,     37,
+     213,     56,    123,    194,
+     153,     55,    141,     88,
+     147,     63,     83,    211,
+      52,     98,     42,    194,
+     122,    111,    182,    147,
+      32,     37,    198,     41,
+      74,     74,     22,     19,
+     180,    228,     88,    163,
+     212,    145,      8,    202,
+      57,    145,    198,      9,
+     114,    240,    216,     36,
+     251,    226,     15,    120,
+      74,    142,      6,     75,
+      17,    101,    223,     75,
+      66,    125,    236,     46,
+      35,      4,    215,    163,
+     159,    124,    238,    174,
+      43,    167,    223,      9,
+     114,    153,     47,    233,
+     122,    181,    185,    165,
+     108,    115,     73,    189,
+     201,    149,    227,    142,
+      58,     13,    203,    136,
+      20,     49,    229,    233,
+     141,    101,     28,    129,
+      22,    138,     24,    166,
+     255,    199,     13,     43,
+     146,    170,    103,    164,
+     156,    218,     54,    123,
+      84,    167,    111,    107,
+     121,     11,    106,    191,
+      83,    202,    219,    136,
+     132,    202,    196,     24,
+      93,     48,    132,    117,
+       0,    110,     75,    195,
+     226,    171,     52,    205,
+     156,     45,     10,    159,
+     171,     16,    136,    221,
+      53,    196,     36,     22,
+     223,     73,     77,     60,
+     140,    134,     38,      7,
+     223,    106,    104,    196,
+     206,    193,     56,    241,
+     187,    191,    199,     72,
+      80,     88,    220,     34,
+     132,    203,    241,     43,
+     145,     34,      9,    215,
+      61,    199,    115,     36,
+     132,     19,    165,     99,
+      56,    175,    112,    230,
+      16,    136,    209,    190,
+     165,    165,    234,    253,
+     152,    212,    194,    118,
+      37,     97,     75,    114,
+     183,    130,    168,     62,
+     175,     17,     69,     54,
+     246,    211,    148,    123,
+     242,      5,     28,     81,
+      89,     12,     56,     29,
+     146,    108,     51,    186,
+      28,     13,    204,     65,
+     135,     42,    242,    176,
+     201,    170,    126,    216,
+     110,     79,    189,    250,
+      10,    137,     82,     28,
+      39,    144,     73,    218,
+     231,     59,    201,    114,
+      29,     57,     39,     77,
+      96,    240,     70,     93,
+     150,    207,     16,    116,
+       2,     33,     59,    254,
+      41,     28,     83,     70,
+      15,     81,    184,    223,
+      27,    149,    243,    167,
+     130,    146,    237,    155,
+      78,     18,    157,     55,
+       3,    173,     98,    112,
+      37,    245,     83,    180,
+     188,     15,    153,    176,
+     189,     76,     16,    113,
+     240,    102,    139,    163,
+     104,     30,    176,    145,
+      68,    182,    157,    133,
+       8,     10,    225,    186,
+     112,    177,    187,     84,
+      67,    127,    200,     35,
+      19,      6,    234,     74,
+     182,    207,     73,     93,
+     202,     16,    245,    210,
+      96,     53,     30,    133,
+     140,    224,     56,    150,
+     160,    214,    141,     62,
+     227,     54,    137,    136,
+      74,     62,    111,    245,
+     120,    163,    151,    217,
+       6,    230,     24,     49,
+      20,    137,     26,     43,
+     175,     53,     71,     74,
+     239,     48,     38,     62,
+     135,     16,     61,      2,
+      39,     31,    231,    175,
+      83,     43,    243,    137,
+     253,     22,    137,     73,
+     212,    227,    232,    199,
+     182,    162,    161,    219,
+     130,    193,    245,    125,
+     164,    125,     99,    254,
+      60,    239,    220,     41,
+      83,     35,    206,     85,
+     231,      4,    237,     84,
+      49,     28,     98,     98,
+      99,    115,     21,    154,
+     160,     37,     89,    136,
+     207,    247,     29,    126,
+     141,      4,     89,    237,
+     227,    188,    100,    178,
+      25,     65,     69,    163,
+     104,    201,     49,     90,
+     227,    227,     91,      4,
+      68,    218,    177,    170,
+     152,     31,    203,    230,
+     187,      4,      8,     85,
+     122,    145,    180,    237,
+     235,     76,    243,    233,
+      57,    104,    162,    116,
+      25,    219,    113,    140,
+      42,    247,     21,    168,
+     164,    228,     50,    124,
+     211,    215,    104,    164,
+     180,    116,    113,    152,
+     236,    107,    221,     65,
+     213,    211,    233,    122,
+     224,     49,     25,    241,
+       2,    146,     28,     70,
+     105,     24,     76,    209,
+     228,    158,    116,    115,
+     116,     98,    217,     43,
+     208,     65,    184,     51,
+     169,    194,    243,     69,
+     231,    233,    106,    222,
+     144,    138,    131,     21,
+      80,    244,     50,     78,
+     144,    153,      3,    199,
+      29,      4,    136,    231,
+     204,    162,      9,    198,
+      24,    159,     79,    233,
+      29,    153,     97,    163,
+     159,     49,    154,     18,
+     145,    132,    245,    204,
+     116,     40,    250,    150,
+     211,    232,    195,     98,
+      94,    159,    214,    132,
+     117,    130,     58,    150,
+     107,    178,    120,     18,
+      36,    169,     84,    165,
+      94,     30,    142,    219,
+     100,     93,     42,     81,
+     233,    195,    198,    176,
+     143,     32,    198,    172,
+     105,     53,     60,    151,
+     225,    204,    166,     16,
+     228,     30,    194,    184,
+      22,    139,    115,    100,
+     130,    148,     75,    232,
+     229,    250,    204,     93,
+      20,     69,    235,    185,
+      11,    205,    100,     58,
+     119,    158,    174,     42,
+      45,     11,    201,    225,
+      48,    140,    148,     52,
+      53,     29,    141,     82,
+      57,    108,    243,    197,
+     208,     85,     69,     81,
+     218,    230,    217,     86,
+      24,     73,     83,    181,
+      54,     90,    112,     57,
+     230,    234,     21,    128,
+     154,     10,    203,    190,
+     130,     32,    179,    127,
+     222,    159,    219,     33,
+     164,     20,     66,     90,
+     140,    255,    174,    111,
+      73,     19,    189,     24,
+     247,     25,    110,     26,
+      73,    230,     57,    187,
+     117,    206,     20,     73,
+      72,     25,    240,    122,
+     202,    219,     17,     21,
+       4,    170,    141,    117,
+     179,    115,    171,     20,
+      73,     44,    179,    218,
+     176,     92,    144,    146,
+       8,     25,    222,    236,
+     186,    213,     29,    138,
+     162,    142,    193,    140,
+      24,     27,     65,     19,
+      68,      2,      0,      0,
+      52,    253,     49,    134,
+      99,    156,     34,    209,
+      68,     46,     19,    247,
+     172,    253,     70,     67,
+     232,    113,    115,    227,
+      88,    174,     16,     72,
+      90,    154,    191,    122,
+     203,    179,    133,     66,
+      34,    218,    216,     11,
+     235,    172,     77,      4,
+     138,     58,    249,    113,
+     199,    227,    124,     34,
+      80,     68,    237,    213,
+      89,     12,    119,    141,
+      64,    233,    217,    169,
+     112,     56,    102,     53,
+     138,    150,    251,     21,
+     231,     49,    126,     72,
+     138,     20,    183,    226,
+     158,    231,    188,    164,
+      81,     20,      0,     72,
+     134,    231,      2,     65,
+      73,    205,    207,    203,
+      47,    170,     16,    164,
+     230,    220,    221,    139,
+      40,    132,    102,    198,
+     202,    237,    140,    160,
+      80,    116,    206,    198,
+     198,     94,     66,     17,
+      36,     25,     96,     40,
+     103,     98,    165,     16,
+     132,     28,     11,    115,
+     182,     16,    132,    146,
+     122,    124,    140,    159,
+      16,     20,    233,    118,
+      63,     99,    173,     82,
+      66,    244,    198,    157,
+     191,     74,     33,     68,
+     238,      0,      0,      0,
+     144,    130,    177,    115,
+      35,     21,     65,    168,
+     113,    156,    119,     83,
+      83,     20,    129,    144,
+     203,     51,     38,    174,
+      39,     41,    146,     18,
+     134,    241,    238,    191,
+     132,    146,    180,    152,
+     183,    156,    187,    111,
+      37,     40,    146,     60,
+     140,     96,    252,    237,
+     158,     64,     34,    164,
+     113,    158,    249,    221,
+      61,    146,    164,    212,
+      57,    103,    221,    213,
+      40,     73,    233,     10,
+     199,     56,     51,    123,
+      41,    145,    170,     29,
+     227,    247,    198,    136,
+     166,    105,     93,    227,
+      34,     21,    162,     61,
+     198,    191,     68,     81,
+       8,    153,     27,    195,
+      76,    167,     66,    169,
+     202,     29,    142,     45,
+     168,    208,    168,     54,
+      28,    247,     70,     68,
+      33,     84,    206,     25,
+     204,     65,    240,     80,
+      74,     69,    203,    142,
+     239,     73,    137,     80,
+     104,     24,     12,    155,
+     116,     42,     74,    133,
+     224,    220,    189,     83,
+      74,     52,     50,    119,
+      62,    105,     75,     40,
+     237,     96,     48,     12,
+       0,      0,      0,     36,
+      55,     39,     90,    202,
+     136,     89,    179,    126,
+      91,     16,    153,    217,
+     233,    156,     63,     37,
+      90,    101,    202,     90,
+     227,     76,     68,    150,
+     144,     93,     99,    126,
+     205,    135,     84,    186,
+     163,     42,    108,     48,
+      27,     82,    100,      8,
+     221,    158,    181,     27,
+      81,    217,     74,    199,
+     254,    154,    223,     80,
+      90,     85,     79,    172,
+     177,    174,    186,     59,
+      82,    244,     59,    251,
+      83,     41,     82,     72,
+      49,    107,      1,    176,
+     136,     54,    198,    222,
+      95,    135,    208,    206,
+     183,    185,    137,     34,
+     237,    186,    157,    255,
+     136,    104,     83,    185,
+     251,     22,     17,     65,
+     244,    198,    250,    237,
+      65,    167,    228,    139,
+      24,    206,     74,     73,
+     165,    237,    220,     63,
+     153,    150,    208,    221,
+     103,    249,    133,    170,
+      62,    111,    184,     79,
+     149,    164,    146,    133,
+     179,    134,      0,      0,
+       0,      0,      0,      0,
+       0,      0,      0,      0,
+       0,      0,     64,    112,
+     132,    110,    203,    121,
+       9,     41,    185,    106,
+      10,    161,    232,    182,
+      78,    163,    116,    187,
+      87,     66,    162,    215,
+     101,    136,     37,    164,
+     227,    216,    110,    154,
+     244,    231,     45,    145,
+      40,    205,    100,     95,
+     146,    218,    238,     77,
+     145,    164,    172,     27,
+       0,     32,    137,    173,
+      71,     73,    234,    204,
+     196,     72,    138,    234,
+     185,    146,     36,    218,
+     114,    183,    136,     82,
+     239,    197,    208,    148,
+     244,    100,    190,    104,
+      72,     90,     44,     62,
+      37,     20,    101,    199,
+      45,     73,    106,    249,
+      29,     82,     18,     57,
+     255,     82,     34,      1,
+      66,      2,    227,     72,
+      66,    196,    224,     48,
+      65,    255,    158,    145,
+     174,     97,    140,    115,
+      95,    227,     90,    175,
+      80,    207,    167,    122,
+     114,    187,    133,    198,
+      60,    141,     87,     28,
+      92,    111,    209,    211,
+     100,    255,    248,    173,
+     170,    195,    164,    157,
+      77,    247,     65,    205,
+     249,    206,    218,    238,
+     102,      5,      4,    182,
+     156,     89,    179,    112,
+      84,     99,     28,    118,
+     255,     35,    148,    113,
+     166,    167,     79,    193,
+      64,     83,    183,    188,
+      20,     24,     40,    156,
+     137,    133,    210,    132,
+     165,    154,    200,     45,
+     134,     58,    114,    244,
+     241,    205,    143,    116,
+     249,    210,    138,    172,
+     252,    137,     68,    230,
+      46,     86,    239,    205,
+      11,     50,     14,    181,
+     196,    204,    201,     23,
+      58,    215,     82,     71,
+      55,     26,     58,    219,
+     255,    100,     48,    160,
+      65,    195,     43,    110,
+     171,    139,     96,     57,
+     166,     66,     69,     57,
+     152,    233,     35,      1,
+     113,     48,    112,    217,
+      40,     29,     69,     92,
+     184,     48,    145,     20,
+      30,    195,    212,    244,
+      13,    235,     42,    215,
+     208,    125,    184,    174,
+     182,    140,    182,     18,
+     144,     33,     48,     60,
+      92,     38,    196,     83,
+     145,     10,    183,     51,
+     161,    178,    214,     67,
+     193,    225,     50,     23,
+     116,    143,    209,    162,
+      38,     94,     11,     27,
+     249,    138,    234,    215,
+     175,    215,    229,     93,
+     245,    225,    183,      6,
+      15,     23,    202,     96,
+     140,     67,     18,     20,
+      28,    245,     29,    169,
+      84,    221,    112,     14,
+      25,     62,     58,    169,
+      40,    230,    239,     85,
+     100,     53,     71,     36,
+      35,     84,     76,    206,
+      69,      3,    208,     14,
+      31,     31,    143,     72,
+      70,    237,    223,    133,
+      75,     37,    240,    192,
+     243,    104,    200,      3,
+       3,    192,    119,      4,
+      17,    121,    131,     11,
+     110,    144,     21,     63,
+     126,     64,      6,    201,
+     241,    224,     96,     33,
+      16,    101,    138,    195,
+      88,    135,    110,    149,
+     169,    227,     45,    222,
+     167,    126,    238,    233,
+     250,    114,     18,    179,
+      95,     29,    241,     76,
+      95,    226,     69,     26,
+     161,    243,     48,     58,
+      26,     40,    189,    234,
+     212,    176,     14,    121,
+     118,    221,    242,    211,
+     184,     44,     85,    189,
+      76,    229,    195,     41,
+     147,    133,    193,    184,
+      52,    181,     96,    151,
+      25,     74,     26,    154,
+     198,    110,    105,    212,
+      64,     16,     25,    204,
+      12,     26,    181,     54,
+     155,     54,    166,    156,
+     220,    129,    201,     67,
+     136,    162,    241,    129,
+     129,     71,     44,     64,
+     165,    224,    101,    175,
+      40,     58,    103,    237,
+      32,     70,     22,    221,
+      60,    254,    154,    142,
+     252,     57,    141,    214,
+      76,    252,    124,    103,
+     239,     45,    214,    181,
+      91,     61,     77,     52,
+     112,    116,    153,    227,
+     249,      2,    193,    104,
+      60,    165,    102,     67,
+      46,      8,     76,    206,
+      72,     12,    240,     16,
+     182,    169,     12,     46,
+      40,     16,    124,    201,
+      13,     27,    136,     96,
+      88,    208,    207,    149,
+      80,     21,    197,    211,
+      75,    240,     70,    229,
+     100,     39,     38,      9,
+     148,    129,     17,    101,
+      66,     66,      0,    251,
+       8,    130,    179,     35,
+     133,    197,    215,    109,
+     171,      8,      9,     38,
+      65,     44,    120,    138,
+      94,     51,     11,     93,
+     252,    116,    153,    210,
+      78,    113,    181,    104,
+     199,     37,    125,    134,
+     145,     94,     80,     74,
+     178,     24,      2,     73,
+      98,    145,    195,    154,
+     166,    244,    195,      3,
+      48,     81,    204,     70,
+     234,    203,     47,     52,
+      68,    187,     41,    123,
+      26,    133,     80,     24,
+      30,     52,    195,     12,
+     146,     48,     66,    176,
+     212,     79,    113,    109,
+      65,    169,     33,    117,
+      60,    145,     64,    122,
+     184,     65,    216,    177,
+     210,    225,    241,     16,
+       9,     92,    230,    147,
+      67,    193,    219,    131,
+     165,    145,    214,     72,
+     220,     38,    203,    240,
+      43,    242,    187,    235,
+      80,    171,    241,    122,
+     240,    130,    180,     59,
+      35,    126,     82,     96,
+     118,    249,    125,    187,
+     186,    133,     40,    117,
+     151,     47,     34,    235,
+      76,     82,     97,     91,
+     149,    168,    186,    248,
+     104,     67,     77,    243,
+     223,     33,     41,     37,
+     216,    222,    233,     93,
+      10,    198,     94,     93,
+     137,     43,    204,    155,
+     243,     89,    237,     61,
+     153,     98,    177,     61,
+      10,     10,    209,    103,
+      50,     77,     13,    141,
+     226,    250,    255,     12,
+      98,    192,     52,    209,
+     145,     46,     54,    156,
+       7,     42,    181,     53,
+      28,     54,      9,    209,
+     183,    105,    165,    160,
+       6,    216,    252,    132,
+       6,     53,    193,    183,
+     207,    208,    104,    219,
+      12,    229,     10,    213,
+     185,     93,     57,    203,
+     220,    178,     28,    199,
+     223,    163,     43,    213,
+     176,    102,     16,    132,
+     180,    231,      3,    115,
+      95,     90,    246,     24,
+      83,    213,     89,     63,
+     119,    169,    250,    226,
+     162,    186,    231,    171,
+     110,     68,    184,     36,
+     244,     50,    236,     40,
+     161,    131,     99,     91,
+     135,    146,    198,     16,
+     146,    199,     27,     10,
+     148,    228,    185,     55,
+      26,    101,    112,    138,
+     244,    166,    252,     33,
+      17,    250,    241,     12,
+     173,    106,    158,    107,
+      21,     43,    110,     34,
+     254,     50,     90,    253,
+     183,    232,    156,    255,
+      17,     93,    111,     55,
+     165,     10,     10,    130,
+     132,    142,     99,    198,
+     188,    105,     66,     18,
+      66,    168,    173,    254,
+      68,     34,     61,     29,
+      28,    127,     31,     22,
+     231,     89,    128,    136,
+     196,    128,    212,    248,
+      18,     34,     68,     64,
+     144,    177,    159,     97,
+     222,     71,    249,     38,
+     156,     11,    137,    132,
+      16,    234,     14,     51,
+     155,     47,     52,      4,
+       8,     71,    169,    102,
+     166,    219,    220,    109,
+     214,    135,     40,    237,
+     186,     86,    110,     48,
+      95,     41,     77,     50,
+     165,     52,    229,     56,
+     227,    119,    165,     40,
+     169,     20,    138,      2,
+      20,     45,     48,    192,
+     128,    141,    208,     56,
+      28,     28,     15,     20,
+     132,    212,    220,     69,
+      17,    162,    119,    254,
+       5,     82,    169,    247,
+      34,     72,    230,    235,
+      54,     50,    121,    110,
+      55,    153,     46,     14,
+       0,      0,     72,     14,
+      65,    171,    216,    153,
+     221,    113,    238,    119,
+     191,    138,    146,    132,
+     168,    189,     17,     29,
+     199,     48,    246,     20,
+      77,    235,     91,     19,
+      41,    179,     28,     15,
+     131,    101,     19,      1,
+     137,    104,    207,     15,
+      20,     32,    129,     36,
+     113,    224,    193,    227,
+     134,     32,      5,      7,
+       6,    239,     41,     40,
+     144,    232,    180,    236,
+     158,     18,    178,     13,
+     207,    184,    214,    154,
+     168,     49,    230,     91,
+     137,    185,    189,    185,
+      20,    162,    231,    214,
+     237,     69,     70,    222,
+       2,      0,      0,      0,
+       0,      0,      0,      0,
+       0,      0,      0,      0,
+       0,      0,      0,     32,
+     172,     86,    105,    170,
+      84,    170,    210,    149,
+     213,    183,    156,    172,
+     150,     74,    137,     70,
+      69,    146,    148,    162,
+      90,    119,    150,    221,
+     206,    199,    229,    110,
+     173,    166,     41,    165,
+     164,    148,    170,    100,
+     117,    189,     94,      7,
+       0,     64,    145,     16,
+      57,     68,    114,    158,
+     210,     13,    209,     68,
+      34,     21,    162,     80,
+      57,     13,     13,    203,
+     204,    230,    178,     68,
+      70,     70,    150,     10,
+      45,    148,     67,    132,
+     167,    176,    148,     82,
+      42,    196,    149,     17,
+     234,      0,     16,    244,
+     228,     54,     97,    117,
+     149,     82,    145,     10,
+      93,    202,    181,    179,
+     137,    191,    213,     84,
+      40,    145,     34,    146,
+     165,    172,    102,    113,
+     113,     95,    211,    145,
+      36,     74,     20,     77,
+      87,    231,    220,    150,
+     245,     42,     37,     41,
+     169,      4,      0,     50,
+      24,     35,     53,     33,
+     239,     56,    115,     89,
+      29,     19,     33,    170,
+     226,    239,    148,     82,
+      25,    214,    187,     80,
+     154,     72,    227,     88,
+     187,    170,    117,     71,
+     126,    198,    237,     94,
+      74,    146,    234,    179,
+      28,    119,     77,    104,
+     121,    111,    237,     85,
+     117,     92,     78,    170,
+     136,    189,     81,     66,
+     171,    127,    111,     70,
+      18,     68,     29,    231,
+     253,    165,     84,     61,
+     185,     49,    183,    123,
+      37,     73,    173,      6,
+     128,      2,    133,    195,
+     217,     34,    104,    153,
+     206,    154,    173,    170,
+     219,     73,    169,    228,
+      25,    230,    134,     32,
+     169,    112,     44,    243,
+      77,    145,    234,     60,
+     235,    167,    164,    200,
+     152,     20,     89,    235,
+     221,     75,     26,     65,
+     151,    197,     97,    108,
+     105,     90,    246,     51,
+     110,     34,    243,    227,
+     146,     80,    106,    140,
+     255,    162,     72,    157,
+     158,    225,    175,     73,
+      66,    157,    103,    253,
+     138,    150,     81,    147,
+      34,    235,    157,     93,
+      73,    162,    104,     72,
+      32,     51,    113,     24,
+      91,     33,    232,    194,
+      52,    156,    189,    210,
+      88,    119,     53,     69,
+     149,    138,     99,    123,
+      71,     33,    209,    148,
+     199,     96,     57,     75,
+      39,    105,    217,    113,
+     237,     27,    114,    110,
+     225,    196,    158,    219,
+     115,     25,     78,     34,
+      80,    233,    218,    102,
+     242,     89,    175,     19,
+     101,    233,     24,    206,
+      28,    173,    188,    181,
+     154,     40,     74,    197,
+      96,     88,     87,     35,
+      17,    132,    203,    225,
+     121,     67,    212,    213,
+     230,    152,    254,     78,
+      85,     72,    105,     68,
+      65,    136,    203,     98,
+      24,     77,     71,    161,
+       2,     58,     52,      6,
+     211,     76,     58,     73,
+     123,     60,    166,     89,
+     100,    162,    246,    124,
+     158,    215,      8,    100,
+     245,    216,     12,    175,
+      81,    200,    234,    224,
+     176,    188,     66,     34,
+     105,    131,    197,     52,
+     147,     78,    213,    150,
+     207,    244,    170,     78,
+      21,    135,    207,    179,
+     162,     76,    149,     31,
+     131,    101,     38,    157,
+      42,     29,    159,    107,
+      70,    157,    170,     46,
+     151,    233,    101,      2,
+      89,     94,     54,    203,
+     140,     20,    154,     58,
+      25,     76,     55,     17,
+      40,    218,    227,     48,
+     221,    166,     19,    213,
+     229,     50,    157,     72,
+     162,     18,      6,    195,
+     183,     18,    141,      8,
+       0,      8,      0,      0,
+     136,     11,    207,     60,
+     216,     51,     59,    159,
+      20,    137,    132,     68,
+     146,    180,     98,    217,
+     153,    115,     61,     77,
+     104,     18,     17,    137,
+      76,    202,    122,    142,
+     143,    255,     74,    138,
+     136,     68,    164,     68,
+     203,    121,    142,    121,
+     207,    157,     66,     17,
+      66,      4,     33,     34,
+      72,     20,     64,      0,
+     160,    207,    220,    238,
+     198,    204,    204,     30,
+     235,    164,     85,     17,
+      85,    169,    182,     98,
+     114,    203,    109,    254,
+     207,    146,    235,     85,
+      42,     42,     34,     42,
+     147,    244,    253,     45,
+     254,    217,    247,    244,
+     100,    162,    162,    162,
+      34,     82,    189,    236,
+     187,    205,    237,     62,
+     219,    187,    144,    168,
+     170,     82,     34,     74,
+      43,      2,     18,    144,
+      12,    111,     71,    210,
+     106,     48,     56,    118,
+      37,     41,    131,    225,
+     124,     82,     40,    178,
+      44,    107,    135,     68,
+      80,    225,     25,     38,
+      40,     90,     31,    131,
+     229,     70,    147,    212,
+      57,    222,     10,      2,
+      69,    149,    229,    109,
+     104,      4,     81,     12,
+     199,      4,    129,     80,
+     193,    224,    216,     82,
+      40,     29,    143,    113,
+      77,     35,    200,    244,
+      44,     19,     36,     69,
+     157,    197,    248,    209,
+     180,     60,    150,    231,
+      71,     35,    136,     48,
+     172,    105,     18,     77,
+     183,    103,    108,     80,
+       8,      3,    144,     12,
+     203,    241,     38,    154,
+      32,    180,     24,    231,
+      25,    239,    166,    133,
+     214,     74,     85,    188,
+      89,     51,    151,     74,
+      41,    157,    115,     12,
+      99,    253,    165,     38,
+      16,     82,    141,    229,
+      88,    251,     73,     32,
+      72,     82,    157,     99,
+     121,    206,    118,     82,
+     180,     84,     97,    172,
+     101,    110,    138,    208,
+     132,     20,     57,    111,
+     214,    221,    133,     80,
+      74,    228,     24,    203,
+      49,    118,     91,    146,
+     180,     86,     99,     56,
+     235,     95,     17,     52,
+     138,      6,      1,     40,
+       6,    195,    179,     46,
+      53,    138,    164,    123,
+     188,    231,    237,    167,
+     144,     82,    101,    252,
+     253,    207,     92,     93,
+     103,    234,    238,    124,
+     235,    252,    159,    212,
+      40,     66,     10,    134,
+     227,     49,     54,     52,
+       2,    129,    146,    103,
+     121,     28,    235,    149,
+      66,     34,      8,     57,
+     158,     97,    252,    132,
+      36,    180,    202,    218,
+      51,     91,     95,     87,
+     145,    173,     68,    198,
+      59,    198,    153,     19,
+       4,    138,    144,    105,
+      25,     12,    199,    164,
+     166,    209,      8,     17,
+      84,     22,    159,    233,
+      22,     85,     38,    228,
+     116,    214,    120,    207,
+     113,    238,    208,     84,
+      66,    126,    150,    235,
+     133,     44,    230,    225,
+     252,     93,    116,     85,
+     107,    142,    111,     26,
+      37,    107,     61,    167,
+      86,    195,    249,     12,
+     219,     75,     58,     25,
+      73,     29,     62,      6,
+     219,     44,    162,     76,
+      16,    194,     56,    235,
+      76,    227,    239,     32,
+     202,    186,    112,     76,
+     211,     10,    138,     32,
+     156,    237,    205,     36,
+     202,     90,    114,     92,
+     198,     15,     89,    234,
+      61,    149,    216,    150,
+      97,    251,     86,    146,
+      81,     16,      0,     10,
+     208,    217,     48,    176,
+     252,     78,     34,     83,
+     210,     49,     94,     72,
+     197,    177,    156,    165,
+     232,    164,    254,     89,
+      12,     51,     18,    201,
+     250,     96,    112,    253,
+      41,     19,     41,    130,
+     193,    178,    127,    147,
+     196,    154,     94,    232,
+      57,     78,     14,    151,
+     241,      8,    104,     80,
+     136,    135,    137,    143,
+     107,     70,     42,    145,
+     146,    239,    125,    161,
+     133,    239,     56,     75,
+      34,    208,    234,    100,
+     177,    188,     76,     35,
+      82,    150,    205,    103,
+      44,    145,     72,    201,
+     159,    193,    218,     73,
+     211,    114,     57,    163,
+      42,    105,    249,    108,
+     206,    210,    209,    209,
+       1,     20,     32,    243,
+     176,    216,    140,    162,
+     233,     98,     26,     47,
+     148,     24,    182,    181,
+      95,     87,    245,    190,
+      60,    211,     73,     34,
+      69,      9,    166,    107,
+      46,     77,     84,    155,
+     225,     91,    187,     73,
+      82,    108,    239,    180,
+     150,    158,    233,     90,
+      69,     70,     64,     35,
+       4,     22,     14,    150,
+      57,     84,     81,    142,
+     231,    133,    214,    194,
+     253,    198,    147,     68,
+      74,     30,    166,    251,
+     147,    172,    138,    199,
+     225,    120,     67,    144,
+     181,    102,    184,    238,
+     110,    146,     84,    219,
+      28,     41,    150,    227,
+     249,     78,    209,     81,
+     208,      0,      0,      0,
+       0,      0,      0,      0,
+      73,    211,    105,    154,
+     210,    148,     82,     74,
+      41,    165,    148,    165,
+      44,    203,    178,     92,
+      94,    190,    252,     95,
+      62,    253,    159,     62,
+      61,    157,    166,    211,
+     148,      2,     84,     85,
+      85,     85,     85,     85,
+      85,     85,     85,     85,
+      85,     85,     85,     85,
+      85,     85,      1,      0,
+       0,      0,      0,      0,
+       0,      0,      0,      0,
+       0,      0,      0,      0,
+       0,      0,      1,      0,
+       0,      0,      0,      0,
+       0,      0,      0,      0,
+       0,      0,      0,      0,
+       0,      0,    170,    170,
+     170,    170,    170,    170,
+     170,    170,    170,    170,
+     170,    170,    170,    170,
+     170,     42,      1,     32,
+     157,    150,    125,    239,
+     221,     37,    210,    221,
+     123,    223,    180,     92,
+       2,      1,    185,     76,
+     243,    121,    158,    115,
+     158,    115,    158,    231,
+     179,     76,     39,      0,
+       0,      0,    128,    143,
+     136,    136,      8,      0,
+     136,    136,    136,    136,
+       0,     32,     35,     34,
+      34,      2,    232,    136,
+     136,    136,     32,     35,
+      34,     34,    130,    139,
+     136,    136,      8,     96,
+      35,     34,     34,      2,
+     128,    139,    136,    136,
+       8,      0,    124,     68,
+      68,     68,      0,    192,
+      68,     68,     68,      4,
+       0,     23,     17,     17,
+      17,    192,     70,     68,
+      68,      4,     23,     17,
+      17,     17,    100,     68,
+      68,     68,      0,     29,
+      17,     17,     17,      0,
+     100,     68,     68,     68,
+       0,      0,      0,      0,
+       0,      0,      0,      0,
+       0,      0,      0,      0,
+       0,      0,      0,      0,
+     128,      0,     93,    201,
+     170,    171,    186,    186,
+     214,    235,    117,    235,
+     245,    186,    174,    174,
+     234,    146,     85,    181,
+     170,    233,     82,     85,
+     170,     84,     90,     90,
+      90,    105,    105,    105,
+     149,     42,     85,    165,
+     154,    174,      0,      4,
+       0,     57,    147,     66,
+      38,     51,     41,    111,
+     226,     90,     71,    246,
+     148,    204,    100,     66,
+     201,    252,     91,    137,
+     214,     86,    122,     22,
+      78,     38,    135,    230,
+     165,    182,     22,    169,
+      29,      4,      0,    121,
+      97,      9,    147,      9,
+     153,    176,    208,    113,
+      48,      6,    199,    133,
+     134,     76,    200,    100,
+      72,     67,    255,     19,
+      83,    172,     69,    139,
+     137,     28,     14,     12,
+       3,    135,     19,     25,
+      45,     90,    163,    140,
+      60,      1,    254,    167,
+     255,    255,    167,    255,
+     255,    167,    255,      1,
+       1,    255,    203,    255,
+     255,    203,    255,    255,
+     203,    255,      0,      0,
+       0,    145,     90,    173,
+     170,    170,     42,    157,
+     214,     90,    171,     86,
+      85,     85,    165,    211,
+      90,    107,    181,      2,
+       0,    128,      0,      0,
+     128,    213,    106,     85,
+      85,     85,    233,    180,
+     214,     90,    181,    170,
+     170,     42,    157,    214,
+      90,    171,     21,     36,
+      73,    146,     36,     73,
+     146,     36,     73,    146,
+      36,     73,    146,      0,
+       0,      0,      0,      0,
+       0,      0,      0,      5,
+       0,      0,      0,      0,
+       0,      0,      0,     36,
+      73,    146,     36,     73,
+     146,     36,     73,    146,
+      36,     73,     18,    154,
+      36,     73,    146,     36,
+      73,    146,     36,     73,
+     146,     36,     73,      0,
+       0,      0,      0,      0,
+       0,      0,    128,      2,
+       0,      0,      0,      0,
+       0,      0,      0,    146,
+      36,     73,    146,     36,
+      73,    146,     36,     73,
+     146,     36,      9,      1,
+     128,    186,    190,    221,
+     254,    253,    251,    124,
+      95,      7,      8,    188,
+     146,     18,     69,    145,
+      40,     18,     69,    145,
+     146,    210,     96,     64,
+      93,    223,    110,    255,
+     254,    125,    190,    175,
+       3,      4,     94,     73,
+     137,    162,     72,     20,
+     137,    162,     72,     73,
+     105,      0,    128,     31,
+      66,      0,     66,      8,
+       1,    164,     16,      2,
+      90,      8,     65,     10,
+      33,     56,     33,      4,
+     172,     16,      2,     56,
+      33,      4,    240,     67,
+       8,    192,      8,     33,
+     128,     19,     66,    192,
+      10,     33,     56,     33,
+       4,     41,    132,    128,
+      22,     66,      0,     41,
+     132,      0,    148,     16,
+       2,     16,     66,      8,
+      32,    133,     16,    208,
+      66,      8,     82,      8,
+     193,      9,     33,     96,
+     133,     16,    192,      9,
+      33,    128,     31,     66,
+       0,     70,      8,      1,
+     156,     16,      2,     86,
+       8,    193,      9,     33,
+      72,     33,      4,    180,
+      16,      2,     72,     33,
+       4,      0,      0,      0,
+       0,      0,      0,      0,
+     128,      3,     73,    223,
+      39,    207,    151,     63,
+     207,    159,     61,     79,
+     222,     55,    235,    100,
+     146,     72,    164,     17,
+     137,     68,     36,    149,
+      72,     34,    147,    117,
+     233,    251,    228,    249,
+     242,    231,    249,    179,
+     231,    201,    251,    102,
+     157,     76,     18,    137,
+      52,     34,    145,    136,
+     164,     18,     73,    100,
+      50,      1,    224,      8,
+       9,     66,     68,    164,
+     156,    217,    236,    156,
+     136,      8,     65,     66,
+      84,    153,    199,    108,
+     251,     40,     66,    132,
+      40,    106,    219,    140,
+     103,     87,    132,      4,
+      33,     34,     82,    206,
+     108,    118,     78,     68,
+     132,     32,     33,    170,
+     204,     99,    182,    125,
+      20,     33,     66,     20,
+     181,    109,    198,    179,
+       1,      1,    207,    116,
+      84,      5,     17,    154,
+     252,    220,    249,    159,
+      80,     65,     68,    233,
+     116,     73,    106,    101,
+     118,    126,    150,    136,
+      32,      4,     17,     73,
+     216,    249,    141,    213,
+     154,    100,     58,    170,
+     130,      8,     77,    126,
+     238,    252,     79,    168,
+      32,    162,    116,    186,
+      36,    181,     50,     59,
+      63,     75,     68,     16,
+     130,    136,     36,    236,
+     252,    198,    106,      5,
+       1,      0,     62,    253,
+     167,    255,    233,      1,
+       1,      0,      0,     95,
+     254,    203,    255,    242,
+       0,      1,      0,      0,
+      62,    253,    167,    255,
+     233,      1,      1,      0,
+       0,     95,    254,    203,
+     255,    242,      0,      0,
+       0,      0,      0,      0,
+       0,     32,    224,    121,
+      43,     89,      9,     73,
+      78,     85,    159,    105,
+     146,    198,    150,    101,
+     251,    151,     37,    203,
+     101,    213,     69,     42,
+     100,    210,    202,     72,
+      19,    113,    125,     98,
+     203,    246,    199,    254,
+     116,    255,    181,    201,
+     165,    141,    168,    188,
+     173,     72,    158,     87,
+     111,    219,    107,    249,
+     238,    105,    237,      0,
+       8,    143,    228,     68,
+      58,     33,    178,    162,
+     232,    214,    167,    195,
+     183,    248,    230,    244,
+     101,     34,     83,    147,
+     168,    208,     74,    134,
+      44,     43,    241,     21,
+     150,    158,    167,    228,
+     138,    148,    164,    130,
+      66,     53,    209,    148,
+     211,    137,    229,     51,
+     109,     22,      1,    218,
+     162,    155,     16,     30,
+      66,     49,     65,     46,
+     201,     73,     46,     97,
+     107,      8,    172,    237,
+      40,     88,     79,    212,
+     143,     84,     68,     39,
+      89,     33,     94,    122,
+      45,     56,    200,    198,
+      72,    203,     55,    210,
+     161,    200,     36,    162,
+     142,     18,    189,     60,
+     100,     97,    122,    101,
+     158,      0,      0,    128,
+     135,     16,     43,    105,
+      42,    154,    202,     35,
+      32,    165,    215,    160,
+      33,    238,     16,    136,
+     245,     52,    144,     50,
+       5,     66,    153,     39,
+     160,     90,    244,    153,
+      34,    219,    177,     31,
+     102,    114,    176,    152,
+      15,    195,    154,    127,
+     159,    237,     96,     56,
+     245,     28,     28,    119,
+     102,    234,    240,    252,
+      22,    135,    249,     28,
+     111,    159,      5,    231,
+     247,    173,    123,    101,
+     120,    247,    138,     80,
+     206,    253,     17,    154,
+      40,    198,      8,    180,
+      42,     10,     73,      9,
+     146,     20,    254,      0,
+       0,     40,    250,    176,
+     154,     38,    190,     85,
+     195,    105,    114,    244,
+      36,      8,    212,    103,
+     175,    108,    124,     34,
+     200,    234,    185,     99,
+     237,     41,     80,    222,
+     186,    243,    175,     49,
+      77,     43,    246,    251,
+     223,    182,    103,     23,
+     139,    177,    103,     24,
+     186,     92,    204,     64,
+     214,     47,    134,    127,
+     131,     72,     16,     76,
+     182,     55,     61,    167,
+     105,    197,    250,    207,
+     229,     91,    111,    164,
+     146,    196,    207,    246,
+     183,    142,     68,     61,
+     223,    112,    106,    151,
+     149,     57,    171,    158,
+      95,    236,    125,     70,
+     181,    249,     30,    166,
+     173,    136,    237,    165,
+     119,    215,    233,    127,
+     146,    212,    228,    223,
+     105,    219,      5,      5,
+      65,    184,    213,    102,
+      59,      2,     98,    190,
+     119,    229,     35,      7,
+     134,     29,     52,    106,
+      62,      6,    211,    174,
+      40,    122,     29,    142,
+     251,    167,     30,     95,
+     107,    226,    155,    231,
+      49,    156,     69,    164,
+     183,    184,    120,    230,
+      23,    213,     80,    130,
+      48,    247,     75,    206,
+     232,    212,    108,    241,
+      56,    183,    210,     16,
+     148,    237,    179,     88,
+     189,     11,    106,     73,
+     201,    136,    121,     78,
+      78,     85,     75,    175,
+     146,      5,      0,      0,
+       0,    128,     16,    198,
+     245,    156,    219,     80,
+      68,     19,     50,     40,
+     134,    199,     97,    173,
+      38,    160,    209,    210,
+     241,    252,     36,    178,
+      46,    113,    132,    161,
+     252,    114,     73,     65,
+     160,    206,    226,    236,
+     208,     68,      7,      6,
+      19,    133,     38,    100,
+     205,    116,     50,     60,
+     216,     48,     80,    208,
+     164,     48,    216,    181,
+      41,    133,    122,     99,
+     214,     87,     72,     10,
+      45,     44,      7,    139,
+     145,     20,     72,    194,
+     193,    177,     94,    162,
+       9,    121,     23,     87,
+     198,     89,     47,    138,
+      64,    168,    108,      0,
+       0,    120,     40,    142,
+     101,    253,    175,    146,
+       8,    148,     38,    114,
+     151,     97,     89,    183,
+     157,     90,    201,    170,
+      41,    149,    245,    193,
+     133,    187,    155,    144,
+     146,     34,     42,    111,
+      35,    156,    113,     54,
+      74,     83,    132,    206,
+     139,     63,    198,    243,
+     247,      4,     65,     17,
+      61,    113,    159,    123,
+     206,    216,    123,     41,
+       8,     74,    247,     30,
+     235,    127,     43,    119,
+      68,     19,     58,    251,
+     126,    204,    143,    219,
+     157,    214,    164,     38,
+       4,      0,     64,     65,
+     112,    252,    147,     12,
+      65,     68,     55,    102,
+       9,    153,      8,    134,
+     157,     76,     52,     58,
+     161,     54,    230,     61,
+     138,     24,    188,    168,
+     254,      8,    113,     92,
+      98,     38,    186,     84,
+     242,    201,    184,     36,
+     213,     77,    135,    212,
+      38,    119,     95,     37,
+      66,    155,     46,    191,
+     189,    105,     41,    218,
+      25,     70,    190,    250,
+     178,     74,    132,     76,
+      11,     18,    165,    248,
+      59,    169,    226,     15,
+       4,     73,     81,    155,
+     187,    219,    169,    146,
+     134,    150,    176,    237,
+     116,     45,    135,    195,
+     114,    143,     26,     94,
+     117,     60,      3,     25,
+      64,    210,      1,     15,
+      14,      9,    173,     98,
+      61,    232,     20,    134,
+      68,     41,    215,     16,
+       2,    231,     95,      6,
+     211,    207,     10,    135,
+     227,    120,     91,    213,
+     150,    227,    190,    228,
+      56,     50,    101,     26,
+     229,    151,    246,     99,
+     218,    189,    165,     97,
+     236,     37,    160,    235,
+     206,    209,    100,    180,
+     206,     16,    214,    150,
+     230,     79,     51,     43,
+     173,    164,    182,     38,
+     192,    168,     58,    162,
+     239,    200,    139,    253,
+     150,    164,     33,    161,
+     192,     55,     72,     29,
+     175,    232,    175,     39,
+     140,    115,    119,    236,
+     183,    141,    249,     79,
+     210,    238,     46,     55,
+     191,    137,     30,     16,
+      10,    129,     19,      7,
+      45,    181,    216,    243,
+      35,     37,    225,    140,
+       8,    206,    191,     72,
+      47,     71,    245,    220,
+     171,    171,     21,     88,
+     157,    187,    233,     16,
+     200,    170,    123,    124,
+     178,    105,     21,     11,
+     199,     53,    126,    109,
+     233,    123,    134,     65,
+      28,    200,     87,     30,
+     161,    105,    130,     64,
+     225,     57,    211,     74,
+     171,     52,     23,    193,
+      24,    111,     75,    226,
+       8,    219,    111,     26,
+     146,     99,      1,    228,
+      27,     11,     97,    233,
+     205,    135,    236,    104,
+     102,    231,     53,    191,
+     171,    230,    183,     34,
+     112,    114,    209,    213,
+     239,     24,     26,     26,
+      85,     38,     56,    109,
+     109,    119,    247,    250,
+     212,    140,    123,     69,
+     136,    230,    198,    156,
+     208,    185,    156,     85,
+     209,    133,     79,     65,
+     249,    177,    208,     75,
+     236,     34,    218,    239,
+     207,    211,     74,    164,
+     252,    140,    211,     52,
+      75,    207,     91,    250,
+     123,    222,     97,    157,
+     100,    230,     82,    206,
+     245,    210,     49,     96,
+     130,    196,    200,     13,
+     114,     59,    163,    202,
+      27,     21,    122,      7,
+      38,    218,    196,    163,
+      77,    231,     67,     81,
+      46,    151,    246,     24,
+     201,    158,    168,      1,
+     172,     10,     22,    226,
+     140,    141,     34,     51,
+     124,    154,    209,     32,
+     104,     76,     62,    106,
+      43,     78,     80,    112,
+     242,     35,    242,    155,
+     199,    204,    235,    203,
+     124,    251,    245,    151,
+     207,    154,    118,     83,
+     160,     11,    157,    169,
+     198,     36,    145,    152,
+      85,     82,      6,    133,
+     254,     31,    145,     28,
+     140,    168,     68,    140,
+      10,    114,    239,     77,
+     188,     56,     83,    177,
+     251,     39,    183,     49,
+      32,    242,     91,     72,
+      89,    138,    124,    178,
+       6,    122,    188,      3,
+      61,     30,     55,     84,
+      70,     48,      2,     58,
+       6,     96,      4,    140,
+      56,    176,     65,    248,
+     143,     38,     36,     27,
+      62,    168,     63,     54,
+     178,    232,     76,     66,
+     209,    186,    144,    191,
+      51,    249,     84,    164,
+     110,    151,     80,    106,
+      58,    214,     91,     12,
+     131,    145,    121,    178,
+     184,    185,     14,    178,
+      65,     39,    197,    217,
+     161,    254,    148,     50,
+     120,    104,     77,    215,
+     242,     14,    159,    165,
+      98,    207,    152,    154,
+     221,     70,    215,     76,
+     118,    100,    173,    208,
+     157,    239,    210,    147,
+     177,    133,    250,    216,
+      86,     56,    229,    159,
+     151,    225,    164,     80,
+      58,     23,    231,    106,
+       1,    227,    178,     28,
+     187,    164,    170,    119,
+      63,    120,    223,    232,
+     174,    198,    170,     15,
+     155,     17,    153,    145,
+      45,    149,      7,     27,
+     106,    125,    236,    180,
+     244,    185,     10,    157,
+     114,    195,     49,     73,
+      62,     87,     58,     22,
+      54,    116,    158,    254,
+     221,    224,    207,    163,
+     253,    233,    221,    119,
+      82,     22,    145,    189,
+      26,    124,    135,    148,
+      44,     13,    110,    130,
+      34,    126,    225,    178,
+     247,     69,     43,    101,
+     223,    202,     74,    114,
+     210,     11,    253,     20,
+     102,    168,     48,     12,
+     160,    196,    236,    140,
+      50,    143,    146,     33,
+      89,      9,    220,    112,
+     197,     32,     67,    149,
+      55,     18,     51,    255,
+     122,    222,    226,     85,
+      94,    140,    217,     35,
+     109,    128,     17,    106,
+      35,     76,    200,    201,
+      32,     77,    115,    192,
+     146,     46,     83,     18,
+       2,    152,    234,    209,
+     193,    189,     74,    146,
+     163,    112,    198,    241,
+      65,    114,    226,    142,
+     202,    143,    213,      9,
+     217,      6,    127,     36,
+      74,     88,    208,    214,
+     194,    119,    130,    166,
+     235,    120,     65,    196,
+     218,     14,    103,    174,
+     182,     72,    238,    112,
+      66,    186,    131,    140,
+     168,    222,    158,    143,
+      66,     90,      3,    135,
+       4,     45,    214,    113,
+      30,    136,      1,      0,
+       0,      0,      0,      0,
+       0,      0,     90,    179,
+      55,    187,    136,     74,
+     204,    147,     70,     43,
+     178,    216,    173,    170,
+     149,     54,    102,    175,
+      42,    121,     58,    123,
+      38,     69,     59,    187,
+     245,     69,    218,     92,
+     220,     77,     66,    164,
+     253,    110,    111,    165,
+     237,    236,    150,    166,
+      68,    108,    236,    171,
+     180,    218,     56,    179,
+      72,     75,    116,    254,
+     253,    161,      0,      0,
+     144,    150,    170,    166,
+     102,    246,     43,    169,
+     217,     98,    205,    238,
+     137,    144,    199,    153,
+     101,    138,    144,    142,
+     243,     21,    161,     72,
+      54,    214,     40,    161,
+     253,    211,    210,    187,
+     121,     85,     36,    119,
+     206,     88,     41,     68,
+     206,    112,    191,     40,
+     162,    226,    247,     70,
+     169,    144,    103,    213,
+      74,    223,      8,     81,
+     233,    113,    171,     42,
+      37,    225,      0,     10,
+     163,    148,     36,    249,
+     183,     74,    101,    111,
+     159,    216,     44,    132,
+     136,    217,    249,     83,
+      66,    245,    198,    173,
+      90,     66,    228,    245,
+     190,     68,    155,    107,
+     147,    184,     93,    136,
+     202,    156,    241,    173,
+     148,    136,     27,    179,
+     107,    145,     54,    102,
+      73,     73,    117,    105,
+      90,    219,    170,    162,
+     237,     57,    115,     68,
+     149,     52,     56,      0,
+       2,    163,    168,    174,
+      74,    206,    156,    125,
+      49,    161,     68,    106,
+     166,    145,     72,    111,
+     198,    110,     21,     21,
+     210,    176,    253,    149,
+     174,     30,    204,     74,
+      81,      8,    133,    130,
+      18,    194,    225,     56,
+     152,    155,     89,     91,
+     185,    138,     74,    254,
+     109,    182,     20,    145,
+      68,    146,    132,     72,
+     111,    249,    231,     19,
+      21,    105,     50,    209,
+     180,     13,      7,      0,
+     226,      2,    165,    227,
+     130,    214,     49,    155,
+     153,      9,    138,     52,
+     204,     85,     36,     68,
+     206,    124,    231,    124,
+     132,     82,     26,    204,
+     238,     19,     66,    130,
+     205,    119,     33,     32,
+       4,      4,     80,     80,
+     138,    131,    195,    192,
+     113,    190,    234,     62,
+      37,     93,     34,    153,
+     228,    238,     39,     16,
+      66,    242,    200,    136,
+     244,    110,     77,    252,
+      23,    162,     52,    219,
+     181,     42,     25,      3,
+     169,    140,     35,    165,
+     252,     48,    218,    232,
+      41,    127,    179,     66,
+     111,    192,    200,     34,
+      66,     66,    221,    122,
+     177,    121,     72,    169,
+      44,     56,     34,    250,
+     158,    225,    165,    162,
+     176,     99,    179,    164,
+     101,     77,     70,     96,
+     226,     52,     37,    235,
+     167,     70,     80,     96,
+     179,     17,    163,    250,
+      49,     25,      4,    227,
+     174,    135,    148,      8,
+      15,     76,    147,    252,
+     225,     30,    145,    162,
+     127,    241,    115,     40,
+     201,     22,    231,    127,
+      28,    157,    150,    162,
+     180,     49,     56,    231,
+     146,    144,    186,    115,
+      91,     91,    133,    199,
+      24,     17,    245,     78,
+     119,     70,     69,    113,
+     241,    226,     56,     41,
+     105,    179,    181,    106,
+     205,    252,     11,     66,
+      18,     51,    143,      8,
+      31,    193,    201,    177,
+      46,    117,    243,    157,
+     246,    235,    131,    146,
+      76,    120,    207,    196,
+     174,     34,    170,    158,
+     222,    251,     37,    148,
+      98,     78,    247,    182,
+     204,    105,     43,     64,
+      74,    192,    202,    220,
+     226,    122,     12,     74,
+     171,     77,     28,     44,
+     156,     60,    175,     18,
+      98,     87,    235,     23,
+       1,    229,    153,    231,
+     255,    184,     94,      9,
+      18,     22,     60,    158,
+      27,      3,     83,     14,
+      13,    138,      4,    142,
+     222,    215,    124,    246,
+     105,     99,     97,    177,
+     111,    200,    105,    230,
+     150,    123,     55,    219,
+     169,     22,    161,    250,
+     243,     20,    207,    173,
+      29,    106,     66,     33,
+     135,    121,     81,     85,
+      46,     97,    232,    254,
+      45,     43,     20,    155,
+      18,     33,     63,    227,
+     146,    116,    211,    101,
+       8,     47,    241,    225,
+     233,     73,     22,     78,
+     155,     70,    150,     36,
+      66,    129,    137,    159,
+     161,     35,    163,    237,
+     157,     44,    137,     60,
+     243,    123,    148,    250,
+     213,     36,     68,     44,
+     100,    194,     96,     91,
+     223,    146,    148,    106,
+     177,    122,    237,    108,
+      14,     49,    217,    203,
+     125,    163,     64,     49,
+     241,     90,    191,    111,
+     210,     34,     36,     25,
+      29,    201,    192,    196,
+      94,     65,    129,    104,
+     199,    240,    107,     53,
+       6,    191,    209,    104,
+     139,    168,    232,     50,
+     131,    195,    204,    106,
+      35,     64,    173,    117,
+     221,     58,    129,    199,
+      91,     82,    132,     94,
+      95,     74,    165,     47,
+     252,    156,      6,    133,
+      50,     46,     85,     21,
+      19,    119,     71,     47,
+     224,     48,      1,     19,
+     229,    216,    157,     90,
+     248,    174,    162,    134,
+      33,    117,     11,    199,
+     207,    116,    122,    103,
+     112,    131,    222,     56,
+     159,     66,    187,    182,
+      12,     73,    227,     99,
+      90,    103,     86,     58,
+     241,    248,     28,     22,
+     215,    160,    161,     76,
+      12,     15,     13,    121,
+     225,    216,     35,      4,
+      17,    149,    118,    157,
+      48,     88,    252,     10,
+      10,      4,      7,    215,
+     162,    104,     14,    199,
+     244,    188,     70,    166,
+      22,    203,    112,    249,
+      46,     13,     42,    197,
+     246,     68,    205,    241,
+      51,    181,    250,    118,
+      35,    201,    197,    230,
+      26,     26,    161,     38,
+     161,    112,    177,     34,
+     178,    198,    115,      1,
+      74,    188,     75,     93,
+     102,     69,    255,     71,
+     157,     61,     65,    170,
+     178,    220,    101,    124,
+      82,    196,    154,     36,
+     130,     99,    166,     51,
+     101,    159,    245,    222,
+       5,     69,    167,    117,
+      74,    142,    191,     18,
+      34,      9,    177,    191,
+     179,    171,     32,    232,
+     231,    157,     16,    251,
+      51,     91,     82,    157,
+     187,    253,    211,     40,
+     105,    125,    230,    156,
+      34,    242,    221,     85,
+     196,     94,     40,    153,
+     183,    239,    125,     35,
+     244,     59,      0,      0,
+       0,      0,      0,      0,
+       0,      0,      0,      0,
+       0,      0,      0,      0,
+       0,    241,     69,     55,
+     117,    209,     39,    189,
+      86,    173,    186,    234,
+      42,    146,     44,     77,
+      66,    165,     80,     45,
+      37,    234,     92,     78,
+     231,    175,    185,     76,
+     157,    107,    213,     50,
+      85,    169,    163,    228,
+      85,     57,    109,    169,
+      15,     12,    209,    179,
+     238,    168,     44,    170,
+     151,    171,    201,    165,
+     203,     61,    169,    166,
+      44,    189,    146,     56,
+     165,     16,     68,    109,
+     179,    147,     53,    165,
+      90,    182,     86,    201,
+      37,     34,    157,     79,
+      85,    154,     66,    228,
+      91,     91,    189,     66,
+       2,      6,    200,    220,
+     253,    107,    148,    166,
+     150,    200,    243,    121,
+      94,    201,     26,    178,
+     185,    127,     21,     73,
+     215,    140,    188,    151,
+      86,    204,    220,     94,
+      40,     32,     64,     16,
+     135,    131,    129,    123,
+     136,    144,     36,     34,
+     217,    204,     98,     37,
+     137,     91,    132,     32,
+      36,     99,    191,    200,
+     250,    134,    132,    232,
+     187,    228,    150,     88,
+     162,     66,      1,     12,
+      64,    142,    115,    107,
+     164,    162,     95,     34,
+     217,    198,    236,     81,
+     209,     73,     54,    119,
+     139,     40,    145,    155,
+      55,     42,    153,     45,
+     138,    220,     48,    156,
+      23,     80,      0,     20,
+     128,      2,    117,    128,
+       3,     24,      0,      3,
+      19,      4,    133,    228,
+      86,    145,    230,    126,
+      19,     68,    107,    126,
+      19,    130,     84,    254,
+     173,    123,     34,    170,
+     170,    251,     38,    201,
+     195,     60,     74,     32,
+      15,    185,    156,     29,
+     213,     29,    179,    174,
+      42,     69,    205,    236,
+     126,     70,    182,    168,
+     248,     53,     63,    165,
+     100,    103,    205,    219,
+     169,    236,    255,    159,
+      75,     34,    151,     97,
+      92,    162,     65,      3,
+     141,     58,     48,    224,
+     192,    240,     33,     72,
+      50,    214,     77,    118,
+     139,    218,    121,     65,
+     116,    238,    141,     53,
+     211,    173,    170,    235,
+     126,     38,     38,     68,
+     171,     58,    115,    175,
+      90,    228,     57,     55,
+      37,     52,     44,     80,
+     143,     27,    217,    156,
+     139,    245,     75,    210,
+     231,    139,     12,     55,
+      20,    249,    254,    242,
+     221,    231,    152,    111,
+      66,    196,     17,    100,
+     113,     47,    169,      3,
+       7,     51,    122,    158,
+     212,    139,     53,    186,
+      10,     10,    128,      0,
+      36,      3,    192,      1,
+     251,    105,     57,      9,
+      41,     56,    190,    106,
+      21,     20,    116,    241,
+      28,    133,     62,     12,
+      79,     16,     28,    102,
+     169,    222,    165,    137,
+     115,      2,     33,     88,
+      76,     17,    106,     92,
+     172,     53,     73,    168,
+      27,    138,    122,    126,
+       1,     22,    202,    179,
+     154,    176,    252,     29,
+     142,     55,     73,    234,
+     178,    154,    120,    118,
+     162,    136,    134,    121,
+     234,    247,    166,     48,
+     238,    205,     82,     90,
+      67,    211,    163,    249,
+       5,    202,    194,    197,
+      59,    122,    216,    130,
+     248,     56,     75,    206,
+     150,      2,      4,    208,
+      61,    224,    195,    171,
+     178,    197,    105,    244,
+     228,     57,    113,    253,
+     136,    138,     86,     56,
+     158,     72,    186,     28,
+      87,     80,     46,    103,
+      73,    117,    110,     77,
+      47,     63,    145,     20,
+     147,    185,     36,    225,
+     222,     20,     44,    167,
+     104,    125,     21,    157,
+     176,     57,     23,      0,
+       0,    188,     36,    106,
+     242,    126,    221,     62,
+     145,    148,     16,     27,
+     179,    139,    100,    180,
+      77,     55,     51,     99,
+     118,    169,    166,    246,
+     244,    181,    148,     16,
+      66,     81,     84,    239,
+      12,    230,    102,    190,
+      87,     34,    222,    213,
+     242,     82,     69,    132,
+     182,     66,     74,    186,
+      36,    171,    228,    184,
+      99,    102,    251,     70,
+      46,     66,     18,    137,
+       4,      0,      0,    224,
+      80,    194,    157,     61,
+     144,    138,    196,     43,
+       2,    101,     62,    243,
+     155,    201,     23,    167,
+     144,    174,     46,     17,
+     218,    217,    124,    221,
+      25,     23,    107,    105,
+     233,    152,     32,      2,
+     212,    216,     96,     24,
+      73,    114,     30,     87,
+      66,     21,    229,    254,
+     148,     16,     86,    140,
+      65,     17,      4,    144,
+     186,    216,    169,     86,
+      49,     48,    199,     70,
+     106,    156,    251,     68,
+      64,    173,    212,      4,
+       2,    128,     81,      4,
+     199,    238,     15,     84,
+      21,    101,    141,     80,
+      18,    148,    115,    205,
+     250,     54,     39,     49,
+      46,    184,     68,     79,
+      54,     59,     34,     40,
+     242,    239,     48,     47,
+      74,      5,     38,    214,
+      16,    168,     34,     11,
+     215,     98,    208,    233,
+     151,    199,    235,     28,
+     106,    248,    121,    135,
+      34,     11,    177,    152,
+     153,    165,    219,    167,
+     199,     80,    132,      0,
+     213,    140,     24,     11,
+      69,     28,    138,    133,
+      51,    126,    169,    242,
+     195,    240,    157,      9,
+     105,     28,    193,     13,
+      26,     49,      8,     14,
+      83,    254,    160,    227,
+      72,    239,    180,    212,
+     160,    207,     73,    222,
+     203,     95,    201,     50,
+     137,      9,      8,    147,
+     205,    111,    143,     68,
+     252,     15,    198,    233,
+      33,    146,    143,    183,
+      36,    178,    105,    193,
+     103,     27,    116,     50,
+     129,    129,     83,    234,
+     201,    230,    239,     57,
+      20,    121,    168,    192,
+     215,     60,     66,     51,
+     194,    192,     17,     58,
+     160,      8,     86,    158,
+     129,    214,    129,    226,
+      96,    143,    113,    168,
+     244,    101,     49,     42,
+      18,    194,     88,    201,
+      62,      4,    128,    124,
+     106,    185,     48,    131,
+     206,    147,     12,     43,
+      53,      9,     50,     76,
+     114,    172,    176,     47,
+      89,     19,    174,     32,
+     162,    154,    141,    188,
+      32,    255,    130,     49,
+      82,    232,    196,     57,
+     199,     73,    132,     66,
+      41,     47,    212,    162,
+     133,    127,     30,     94,
+     170,     32,    146,    251,
+     229,     40,    121,    116,
+     224,    182,     14,     73,
+     189,     50,    120,     17,
+     135,    144,    172,    186,
+     129,     36,    155,     98,
+      97,    214,     30,    221,
+      70,    188,     87,    157,
+      16,    222,     23,    206,
+     160,      0,      0,     72,
+     142,    170,    235,      9,
+      68,    222,     96,    216,
+      34,     16,    144,    241,
+     195,     48,    231,    126,
+     156,    137,    145,    232,
+     238,    186,    202,    181,
+     109,    174,    127,      8,
+     130,     92,     12,    135,
+      97,     66,     75,    164,
+      58,    169,     10,     33,
+     222,    227,    176,    173,
+      82,    158,    141,    177,
+      34,     71,     13,    235,
+     170,     17,    168,    150,
+     199,     25,    183,    213,
+      92,     95,     67,    160,
+      90,    120,    188,    169,
+     212,     53,     29,    165,
+     148,     68,     56,    214,
+     178,     38,      1,      0,
+      80,     56,     69,    200,
+     238,     38,     98,     44,
+     134,    123,    141,     34,
+     115,    223,     57,    231,
+     214,    222,    175,    160,
+      16,     82,    149,     18,
+     177,    188,     51,     81,
+      34,     73,      4,    241,
+      60,      6,    203,    152,
+     164,     72,     37,    100,
+      75,     66,     12,    131,
+     101,     75,    116,    236,
+      68,    213,     92,    206,
+      91,     46,      9,     18,
+      73,    201,    180,     12,
+     231,    204,    216,      9,
+     133,     66,    168,    113,
+     252,     11,     41,     54,
+      51,    165,     34,    104,
+     202,    113,     24,    246,
+      29,      0,      0,    112,
+     240,     82,    107,    213,
+      74,    235,    227,    176,
+     184,     21,      8,     90,
+     141,    113,    206,    185,
+      55,     63,     35,     53,
+     209,     34,    165,     76,
+     195,     91,     95,     37,
+      53,      1,     69,     31,
+     135,    195,     98,     46,
+       8,     66,     74,    130,
+     160,    169,     90,     60,
+      14,    147,    162,    203,
+     221,     76,    199,    197,
+      28,    235,     71,    144,
+       8,    130,     74,    203,
+     240,    206,    157,    203,
+     208,     72,    164,     90,
+     206,     27,     41,    196,
+      70,    148,    150,     52,
+     173,    141,    103,     89,
+     198,      2,    160,    119,
+     189,     18,    201,    251,
+     223,     36,    141,    100,
+      91,     69,     17,      4,
+      25,    131,     99,     88,
+     167,    170,    149,    173,
+      95,     63,     37,     26,
+      97,    195,    246,     18,
+     162,     99,    216,     67,
+     133,    144,    196,    237,
+      27,    130,     32,     74,
+      28,    199,    240,    211,
+      10,     89,    158,     83,
+      65,    201,    142,    153,
+      91,    143,    134,    110,
+     119,     55,     47,    133,
+      66,    116,     24,    160,
+     207,    198,      8,     41,
+     243,    227,    247,    190,
+      38,     43,    115,    102,
+      34,      9,     20,    146,
+      30,     14,     12,     22,
+     243,    167,    154,     32,
+     132,    152,     88,    107,
+     236,     18,      8,     45,
+     195,     24,    140,     53,
+      69,    145,    242,     88,
+     156,     79,     77,     81,
+      90,    164,    179,    140,
+      57,      4,      2,     73,
+      82,     14,     15,     11,
+     243,     45,    165,    174,
+     254,     25,     66,     32,
+     136,     53,     44,    227,
+     221,    132,    150,    100,
+     222,    114,     12,    203,
+      30,      2,      4,     52,
+      21,     28,    160,    214,
+     215,     84,     83,    226,
+      55,    197,    108,    159,
+      51,     66,    255,     68,
+      94,    146,     72,    106,
+      29,    142,    231,    227,
+      34,    104,     40,    149,
+     162,     88,    172,    103,
+     109,     34,    209,     82,
+     141,    193,     51,    219,
+       4,     73,     15,    203,
+     187,     22,    130,     32,
+      34,    135,    193,    178,
+     137,    164,     80,     40,
+     122,     97,     56,    158,
+      25,    169,    169,    210,
+     231,     44,    213,    186,
+     206,    225,    108,    133,
+      89,    148,    166,    178,
+      19,    131,    227,     24,
+     163,    160,     64,    232,
+     177,    216,    177,     98,
+     126,      9,    233,    159,
+      70,     87,    228,    193,
+     192,      8,    114,     94,
+     232,    125,      2,     65,
+     216,    127,    195,    136,
+     240,      6,      1,    186,
+     171,     19,     15,    150,
+     225,    113,     15,      9,
+      74,    146,    114,    176,
+      62,    251,      4,     25,
+     188,     87,    196,    132,
+     146,    126,    242,     97,
+      48,     13,     66,     17,
+      36,    244,     50,    103,
+      48,     76,    106,    149,
+     244,    112,     28,     41,
+     199,    175,    199,     45,
+     138,    122,    135,     68,
+     136,     39,     18,     11,
+     107,     13,    115,     36,
+     148,    188,      4,      0,
+      64,    231,      4,     89,
+     120,     91,    212,    206,
+     237,    146,    241,    178,
+     224,     50,    135,     50,
+     173,     90,    183,     25,
+     196,    184,    162,    212,
+     138,    160,    108,     35,
+     106,    203,    203,    197,
+      98,    149,    184,    191,
+      34,    220,    163,    196,
+     151,    180,     62,     34,
+      81,    240,    140,    113,
+     220,    147,    179,    237,
+     245,     96,     59,    153,
+      82,    138,     34,    236,
+      37,     40,    107,     10,
+     117,    255,    242,     56,
+      94,     86,    238,    151,
+     178,    241,     68,     97,
+      46,     34,    233,     89,
+     185,    110,    191,     42,
+     207,    123,    213,    216,
+       7,     54,      4,     19,
+     199,    219,      2,    138,
+      60,      2,     14,    191,
+     102,     21,    169,     56,
+      38,    243,     82,      9,
+     178,    108,    178,     61,
+      75,     67,    203,    117,
+      98,    242,    106,    162,
+     162,     60,    195,    196,
+      94,      8,     18,     93,
+     229,     50,     28,     14,
+       5,    181,    105,     11,
+     150,     59,     18,      2,
+      37,     28,     22,     59,
+      10,     42,     66,     52,
+     109,    230,     37,    146,
+      84,    205,    196,    176,
+     191,    130,    160,    166,
+     199,    230,     55,     73,
+     166,    103,    207,    101,
+     110,    157,    166,    169,
+      27,    195,    123,    153,
+     168,    166,    135,    193,
+      13,    154,    138,    210,
+      76,    147,     63,     73,
+      36,     19,     36,     92,
+     156,     22,    147,    154,
+     182,     74,     31,    156,
+     246,     58,    164,    160,
+      58,     46,     27,    134,
+     140,     82,     66,    161,
+      49,    123,    189,     78,
+      10,    202,     65,    112,
+     227,     55,    149,     13,
+       2,    138,    253,    176,
+      99,    107,    137,    115,
+      90,     17,    175,    209,
+     232,     37,    164,     76,
+     180,     14,     56,     12,
+      95,     72,    157,     87,
+      33,     59,    131,    170,
+      83,     18,     15,     30,
+      15,    119,     65,     47,
+     208,    232,    120,     88,
+      61,    183,    134,    186,
+     172,     14,    108,     28,
+     130,     88,     78,     31,
+     253,     30,     28,     15,
+      97,    174,     20,    187,
+     249,    254,     91,     68,
+      85,     69,      3,     30,
+     150,     56,     39,    160,
+     218,    102,      3,    127,
+      65,     43,      2,     45,
+     210,    230,    118,     91,
+       3,     61,    217,     77,
+     113,    192,    245,     31,
+      78,    168,    138,    221,
+      34,    115,     46,     77,
+     217,    162,     94,    213,
+     236,    108,     98,    163,
+     170,    120,    107,     95,
+      25,     31,    123,      5,
+      42,     34,    227,    138,
+      21,    155,    184,    110,
+      76,    187,    105,    252,
+     246,    112,     16,     23,
+      11,    168,     24,     48,
+     125,    253,    114,    242,
+     141,     88,    142,    139,
+     131,     78,     66,     66,
+     123,     54,    157,    250,
+     135,    104,    164,    170,
+       2,    198,    142,    195,
+     181,    128,    250,     37,
+     149,    224,    230,     81,
+      79,    105,    233,     79,
+     134,     83,     46,     17,
+     233,     78,     94,    199,
+     209,    109,    185,    213,
+      80,     28,    149,     26,
+     188,     92,    186,     49,
+      53,    185,    229,    231,
+     200,    161,    166,    221,
+       3,    230,    244,    106,
+     203,     75,     76,     90,
+     204,    237,    141,     99,
+      47,     45,     60,     87,
+      96,    251,    164,    210,
+      94,    218,     94,    101,
+     125,    104,    168,     18,
+     199,    195,    128,    255,
+      22,     46,      5,     97,
+     201,    254,    247,    103,
+       9,     45,    249,    222,
+     102,    112,    113,     82,
+     183,     59,     90,     53,
+     140,     92,     61,    183,
+      31,     37,    197,    166,
+     108,    112,    253,    133,
+      79,    131,    100,    117,
+      11,     70,    108,     13,
+     121,    217,     17,    118,
+     254,    251,    216,     52,
+      20,     89,    242,    176,
+      49,    164,    205,     42,
+     213,    154,     28,    217,
+     121,     81,     80,     73,
+     181,    161,    235,     13,
+     230,    179,     31,    236,
+      86,     31,    139,     43,
+     106,    114,    214,      8,
+     244,    199,     67,    160,
+      49,      3,    153,    129,
+     221,     31,     22,     99,
+      91,     73,     86,    104,
+     244,    197,    104,    210,
+      19,     33,    232,    123,
+     179,    224,    225,     21,
+      18,    145,     34,      4,
+      54,    222,    165,     35,
+      64,    128,    152,    249,
+      56,    216,    108,     18,
+       4,     26,    154,      8,
+      27,    118,    113,     44,
+       8,     80,    166,    227,
+     192,    193,    156,     81,
+      39,     46,    230,     29,
+     140,     10,     34,    164,
+      78,    144,    152,    120,
+      71,     83,     84,     97,
+     179,    225,    241,    179,
+      20,    233,    196,    255,
+     180,    213,     72,     45,
+      35,      4,    150,    154,
+     177,     45,    162,    201,
+      86,     54,    222,     44,
+     220,     10,    212,    108,
+       5,    211,    162,    200,
+     173,     23,    147,     51,
+     178,    242,     50,     82,
+     225,     13,    201,    245,
+     171,    218,    141,    167,
+      93,    118,    215,    188,
+      10,     33,    123,    227,
+     125,    142,    169,     66,
+     142,      5,    137,      3,
+     216,      6,    237,    146,
+      64,    168,    174,     13,
+      62,     54,     84,    234,
+      69,     71,    100,     49,
+       7,    182,    137,     10,
+      69,    201,     38,    124,
+     147,    120,     21,    168,
+      26,     59,     25,     96,
+      48,     32,    210,    143,
+      36,     24,     92,    204,
+       6,    145,    228,    234,
+      84,     24,    240,     52,
+     209,     60,    186,     30,
+      55,    227,    191,     40,
+      82,    222,    202,     46,
+     119,     72,    153,      4,
+       0,    190,    189,    242,
+     174,    148,    124,    231,
+     219,     69,    145,    123,
+     120,    243,    159,     42,
+     172,    187,    191,    119,
+     164,     52,    132,    238,
+      77,     49,     55,    157,
+     182,    108,    203,    176,
+      34,    137,     50,     76,
+      30,    155,     19,    200,
+       8,     98,    153,     28,
+     118,     70,    146,     41,
+      40,      9,    135,    235,
+     184,    133,     72,     24,
+     159,    135,     97,     71,
+     149,     78,    215,    166,
+      99,    187,    149,     70,
+     209,     69,     19,    139,
+     225,     89,    153,    222,
+     247,    218,    156,     69,
+     209,    123,     77,    223,
+      58,     61,    231,    113,
+     138,    227,    117,    245,
+      14,     17,    207,     41,
+     235,    230,    100,     68,
+      74,    139,     68,    129,
+     227,    109,     12,    156,
+      34,    132,     46,    135,
+      35,     17,    233,      8,
+      84,    113,     48,    112,
+     124,    199,    251,    201,
+     195,    103,     47,     35,
+      65,     65,     13,    153,
+     242,     38,      2,    154,
+     144,    147,    207,    103,
+      56,     55,    133,    187,
+      60,    198,     80,    179,
+      14,     65,    180,    154,
+     226,      6,    164,    110,
+     134,    143,    203,     10,
+     161,     82,    148,    235,
+      24,    179,    235,    178,
+      92,    183,    183,    239,
+     142,    194,    221,    202,
+     228,    101,    221,     41,
+      72,    205,     19,     37,
+     123,    118,    227,     39,
+     192,    116,     93,    201,
+      53,     47,     85,     52,
+      12,    203,    191,     39,
+     195,     24,     53,    127,
+     160,    202,     74,    121,
+     187,    200,     98,    207,
+      19,     90,     12,    159,
+     211,    154,    172,    230,
+      70,    180,     13,     74,
+      65,     38,     39,      9,
+       5,    170,    119,     78,
+     103,    255,     49,    242,
+     188,     55,     83,    168,
+     178,      7,    168,     38,
+      27,     74,    178,    159,
+     142,    220,     21,     82,
+      59,    153,     59,      7,
+     255,    246,    113,     78,
+      34,    163,    141,    138,
+     104,    209,    208,    197,
+      49,    193,    101,    147,
+     245,     60,    115,    206,
+     193,     85,    157,     86,
+     137,    108,     29,    202,
+      57,     17,     93,    167,
+      42,    116,    109,    229,
+     181,    168,      0,     56,
+     177,    164,    120,    246,
+     243,    118,     28,     69,
+     143,     91,    165,     12,
+      65,     55,    121,    195,
+     196,    180,    134,    239,
+      95,    107,    171,    196,
+      42,    146,    137,     84,
+     213,    121,    116,    137,
+     239,     13,     62,    115,
+     187,    133,    248,    124,
+      93,     93,     20,     20,
+      26,    146,     24,     40,
+     153,     87,    169,     92,
+     126,    102,    192,    184,
+     211,    239,    164,     42,
+      18,     37,    141,    166,
+      42,    186,    248,    204,
+     103,    241,    156,     97,
+     239,    110,    227,    116,
+     117,    235,     80,    242,
+      82,    135,     29,    245,
+      20,    139,    225,     56,
+     254,    173,    211,      9,
+     151,     13,      0,    224,
+     208,    152,    172,     99,
+     121,    203,     57,    213,
+      56,      8,    149,     45,
+     136,     48,    184,    132,
+     141,    215,     85,    166,
+      43,     61,    183,     84,
+     227,    142,     16,    133,
+     170,    201,    142,    171,
+      41,    140,    138,     28,
+      76,     20,    138,     43,
+     210,    109,    131,    188,
+     124,     89,    187,     50,
+     225,      9,    145,     83,
+     200,    115,     65,    145,
+     109,    157,    110,    123,
+     164,    126,     37,    109,
+     155,    225,     56,    145,
+      36,    253,    163,    196,
+     215,    228,    232,     60,
+     165,    124,     69,    126,
+      79,    120,     92,    127,
+     153,     92,    231,    113,
+     177,    140,    203,     94,
+      16,     40,     13,      0,
+     128,    233,     95,    245,
+     187,     66,     54,    202,
+     198,    179,    163,    247,
+     233,     26,    171,    234,
+     246,    131,    162,     78,
+     146,    136,    193,    184,
+      60,     86,     89,    230,
+      58,    222,    235,    130,
+     140,     66,     84,     68,
+      41,     68,     82,     31,
+     202,    195,    101,     76,
+     174,     69,    137,    147,
+      38,     25,     26,    177,
+     211,    160,    201,     69,
+      12,    172,    165,     56,
+     102,    243,    112,    119,
+      53,     11,    170,    182,
+      16,    168,    179,    147,
+     115,     35,     20,    219,
+     244,    185,    206,     48,
+      74,    119,     44,     41,
+     110,     25,    101,    109,
+     121,    226,     69,      5,
+     135,    161,    187,    216,
+      21,      0,      0,      0,
+       0,      0,      0,      0,
+      15,    198,     59,    130,
+     200,    217,     67,    180,
+     113,     76,    137,     66,
+      80,    115,    103,     39,
+      85,    226,    204,    102,
+       8,     37,    186,    253,
+     161,     52,     50,    206,
+     238,     69,    211,    249,
+      87,    130,    136,    136,
+     179,    116,    170,     99,
+     220,    118,     65,    187,
+     158,     41,     33,     82,
+     113,    230,    181,     80,
+     197,    173,    220,     16,
+     116,     34,    199,     67,
+      68,     73,     24,    236,
+      25,      1,     65,    101,
+     156,    219,     41,    164,
+      92,      8,     47,    228,
+      48,     38,     22,     20,
+     250,    111,     60,     80,
+     154,     20,    135,    133,
+     172,    232,     56,     79,
+     135,     64,      9,    123,
+     184,    161,     16,    151,
+      96,     48,     19,     66,
+     180,    199,    167,     21,
+      32,    132,    217,    112,
+     163,     68,     95,    199,
+      57,    149,     64,    201,
+     248,     86,     37,    136,
+      96,     30,    152,    129,
+     168,     73,     57,     78,
+     116,      8,    200,    204,
+     238,      3,    228,     40,
+     154,    115,    110,     62,
+      82,     37,    181,    212,
+      30,     63,     41,     66,
+     118,     59,     65,     16,
+     196,     56,    198,    121,
+      32,    211,    115,    246,
+      35,     80,    132,     16,
+     238,    217,    160,     20,
+      27,      7,    115,     17,
+     213,    201,    121,     32,
+       4,    129,    204,    135,
+      49,     81,    173,     99,
+      12,     11,     33,     40,
+     173,    237,     66,     80,
+      85,    227,     24,     54,
+     210,    144,    227,    110,
+     138,     34,     32,    122,
+     230,      0,      0,      0,
+       0,      0,      0,      0,
+     208,    152,     80,    187,
+     220,    220,     68,    172,
+     202,    138,    246,    149,
+      69,    107,    246,     86,
+      17,    154,    218,    189,
+     213,    218,    207,     13,
+     145,     67,     21,     22,
+     196,      3,     33,     46,
+     199,    110,    161,     91,
+     134,    143,     74,     41,
+      61,     11,     97,    130,
+     158,    101,    220,    165,
+     146,    212,    175,    180,
+     129,    156,    183,    124,
+     200,    121,    199,    150,
+     182,    162,     54,      0,
+       0,     58,    254,    169,
+      16,    226,     46,     55,
+      40,    189,     42,    206,
+     151,     17,     84,    205,
+      98,     38,     26,     35,
+     111,    134,    173,     66,
+     160,    253,     12,     19,
+      34,     68,    134,    227,
+     159,     20,    162,    172,
+     198,    133,     82,    170,
+      44,    142,     11,    234,
+     133,    112,    216,     50,
+     129,     72,    132,     89,
+     171,    136,     88,     25,
+     152,    232,    138,      6,
+     123,     45,     80,    228,
+     167,    142,    149,     94,
+       5,      0,     36,     27,
+      74,    196,    109,    184,
+     162,    213,    232,     98,
+      55,    183,    116,    154,
+     139,     29,    161,    228,
+     187,    139,     21,     45,
+     158,    113,    178,    131,
+     166,    173,     23,    239,
+     165,    140,     62,    207,
+     152,     46,    217,     25,
+     118,     50,     75,    146,
+     103,    118,    252,    145,
+     202,     70,    177,     78,
+     117,     42,    117,     27,
+      87,     41,     85,     25,
+      31,    107,     41,    241,
+      47,    157,     87,    178,
+       4,     17,    246,    187,
+      66,     41,    103,     23,
+       0,      0,     18,    198,
+     143,     60,     64,    194,
+     232,    184,     34,     39,
+      99,     51,     76,    208,
+       9,    212,    184,    212,
+     166,    103,    163,    242,
+      16,    199,     17,    208,
+      21,    113,    176,    222,
+      40,     89,     24,    102,
+     148,     35,     64,    118,
+     194,    176,    128,     68,
+     201,    112,    108,     61,
+      65,    221,    198,     34,
+     168,    146,     90,     28,
+      67,    209,     25,    197,
+     192,    100,     70,     33,
+      89,    184,    144,     67,
+      16,     86,     97,     48,
+     145,     21,      0,      0,
+       0,      0,      0,     28,
+       0,    226,    204,     57,
+       6,    231,    220,    140,
+     162,     16,    148,     72,
+      62,     99,     38,    136,
+     104,     91,    123,    146,
+     104,    201,    116,    251,
+     100,     95,    239,    238,
+     118,     81,      4,      2,
+       2,     69,    123,      6,
+     195,    225,    156,    253,
+      81,    109,     34,     42,
+      68,     68,    230,    246,
+      45,    170,     52,    218,
+     179,    247,      9,    165,
+     210,      4,    227,    206,
+     220,    170,    148,    160,
+      68,     75,      1,      0,
+     176,     17,    169,     46,
+     152,    153,     76,    169,
+     106,    109,    254,     73,
+     159,     61,     75,    214,
+     103,     25,    137,    170,
+     220,     63,     75,    137,
+     214,    102,    191,     10,
+      74,     72,    205,    184,
+     185,     84,    145,    108,
+     251,     90,     81,    177,
+     125,    255,    100,     89,
+     150,     74,    175,    175,
+      77,     85,     42,     99,
+     206,     50,    161,     84,
+      37,    115,      0,      0,
+     118,     66,    136,    230,
+      48,    198,    200,    149,
+     162,    116,    113,    243,
+     180,    207,    183,    103,
+     249,     54,     29,     82,
+      66,     98,    152,    217,
+     166,    136,    138,     25,
+     179,    148,     66,     81,
+     162,    220,    113,    230,
+      85,    138,     52,    118,
+     203,     68,    169,    108,
+     243,    179,    245,     53,
+     185,     84,    155,    126,
+      63,     34,    164,    114,
+      12,    247,    135,     82,
+      40,    149,    157,      3,
+       0,     24,     79,     72,
+      66,     84,    113,    158,
+      51,     38,      4,     65,
+      18,     50,    207,    204,
+     237,    119,     85,     24,
+     231,     57,     19,     82,
+     163,     40,     84,    134,
+      99,     88,    156,    157,
+     108,     66,    171,    248,
+     117,     19,     66,     82,
+      90,    134,     49,    214,
+     153,     72,     41,    179,
+     222,    188,    189,     80,
+       8,      4,     33,    251,
+      25,     12,    198,    251,
+      24,    154,     80,    173,
+     246,    231,    186,     90,
+     212,     88,     99,     89,
+     119,     82,    210,     20,
+     149,    245,    203,      0,
 };
 const uint8_t wt_map[] = {
      176,    255,    202,    193,
@@ -11425,7 +8569,7 @@ const uint8_t wt_code[] = {
 
 
 const uint8_t* wt_table[] = {
-  wt_waves,
+  wt_compressed_waves,
   wt_map,
   wt_code,
 };
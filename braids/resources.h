@@ -36,6 +36,9 @@
 
 #include "stmlib/stmlib.h"
 
+// Set when the wavetable is stored compressed (see waveforms.COMPRESS_WAVES).
+#define BRAIDS_COMPRESSED_WAVES 1
+
 
 
 namespace braids {
@@ -99,7 +102,7 @@ extern const int16_t ws_moderate_overdrive[];
 extern const int16_t ws_violent_overdrive[];
 extern const int16_t ws_sine_fold[];
 extern const int16_t ws_tri_fold[];
-extern const uint8_t wt_waves[];
+extern const uint8_t wt_compressed_waves[];
 extern const uint8_t wt_map[];
 extern const uint8_t wt_code[];
 extern const uint16_t chr_characters[];
@@ -186,8 +189,8 @@ extern const uint16_t chr_characters[];
 #define WS_SINE_FOLD_SIZE 257
 #define WS_TRI_FOLD 3
 #define WS_TRI_FOLD_SIZE 257
-#define WT_WAVES 0
-#define WT_WAVES_SIZE 33024
+#define WT_COMPRESSED_WAVES 0
+#define WT_COMPRESSED_WAVES_SIZE 21600
 #define WT_MAP 1
 #define WT_MAP_SIZE 256
 #define WT_CODE 2
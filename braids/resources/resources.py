@@ -63,9 +63,6 @@ header = """// Copyright 2012 Olivier Gillet.
 namespace = 'braids'
 target = 'braids'
 types = ['uint8_t', 'uint16_t']
-includes = """
-#include "stmlib/stmlib.h"
-"""
 
 import characters
 import lookup_tables
@@ -73,6 +70,13 @@ import lookup_tables
 import waveforms
 import waveshapers
 
+includes = """
+#include "stmlib/stmlib.h"
+
+// Set when the wavetable is stored compressed (see waveforms.COMPRESS_WAVES).
+#define BRAIDS_COMPRESSED_WAVES %d
+""" % int(waveforms.COMPRESS_WAVES)
+
 create_specialized_manager = True
 
 resources = [
@@ -30,6 +30,8 @@
 
 import numpy
 
+import wavetable_codec
+
 
 """----------------------------------------------------------------------------
 Waveforms for vowel synthesis
@@ -141,9 +143,16 @@ waveforms.extend(bl_tri_tables)
 Wavetables
 -----------------------------------------------------------------------------"""
 
+# Set to False to store the waves uncompressed, as wt_waves.
+COMPRESS_WAVES = True
+
 wavetable_data = []
 waves = map(ord, file('braids/data/waves.bin', 'rb').read())
-wavetable_data.append(('waves', waves))
+if COMPRESS_WAVES:
+  wavetable_data.append(
+      ('compressed_waves', wavetable_codec.compress(waves, 129, 128)))
+else:
+  wavetable_data.append(('waves', waves))
 
 wave_map = map(ord, file('braids/data/map.bin', 'rb').read())
 wavetable_data.append(('map', wave_map))
@@ -0,0 +1,182 @@
+#!/usr/bin/python2.5
+#
+# Copyright 2012 Olivier Gillet.
+#
+# Author: Olivier Gillet (ol.gillet@gmail.com)
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+# 
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+# 
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+# 
+# See http://creativecommons.org/licenses/MIT/ for more information.
+#
+# -----------------------------------------------------------------------------
+#
+# Lossless codec for the wavetable data.
+#
+# Each wave is stored as the difference with a "base" wave (the last wave which
+# was itself stored without base), or as is when this is not cheaper. This
+# residual is then predicted with a first or second order polynomial, and the
+# prediction errors are Rice-coded, with a parameter chosen for each wave. All
+# the arithmetic is done modulo 256.
+#
+# The output starts with a 4-byte header per wave:
+#   - offset of the wave's bitstream in the output (16 bits, LSB first).
+#   - index of the base wave.
+#   - Rice parameter in bits 0-2, predictor order minus one in bit 3, and bit 4
+#     set if the wave has a base.
+#
+# The last sample of each wave (a copy of its first sample, used as a guard for
+# interpolation) is not stored.
+#
+# Decoded by braids/wavetable_codec.cc.
+#
+# The codec only suits tables read one whole wave at a time, with few waves in
+# use at once. This is why the other modules' wavetables are not compressed:
+# Tides reads the full-resolution level of four wt_waves corners per sample,
+# and the cell moves at audio rate under CV, so it would need 2kB of decoded
+# waves and a 257-sample decode per cell change; Frames reads one
+# wt_lfo_waveforms wave per channel (up to 64) and the table is only 4.6kB;
+# the Warps tables are floats, which this codec does not handle losslessly.
+
+def _signed(x):
+  x &= 0xff
+  return x - 256 if x > 127 else x
+
+
+def _prediction_errors(residual, order):
+  errors = []
+  for i, x in enumerate(residual):
+    if i == 0:
+      prediction = 0
+    elif i == 1 or order == 1:
+      prediction = residual[i - 1]
+    else:
+      prediction = 2 * residual[i - 1] - residual[i - 2]
+    errors.append(_signed(x - prediction))
+  return errors
+
+
+def _zigzag(x):
+  return (x << 1) if x >= 0 else ((-x) << 1) - 1
+
+
+def _rice_size(errors, k):
+  return sum((_zigzag(e) >> k) + 1 + k for e in errors)
+
+
+def _encode_residual(residual):
+  """Returns (size in bits, order, rice parameter) of the cheapest coding."""
+  candidates = []
+  for order in [1, 2]:
+    errors = _prediction_errors(residual, order)
+    for k in range(8):
+      candidates.append((_rice_size(errors, k), order, k))
+  return min(candidates)
+
+
+class _BitWriter(object):
+
+  def __init__(self):
+    self.bytes = []
+    self._byte = 0
+    self._num_bits = 0
+
+  def write(self, bit):
+    self._byte |= bit << self._num_bits
+    self._num_bits += 1
+    if self._num_bits == 8:
+      self.flush()
+
+  def flush(self):
+    if self._num_bits:
+      self.bytes.append(self._byte)
+      self._byte = 0
+      self._num_bits = 0
+
+
+def compress(data, stride, size):
+  """Compresses a list of len(data) / stride waves of size samples."""
+  waves = [list(data[i:i + size]) for i in range(0, len(data), stride)]
+  assert len(waves) <= 256
+
+  header = []
+  stream = []
+  base = None
+  for index, wave in enumerate(waves):
+    choice = _encode_residual(wave) + (None, wave)
+    if base is not None:
+      residual = [(x - y) & 0xff for x, y in zip(wave, waves[base])]
+      with_base = _encode_residual(residual) + (base, residual)
+      if with_base[0] < choice[0]:
+        choice = with_base
+    _, order, k, wave_base, residual = choice
+    flags = k | ((order - 1) << 3)
+    if wave_base is None:
+      base = index
+      wave_base = 0
+    else:
+      flags |= 0x10
+
+    offset = 4 * len(waves) + len(stream)
+    assert offset < 65536
+    header.extend([offset & 0xff, offset >> 8, wave_base, flags])
+
+    writer = _BitWriter()
+    for e in _prediction_errors(residual, order):
+      z = _zigzag(e)
+      for i in range(z >> k):
+        writer.write(0)
+      writer.write(1)
+      for i in range(k):
+        writer.write((z >> i) & 1)
+    writer.flush()
+    stream.extend(writer.bytes)
+  return header + stream
+
+
+def decompress(data, num_waves, stride, size):
+  """Reference decoder, for testing."""
+  waves = []
+  for index in range(num_waves):
+    offset = data[4 * index] | (data[4 * index + 1] << 8)
+    base, flags = data[4 * index + 2], data[4 * index + 3]
+    k, order = flags & 7, ((flags >> 3) & 1) + 1
+    bits = []
+    for byte in data[offset:]:
+      bits.extend((byte >> i) & 1 for i in range(8))
+    bits.reverse()
+    residual = []
+    for i in range(size):
+      q = 0
+      while not bits.pop():
+        q += 1
+      z = q << k
+      for j in range(k):
+        z |= bits.pop() << j
+      e = (z >> 1) ^ -(z & 1)
+      if i == 0:
+        prediction = 0
+      elif i == 1 or order == 1:
+        prediction = residual[i - 1]
+      else:
+        prediction = 2 * residual[i - 1] - residual[i - 2]
+      residual.append((prediction + e) & 0xff)
+    if flags & 0x10:
+      residual = [(x + y) & 0xff for x, y in zip(residual, waves[base])]
+    waves.append(residual + [residual[0]] * (stride - size))
+  return waves
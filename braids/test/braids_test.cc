@@ -17,8 +17,10 @@
 #include <cstdio>
 #include <cstring>
 #include <cstdlib>
+#include <ctime>
 
 #include "braids/macro_oscillator.h"
+#include "braids/macro_oscillator_bank.h"
 #include "braids/quantizer.h"
 #include "stmlib/test/wav_writer.h"
 #include "stmlib/utils/dsp.h"
@@ -57,6 +59,101 @@ void TestAudioRendering() {
   }
 }
 
+void TestWavetableSweep() {
+  MacroOscillator osc;
+  WavWriter wav_writer(1, kSampleRate, 10);
+  wav_writer.Open("wavetable_sweep.wav");
+
+  osc.Init();
+  osc.set_shape(MACRO_OSC_SHAPE_WAVE_MAP);
+
+  // Sweep the pitch from C1 to C9 to check that the mipmap level switches do
+  // not cause audible discontinuities, and that no aliasing folds back.
+  uint32_t num_blocks = kSampleRate * 10 / kAudioBlockSize;
+  for (uint32_t i = 0; i < num_blocks; ++i) {
+    int16_t buffer[kAudioBlockSize];
+    uint8_t sync_buffer[kAudioBlockSize];
+    memset(sync_buffer, 0, sizeof(sync_buffer));
+    osc.set_parameters(12000, 20000);
+    osc.set_pitch((24 << 7) + (96 << 7) * i / num_blocks);
+    osc.Render(sync_buffer, buffer, kAudioBlockSize);
+    wav_writer.WriteFrames(buffer, kAudioBlockSize);
+  }
+}
+
+void TestSawSwarm() {
+  MacroOscillator osc;
+  WavWriter wav_writer(1, kSampleRate, 8);
+  wav_writer.Open("saw_swarm.wav");
+
+  osc.Init();
+  osc.set_shape(MACRO_OSC_SHAPE_SAW_SWARM);
+
+  // Two seconds of each swarm size, with the same detuning.
+  uint32_t num_blocks = kSampleRate * 2 / kAudioBlockSize;
+  const size_t swarm_sizes[] = { 7, 12, 20, 32 };
+  for (size_t size = 0; size < 4; ++size) {
+    osc.set_swarm_size(swarm_sizes[size]);
+    osc.Strike();
+    clock_t start = clock();
+    for (uint32_t i = 0; i < num_blocks; ++i) {
+      int16_t buffer[kAudioBlockSize];
+      uint8_t sync_buffer[kAudioBlockSize];
+      memset(sync_buffer, 0, sizeof(sync_buffer));
+      osc.set_parameters(16000, 12000);
+      osc.set_pitch(48 << 7);
+      osc.Render(sync_buffer, buffer, kAudioBlockSize);
+      wav_writer.WriteFrames(buffer, kAudioBlockSize);
+    }
+    printf(
+        "%d saws: %.3fs for 2s of audio\n",
+        int(swarm_sizes[size]),
+        float(clock() - start) / CLOCKS_PER_SEC);
+  }
+}
+
+void TestBank() {
+  const size_t kNumVoices = 128;
+  const size_t kHostBlockSize = 64;
+  MacroOscillatorBankVoice* voices = new MacroOscillatorBankVoice[kNumVoices];
+  MacroOscillatorBank bank;
+  bank.Init(voices, kNumVoices);
+  
+  float* out[kNumVoices];
+  for (size_t i = 0; i < kNumVoices; ++i) {
+    out[i] = new float[kHostBlockSize];
+    bank.set_shape(i, static_cast<MacroOscillatorShape>(
+        i % MACRO_OSC_SHAPE_LAST));
+    bank.set_pitch(i, (36 << 7) + i * 32);
+    bank.set_parameters(i, 8192, 16384);
+  }
+
+  WavWriter wav_writer(1, kSampleRate, 5);
+  wav_writer.Open("bank.wav");
+  
+  clock_t start = clock();
+  size_t num_blocks = kSampleRate * 5 / kHostBlockSize;
+  for (size_t block = 0; block < num_blocks; ++block) {
+    bank.Render(out, kHostBlockSize);
+    int16_t mix[kHostBlockSize];
+    for (size_t j = 0; j < kHostBlockSize; ++j) {
+      float sum = 0.0f;
+      for (size_t i = 0; i < kNumVoices; ++i) {
+        sum += out[i][j];
+      }
+      mix[j] = Clip16(static_cast<int32_t>(sum * 32768.0f * 0.05f));
+    }
+    wav_writer.WriteFrames(mix, kHostBlockSize);
+  }
+  float seconds = static_cast<float>(clock() - start) / CLOCKS_PER_SEC;
+  printf("%d voices, 5s rendered in %fs\n", int(kNumVoices), seconds);
+  
+  for (size_t i = 0; i < kNumVoices; ++i) {
+    delete[] out[i];
+  }
+  delete[] voices;
+}
+
 void TestQuantizer() {
   Quantizer q;
   q.Init();
@@ -69,4 +166,7 @@ void TestQuantizer() {
 int main(void) {
   // TestQuantizer();
   TestAudioRendering();
+  // TestWavetableSweep();
+  // TestBank();
+  // TestSawSwarm();
 }
@@ -0,0 +1,92 @@
+// Copyright 2012 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Decoder for the wavetable data compressed by resources/wavetable_codec.py.
+
+#include "braids/wavetable_codec.h"
+
+#include "braids/wavetable_mipmap.h"
+
+namespace braids {
+
+void DecodeWave(const uint8_t* data, uint16_t index, uint8_t* destination) {
+  const uint8_t* header = data + 4 * index;
+  const uint8_t* stream = data + (header[0] | (header[1] << 8));
+  uint8_t base = header[2];
+  uint8_t flags = header[3];
+  uint8_t k = flags & 7;
+  bool second_order = flags & 0x08;
+  bool has_base = flags & 0x10;
+  
+  // A base wave never has a base itself, so this recurses only once.
+  if (has_base) {
+    DecodeWave(data, base, destination);
+  }
+  
+  uint32_t bits = 0;
+  uint8_t num_bits = 0;
+  uint8_t previous = 0;
+  uint8_t previous_previous = 0;
+  for (size_t i = 0; i < kWaveSize; ++i) {
+    // Rice-coded zigzagged prediction error: unary quotient, then k bits.
+    uint32_t z = 0;
+    while (true) {
+      if (!num_bits) {
+        bits = *stream++;
+        num_bits = 8;
+      }
+      uint32_t bit = bits & 1;
+      bits >>= 1;
+      --num_bits;
+      if (bit) {
+        break;
+      }
+      z += 1 << k;
+    }
+    for (uint8_t j = 0; j < k; ++j) {
+      if (!num_bits) {
+        bits = *stream++;
+        num_bits = 8;
+      }
+      z |= (bits & 1) << j;
+      bits >>= 1;
+      --num_bits;
+    }
+    uint8_t error = (z >> 1) ^ -(z & 1);
+    
+    uint8_t prediction = previous;
+    if (second_order && i >= 2) {
+      prediction = 2 * previous - previous_previous;
+    }
+    uint8_t residual = prediction + error;
+    previous_previous = previous;
+    previous = residual;
+    destination[i] = has_base ? destination[i] + residual : residual;
+  }
+  destination[kWaveSize] = destination[0];
+}
+
+}  // namespace braids
@@ -0,0 +1,101 @@
+// Copyright 2012 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Decoder for the wavetable data compressed by resources/wavetable_codec.py,
+// and small cache of decoded waves.
+//
+// When the resources are generated without compression
+// (BRAIDS_COMPRESSED_WAVES is 0 in braids/resources.h), wt_waves is used
+// directly and the cache is bypassed.
+
+#ifndef BRAIDS_WAVETABLE_CODEC_H_
+#define BRAIDS_WAVETABLE_CODEC_H_
+
+#include "stmlib/stmlib.h"
+
+#include "braids/resources.h"
+
+namespace braids {
+
+// Size of a wave in wt_waves, including the guard sample.
+static const size_t kWaveStride = 129;
+
+// Decodes a wave from the compressed data into destination.
+void DecodeWave(const uint8_t* data, uint16_t index, uint8_t* destination);
+
+// Returns a pointer to a wave, decoded into buffer if needed.
+inline const uint8_t* LoadWave(uint16_t index, uint8_t* buffer) {
+#if BRAIDS_COMPRESSED_WAVES
+  DecodeWave(wt_compressed_waves, index, buffer);
+  return buffer;
+#else
+  return wt_waves + index * kWaveStride;
+#endif  // BRAIDS_COMPRESSED_WAVES
+}
+
+// Least recently used cache of decoded waves. The number of slots is a
+// trade-off between RAM and decoding time, and depends on how many waves the
+// client accesses simultaneously.
+template<size_t num_slots>
+struct WaveCache {
+  uint16_t wave_index[num_slots];
+  uint32_t last_use[num_slots];
+  uint32_t clock;
+  uint8_t data[num_slots][kWaveStride];
+  
+  void Init() {
+    for (size_t i = 0; i < num_slots; ++i) {
+      wave_index[i] = 0xffff;
+      last_use[i] = 0;
+    }
+    clock = 0;
+  }
+  
+  const uint8_t* Get(uint16_t index) {
+#if BRAIDS_COMPRESSED_WAVES
+    ++clock;
+    size_t slot = 0;
+    for (size_t i = 0; i < num_slots; ++i) {
+      if (wave_index[i] == index) {
+        last_use[i] = clock;
+        return data[i];
+      }
+      if (last_use[i] < last_use[slot]) {
+        slot = i;
+      }
+    }
+    wave_index[slot] = index;
+    last_use[slot] = clock;
+    return LoadWave(index, data[slot]);
+#else
+    return LoadWave(index, NULL);
+#endif  // BRAIDS_COMPRESSED_WAVES
+  }
+};
+
+}  // namespace braids
+
+#endif  // BRAIDS_WAVETABLE_CODEC_H_
@@ -0,0 +1,120 @@
+// Copyright 2012 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Band-limited mipmaps of the 128-sample waves of the wavetable data.
+//
+// Level 0 is the original wave converted to 16-bit. Each subsequent level is
+// obtained by half-band filtering and decimating the previous one, so level n
+// has 128 >> n samples and contains no harmonic above (64 >> n). Each level is
+// followed by a copy of its first sample so that interpolation never needs to
+// wrap around.
+
+#ifndef BRAIDS_WAVETABLE_MIPMAP_H_
+#define BRAIDS_WAVETABLE_MIPMAP_H_
+
+#include "stmlib/stmlib.h"
+
+namespace braids {
+
+static const size_t kWaveSizeBits = 7;
+static const size_t kWaveSize = 1 << kWaveSizeBits;
+static const size_t kNumMipmapLevels = 6;
+static const size_t kMipmapSize = 2 * kWaveSize - \
+    (kWaveSize >> (kNumMipmapLevels - 1)) + kNumMipmapLevels;
+
+// Non-zero taps of an 11-tap half-band filter (Blackman-windowed sinc), in
+// 15-bit fixed point. The center tap is 0.5 and the even taps are zero.
+static const int32_t kHalfBandTaps[3] = { 9318, -1183, 57 };
+
+inline size_t MipmapLevelOffset(size_t level) {
+  return 2 * kWaveSize - (2 * kWaveSize >> level) + level;
+}
+
+inline const int16_t* MipmapLevel(const int16_t* mipmap, size_t level) {
+  return mipmap + MipmapLevelOffset(level);
+}
+
+// Picks the coarsest level whose highest harmonic stays below Nyquist.
+inline size_t ComputeMipmapLevel(uint32_t phase_increment) {
+  size_t level = 0;
+  uint32_t limit = 1L << (32 - kWaveSizeBits);
+  while (phase_increment >= limit && level < kNumMipmapLevels - 1) {
+    limit <<= 1;
+    ++level;
+  }
+  return level;
+}
+
+inline size_t MipmapPhaseShift(size_t level) {
+  return 32 - kWaveSizeBits + level;
+}
+
+// Single linearly interpolated read from one level, with a 15-bit fractional
+// part taken right below the integral part of the phase.
+inline int16_t InterpolateMipmap(
+    const int16_t* level,
+    uint32_t phase,
+    size_t shift) {
+  uint32_t integral = phase >> shift;
+  int32_t fractional = (phase << (32 - shift)) >> 17;
+  int32_t a = level[integral];
+  int32_t b = level[integral + 1];
+  return a + ((b - a) * fractional >> 15);
+}
+
+inline void BuildWavetableMipmap(const uint8_t* wave, int16_t* mipmap) {
+  int16_t* source = mipmap;
+  for (size_t i = 0; i < kWaveSize; ++i) {
+    source[i] = (static_cast<int16_t>(wave[i]) << 8) - 32768;
+  }
+  source[kWaveSize] = source[0];
+
+  size_t size = kWaveSize;
+  for (size_t level = 1; level < kNumMipmapLevels; ++level) {
+    int16_t* destination = source + size + 1;
+    size_t mask = size - 1;
+    for (size_t i = 0; i < (size >> 1); ++i) {
+      size_t center = i << 1;
+      int32_t sum = static_cast<int32_t>(source[center]) << 14;
+      for (size_t tap = 0; tap < 3; ++tap) {
+        size_t offset = (tap << 1) + 1;
+        sum += kHalfBandTaps[tap] * (
+            source[(center + offset) & mask] +
+            source[(center - offset) & mask]);
+      }
+      sum >>= 15;
+      CLIP(sum)
+      destination[i] = sum;
+    }
+    size >>= 1;
+    destination[size] = destination[0];
+    source = destination;
+  }
+}
+
+}  // namespace braids
+
+#endif  // BRAIDS_WAVETABLE_MIPMAP_H_
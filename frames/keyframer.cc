@@ -57,6 +57,7 @@ stmlib::Storage<0x8020000, 4> storage;
 #endif  // TEST
 
 void Keyframer::Init() {
+  cursor_ = kInvalidCursor;
 #ifndef TEST
   if (!storage.ParsimoniousLoad(keyframes_, SETTINGS_SIZE, &version_token_)) {
     for (uint8_t i = 0; i < kNumChannels; ++i) {
@@ -92,6 +93,7 @@ void Keyframer::Clear() {
   fill(&keyframes_[0], &keyframes_[kMaxNumKeyframe], empty);
   num_keyframes_ = 0;
   id_counter_ = 0;
+  cursor_ = kInvalidCursor;
 }
 
 uint16_t Keyframer::FindKeyframe(uint16_t timestamp) {
@@ -107,6 +109,43 @@ uint16_t Keyframer::FindKeyframe(uint16_t timestamp) {
       KeyframeLess()) - keyframes_;
 }
 
+uint16_t Keyframer::Seek(uint16_t timestamp) {
+  uint16_t position = cursor_;
+  bool found = false;
+  if (position <= num_keyframes_) {
+    // Timestamps usually move slowly, or monotonically: look for the new
+    // position in the neighborhood of the previous one.
+    for (uint8_t i = 0; i <= kMaxCursorSteps; ++i) {
+      if (position < num_keyframes_ &&
+          keyframes_[position].timestamp < timestamp) {
+        ++position;
+      } else if (position > 0 &&
+          keyframes_[position - 1].timestamp >= timestamp) {
+        --position;
+      } else {
+        found = true;
+        break;
+      }
+    }
+  }
+  if (!found) {
+    position = FindKeyframe(timestamp);
+  }
+  
+  if (position != cursor_) {
+    cursor_ = position;
+    if (position > 0 && position < num_keyframes_) {
+      // The reciprocal is rounded up, and has 16 more bits than the
+      // numerator of the scale, so that the result is exactly the quotient.
+      uint64_t start = keyframes_[position - 1].timestamp;
+      uint64_t duration = keyframes_[position].timestamp - start;
+      segment_start_ = start;
+      segment_reciprocal_ = ((1ULL << 48) + duration - 1) / duration;
+    }
+  }
+  return position;
+}
+
 /* static */
 uint16_t Keyframer::ConvertToDacCode(uint16_t gain, uint8_t response) {
   // Exponential response is easy, straight to the 2164.
@@ -122,25 +161,6 @@ uint16_t Keyframer::ConvertToDacCode(uint16_t gain, uint8_t response) {
   return (linear + ((exponential - linear) * balance >> 15)) >> 4;
 }
 
-inline uint16_t Keyframer::Easing(
-    int32_t from,
-    int32_t to,
-    uint32_t scale,
-    EasingCurve curve) {
-  int32_t shaped_scale = scale;
-  if (curve == EASING_CURVE_STEP) {
-    shaped_scale = scale < 32768 ? 0 : 65535;
-  } else if (curve >= EASING_CURVE_IN_QUARTIC) {
-    const uint16_t* easing_curve = lookup_table_table[
-        curve - EASING_CURVE_IN_QUARTIC];
-    int32_t scale_a = easing_curve[scale >> 6];
-    int32_t scale_b = easing_curve[(scale >> 6) + 1];
-    shaped_scale = scale_a + (((scale_b - scale_a) >> 1) * \
-      ((scale << 10) & 0xffff) >> 15);
-  }
-  return from + ((to - from) * (shaped_scale >> 1) >> 15);
-}
-
 uint16_t Keyframer::SampleAnimation(
     uint8_t channel,
     uint16_t tick,
@@ -190,6 +210,7 @@ bool Keyframer::AddKeyframe(uint16_t timestamp, uint16_t* values) {
     keyframes_[insertion_point].timestamp = timestamp;
     keyframes_[insertion_point].id = id_counter_++;
     ++num_keyframes_;
+    cursor_ = kInvalidCursor;
   }
   copy(values, values + kNumChannels, keyframes_[insertion_point].values);
   return true;
@@ -208,6 +229,7 @@ bool Keyframer::RemoveKeyframe(uint16_t timestamp) {
     keyframes_[i] = keyframes_[i + 1];
   }
   --num_keyframes_;
+  cursor_ = kInvalidCursor;
   return true;
 }
 
@@ -218,7 +240,7 @@ void Keyframer::Evaluate(uint16_t timestamp) {
     position_ = -1;
     nearest_keyframe_ = -1;
   } else {
-    uint16_t position = FindKeyframe(timestamp);
+    uint16_t position = Seek(timestamp);
     position_ = position;
 
     // Check for the areas before the first keyframe, and after the last
@@ -232,9 +254,7 @@ void Keyframer::Evaluate(uint16_t timestamp) {
       // This is where the real interpolation takes place.
       const Keyframe& a = keyframes_[position - 1];
       const Keyframe& b = keyframes_[position];
-      uint32_t scale = timestamp - a.timestamp;
-      scale <<= 16;
-      scale /= (b.timestamp - a.timestamp);
+      uint32_t scale = SegmentScale(timestamp);
       for (uint8_t i = 0; i < kNumChannels; ++i) {
         int32_t from = a.values[i];
         int32_t to = b.values[i];
@@ -257,4 +277,34 @@ void Keyframer::Evaluate(uint16_t timestamp) {
   }
 }
 
+void Keyframer::EvaluateBlock(
+    const uint16_t* timestamps,
+    uint16_t* levels,
+    size_t size) {
+  while (size--) {
+    uint16_t timestamp = *timestamps++;
+    if (!num_keyframes_) {
+      copy(immediate_, immediate_ + kNumChannels, levels);
+    } else {
+      uint16_t position = Seek(timestamp);
+      if (position == 0 || position == num_keyframes_) {
+        const Keyframe& source = keyframes_[position ? position - 1 : 0];
+        copy(source.values, source.values + kNumChannels, levels);
+      } else {
+        const Keyframe& a = keyframes_[position - 1];
+        const Keyframe& b = keyframes_[position];
+        uint32_t scale = SegmentScale(timestamp);
+        for (uint8_t i = 0; i < kNumChannels; ++i) {
+          levels[i] = Easing(
+              a.values[i],
+              b.values[i],
+              scale,
+              settings_[i].easing_curve);
+        }
+      }
+    }
+    levels += kNumChannels;
+  }
+}
+
 }  // namespace frames
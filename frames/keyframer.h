@@ -31,6 +31,8 @@
 
 #include "stmlib/stmlib.h"
 
+#include "frames/resources.h"
+
 namespace frames {
   
 const uint8_t kNumChannels = 4;
@@ -38,6 +40,11 @@ const uint8_t kMaxNumKeyframe = 64;
 
 const uint8_t kNumPaletteEntries = 8;
 
+// Largest move of the evaluation cursor, in keyframes, before falling back to
+// a binary search.
+const uint8_t kMaxCursorSteps = 2;
+const uint16_t kInvalidCursor = 0xffff;
+
 enum EasingCurve {
   EASING_CURVE_STEP,
   EASING_CURVE_LINEAR,
@@ -99,6 +106,11 @@ class Keyframer {
   
   void Evaluate(uint16_t timestamp);
   
+  // Computes the levels of all channels for a block of timestamps, and writes
+  // them interleaved (kNumChannels values per timestamp) to levels. The state
+  // exposed to the UI (levels, DAC codes, color, position) is not modified.
+  void EvaluateBlock(const uint16_t* timestamps, uint16_t* levels, size_t size);
+  
   inline ChannelSettings* mutable_settings(uint8_t channel) {
     return &settings_[channel];
   }
@@ -117,7 +129,24 @@ class Keyframer {
   
   inline uint16_t num_keyframes() const { return num_keyframes_; }
   
-  uint16_t Easing(int32_t from, int32_t to, uint32_t scale, EasingCurve curve);
+  static inline uint16_t Easing(
+      int32_t from,
+      int32_t to,
+      uint32_t scale,
+      EasingCurve curve) {
+    int32_t shaped_scale = scale;
+    if (curve == EASING_CURVE_STEP) {
+      shaped_scale = scale < 32768 ? 0 : 65535;
+    } else if (curve >= EASING_CURVE_IN_QUARTIC) {
+      const uint16_t* easing_curve = lookup_table_table[
+          curve - EASING_CURVE_IN_QUARTIC];
+      int32_t scale_a = easing_curve[scale >> 6];
+      int32_t scale_b = easing_curve[(scale >> 6) + 1];
+      shaped_scale = scale_a + (((scale_b - scale_a) >> 1) * \
+        ((scale << 10) & 0xffff) >> 15);
+    }
+    return from + ((to - from) * (shaped_scale >> 1) >> 15);
+  }
   
   // This creates a sample animation (between 0 to 65535 and back to 0) used
   // for animating the LED when editing the easing curve or response.
@@ -139,6 +168,15 @@ class Keyframer {
   
  private:
   uint16_t FindKeyframe(uint16_t timestamp);
+  uint16_t Seek(uint16_t timestamp);
+  
+  // Same as ((timestamp - start) << 16) / (end - start) for the segment on
+  // which the cursor is, but with a multiplication by the reciprocal of the
+  // segment duration computed by Seek().
+  inline uint32_t SegmentScale(uint16_t timestamp) const {
+    uint64_t t = static_cast<uint16_t>(timestamp - segment_start_);
+    return static_cast<uint32_t>((t * segment_reciprocal_) >> 32);
+  }
    
   Keyframe keyframes_[kMaxNumKeyframe];
   ChannelSettings settings_[kNumChannels];
@@ -159,6 +197,13 @@ class Keyframer {
 
   int16_t position_;
   int16_t nearest_keyframe_;
+  
+  // Index of the first keyframe at or after the last evaluated timestamp,
+  // and start time and reciprocal of the duration of the segment ending at
+  // this keyframe.
+  uint16_t cursor_;
+  uint16_t segment_start_;
+  uint64_t segment_reciprocal_;
 
   uint16_t dac_code_[kNumChannels];
   uint16_t levels_[kNumChannels];
@@ -0,0 +1,399 @@
+// Copyright 2013 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+//
+// -----------------------------------------------------------------------------
+//
+// Keyframe interpolator for a large number of channels.
+
+#include "frames/multi_keyframer.h"
+
+#include <algorithm>
+
+#ifndef TEST
+#include "stmlib/system/flash_programming.h"
+#endif  // TEST
+
+namespace frames {
+
+using namespace std;
+
+void MultiKeyframer::Init(
+    uint16_t* buffer,
+    size_t buffer_size,
+    uint8_t num_channels) {
+  if (num_channels > kMaxNumMultiKeyframerChannels) {
+    num_channels = kMaxNumMultiKeyframerChannels;
+  }
+  size_t num_columns = num_channels + 1;
+  size_t capacity = buffer_size / num_columns;
+  size_t max_capacity = (kMultiKeyframerStoragePages - 1) * \
+      kMultiKeyframerPageSize / num_columns;
+  if (capacity > max_capacity) {
+    capacity = max_capacity;
+  }
+  if (capacity > 0xffff) {
+    capacity = 0xffff;
+  }
+  
+  buffer_ = buffer;
+  state_.capacity = capacity;
+  state_.num_channels = num_channels;
+  state_.padding = 0;
+  state_.enabled_banks = 0;
+  uint8_t num_banks = (num_channels + kMultiKeyframerBankSize - 1) / \
+      kMultiKeyframerBankSize;
+  for (uint8_t i = 0; i < num_banks; ++i) {
+    set_bank_enabled(i, true);
+  }
+  for (uint8_t i = 0; i < kMaxNumMultiKeyframerChannels; ++i) {
+    state_.settings[i].easing_curve = EASING_CURVE_LINEAR;
+    state_.settings[i].response = 0;
+  }
+  state_.generation = 0;
+  fill(
+      &state_.page_generation[0],
+      &state_.page_generation[kMultiKeyframerStoragePages],
+      0);
+  dirty_pages_ = 0;
+  Clear();
+}
+
+void MultiKeyframer::Clear() {
+  state_.num_keyframes = 0;
+  cursor_ = kInvalidCursor;
+  dirty_pages_ |= 1;
+}
+
+int32_t MultiKeyframer::FindKeyframe(uint16_t timestamp) const {
+  return lower_bound(
+      buffer_,
+      buffer_ + state_.num_keyframes,
+      timestamp) - buffer_;
+}
+
+void MultiKeyframer::MarkDirty(const uint16_t* begin, const uint16_t* end) {
+  if (begin >= end) {
+    return;
+  }
+  size_t first_page = (begin - buffer_) / kMultiKeyframerPageSize;
+  size_t last_page = (end - buffer_ - 1) / kMultiKeyframerPageSize;
+  for (size_t page = first_page; page <= last_page; ++page) {
+    dirty_pages_ |= 2UL << page;
+  }
+}
+
+void MultiKeyframer::MarkColumnsDirty(
+    uint16_t first_index,
+    uint16_t last_index) {
+  for (uint8_t i = 0; i <= state_.num_channels; ++i) {
+    uint16_t* column = &buffer_[i * state_.capacity];
+    MarkDirty(column + first_index, column + last_index);
+  }
+  dirty_pages_ |= 1;
+}
+
+bool MultiKeyframer::AddKeyframe(uint16_t timestamp, const uint16_t* values) {
+  uint16_t n = state_.num_keyframes;
+  uint16_t position = FindKeyframe(timestamp);
+  if (position < n && buffer_[position] == timestamp) {
+    for (uint8_t i = 0; i < state_.num_channels; ++i) {
+      set_value(position, i, values[i]);
+    }
+    return true;
+  }
+  
+  if (n == state_.capacity) {
+    return false;
+  }
+  uint16_t* timestamps = buffer_;
+  copy_backward(timestamps + position, timestamps + n, timestamps + n + 1);
+  timestamps[position] = timestamp;
+  for (uint8_t i = 0; i < state_.num_channels; ++i) {
+    uint16_t* v = column(i);
+    copy_backward(v + position, v + n, v + n + 1);
+    v[position] = values[i];
+  }
+  ++state_.num_keyframes;
+  cursor_ = kInvalidCursor;
+  MarkColumnsDirty(position, n + 1);
+  return true;
+}
+
+bool MultiKeyframer::RemoveKeyframe(uint16_t timestamp) {
+  uint16_t n = state_.num_keyframes;
+  uint16_t position = FindKeyframe(timestamp);
+  if (position >= n || buffer_[position] != timestamp) {
+    return false;
+  }
+  for (uint8_t i = 0; i <= state_.num_channels; ++i) {
+    uint16_t* v = &buffer_[i * state_.capacity];
+    copy(v + position + 1, v + n, v + position);
+  }
+  --state_.num_keyframes;
+  cursor_ = kInvalidCursor;
+  MarkColumnsDirty(position, n - 1);
+  return true;
+}
+
+uint16_t MultiKeyframer::Seek(uint16_t timestamp) {
+  uint16_t n = state_.num_keyframes;
+  uint16_t position = cursor_;
+  bool found = false;
+  if (position <= n) {
+    for (uint8_t i = 0; i <= kMaxCursorSteps; ++i) {
+      if (position < n && buffer_[position] < timestamp) {
+        ++position;
+      } else if (position > 0 && buffer_[position - 1] >= timestamp) {
+        --position;
+      } else {
+        found = true;
+        break;
+      }
+    }
+  }
+  if (!found) {
+    position = FindKeyframe(timestamp);
+  }
+  
+  if (position != cursor_) {
+    cursor_ = position;
+    if (position > 0 && position < n) {
+      uint64_t start = buffer_[position - 1];
+      uint64_t duration = buffer_[position] - start;
+      segment_start_ = start;
+      segment_reciprocal_ = ((1ULL << 48) + duration - 1) / duration;
+    }
+  }
+  return position;
+}
+
+void MultiKeyframer::Evaluate(uint16_t timestamp, uint16_t* levels) {
+  uint16_t n = state_.num_keyframes;
+  uint16_t position = n ? Seek(timestamp) : 0;
+  bool interpolate = position > 0 && position < n;
+  uint32_t scale = interpolate ? SegmentScale(timestamp) : 0;
+  uint16_t source = position ? position - 1 : 0;
+  
+  for (uint8_t channel = 0; channel < state_.num_channels; ) {
+    if (!bank_enabled(channel / kMultiKeyframerBankSize)) {
+      channel += kMultiKeyframerBankSize;
+      continue;
+    }
+    uint8_t bank_end = min(
+        channel + kMultiKeyframerBankSize,
+        static_cast<int>(state_.num_channels));
+    for (; channel < bank_end; ++channel) {
+      const uint16_t* v = column(channel);
+      if (!n) {
+        levels[channel] = 0;
+      } else if (interpolate) {
+        levels[channel] = Keyframer::Easing(
+            v[position - 1],
+            v[position],
+            scale,
+            state_.settings[channel].easing_curve);
+      } else {
+        levels[channel] = v[source];
+      }
+    }
+  }
+}
+
+void MultiKeyframer::EvaluateChannel(
+    uint8_t channel,
+    const uint16_t* timestamps,
+    uint16_t* levels,
+    size_t size) {
+  uint16_t n = state_.num_keyframes;
+  const uint16_t* v = column(channel);
+  EasingCurve curve = state_.settings[channel].easing_curve;
+  if (!n) {
+    fill(levels, levels + size, 0);
+    return;
+  }
+  while (size--) {
+    uint16_t timestamp = *timestamps++;
+    uint16_t position = Seek(timestamp);
+    if (position == 0) {
+      *levels++ = v[0];
+    } else if (position == n) {
+      *levels++ = v[n - 1];
+    } else {
+      *levels++ = Keyframer::Easing(
+          v[position - 1],
+          v[position],
+          SegmentScale(timestamp),
+          curve);
+    }
+  }
+}
+
+void MultiKeyframer::Save() {
+  dirty_pages_ |= 1;
+  while (Tick());
+}
+
+bool MultiKeyframer::Tick() {
+  if (dirty_pages_) {
+    // The state page, which holds the number of keyframes, is written last.
+    uint8_t page = 1;
+    while (page < 32 && !(dirty_pages_ & (1UL << page))) {
+      ++page;
+    }
+    WritePage(page == 32 ? 0 : page);
+  }
+  return dirty_pages_ != 0;
+}
+
+void MultiKeyframer::WritePage(uint8_t page) {
+  const uint16_t* data;
+  size_t size;
+  if (page == 0) {
+    data = static_cast<const uint16_t*>(static_cast<const void*>(&state_));
+    size = sizeof(state_) / sizeof(uint16_t);
+  } else {
+    size_t start = (page - 1) * kMultiKeyframerPageSize;
+    size_t end = (state_.num_channels + 1) * state_.capacity;
+    data = &buffer_[start];
+    size = min(kMultiKeyframerPageSize, end - start);
+    state_.page_generation[page] = state_.generation;
+  }
+  dirty_pages_ &= ~(1UL << page);
+  
+  MultiKeyframerPageHeader header;
+  header.magic = kMultiKeyframerStorageMagic;
+  header.index = page;
+  header.size = size;
+  header.checksum = 0;
+  header.generation = state_.generation;
+  header.padding = 0;
+  for (size_t i = 0; i < size; ++i) {
+    header.checksum += data[i];
+  }
+
+#ifndef TEST
+  uint32_t address = kMultiKeyframerStorageBase + page * PAGE_SIZE;
+  FLASH_Unlock();
+  FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPRTERR);
+  FLASH_ErasePage(address);
+  
+  // The header is written last, so that an interrupted write is detected.
+  uint32_t data_address = address + sizeof(header);
+  for (size_t i = 0; i < size; ++i) {
+    FLASH_ProgramHalfWord(data_address + i * 2, data[i]);
+  }
+  const uint16_t* header_words = static_cast<const uint16_t*>(
+      static_cast<const void*>(&header));
+  for (size_t i = sizeof(header) / sizeof(uint16_t); i--; ) {
+    FLASH_ProgramHalfWord(address + i * 2, header_words[i]);
+  }
+#endif  // TEST
+  if (page == 0) {
+    // The pages written from now on belong to the next save.
+    ++state_.generation;
+  }
+}
+
+bool MultiKeyframer::ReadPage(uint8_t page) {
+#ifndef TEST
+  uint32_t address = kMultiKeyframerStorageBase + page * PAGE_SIZE;
+  const MultiKeyframerPageHeader* header = \
+      reinterpret_cast<const MultiKeyframerPageHeader*>(address);
+  const uint16_t* data = reinterpret_cast<const uint16_t*>(
+      address + sizeof(MultiKeyframerPageHeader));
+  
+  size_t expected_size;
+  uint16_t* destination;
+  if (page == 0) {
+    expected_size = sizeof(state_) / sizeof(uint16_t);
+    destination = static_cast<uint16_t*>(static_cast<void*>(&state_));
+  } else {
+    size_t start = (page - 1) * kMultiKeyframerPageSize;
+    size_t end = (state_.num_channels + 1) * state_.capacity;
+    expected_size = min(kMultiKeyframerPageSize, end - start);
+    destination = &buffer_[start];
+  }
+  if (header->magic != kMultiKeyframerStorageMagic ||
+      header->index != page ||
+      header->size != expected_size ||
+      (page != 0 && header->generation != state_.page_generation[page])) {
+    return false;
+  }
+  uint16_t checksum = 0;
+  for (size_t i = 0; i < expected_size; ++i) {
+    checksum += data[i];
+  }
+  if (checksum != header->checksum) {
+    return false;
+  }
+  copy(data, data + expected_size, destination);
+  return true;
+#else
+  return false;
+#endif  // TEST
+}
+
+bool MultiKeyframer::Load() {
+  MultiKeyframerState current = state_;
+  if (!ReadPage(0)) {
+    return false;
+  }
+  // Whatever happens next, the pages written by the next save must not be
+  // mistaken for pages of the stored one.
+  uint16_t generation = state_.generation + 1;
+  if (state_.num_channels != current.num_channels ||
+      state_.capacity != current.capacity ||
+      state_.num_keyframes > state_.capacity) {
+    state_ = current;
+    state_.generation = generation;
+    return false;
+  }
+  
+  // Only read the pages containing keyframes.
+  uint32_t used_pages = 0;
+  for (uint8_t i = 0; i <= state_.num_channels; ++i) {
+    size_t begin = i * state_.capacity;
+    size_t end = begin + state_.num_keyframes;
+    for (size_t word = begin; word < end; ) {
+      size_t page = word / kMultiKeyframerPageSize;
+      used_pages |= 2UL << page;
+      word = (page + 1) * kMultiKeyframerPageSize;
+    }
+  }
+  for (uint8_t page = 1; page < kMultiKeyframerStoragePages; ++page) {
+    if ((used_pages & (1UL << page)) && !ReadPage(page)) {
+      state_ = current;
+      state_.generation = generation;
+      Clear();
+      return false;
+    }
+  }
+  state_.generation = generation;
+  cursor_ = kInvalidCursor;
+  dirty_pages_ = 0;
+  return true;
+}
+
+}  // namespace frames
@@ -0,0 +1,193 @@
+// Copyright 2013 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+//
+// -----------------------------------------------------------------------------
+//
+// Keyframe interpolator for a large number of channels.
+//
+// The keyframes are stored by column in a buffer provided by the caller: the
+// timestamps first, then the values of each channel. The number of keyframes
+// is thus only limited by the size of this buffer. Channels are grouped in
+// banks of 4; only the channels of the enabled banks are evaluated.
+//
+// For storage, the buffer is split into flash pages. Only the pages in which
+// keyframes have been modified since the last save are rewritten, and only
+// the pages containing keyframes are read back. The state page is written
+// last, and records the save during which each page of the buffer was
+// written: a page left over from an interrupted save is thus rejected instead
+// of being mixed with the keyframes of the previous one.
+
+#ifndef FRAMES_MULTI_KEYFRAMER_H_
+#define FRAMES_MULTI_KEYFRAMER_H_
+
+#include "stmlib/stmlib.h"
+
+#include "frames/keyframer.h"
+
+namespace frames {
+
+const uint8_t kMaxNumMultiKeyframerChannels = 64;
+const uint8_t kMultiKeyframerBankSize = 4;
+
+// 28 pages right below the storage of the Keyframer. The first page stores
+// the number of keyframes and channel settings, the others the buffer. The
+// makefile checks that the application ends below
+// kMultiKeyframerStorageBase.
+const uint32_t kMultiKeyframerStorageBase = 0x8018000;
+const uint8_t kMultiKeyframerStoragePages = 28;
+const uint16_t kMultiKeyframerStorageMagic = 0x4b4d;  // "MK"
+
+struct MultiKeyframerPageHeader {
+  uint16_t magic;
+  uint16_t index;
+  uint16_t size;
+  uint16_t checksum;
+  uint16_t generation;
+  uint16_t padding;
+};
+
+// Number of 16-bit words of the buffer stored in one (1kB) flash page.
+const size_t kMultiKeyframerPageSize = (1024 - \
+    sizeof(MultiKeyframerPageHeader)) / sizeof(uint16_t);
+
+struct MultiKeyframerState {
+  uint16_t num_keyframes;
+  uint16_t capacity;
+  uint8_t num_channels;
+  uint8_t padding;
+  uint16_t enabled_banks;
+  ChannelSettings settings[kMaxNumMultiKeyframerChannels];
+  // Incremented after each save.
+  uint16_t generation;
+  // Generation of the save during which each page was last written.
+  uint16_t page_generation[kMultiKeyframerStoragePages];
+};
+
+class MultiKeyframer {
+ public:
+  MultiKeyframer() { }
+  ~MultiKeyframer() { }
+  
+  // The buffer must be able to hold (num_channels + 1) words per keyframe.
+  void Init(uint16_t* buffer, size_t buffer_size, uint8_t num_channels);
+  void Clear();
+  
+  // Loads the keyframes saved for the same number of channels and capacity.
+  bool Load();
+  
+  // Writes all the pages modified since the last save.
+  void Save();
+  
+  // Writes at most one of the pages modified since the last save, for callers
+  // which cannot be blocked by several page erasures. Returns true while
+  // pages remain to be written.
+  bool Tick();
+  
+  bool AddKeyframe(uint16_t timestamp, const uint16_t* values);
+  bool RemoveKeyframe(uint16_t timestamp);
+  int32_t FindKeyframe(uint16_t timestamp) const;
+  
+  void set_value(uint16_t index, uint8_t channel, uint16_t value) {
+    uint16_t* v = column(channel);
+    v[index] = value;
+    MarkDirty(&v[index], &v[index + 1]);
+  }
+  
+  // Writes the levels of the channels of the enabled banks; the levels of the
+  // other channels are left untouched.
+  void Evaluate(uint16_t timestamp, uint16_t* levels);
+  
+  // Evaluates a single channel for a block of timestamps.
+  void EvaluateChannel(
+      uint8_t channel,
+      const uint16_t* timestamps,
+      uint16_t* levels,
+      size_t size);
+  
+  inline void set_bank_enabled(uint8_t bank, bool enabled) {
+    if (enabled) {
+      state_.enabled_banks |= 1 << bank;
+    } else {
+      state_.enabled_banks &= ~(1 << bank);
+    }
+  }
+  inline bool bank_enabled(uint8_t bank) const {
+    return state_.enabled_banks & (1 << bank);
+  }
+  
+  inline ChannelSettings* mutable_settings(uint8_t channel) {
+    return &state_.settings[channel];
+  }
+  inline const ChannelSettings& settings(uint8_t channel) const {
+    return state_.settings[channel];
+  }
+  
+  inline uint16_t timestamp(uint16_t index) const {
+    return buffer_[index];
+  }
+  inline uint16_t value(uint16_t index, uint8_t channel) const {
+    return buffer_[(channel + 1) * state_.capacity + index];
+  }
+  
+  inline uint16_t num_keyframes() const { return state_.num_keyframes; }
+  inline uint16_t capacity() const { return state_.capacity; }
+  inline uint8_t num_channels() const { return state_.num_channels; }
+  inline bool dirty() const { return dirty_pages_ != 0; }
+  
+ private:
+  inline uint16_t* column(uint8_t channel) {
+    return &buffer_[(channel + 1) * state_.capacity];
+  }
+  
+  uint16_t Seek(uint16_t timestamp);
+  inline uint32_t SegmentScale(uint16_t timestamp) const {
+    uint64_t t = static_cast<uint16_t>(timestamp - segment_start_);
+    return static_cast<uint32_t>((t * segment_reciprocal_) >> 32);
+  }
+  
+  // Flags the pages containing the words from begin (included) to end
+  // (excluded) of the buffer as modified.
+  void MarkDirty(const uint16_t* begin, const uint16_t* end);
+  void MarkColumnsDirty(uint16_t first_index, uint16_t last_index);
+  void WritePage(uint8_t page);
+  bool ReadPage(uint8_t page);
+  
+  uint16_t* buffer_;
+  MultiKeyframerState state_;
+  
+  // Bit 0 is the page storing the state, bit n is the page storing the words
+  // of the buffer from (n - 1) * kMultiKeyframerPageSize.
+  uint32_t dirty_pages_;
+  
+  uint16_t cursor_;
+  uint16_t segment_start_;
+  uint64_t segment_reciprocal_;
+  
+  DISALLOW_COPY_AND_ASSIGN(MultiKeyframer);
+};
+
+}  // namespace frames
+
+#endif  // FRAMES_MULTI_KEYFRAMER_H_
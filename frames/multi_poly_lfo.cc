@@ -0,0 +1,150 @@
+// Copyright 2013 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+//
+// -----------------------------------------------------------------------------
+//
+// Poly LFO with an arbitrary number of channels, rendered by blocks.
+
+#include "frames/multi_poly_lfo.h"
+
+#include <algorithm>
+
+#include "stmlib/utils/dsp.h"
+
+#include "frames/keyframer.h"
+#include "frames/poly_lfo.h"
+#include "frames/resources.h"
+
+namespace frames {
+
+using namespace std;
+using namespace stmlib;
+
+void MultiPolyLfo::Init(uint8_t num_channels) {
+  if (num_channels > kMaxNumPolyLfoChannels) {
+    num_channels = kMaxNumPolyLfoChannels;
+  }
+  if (num_channels < 1) {
+    num_channels = 1;
+  }
+  num_channels_ = num_channels;
+  spread_ = 0;
+  shape_ = 0;
+  shape_spread_ = 0;
+  coupling_ = 0;
+  fill(&phase_[0], &phase_[kMaxNumPolyLfoChannels], 0);
+  fill(&value_[0], &value_[kMaxNumPolyLfoChannels], 0);
+}
+
+// The frequency is in 1/5040th of an octave above the bottom of
+// lut_increments. The 4 channels of PolyLfo, with the widest negative spread,
+// go up to 16 octaves higher. Beyond, the increment read from the table would
+// be shifted out of range.
+const int32_t kMaxFrequency = 17 * 5040 - 1;
+
+static inline uint32_t ClampedPhaseIncrement(int32_t frequency) {
+  CONSTRAIN(frequency, 0, kMaxFrequency);
+  return PolyLfo::FrequencyToPhaseIncrement(frequency);
+}
+
+void MultiPolyLfo::PrepareBlock(int32_t frequency) {
+  uint8_t n = num_channels_;
+  if (spread_ >= 0) {
+    // All channels run at the same frequency, at a fixed phase offset from the
+    // first one.
+    uint32_t phase_difference = static_cast<uint32_t>(spread_) << 15;
+    uint32_t increment = ClampedPhaseIncrement(frequency);
+    uint32_t offset = 0;
+    for (uint8_t i = 0; i < n; ++i) {
+      phase_increment_[i] = increment;
+      phase_offset_[i] = offset;
+      offset += phase_difference;
+    }
+  } else {
+    // Each channel is up to one octave above the previous one.
+    for (uint8_t i = 0; i < n; ++i) {
+      phase_increment_[i] = ClampedPhaseIncrement(frequency);
+      frequency -= 5040 * spread_ >> 15;
+    }
+  }
+  
+  uint16_t wavetable_index = shape_;
+  for (uint8_t i = 0; i < n; ++i) {
+    wave_[i] = &wt_lfo_waveforms[(wavetable_index >> 12) * 257];
+    wave_balance_[i] = wavetable_index << 4;
+    wavetable_index += shape_spread_;
+  }
+}
+
+void MultiPolyLfo::Couple() {
+  uint8_t last = num_channels_ - 1;
+  if (coupling_ > 0) {
+    int32_t coupling = coupling_;
+    for (uint8_t i = 0; i < last; ++i) {
+      coupled_phase_[i] = phase_[i] + value_[i + 1] * coupling;
+    }
+    coupled_phase_[last] = phase_[last] + value_[0] * coupling;
+  } else {
+    int32_t coupling = -coupling_;
+    coupled_phase_[0] = phase_[0] + value_[last] * coupling;
+    for (uint8_t i = 1; i <= last; ++i) {
+      coupled_phase_[i] = phase_[i] + value_[i - 1] * coupling;
+    }
+  }
+}
+
+void MultiPolyLfo::Render(int32_t frequency, uint16_t* dac_codes, size_t size) {
+  PrepareBlock(frequency);
+  
+  uint8_t n = num_channels_;
+  const uint8_t* sine = &wt_lfo_waveforms[17 * 257];
+  while (size--) {
+    // Advance phasors.
+    if (spread_ >= 0) {
+      uint32_t phase = phase_[0] + phase_increment_[0];
+      for (uint8_t i = 0; i < n; ++i) {
+        phase_[i] = phase + phase_offset_[i];
+      }
+    } else {
+      for (uint8_t i = 0; i < n; ++i) {
+        phase_[i] += phase_increment_[i];
+      }
+    }
+    
+    Couple();
+    
+    // Wavetable lookup.
+    for (uint8_t i = 0; i < n; ++i) {
+      uint32_t phase = coupled_phase_[i];
+      const uint8_t* a = wave_[i];
+      int16_t value = Crossfade(a, a + 257, phase, wave_balance_[i]);
+      value_[i] = Interpolate824(sine, phase);
+      dac_codes[i] = Keyframer::ConvertToDacCode(value + 32768, 0);
+    }
+    dac_codes += n;
+  }
+}
+
+}  // namespace frames
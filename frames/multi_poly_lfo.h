@@ -0,0 +1,109 @@
+// Copyright 2013 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+//
+// -----------------------------------------------------------------------------
+//
+// Poly LFO with an arbitrary number of channels, rendered by blocks.
+//
+// The state of the channels is stored as arrays, and each stage (phase
+// increment, coupling, waveshaping) is processed for all channels before the
+// next one, so that the channels can be processed in parallel. In particular,
+// the coupling term of each channel is computed from the value of its
+// neighbour at the previous sample, while PolyLfo uses the value already
+// computed at the current sample whenever the neighbour has been processed
+// first. Without coupling, the output is identical to PolyLfo's. Frequency,
+// spread and shape are applied once per block.
+
+#ifndef FRAMES_MULTI_POLY_LFO_H_
+#define FRAMES_MULTI_POLY_LFO_H_
+
+#include "stmlib/stmlib.h"
+
+namespace frames {
+
+const uint8_t kMaxNumPolyLfoChannels = 64;
+
+class MultiPolyLfo {
+ public:
+  MultiPolyLfo() { }
+  ~MultiPolyLfo() { }
+  
+  void Init(uint8_t num_channels);
+  
+  // Renders size frames of num_channels DAC codes, interleaved.
+  void Render(int32_t frequency, uint16_t* dac_codes, size_t size);
+
+  inline void set_shape(uint16_t shape) {
+    shape_ = shape;
+  }
+  inline void set_shape_spread(uint16_t shape_spread) {
+    shape_spread_ = static_cast<int16_t>(shape_spread - 32768) >> 1;
+  }
+  inline void set_spread(uint16_t spread) {
+    if (spread < 32768) {
+      int32_t x = spread - 32768;
+      int32_t scaled = -(x * x >> 15);
+      spread_ = (x + 3 * scaled) >> 2;
+    } else {
+      spread_ = spread - 32768;
+    }
+  }
+  inline void set_coupling(uint16_t coupling) {
+    int32_t x = coupling - 32768;
+    int32_t scaled = x * x >> 15;
+    scaled = x > 0 ? scaled : - scaled;
+    scaled = (x + 3 * scaled) >> 2;
+    coupling_ = (scaled >> 4) * 10;
+  }
+  
+  inline uint8_t num_channels() const { return num_channels_; }
+
+ private:
+  void PrepareBlock(int32_t frequency);
+  void Couple();
+  
+  uint8_t num_channels_;
+  
+  uint16_t shape_;
+  int16_t shape_spread_;
+  int32_t spread_;
+  int16_t coupling_;
+
+  uint32_t phase_[kMaxNumPolyLfoChannels];
+  uint32_t coupled_phase_[kMaxNumPolyLfoChannels];
+  int16_t value_[kMaxNumPolyLfoChannels];
+  
+  // Computed once per block.
+  uint32_t phase_increment_[kMaxNumPolyLfoChannels];
+  uint32_t phase_offset_[kMaxNumPolyLfoChannels];
+  const uint8_t* wave_[kMaxNumPolyLfoChannels];
+  uint16_t wave_balance_[kMaxNumPolyLfoChannels];
+
+  DISALLOW_COPY_AND_ASSIGN(MultiPolyLfo);
+};
+
+}  // namespace frames
+
+#endif  // FRAMES_MULTI_POLY_LFO_H_
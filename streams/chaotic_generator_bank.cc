@@ -0,0 +1,170 @@
+// Copyright 2014 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Bank of chaotic systems (Lorenz, Rossler) used as slow modulation sources.
+
+#include "streams/chaotic_generator_bank.h"
+
+#include "streams/resources.h"
+
+namespace streams {
+
+using namespace stmlib;
+
+// Largest step (0.02 and 0.08, in 8.24 fixed point) for each integrator.
+// The fastest rate of the Lorenz generator is right at the stability limit of
+// the Euler method. With decimation, faster rates are slowed down to this.
+const int32_t kMaxStep[INTEGRATOR_LAST] = { 335544, 1342177 };
+
+template<ChaoticSystem system>
+struct Derivative { };
+
+template<>
+struct Derivative<CHAOTIC_SYSTEM_LORENZ> {
+  static inline void Compute(
+      int32_t x, int32_t y, int32_t z,
+      int64_t* dx, int64_t* dy, int64_t* dz) {
+    const int64_t sigma = 10.0 * (1 << 24);
+    const int64_t rho = 28.0 * (1 << 24);
+    const int64_t beta = 8.0 / 3.0 * (1 << 24);
+    *dx = sigma * (y - x) >> 24;
+    *dy = (x * (rho - z) >> 24) - y;
+    *dz = (x * static_cast<int64_t>(y) >> 24) - (beta * z >> 24);
+  }
+};
+
+template<>
+struct Derivative<CHAOTIC_SYSTEM_ROSSLER> {
+  static inline void Compute(
+      int32_t x, int32_t y, int32_t z,
+      int64_t* dx, int64_t* dy, int64_t* dz) {
+    const int64_t a = 0.2 * (1 << 24);
+    const int64_t b = 0.2 * (1 << 24);
+    const int64_t c = 5.7 * (1 << 24);
+    *dx = -static_cast<int64_t>(y) - z;
+    *dy = x + (a * y >> 24);
+    *dz = b + (z * (x - c) >> 24);
+  }
+};
+
+void ChaoticGeneratorBank::Init(
+    size_t num_generators,
+    ChaoticSystem system,
+    Integrator integrator,
+    size_t decimation) {
+  num_generators_ = num_generators > kMaxNumChaoticGenerators
+      ? kMaxNumChaoticGenerators
+      : num_generators;
+  system_ = system;
+  integrator_ = integrator;
+  decimation_ = decimation < 1 ? 1 : decimation;
+  phase_ = 0;
+  max_step_ = kMaxStep[integrator];
+  
+  for (size_t i = 0; i < kMaxNumChaoticGenerators; ++i) {
+    // Slightly different initial conditions, so that the generators quickly
+    // diverge from each other.
+    x_[i] = 0.1 * (1 << 24) + (i << 16);
+    y_[i] = 0;
+    z_[i] = 0;
+    set_rate(i, 128);
+  }
+}
+
+void ChaoticGeneratorBank::set_rate(size_t generator, int32_t rate) {
+  CONSTRAIN(rate, 0, 256);
+  // Each step covers decimation_ samples.
+  int64_t step = static_cast<int64_t>(lut_lorenz_rate[rate]) * decimation_;
+  step_[generator] = step > max_step_ ? max_step_ : step;
+}
+
+template<ChaoticSystem system, Integrator integrator>
+void ChaoticGeneratorBank::Step() {
+  size_t n = num_generators_;
+  for (size_t i = 0; i < n; ++i) {
+    int64_t h = step_[i];
+    int32_t x = x_[i];
+    int32_t y = y_[i];
+    int32_t z = z_[i];
+    int64_t dx, dy, dz;
+    Derivative<system>::Compute(x, y, z, &dx, &dy, &dz);
+    if (integrator == INTEGRATOR_EULER) {
+      x_[i] = x + (h * dx >> 24);
+      y_[i] = y + (h * dy >> 24);
+      z_[i] = z + (h * dz >> 24);
+    } else {
+      int64_t sum_x = dx;
+      int64_t sum_y = dy;
+      int64_t sum_z = dz;
+      // Midpoint estimates, counted twice.
+      for (size_t k = 0; k < 2; ++k) {
+        Derivative<system>::Compute(
+            x + (h * dx >> 25),
+            y + (h * dy >> 25),
+            z + (h * dz >> 25),
+            &dx, &dy, &dz);
+        sum_x += 2 * dx;
+        sum_y += 2 * dy;
+        sum_z += 2 * dz;
+      }
+      // End point estimate.
+      Derivative<system>::Compute(
+          x + (h * dx >> 24),
+          y + (h * dy >> 24),
+          z + (h * dz >> 24),
+          &dx, &dy, &dz);
+      sum_x += dx;
+      sum_y += dy;
+      sum_z += dz;
+      // 2796203 / 2^24 ~ 1 / 6.
+      x_[i] = x + ((h * sum_x >> 24) * 2796203 >> 24);
+      y_[i] = y + ((h * sum_y >> 24) * 2796203 >> 24);
+      z_[i] = z + ((h * sum_z >> 24) * 2796203 >> 24);
+    }
+  }
+}
+
+void ChaoticGeneratorBank::Process(size_t size) {
+  phase_ += size;
+  while (phase_ >= decimation_) {
+    phase_ -= decimation_;
+    if (system_ == CHAOTIC_SYSTEM_LORENZ) {
+      if (integrator_ == INTEGRATOR_EULER) {
+        Step<CHAOTIC_SYSTEM_LORENZ, INTEGRATOR_EULER>();
+      } else {
+        Step<CHAOTIC_SYSTEM_LORENZ, INTEGRATOR_RK4>();
+      }
+    } else {
+      if (integrator_ == INTEGRATOR_EULER) {
+        Step<CHAOTIC_SYSTEM_ROSSLER, INTEGRATOR_EULER>();
+      } else {
+        Step<CHAOTIC_SYSTEM_ROSSLER, INTEGRATOR_RK4>();
+      }
+    }
+  }
+}
+
+}  // namespace streams
@@ -0,0 +1,115 @@
+// Copyright 2014 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Bank of chaotic systems (Lorenz, Rossler) used as slow modulation sources.
+//
+// All the systems of a bank are of the same kind and are advanced together, at
+// a rate divided by a decimation factor. The state is stored as one array per
+// variable, so that each integration stage is a flat loop over all systems.
+// The kind of system and the integrator are dispatched once per block to
+// template-specialized loops.
+
+#ifndef STREAMS_CHAOTIC_GENERATOR_BANK_H_
+#define STREAMS_CHAOTIC_GENERATOR_BANK_H_
+
+#include "stmlib/stmlib.h"
+
+namespace streams {
+
+const size_t kMaxNumChaoticGenerators = 64;
+
+enum ChaoticSystem {
+  CHAOTIC_SYSTEM_LORENZ,
+  CHAOTIC_SYSTEM_ROSSLER,
+  CHAOTIC_SYSTEM_LAST
+};
+
+enum Integrator {
+  INTEGRATOR_EULER,
+  INTEGRATOR_RK4,
+  INTEGRATOR_LAST
+};
+
+class ChaoticGeneratorBank {
+ public:
+  ChaoticGeneratorBank() { }
+  ~ChaoticGeneratorBank() { }
+  
+  // The systems are integrated once every decimation samples.
+  void Init(
+      size_t num_generators,
+      ChaoticSystem system,
+      Integrator integrator,
+      size_t decimation);
+  
+  // Same scale as the rate parameter of LorenzGenerator, from 0 to 256.
+  void set_rate(size_t generator, int32_t rate);
+  
+  // Advances all the generators by size samples.
+  void Process(size_t size);
+  
+  // Outputs, scaled like those of LorenzGenerator.
+  inline uint16_t x(size_t generator) const {
+    return Scale(x_[generator], -32768, 32767) + 32768;
+  }
+  inline uint16_t y(size_t generator) const {
+    return Scale(y_[generator], -32768, 32767) + 32768;
+  }
+  inline uint16_t z(size_t generator) const {
+    return Scale(z_[generator], 0, 65535);
+  }
+  
+  inline size_t num_generators() const { return num_generators_; }
+  
+ private:
+  static inline int32_t Scale(int32_t value, int32_t min, int32_t max) {
+    value >>= 14;
+    CONSTRAIN(value, min, max);
+    return value;
+  }
+  
+  template<ChaoticSystem system, Integrator integrator>
+  void Step();
+  
+  size_t num_generators_;
+  ChaoticSystem system_;
+  Integrator integrator_;
+  size_t decimation_;
+  size_t phase_;
+  int32_t max_step_;
+  
+  // 8.24 fixed point.
+  int32_t x_[kMaxNumChaoticGenerators];
+  int32_t y_[kMaxNumChaoticGenerators];
+  int32_t z_[kMaxNumChaoticGenerators];
+  int32_t step_[kMaxNumChaoticGenerators];
+  
+  DISALLOW_COPY_AND_ASSIGN(ChaoticGeneratorBank);
+};
+
+}  // namespace streams
+
+#endif  // STREAMS_CHAOTIC_GENERATOR_BANK_H_
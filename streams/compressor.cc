@@ -30,10 +30,16 @@
 
 // #include <cmath>
 
+#include <algorithm>
+
 #include "stmlib/utils/dsp.h"
 
+#include "streams/log_exp.h"
+#include "streams/process_block.h"
+
 namespace streams {
 
+using namespace std;
 using namespace stmlib;
 
 // 256 LSB <=> 1.55dB
@@ -41,43 +47,8 @@ const int32_t kGainConstant = 1 / (1.55 / 6.0 * 65536.0 / 256.0) * 65536;
 
 void Compressor::Init() {
   detector_ = 0;
-}
-
-/* static */
-int32_t Compressor::Log2(int32_t value) {
-  if (value <= 0) {
-    value = 1;
-  }
-  int32_t log_value = 0;
-  while (value >= 512) {
-    value >>= 1;
-    log_value += 65536;
-  }
-  while (value < 256) {
-    value <<= 1;
-    log_value -= 65536;
-  }
-  // Value is between 256 and 512, we can use the LUT.
-  return log_value + lut_log2[value - 256];
-}
-
-/* static */
-int32_t Compressor::Exp2(int32_t value) {
-  int32_t num_shifts = 0;
-  while (value >= 65536) {
-    ++num_shifts;
-    value -= 65536;
-  }
-  while (value < 0) {
-    --num_shifts;
-    value += 65536;
-  }
-  
-  // Value is between 0 and 65535, we can use the LUT.
-  int32_t a = lut_exp2[value >> 8];
-  int32_t b = lut_exp2[(value >> 8) + 1];
-  int32_t mantissa = a + ((b - a) * (value & 0xff) >> 8);
-  return num_shifts >= 0 ? mantissa << num_shifts : mantissa >> -num_shifts;
+  lookahead_ = NULL;
+  delayed_audio_ = 0;
 }
 
 /* static */
@@ -104,6 +75,18 @@ int32_t Compressor::Compress(
   return -attenuation;
 }
 
+int32_t Compressor::ComputeGain(
+    int32_t squared_level,
+    int32_t* gain_reduction) const {
+  int32_t g = Compress(squared_level, threshold_, ratio_, soft_knee_);
+  *gain_reduction = g >> 3;
+  g = kUnityGain + ((g + makeup_gain_) * kGainConstant >> 16);
+  if (g > 65535) {
+    g = 65535;
+  }
+  return g;
+}
+
 void Compressor::Process(
     int16_t audio,
     int16_t excite,
@@ -130,29 +113,46 @@ void Compressor::Process(
     energy *= energy;
   }
   
+  int64_t attack_coefficient = attack_coefficient_;
+  if (lookahead_) {
+    // Anticipate the peaks which have not reached the delayed output yet.
+    delayed_audio_ = lookahead_->Process(audio, &energy);
+    // Keep the slower of the two attacks (-1 is the fastest).
+    int64_t lookahead_attack_coefficient = lookahead_->attack_coefficient();
+    if (attack_coefficient == -1 ||
+        (lookahead_attack_coefficient != -1 &&
+         lookahead_attack_coefficient < attack_coefficient)) {
+      attack_coefficient = lookahead_attack_coefficient;
+    }
+  } else {
+    delayed_audio_ = audio;
+  }
+  
   // Detect the RMS level on the EXCITE or AUDIO input - whichever active.
   error = energy - detector_;
   if (error > 0) {
-    if (attack_coefficient_ == -1) {
+    if (attack_coefficient == -1) {
       detector_ += error;
     } else {
-      detector_ += error * attack_coefficient_ >> 31;
+      detector_ += error * attack_coefficient >> 31;
     }
   } else {
     detector_ += error * decay_coefficient_ >> 31;
   }
   
-  int32_t g = Compress(detector_, threshold_, ratio_, soft_knee_);
-  gain_reduction_ = g >> 3;
-  g = kUnityGain + ((g + makeup_gain_) * kGainConstant >> 16);
-  if (g > 65535) {
-    g = 65535;
-  }
-  
-  *gain = g;
+  *gain = ComputeGain(detector_, &gain_reduction_);
   // float ogain = powf(10.0f, 1.55f / 20.0f * (g - kUnityGain) / 256.0f);
   // printf("%f %f\n", gain_reduction_ / 32768.0 * 24, 20 * logf(ogain) / logf(10.0f));
   *frequency = 65535;
 }
 
+void Compressor::Process(
+    const int16_t* audio,
+    const int16_t* excite,
+    uint16_t* gain,
+    uint16_t* frequency,
+    size_t size) {
+  ProcessBlock(this, audio, excite, gain, frequency, size);
+}
+
 }  // namespace streams
@@ -31,13 +31,86 @@
 
 #include "stmlib/stmlib.h"
 
+#include <algorithm>
 #include <cstdio>
 
 #include "streams/gain.h"
 #include "streams/resources.h"
+#include "streams/sliding_max.h"
 
 namespace streams {
 
+// State of the compressor's lookahead mode: a peak detector over the next
+// num_samples samples, and the delay line aligning the audio with it. It is
+// kept out of the Compressor so that it takes no RAM when unused, and its
+// buffers are provided by the caller, so the maximum lookahead time is only
+// bounded by the memory it is given.
+class CompressorLookahead {
+ public:
+  CompressorLookahead() { }
+  ~CompressorLookahead() { }
+  
+  // Bytes of buffer needed for a lookahead of num_samples.
+  static inline size_t buffer_size(size_t num_samples) {
+    return (num_samples + 1) * (sizeof(int32_t) + sizeof(uint32_t)) +
+        num_samples * sizeof(int16_t);
+  }
+  
+  // buffer must be 32-bit aligned and hold at least buffer_size(1) bytes.
+  // num_samples is reduced to what fits in size bytes.
+  void Init(void* buffer, size_t size, size_t num_samples) {
+    size_t max_num_samples = size > buffer_size(0)
+        ? (size - buffer_size(0)) / (buffer_size(1) - buffer_size(0))
+        : 0;
+    num_samples_ = std::min(num_samples, max_num_samples);
+    if (num_samples_ < 1) {
+      num_samples_ = 1;
+    }
+    peak_value_ = static_cast<int32_t*>(buffer);
+    peak_time_stamp_ = reinterpret_cast<uint32_t*>(
+        peak_value_ + num_samples_ + 1);
+    delay_line_ = reinterpret_cast<int16_t*>(
+        peak_time_stamp_ + num_samples_ + 1);
+    // Reach the peak's level within the lookahead time.
+    int64_t coefficient = (static_cast<int64_t>(5) << 31) / (num_samples_ + 1);
+    attack_coefficient_ = coefficient >= (1LL << 31) ? -1 : coefficient;
+    Reset();
+  }
+  
+  void Reset() {
+    peak_.Init(peak_value_, peak_time_stamp_, num_samples_ + 1);
+    std::fill(&delay_line_[0], &delay_line_[num_samples_], 0);
+    delay_ptr_ = 0;
+  }
+  
+  // Returns the audio delayed by num_samples, and replaces energy with its
+  // maximum over the lookahead window.
+  inline int16_t Process(int16_t audio, int32_t* energy) {
+    int16_t delayed = delay_line_[delay_ptr_];
+    delay_line_[delay_ptr_] = audio;
+    delay_ptr_ = delay_ptr_ + 1 >= num_samples_ ? 0 : delay_ptr_ + 1;
+    *energy = peak_.Process(*energy);
+    return delayed;
+  }
+  
+  inline size_t num_samples() const { return num_samples_; }
+  
+  // Fastest attack reaching the peak's level within the lookahead time, -1
+  // for an instant attack.
+  inline int64_t attack_coefficient() const { return attack_coefficient_; }
+  
+ private:
+  size_t num_samples_;
+  int64_t attack_coefficient_;
+  SlidingMax<int32_t> peak_;
+  int32_t* peak_value_;
+  uint32_t* peak_time_stamp_;
+  int16_t* delay_line_;
+  size_t delay_ptr_;
+  
+  DISALLOW_COPY_AND_ASSIGN(CompressorLookahead);
+};
+
 class Compressor {
  public:
   Compressor() { }
@@ -50,6 +123,12 @@ class Compressor {
       int16_t excite,
       uint16_t* gain,
       uint16_t* frequency);
+  void Process(
+      const int16_t* audio,
+      const int16_t* excite,
+      uint16_t* gain,
+      uint16_t* frequency,
+      size_t size);
   
   void Configure(bool alternate, int32_t* parameters, int32_t* globals) {
     uint16_t attack_time;
@@ -104,9 +183,32 @@ class Compressor {
   
   inline int32_t gain_reduction() const { return gain_reduction_; }
   
+  // Gain computer, exposed so that several detectors can share the settings
+  // of a single compressor.
+  int32_t ComputeGain(int32_t squared_level, int32_t* gain_reduction) const;
+  inline int64_t attack_coefficient() const { return attack_coefficient_; }
+  inline int64_t decay_coefficient() const { return decay_coefficient_; }
+  
+  // Delays the gain computation by lookahead->num_samples() samples: the
+  // detector sees the peak of the next samples, and gain() is aligned with
+  // delayed_audio() rather than with the audio input. NULL disables the
+  // lookahead. The attack used is the slower of the configured one and of
+  // lookahead->attack_coefficient(): anticipating the peaks allows a softer
+  // attack than the configured one, never a faster one.
+  void set_lookahead(CompressorLookahead* lookahead) {
+    lookahead_ = lookahead;
+    if (lookahead_) {
+      lookahead_->Reset();
+    }
+    delayed_audio_ = 0;
+  }
+  
+  inline size_t lookahead() const {
+    return lookahead_ ? lookahead_->num_samples() : 0;
+  }
+  inline int16_t delayed_audio() const { return delayed_audio_; }
+  
  private:
-  static int32_t Log2(int32_t value);
-  static int32_t Exp2(int32_t value);
   static int32_t Compress(
       int32_t squared_level,
       int32_t threshold,
@@ -124,6 +226,9 @@ class Compressor {
   int64_t detector_;
   int64_t sidechain_signal_detector_;
   int32_t gain_reduction_;
+  
+  CompressorLookahead* lookahead_;
+  int16_t delayed_audio_;
 
   DISALLOW_COPY_AND_ASSIGN(Compressor);
 };
@@ -30,6 +30,7 @@
 
 #include "stmlib/utils/dsp.h"
 
+#include "streams/process_block.h"
 #include "streams/resources.h"
 
 #include "streams/gain.h"
@@ -125,4 +126,13 @@ void Envelope::Process(
   *frequency = frequency_offset_ + (scaled * frequency_amount_ >> 15);
 }
 
+void Envelope::Process(
+    const int16_t* audio,
+    const int16_t* excite,
+    uint16_t* gain,
+    uint16_t* frequency,
+    size_t size) {
+  ProcessBlock(this, audio, excite, gain, frequency, size);
+}
+
 }  // namespace streams
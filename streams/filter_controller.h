@@ -31,6 +31,8 @@
 
 #include "stmlib/stmlib.h"
 
+#include "streams/process_block.h"
+
 namespace streams {
 
 class FilterController {
@@ -61,6 +63,15 @@ class FilterController {
     *gain = 0;
     *frequency = f;
   }
+  
+  void Process(
+      const int16_t* audio,
+      const int16_t* excite,
+      uint16_t* gain,
+      uint16_t* frequency,
+      size_t size) {
+    ProcessBlock(this, audio, excite, gain, frequency, size);
+  }
 
   void Configure(bool alternate, int32_t* parameters, int32_t* globals) {
     int32_t amount = parameters[1];
@@ -0,0 +1,111 @@
+// Copyright 2014 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Constant-time log2 and exp2.
+//
+// The fixed-point versions work on 16.16 values and normalize their argument
+// with a count leading zeros instruction before the table lookup, so their
+// execution time does not depend on the data. The float versions are
+// branchless approximations (max error 1.3e-3 for Log2, relative error 2e-4 for
+// Exp2), with array variants that a compiler can vectorize.
+
+#ifndef STREAMS_LOG_EXP_H_
+#define STREAMS_LOG_EXP_H_
+
+#include <cstring>
+
+#include "stmlib/stmlib.h"
+
+#include "streams/resources.h"
+
+namespace streams {
+
+// Returns 65536 * log2(value), for value > 0. Smaller values are clamped to 1.
+inline int32_t Log2(int32_t value) {
+  if (value <= 0) {
+    value = 1;
+  }
+  uint32_t v = static_cast<uint32_t>(value);
+  int32_t shift = 23 - __builtin_clz(v);  // Position of the MSB, minus 8.
+  v = shift >= 0 ? v >> shift : v << -shift;
+  // v is between 256 and 512, we can use the LUT.
+  return (shift << 16) + lut_log2[v - 256];
+}
+
+// Returns 65536 * 2 ^ (value / 65536).
+inline int32_t Exp2(int32_t value) {
+  int32_t num_shifts = value >> 16;
+  value &= 0xffff;
+  
+  // Value is between 0 and 65535, we can use the LUT.
+  int32_t a = lut_exp2[value >> 8];
+  int32_t b = lut_exp2[(value >> 8) + 1];
+  int32_t mantissa = a + ((b - a) * (value & 0xff) >> 8);
+  return num_shifts >= 0 ? mantissa << num_shifts : mantissa >> -num_shifts;
+}
+
+inline float Log2(float x) {
+  uint32_t bits;
+  memcpy(&bits, &x, sizeof(bits));
+  float exponent = static_cast<float>(
+      static_cast<int32_t>((bits >> 23) & 0xff) - 127);
+  bits = (bits & 0x007fffff) | 0x3f800000;
+  float m;
+  memcpy(&m, &bits, sizeof(m));
+  // m is between 1 and 2.
+  return exponent + ((0.15391228f * m - 1.02948533f) * m + 3.01071666f) * m - \
+      2.13380862f;
+}
+
+inline float Exp2(float x) {
+  x = x < -126.0f ? -126.0f : (x > 126.0f ? 126.0f : x);
+  int32_t integral = static_cast<int32_t>(x);
+  integral -= x < static_cast<float>(integral) ? 1 : 0;
+  float t = x - static_cast<float>(integral);
+  // t is between 0 and 1.
+  float mantissa = ((0.07901989f * t + 0.22412623f) * t + 0.69683884f) * t + \
+      0.99981191f;
+  uint32_t bits = static_cast<uint32_t>(integral + 127) << 23;
+  float scale;
+  memcpy(&scale, &bits, sizeof(scale));
+  return mantissa * scale;
+}
+
+inline void Log2(const float* in, float* out, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    out[i] = Log2(in[i]);
+  }
+}
+
+inline void Exp2(const float* in, float* out, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    out[i] = Exp2(in[i]);
+  }
+}
+
+}  // namespace streams
+
+#endif  // STREAMS_LOG_EXP_H_
@@ -28,6 +28,7 @@
 
 #include "streams/lorenz_generator.h"
 
+#include "streams/process_block.h"
 #include "streams/resources.h"
 
 namespace streams {
@@ -79,4 +80,13 @@ void LorenzGenerator::Process(
   *frequency = 65535 + ((x_scaled - 65535) * vcf_amount_ >> 15);
 }
 
+void LorenzGenerator::Process(
+    const int16_t* audio,
+    const int16_t* excite,
+    uint16_t* gain,
+    uint16_t* frequency,
+    size_t size) {
+  ProcessBlock(this, audio, excite, gain, frequency, size);
+}
+
 }  // namespace streams
@@ -0,0 +1,213 @@
+// Copyright 2014 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Compressor for up to 16 channels, with a shared sidechain.
+
+#include "streams/multichannel_dynamics.h"
+
+#include <algorithm>
+
+#include "stmlib/utils/dsp.h"
+
+#include "streams/resources.h"
+
+namespace streams {
+
+using namespace std;
+using namespace stmlib;
+
+void MultichannelDynamics::Init(size_t num_channels) {
+  num_channels_ = num_channels;
+  CONSTRAIN(num_channels_, 1, kMaxNumChannels);
+  link_mode_ = LINK_MODE_MAX;
+  compressor_.Init();
+  
+  // Same crossover frequencies as the follower.
+  band_f_[0] = Interpolate824(lut_svf_cutoff, (45 << 7) << 17);
+  band_f_[1] = Interpolate824(lut_svf_cutoff, (86 << 7) << 17);
+  band_damp_ = lut_svf_damp[0];
+  
+  fill(&sidechain_[0], &sidechain_[kMaxNumChannels], 0);
+  fill(&energy_[0], &energy_[kMaxNumChannels], 0);
+  ResetBands();
+  fill(
+      &sidechain_signal_detector_[0],
+      &sidechain_signal_detector_[kMaxNumChannels],
+      0);
+  fill(&detector_[0], &detector_[kMaxNumChannels], 0);
+  fill(&gain_reduction_[0], &gain_reduction_[kMaxNumChannels], 0);
+}
+
+void MultichannelDynamics::ResetBands() {
+  for (size_t i = 0; i < kNumBands - 1; ++i) {
+    fill(&band_lp_[i][0], &band_lp_[i][kMaxNumChannels], 0);
+    fill(&band_bp_[i][0], &band_bp_[i][kMaxNumChannels], 0);
+  }
+  for (size_t i = 0; i < kNumBands; ++i) {
+    fill(&band_energy_[i][0], &band_energy_[i][kMaxNumChannels], 0);
+  }
+}
+
+void MultichannelDynamics::ComputeSidechain(
+    const int16_t* const* audio,
+    const int16_t* const* excite,
+    size_t index) {
+  size_t n = num_channels_;
+  
+  // Detect the RMS level on the EXCITE inputs.
+  if (excite) {
+    for (size_t c = 0; c < n; ++c) {
+      int32_t energy = excite[c][index];
+      energy *= energy;
+      int64_t error = energy - sidechain_signal_detector_[c];
+      if (error > 0) {
+        sidechain_signal_detector_[c] += error;
+      } else {
+        // Decay time: 5s.
+        sidechain_signal_detector_[c] += error * 14174 >> 31;
+      }
+    }
+  }
+  
+  // Fall back to the AUDIO input when there is no signal on EXCITE.
+  for (size_t c = 0; c < n; ++c) {
+    bool use_excite = excite && \
+        sidechain_signal_detector_[c] >= (1024 * 1024);
+    sidechain_[c] = use_excite ? excite[c][index] : audio[c][index];
+    energy_[c] = sidechain_[c] * sidechain_[c];
+  }
+}
+
+void MultichannelDynamics::ComputeBandEnergy() {
+  size_t n = num_channels_;
+  int32_t damp = band_damp_;
+  const int32_t* input = sidechain_;
+  
+  // Cascade of two SVFs: the LP output of the first one is the low band, its
+  // HP output is split again into the medium and high bands.
+  for (size_t b = 0; b < kNumBands - 1; ++b) {
+    int32_t f = band_f_[b];
+    int32_t* lp = band_lp_[b];
+    int32_t* bp = band_bp_[b];
+    int32_t* low = band_energy_[b];
+    int32_t* high = band_energy_[b + 1];
+    for (size_t c = 0; c < n; ++c) {
+      int32_t notch = input[c] - (bp[c] * damp >> 15);
+      lp[c] += f * bp[c] >> 15;
+      CLIP(lp[c])
+      int32_t hp = notch - lp[c];
+      bp[c] += f * hp >> 15;
+      CLIP(bp[c])
+      CLIP(hp)
+      low[c] = lp[c];
+      high[c] = hp;
+    }
+    // The HP output of this stage is the input of the next one.
+    input = high;
+  }
+  
+  for (size_t b = 0; b < kNumBands; ++b) {
+    int32_t* energy = band_energy_[b];
+    for (size_t c = 0; c < n; ++c) {
+      energy[c] *= energy[c];
+    }
+  }
+}
+
+void MultichannelDynamics::Process(
+    const int16_t* const* audio,
+    const int16_t* const* excite,
+    uint16_t* const* gain,
+    size_t size) {
+  size_t n = num_channels_;
+  int64_t attack_coefficient = compressor_.attack_coefficient();
+  int64_t decay_coefficient = compressor_.decay_coefficient();
+  
+  // With linking, a single detector is used.
+  size_t num_detectors = link_mode_ == LINK_MODE_NONE ? n : 1;
+  
+  for (size_t i = 0; i < size; ++i) {
+    ComputeSidechain(audio, excite, i);
+    
+    switch (link_mode_) {
+      case LINK_MODE_MAX:
+        energy_[0] = *max_element(&energy_[0], &energy_[n]);
+        break;
+        
+      case LINK_MODE_RMS_SUM:
+        {
+          int64_t sum = 0;
+          for (size_t c = 0; c < n; ++c) {
+            sum += energy_[c];
+          }
+          energy_[0] = sum / static_cast<int64_t>(n);
+        }
+        break;
+        
+      case LINK_MODE_PER_BAND:
+        {
+          ComputeBandEnergy();
+          int64_t sum = 0;
+          for (size_t b = 0; b < kNumBands; ++b) {
+            sum += *max_element(&band_energy_[b][0], &band_energy_[b][n]);
+          }
+          energy_[0] = sum > 0x7fffffff ? 0x7fffffff : sum;
+        }
+        break;
+        
+      default:
+        break;
+    }
+    
+    for (size_t c = 0; c < num_detectors; ++c) {
+      int64_t error = energy_[c] - detector_[c];
+      if (error > 0) {
+        if (attack_coefficient == -1) {
+          detector_[c] += error;
+        } else {
+          detector_[c] += error * attack_coefficient >> 31;
+        }
+      } else {
+        detector_[c] += error * decay_coefficient >> 31;
+      }
+    }
+    
+    if (num_detectors == 1) {
+      uint16_t g = compressor_.ComputeGain(detector_[0], &gain_reduction_[0]);
+      for (size_t c = 0; c < n; ++c) {
+        gain[c][i] = g;
+      }
+    } else {
+      for (size_t c = 0; c < n; ++c) {
+        gain[c][i] = compressor_.ComputeGain(
+            detector_[c],
+            &gain_reduction_[c]);
+      }
+    }
+  }
+}
+
+}  // namespace streams
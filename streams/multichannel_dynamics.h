@@ -0,0 +1,127 @@
+// Copyright 2014 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Compressor for up to 16 channels, with a shared sidechain.
+//
+// The gain computer and its settings are those of streams::Compressor. The
+// detector state of all channels is stored as one array per quantity, and each
+// stage (energy, linking, detection, gain) is run on all channels before
+// moving on to the next one.
+
+#ifndef STREAMS_MULTICHANNEL_DYNAMICS_H_
+#define STREAMS_MULTICHANNEL_DYNAMICS_H_
+
+#include "stmlib/stmlib.h"
+
+#include "streams/compressor.h"
+#include "streams/follower.h"
+
+namespace streams {
+
+const size_t kMaxNumChannels = 16;
+
+enum LinkMode {
+  // Each channel is compressed independently.
+  LINK_MODE_NONE,
+  // All channels follow the loudest one.
+  LINK_MODE_MAX,
+  // All channels follow the mean energy of the channels.
+  LINK_MODE_RMS_SUM,
+  // The channels are split in kNumBands bands, like in the follower; all
+  // channels follow the sum of the loudest channel in each band.
+  LINK_MODE_PER_BAND,
+  LINK_MODE_LAST
+};
+
+class MultichannelDynamics {
+ public:
+  MultichannelDynamics() { }
+  ~MultichannelDynamics() { }
+  
+  void Init(size_t num_channels);
+  
+  // Same controls as streams::Compressor.
+  void Configure(bool alternate, int32_t* parameters, int32_t* globals) {
+    compressor_.Configure(alternate, parameters, globals);
+  }
+  
+  inline void set_link_mode(LinkMode link_mode) {
+    // The band filters are not run in the other modes: start them afresh
+    // rather than from the state in which they were left.
+    if (link_mode == LINK_MODE_PER_BAND && link_mode_ != LINK_MODE_PER_BAND) {
+      ResetBands();
+    }
+    link_mode_ = link_mode;
+  }
+  
+  // Renders size gain values for each channel. audio, excite and gain hold one
+  // pointer per channel. When excite is NULL, or when a channel's excite input
+  // is silent, the channel's audio input is used as a sidechain.
+  void Process(
+      const int16_t* const* audio,
+      const int16_t* const* excite,
+      uint16_t* const* gain,
+      size_t size);
+  
+  inline size_t num_channels() const { return num_channels_; }
+  inline LinkMode link_mode() const { return link_mode_; }
+  inline int32_t gain_reduction(size_t channel) const {
+    return gain_reduction_[link_mode_ == LINK_MODE_NONE ? channel : 0];
+  }
+  
+ private:
+  // Picks the sidechain signal of each channel and computes its energy.
+  void ComputeSidechain(
+      const int16_t* const* audio,
+      const int16_t* const* excite,
+      size_t index);
+  // Splits the sidechain signal of each channel in bands, and computes the
+  // energy of each band.
+  void ComputeBandEnergy();
+  void ResetBands();
+  
+  size_t num_channels_;
+  LinkMode link_mode_;
+  Compressor compressor_;
+  
+  int32_t band_f_[kNumBands - 1];
+  int32_t band_damp_;
+  
+  int32_t sidechain_[kMaxNumChannels];
+  int32_t energy_[kMaxNumChannels];
+  int32_t band_energy_[kNumBands][kMaxNumChannels];
+  int32_t band_lp_[kNumBands - 1][kMaxNumChannels];
+  int32_t band_bp_[kNumBands - 1][kMaxNumChannels];
+  int64_t sidechain_signal_detector_[kMaxNumChannels];
+  int64_t detector_[kMaxNumChannels];
+  int32_t gain_reduction_[kMaxNumChannels];
+  
+  DISALLOW_COPY_AND_ASSIGN(MultichannelDynamics);
+};
+
+}  // namespace streams
+
+#endif  // STREAMS_MULTICHANNEL_DYNAMICS_H_
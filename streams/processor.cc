@@ -38,6 +38,7 @@ using namespace std;
 #define REGISTER_PROCESSOR(ClassName) \
   { &Processor::ClassName ## Init, \
     &Processor::ClassName ## Process, \
+    &Processor::ClassName ## ProcessBlock, \
     &Processor::ClassName ## Configure },
 
 /* static */
@@ -52,6 +53,7 @@ Processor::callbacks_table_[PROCESSOR_FUNCTION_LAST] = {
 };
 
 void Processor::Init(uint8_t index) {
+  lookahead_ = NULL;
   for (uint8_t i = 0; i < PROCESSOR_FUNCTION_LAST; ++i) {
     (this->*callbacks_table_[i].init)();
   }
@@ -59,6 +59,11 @@ enum ProcessorFunction {
   void ClassName ## Process(int16_t a, int16_t e, uint16_t* g, uint16_t* f) { \
     variable.Process(a, e, g, f); \
   } \
+  void ClassName ## ProcessBlock( \
+      const int16_t* a, const int16_t* e, uint16_t* g, uint16_t* f, \
+      size_t n) { \
+    variable.Process(a, e, g, f, n); \
+  } \
   void ClassName ## Configure(bool a, int32_t* p, int32_t* g) { \
     variable.Configure(a, p, g); \
   } \
@@ -79,6 +84,12 @@ class Processor {
       int16_t,
       uint16_t*,
       uint16_t*); 
+  typedef void (Processor::*ProcessBlockFn)(
+      const int16_t*,
+      const int16_t*,
+      uint16_t*,
+      uint16_t*,
+      size_t); 
   typedef void (Processor::*ConfigureFn)(
       bool,
       int32_t*,
@@ -87,6 +98,7 @@ class Processor {
   struct ProcessorCallbacks {
     InitFn init;
     ProcessFn process;
+    ProcessBlockFn process_block;
     ConfigureFn configure;
   };
   
@@ -94,6 +106,7 @@ class Processor {
     function_ = function;
     callbacks_ = callbacks_table_[function];
     (this->*callbacks_.init)();
+    compressor_.set_lookahead(lookahead_);
     dirty_ = true;
   }
   
@@ -123,6 +136,19 @@ class Processor {
   inline uint8_t last_gain() const { return last_gain_value_ >> 8; }
   inline int32_t gain_reduction() const { return compressor_.gain_reduction(); }
   
+  // Lookahead state of the compressor, NULL to disable it. In this mode, the
+  // gain is aligned with delayed_audio().
+  inline void set_lookahead(CompressorLookahead* lookahead) {
+    lookahead_ = lookahead;
+    compressor_.set_lookahead(lookahead);
+  }
+  inline size_t latency() const {
+    return function_ == PROCESSOR_FUNCTION_COMPRESSOR
+        ? compressor_.lookahead()
+        : 0;
+  }
+  inline int16_t delayed_audio() const { return compressor_.delayed_audio(); }
+  
   inline void Process(
       int16_t audio,
       int16_t excite,
@@ -132,6 +158,23 @@ class Processor {
     last_gain_value_ = *gain;
     last_frequency_value_ = *frequency;
   }
+  
+  // Processes a block of size samples. The function is dispatched once for
+  // the whole block, and the per-sample code of each processor is inlined in
+  // its own loop.
+  inline void Process(
+      const int16_t* audio,
+      const int16_t* excite,
+      uint16_t* gain,
+      uint16_t* frequency,
+      size_t size) {
+    if (!size) {
+      return;
+    }
+    (this->*callbacks_.process_block)(audio, excite, gain, frequency, size);
+    last_gain_value_ = gain[size - 1];
+    last_frequency_value_ = frequency[size - 1];
+  }
 
   void Configure() {
     if (!dirty_) {
@@ -156,6 +199,8 @@ class Processor {
   uint16_t last_gain_value_;
   uint16_t last_frequency_value_;
   
+  CompressorLookahead* lookahead_;
+  
   ProcessorCallbacks callbacks_;
   static const ProcessorCallbacks callbacks_table_[PROCESSOR_FUNCTION_LAST];
   
@@ -0,0 +1,101 @@
+// Copyright 2014 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Running maximum over a sliding window of the last N samples.
+//
+// Monotonic deque: only the samples which can still become the maximum are
+// kept, in decreasing order. Each sample is inserted and removed at most once,
+// so the cost is O(1) per sample on average whatever the window size, with the
+// storage bounded by the window size. The storage is provided by the caller.
+
+#ifndef STREAMS_SLIDING_MAX_H_
+#define STREAMS_SLIDING_MAX_H_
+
+#include "stmlib/stmlib.h"
+
+namespace streams {
+
+template<typename T>
+class SlidingMax {
+ public:
+  SlidingMax() { }
+  ~SlidingMax() { }
+  
+  // The deque never holds more than window_size samples: value and time_stamp
+  // are caller-provided arrays of window_size elements.
+  void Init(T* value, uint32_t* time_stamp, size_t window_size) {
+    value_ = value;
+    time_stamp_ = time_stamp;
+    window_size_ = window_size < 1 ? 1 : window_size;
+    head_ = 0;
+    size_ = 0;
+    time_ = 0;
+  }
+  
+  // Adds a sample and returns the maximum of the last window_size samples.
+  inline T Process(T value) {
+    ++time_;
+    // Drop the samples which have left the window.
+    if (size_ && time_ - time_stamp_[head_] >= window_size_) {
+      head_ = head_ + 1 >= window_size_ ? 0 : head_ + 1;
+      --size_;
+    }
+    // Drop the samples smaller than the new one, they can no longer be the
+    // maximum.
+    while (size_) {
+      size_t tail = Wrap(head_ + size_ - 1);
+      if (value_[tail] > value) {
+        break;
+      }
+      --size_;
+    }
+    size_t tail = Wrap(head_ + size_);
+    value_[tail] = value;
+    time_stamp_[tail] = time_;
+    ++size_;
+    return value_[head_];
+  }
+  
+  inline size_t window_size() const { return window_size_; }
+  
+ private:
+  inline size_t Wrap(size_t index) const {
+    return index >= window_size_ ? index - window_size_ : index;
+  }
+  
+  T* value_;
+  uint32_t* time_stamp_;
+  size_t head_;
+  size_t size_;
+  size_t window_size_;
+  uint32_t time_;
+  
+  DISALLOW_COPY_AND_ASSIGN(SlidingMax);
+};
+
+}  // namespace streams
+
+#endif  // STREAMS_SLIDING_MAX_H_
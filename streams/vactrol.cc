@@ -31,6 +31,7 @@
 #include "stmlib/utils/dsp.h"
 
 #include "streams/gain.h"
+#include "streams/process_block.h"
 #include "streams/resources.h"
 
 namespace streams {
@@ -183,4 +184,13 @@ void Vactrol::Process(
        (frequency_amount_ * cutoff >> 15);
 }
 
+void Vactrol::Process(
+    const int16_t* audio,
+    const int16_t* excite,
+    uint16_t* gain,
+    uint16_t* frequency,
+    size_t size) {
+  ProcessBlock(this, audio, excite, gain, frequency, size);
+}
+
 }  // namespace streams
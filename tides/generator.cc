@@ -40,8 +40,6 @@ namespace tides {
 using namespace std;
 using namespace stmlib;
 
-const int16_t kOctave = 12 * 128;
-const uint16_t kSlopeBits = 12;
 const uint32_t kSyncCounterMaxTime = 8 * 48000;
 
 const int32_t kDownsampleCoefficient[4] = { 17162, 19069, 17162, 12140 };
@@ -82,6 +80,7 @@ void Generator::Init() {
   for (size_t i = 0; i < kNumBlocks; ++i) {
     fill(&output_samples_[i][0], &output_samples_[i][kBlockSize], s);
     fill(&input_samples_[i][0], &input_samples_[i][kBlockSize], 0);
+    fill(&clock_fractions_[i][0], &clock_fractions_[i][kBlockSize], 0);
   }
   playback_block_ = kNumBlocks / 2;
   render_block_ = 0;
@@ -96,11 +95,34 @@ void Generator::Init() {
   running_ = false;
   
   ClearFilterState();
+  x_ = y_ = 0;
+  attenuation_pitch_ = 0x7fff;
+  attenuation_slope_ = 0x7fff;
+  attenuation_shape_ = 0x7fff;
+  attenuation_smoothness_ = 0x7fff;
+  cached_attenuation_ = ComputeAntialiasAttenuation(
+      attenuation_pitch_,
+      attenuation_slope_,
+      attenuation_shape_,
+      attenuation_smoothness_);
+#ifdef WAVETABLE_HACK
+  wavetable_ = true;
+#else
+  wavetable_ = false;
+#endif  // WAVETABLE_HACK
+  wavetable_cache_ = NULL;
+  stages_ = GENERATOR_STAGE_FILTER;
+  active_stages_ = GENERATOR_STAGE_FILTER;
+  filter_bypass_ = false;
   
   sync_counter_ = kSyncCounterMaxTime;
   frequency_ratio_.p = 1;
   frequency_ratio_.q = 1;
   sync_ = false;
+  sync_mode_ = GENERATOR_SYNC_MODE_PREDICTIVE;
+  num_clock_edges_ = 0;
+  clock_fraction_ = 0;
+  clock_reference_phase_ = 0;
   phase_increment_ = 9448928;
   local_osc_phase_increment_ = phase_increment_;
   target_phase_increment_ = phase_increment_;
@@ -153,6 +175,52 @@ uint32_t Generator::ComputePhaseIncrement(int16_t pitch) {
       : phase_increment >> -num_shifts;
 }
 
+uint32_t Generator::LockToClockEdge(
+    uint32_t phase,
+    uint32_t* phase_increment,
+    uint8_t clock_fraction) {
+  // Time elapsed since the previous edge, in 1/256th of a sample.
+  uint32_t period = (sync_counter_ << 8) + clock_fraction_ - clock_fraction;
+  clock_fraction_ = clock_fraction;
+  
+  if (!num_clock_edges_ || sync_counter_ >= kSyncCounterMaxTime) {
+    // First edge: restart the cycle, the period is not known yet.
+    num_clock_edges_ = 1;
+    clock_reference_phase_ = 0;
+    return (*phase_increment >> 8) * clock_fraction;
+  }
+  
+  uint32_t p = frequency_ratio_.p;
+  uint32_t q = frequency_ratio_.q;
+  uint64_t increment = (static_cast<uint64_t>(p) << 40) / (q * period);
+  if (increment > 0x20000000) {
+    increment = 0x20000000;
+  }
+  
+  // Expected phase at the time of the edge, from which the phase at the
+  // current sample is extrapolated.
+  clock_reference_phase_ += static_cast<uint32_t>(
+      (static_cast<uint64_t>(p % q) << 32) / q);
+  uint32_t expected_phase = clock_reference_phase_ + \
+      (static_cast<uint32_t>(increment) >> 8) * clock_fraction;
+  
+  if (num_clock_edges_ == 1) {
+    // Second edge: the frequency is known, jump to the right phase.
+    num_clock_edges_ = 2;
+    *phase_increment = increment;
+    return expected_phase;
+  }
+  
+  // Subsequent edges: the phase error is spread over the next period, so that
+  // the output never jumps.
+  int32_t phase_error = expected_phase - phase;
+  int32_t correction = phase_error / static_cast<int32_t>(sync_counter_) >> 1;
+  int64_t corrected_increment = static_cast<int64_t>(increment) + correction;
+  CONSTRAIN(corrected_increment, 1, 0x20000000);
+  *phase_increment = static_cast<uint32_t>(corrected_increment);
+  return phase;
+}
+
 int16_t Generator::ComputePitch(uint32_t phase_increment) {
   uint32_t first = lut_increments[0];
   uint32_t last = lut_increments[LUT_INCREMENTS_SIZE - 2];
@@ -236,10 +304,6 @@ int32_t Generator::ComputeAntialiasAttenuation(
 
 void Generator::ProcessFilterWavefolder(
     GeneratorSample* in_out, size_t size) {
-  int32_t frequency = ComputeCutoffFrequency(pitch_, smoothness_);
-  int32_t f_a = lut_cutoff[frequency >> 7] >> 16;
-  int32_t f_b = lut_cutoff[(frequency >> 7) + 1] >> 16;
-  int32_t f = f_a + ((f_b - f_a) * (frequency & 0x7f) >> 7);
   int32_t wf_gain = 2048;
   int32_t wf_balance = 0;
   if (smoothness_ > 0) {
@@ -248,38 +312,139 @@ void Generator::ProcessFilterWavefolder(
     wf_balance = attenuated_smoothness;
   }
   
+  // With a null balance, the wavefolder is an identity. The filter is never
+  // one, and is only skipped when filter_bypass_ is set.
+  uint8_t stages = 0;
+  if (!filter_bypass_ || range_ == GENERATOR_RANGE_HIGH || smoothness_ < 0) {
+    stages |= GENERATOR_STAGE_FILTER;
+  }
+  if (wf_balance) {
+    stages |= GENERATOR_STAGE_WAVEFOLDER;
+  }
+  bool fade = (stages ^ stages_) & GENERATOR_STAGE_FILTER;
+  stages_ = stages;
+  
+  int32_t f = 0;
+  if ((stages & GENERATOR_STAGE_FILTER) || fade) {
+    int32_t frequency = ComputeCutoffFrequency(pitch_, smoothness_);
+    int32_t f_a = lut_cutoff[frequency >> 7] >> 16;
+    int32_t f_b = lut_cutoff[(frequency >> 7) + 1] >> 16;
+    f = f_a + ((f_b - f_a) * (frequency & 0x7f) >> 7);
+  }
+  
+  // Crossfade between the filtered and dry signals when the filter is
+  // switched in or out.
+  int32_t fade_increment = 65536 / static_cast<int32_t>(size);
+  int32_t fade_start = 0;
+  if (fade && !(stages & GENERATOR_STAGE_FILTER)) {
+    fade_start = 65536;
+    fade_increment = -fade_increment;
+  }
+  
+  if (fade) {
+    stages |= GENERATOR_STAGE_FILTER;
+    if (wf_balance) {
+      ProcessFilterWavefolder<true, true, true>(
+          in_out, size, f, wf_gain, wf_balance, fade_start, fade_increment);
+    } else {
+      ProcessFilterWavefolder<true, true, false>(
+          in_out, size, f, wf_gain, wf_balance, fade_start, fade_increment);
+    }
+  } else if (stages & GENERATOR_STAGE_FILTER) {
+    if (wf_balance) {
+      ProcessFilterWavefolder<true, false, true>(
+          in_out, size, f, wf_gain, wf_balance, 0, 0);
+    } else {
+      ProcessFilterWavefolder<true, false, false>(
+          in_out, size, f, wf_gain, wf_balance, 0, 0);
+    }
+  } else {
+    if (wf_balance) {
+      ProcessFilterWavefolder<false, false, true>(
+          in_out, size, f, wf_gain, wf_balance, 0, 0);
+    } else {
+      ProcessFilterWavefolder<false, false, false>(
+          in_out, size, f, wf_gain, wf_balance, 0, 0);
+    }
+  }
+  active_stages_ = stages;
+}
+
+template<bool filter, bool fade, bool fold>
+void Generator::ProcessFilterWavefolder(
+    GeneratorSample* in_out,
+    size_t size,
+    int32_t f,
+    int32_t wf_gain,
+    int32_t wf_balance,
+    int32_t fade_gain,
+    int32_t fade_increment) {
   int32_t uni_lp_state_0 = uni_lp_state_[0];
   int32_t uni_lp_state_1 = uni_lp_state_[1];
   int32_t bi_lp_state_0 = bi_lp_state_[0];
   int32_t bi_lp_state_1 = bi_lp_state_[1];
   
+  int32_t bipolar = 0;
+  int32_t unipolar = 0;
   while (size--) {
     int32_t original, folded;
+    bipolar = in_out->bipolar;
+    unipolar = in_out->unipolar;
     
     // Run through LPF.
-    bi_lp_state_0 += f * (in_out->bipolar - bi_lp_state_0) >> 15;
-    bi_lp_state_1 += f * (bi_lp_state_0 - bi_lp_state_1) >> 15;
+    if (filter) {
+      bi_lp_state_0 += f * (bipolar - bi_lp_state_0) >> 15;
+      bi_lp_state_1 += f * (bi_lp_state_0 - bi_lp_state_1) >> 15;
+      original = bi_lp_state_1;
+      if (fade) {
+        original = bipolar + ((original - bipolar) * (fade_gain >> 1) >> 15);
+      }
+    } else {
+      original = bipolar;
+    }
     
     // Fold.
-    original = bi_lp_state_1;
-    folded = Interpolate1022(wav_bipolar_fold, original * wf_gain + (1UL << 31));
-    in_out->bipolar = original + ((folded - original) * wf_balance >> 15);
+    if (fold) {
+      folded = Interpolate1022(
+          wav_bipolar_fold, original * wf_gain + (1UL << 31));
+      in_out->bipolar = original + ((folded - original) * wf_balance >> 15);
+    } else {
+      in_out->bipolar = original;
+    }
 
     // Run through LPF.
-    uni_lp_state_0 += f * (in_out->unipolar - uni_lp_state_0) >> 15;
-    uni_lp_state_1 += f * (uni_lp_state_0 - uni_lp_state_1) >> 15;
+    if (filter) {
+      uni_lp_state_0 += f * (unipolar - uni_lp_state_0) >> 15;
+      uni_lp_state_1 += f * (uni_lp_state_0 - uni_lp_state_1) >> 15;
+      original = uni_lp_state_1;
+      if (fade) {
+        original = unipolar + ((original - unipolar) * (fade_gain >> 1) >> 15);
+      }
+      original <<= 1;
+    } else {
+      original = unipolar << 1;
+    }
     
     // Fold.
-    original = uni_lp_state_1 << 1;
-    folded = Interpolate1022(wav_unipolar_fold, original * wf_gain) << 1;
-    in_out->unipolar = original + ((folded - original) * wf_balance >> 15);
+    if (fold) {
+      folded = Interpolate1022(wav_unipolar_fold, original * wf_gain) << 1;
+      in_out->unipolar = original + ((folded - original) * wf_balance >> 15);
+    } else {
+      in_out->unipolar = original;
+    }
     
-    uni_lp_state_[0] = uni_lp_state_0;
-    uni_lp_state_[1] = uni_lp_state_1;
-    bi_lp_state_[0] = bi_lp_state_0;
-    bi_lp_state_[1] = bi_lp_state_1;
+    if (fade) {
+      fade_gain += fade_increment;
+    }
     in_out++;
   }
+  
+  if (!filter) {
+    // Keep the filter primed with the dry signal, so that it can be switched
+    // back in without a transient.
+    uni_lp_state_0 = uni_lp_state_1 = unipolar;
+    bi_lp_state_0 = bi_lp_state_1 = bipolar;
+  }
   uni_lp_state_[0] = uni_lp_state_0;
   uni_lp_state_[1] = uni_lp_state_1;
   bi_lp_state_[0] = bi_lp_state_0;
@@ -287,7 +452,10 @@ void Generator::ProcessFilterWavefolder(
 }
 
 void Generator::ProcessAudioRate(
-    const uint8_t* in, GeneratorSample* out, size_t size) {
+    const uint8_t* in,
+    const uint8_t* clock_fraction,
+    GeneratorSample* out,
+    size_t size) {
   GeneratorSample sample = previous_sample_;
   
   if (sync_) {
@@ -300,11 +468,23 @@ void Generator::ProcessAudioRate(
     target_phase_increment_ = phase_increment_;
   }
 
-  attenuation_ = ComputeAntialiasAttenuation(
-      pitch_,
-      slope_,
-      shape_,
-      smoothness_);
+  // The attenuation and the waveshaper are only recomputed when the
+  // parameters they depend on have moved.
+  if (pitch_ != attenuation_pitch_ ||
+      slope_ != attenuation_slope_ ||
+      shape_ != attenuation_shape_ ||
+      smoothness_ != attenuation_smoothness_) {
+    attenuation_pitch_ = pitch_;
+    attenuation_slope_ = slope_;
+    attenuation_shape_ = shape_;
+    attenuation_smoothness_ = smoothness_;
+    cached_attenuation_ = ComputeAntialiasAttenuation(
+        pitch_,
+        slope_,
+        shape_,
+        smoothness_);
+  }
+  attenuation_ = cached_attenuation_;
 
   uint16_t shape = static_cast<uint16_t>((shape_ * attenuation_ >> 15) + 32768);
   uint16_t wave_index = WAV_INVERSE_TAN_AUDIO + (shape >> 14);
@@ -330,10 +510,14 @@ void Generator::ProcessAudioRate(
   
   uint32_t mid_point = mid_point_;
   int32_t next_sample = next_sample_;
+  uint32_t slope_mid_point = 0;
+  int32_t slope_up = 0;
+  int32_t slope_down = 0;
   
   while (size--) {
     ++sync_counter_;
     uint8_t control = *in++;
+    uint8_t fraction = *clock_fraction++;
 
     // When freeze is high, discard any start/reset command.
     if (!(control & CONTROL_FREEZE)) {
@@ -346,7 +530,12 @@ void Generator::ProcessAudioRate(
       }
     }
     
-    if (sync_) {
+    if (sync_ && sync_mode_ == GENERATOR_SYNC_MODE_FAST_LOCK) {
+      if ((control & CONTROL_CLOCK_RISING) && sync_counter_) {
+        phase = LockToClockEdge(phase, &phase_increment, fraction);
+        sync_counter_ = 0;
+      }
+    } else if (sync_) {
       if (control & CONTROL_CLOCK_RISING) {
         ++sync_edges_counter_;
         if (sync_edges_counter_ >= frequency_ratio_.q) {
@@ -394,8 +583,12 @@ void Generator::ProcessAudioRate(
     CONSTRAIN(mid_point, min_mid_point, max_mid_point);
     CONSTRAIN(mid_point, 0x10000, 0xffff0000);
 
-    int32_t slope_up = static_cast<int32_t>(0xffffffff / (mid_point >> 16));
-    int32_t slope_down = static_cast<int32_t>(0xffffffff / (~mid_point >> 16));
+    // mid_point settles quickly when the slope is not moving.
+    if (mid_point != slope_mid_point) {
+      slope_mid_point = mid_point;
+      slope_up = static_cast<int32_t>(0xffffffff / (mid_point >> 16));
+      slope_down = static_cast<int32_t>(0xffffffff / (~mid_point >> 16));
+    }
 
     int32_t this_sample = next_sample;
     next_sample = 0;
@@ -459,7 +652,10 @@ void Generator::ProcessAudioRate(
 }
 
 void Generator::ProcessControlRate(
-    const uint8_t* in, GeneratorSample* out, size_t size) {
+    const uint8_t* in,
+    const uint8_t* clock_fraction,
+    GeneratorSample* out,
+    size_t size) {
   if (sync_) {
     pitch_ = ComputePitch(phase_increment_);
   } else {
@@ -496,6 +692,7 @@ void Generator::ProcessControlRate(
     smoothed_slope += (slope_ - smoothed_slope) >> 4;
     
     uint8_t control = *in++;
+    uint8_t fraction = *clock_fraction++;
 
     // When freeze is high, discard any start/reset command.
     if (!(control & CONTROL_FREEZE)) {
@@ -509,7 +706,9 @@ void Generator::ProcessControlRate(
     }
     
     if ((control & CONTROL_CLOCK_RISING) && sync_ && sync_counter_) {
-      if (sync_counter_ >= kSyncCounterMaxTime) {
+      if (sync_mode_ == GENERATOR_SYNC_MODE_FAST_LOCK) {
+        phase = LockToClockEdge(phase, &phase_increment, fraction);
+      } else if (sync_counter_ >= kSyncCounterMaxTime) {
         phase = 0;
       } else {
         uint32_t predicted_period = sync_counter_ < 480
@@ -622,6 +821,17 @@ void Generator::ProcessControlRate(
 }
 
 
+static inline int32_t ReadWavetable(
+    const int16_t* const* corners,
+    uint32_t phase,
+    uint16_t x_fractional,
+    int32_t y_fractional) {
+  int32_t y_1 = Crossfade(corners[0], corners[1], phase, x_fractional);
+  int32_t y_2 = Crossfade(corners[2], corners[3], phase, x_fractional);
+  return y_1 + ((y_2 - y_1) * y_fractional >> 15);
+}
+
+
 void Generator::ProcessWavetable(
     const uint8_t* in, GeneratorSample* out, size_t size) {
   GeneratorSample sample = previous_sample_;
@@ -655,7 +865,17 @@ void Generator::ProcessWavetable(
   int32_t lp_state_0 = bi_lp_state_[0];
   int32_t lp_state_1 = bi_lp_state_[1];
   
-  const int16_t* bank = wt_waves + mode_ * 64 * 257 - (mode_ & 2) * 4 * 257;
+  uint16_t bank = mode_ * 64 - (mode_ & 2) * 4;
+  
+  // Reads from the band-limited copies of the waves that are alias-free at
+  // the current pitch. The wavefolder adds harmonics above them, so when it
+  // is enabled it runs at 4x the sample rate, followed by decimation.
+  size_t level = wavetable_cache_
+      ? WavetableMipmapCache::ComputeLevel(phase_increment)
+      : 0;
+  uint16_t cell = 0xffff;
+  const int16_t* corners[4] = { NULL, NULL, NULL, NULL };
+  
   while (size--) {
     ++sync_counter_;
     uint8_t control = *in++;
@@ -707,7 +927,8 @@ void Generator::ProcessWavetable(
           bank_index = 0;
         }
         mode_ = static_cast<GeneratorMode>(bank_index);
-        bank = wt_waves + mode_ * 64 * 257 - (mode_ & 2) * 4 * 257;
+        bank = mode_ * 64 - (mode_ & 2) * 4;
+        cell = 0xffff;
       }
     }
     
@@ -734,24 +955,43 @@ void Generator::ProcessWavetable(
     
     uint16_t x_integral = x >> 13;
     uint16_t y_integral = y >> 13;
-    const int16_t* wave_1 = &bank[(x_integral + y_integral * 8) * 257];
-    const int16_t* wave_2 = wave_1 + 257 * 8;
+    uint16_t wave_index = bank + x_integral + y_integral * 8;
+    if (wave_index != cell) {
+      // The four corners of the cell: (x, y), (x + 1, y), (x, y + 1) and
+      // (x + 1, y + 1).
+      for (size_t i = 0; i < 4; ++i) {
+        uint16_t corner = wave_index + (i & 1) + (i >> 1) * 8;
+        const int16_t* wave = wt_waves + corner * kWavetableStride;
+        corners[i] = WavetableMipmapCache::Level(
+            wave,
+            level ? wavetable_cache_->Load(corner) : NULL,
+            level);
+      }
+      cell = wave_index;
+    }
     uint16_t x_fractional = x << 3;
     int32_t y_fractional = (y << 2) & 0x7fff;
-
-    int32_t s = 0;
-    for (int32_t subsample = 0; subsample < 4; ++subsample) {
-      int32_t y_1 = Crossfade(wave_1, wave_1 + 257, phase << 1, x_fractional);
-      int32_t y_2 = Crossfade(wave_2, wave_2 + 257, phase << 1, x_fractional);
-      int32_t y_mix = y_1 + ((y_2 - y_1) * y_fractional >> 15);
-      int32_t folded = Interpolate1022(
-          ws_smooth_bipolar_fold, (y_mix + 32768) << 16);
-      y_mix = y_mix + ((folded - y_mix) * wf_gain >> 15);
-      s += y_mix * kDownsampleCoefficient[subsample];
-      phase += (phase_increment >> 3);
+    
+    int32_t s;
+    if (!wf_gain) {
+      s = ReadWavetable(corners, phase >> level, x_fractional, y_fractional);
+    } else {
+      s = 0;
+      uint32_t subsample_phase = phase;
+      for (int32_t subsample = 0; subsample < 4; ++subsample) {
+        int32_t y_mix = ReadWavetable(
+            corners, subsample_phase >> level, x_fractional, y_fractional);
+        int32_t folded = Interpolate1022(
+            ws_smooth_bipolar_fold, (y_mix + 32768) << 16);
+        y_mix = y_mix + ((folded - y_mix) * wf_gain >> 15);
+        s += y_mix * kDownsampleCoefficient[subsample];
+        subsample_phase += phase_increment >> 2;
+      }
+      s >>= 16;
     }
+    phase += phase_increment;
     
-    lp_state_0 += f * ((s >> 16) - lp_state_0) >> 15;
+    lp_state_0 += f * (s - lp_state_0) >> 15;
     lp_state_1 += f * (lp_state_0 - lp_state_1) >> 15;
     
     uint8_t flags = 0;
@@ -34,6 +34,8 @@
 #include "stmlib/algorithms/pattern_predictor.h"
 #include "stmlib/utils/ring_buffer.h"
 
+#include "tides/wavetable_mipmap.h"
+
 // #define WAVETABLE_HACK
 
 namespace tides {
@@ -50,6 +52,11 @@ enum GeneratorMode {
   GENERATOR_MODE_AR,
 };
 
+enum GeneratorSyncMode {
+  GENERATOR_SYNC_MODE_PREDICTIVE,
+  GENERATOR_SYNC_MODE_FAST_LOCK
+};
+
 enum ControlBitMask {
   CONTROL_FREEZE = 1,
   CONTROL_GATE = 2,
@@ -64,6 +71,11 @@ enum FlagBitMask {
   FLAG_END_OF_RELEASE = 2
 };
 
+enum GeneratorStage {
+  GENERATOR_STAGE_FILTER = 1,
+  GENERATOR_STAGE_WAVEFOLDER = 2
+};
+
 struct GeneratorSample {
   uint16_t unipolar;
   int16_t bipolar;
@@ -73,6 +85,9 @@ struct GeneratorSample {
 const size_t kNumBlocks = 2;
 const size_t kBlockSize = 16;
 
+const int16_t kOctave = 12 * 128;
+const uint16_t kSlopeBits = 12;
+
 struct FrequencyRatio {
   uint32_t p;
   uint32_t q;
@@ -131,14 +146,65 @@ class Generator {
     }
     sync_ = sync;
     sync_edges_counter_ = 0;
+    num_clock_edges_ = 0;
+  }
+  
+  // In wavetable mode, slope and shape scan a 2D grid of waves, the mode
+  // selects one of three banks, and a clock edge (when sync is off) switches
+  // to the next bank.
+  void set_wavetable(bool wavetable) {
+    if (wavetable && !wavetable_) {
+      ClearFilterState();
+    }
+    wavetable_ = wavetable;
+  }
+  
+  // Storage for the band-limited mipmaps of the wavetable mode, owned by the
+  // caller so that it costs no RAM when the mode is not used. Without it, the
+  // waves are read at full bandwidth from flash.
+  void set_wavetable_cache(WavetableMipmapCache* wavetable_cache) {
+    wavetable_cache_ = wavetable_cache;
+    if (wavetable_cache_) {
+      wavetable_cache_->Init();
+    }
+  }
+  
+  // In fast lock mode, the generator is phase-locked to the clock edges using
+  // their sub-sample timestamps. The frequency is known after two edges; the
+  // remaining phase error is then corrected at each edge.
+  void set_sync_mode(GeneratorSyncMode sync_mode) {
+    sync_mode_ = sync_mode;
+    num_clock_edges_ = 0;
   }
   
   inline GeneratorMode mode() const { return mode_; }
   inline GeneratorRange range() const { return range_; }
   inline bool sync() const { return sync_; }
+  inline GeneratorSyncMode sync_mode() const { return sync_mode_; }
+  inline bool wavetable() const { return wavetable_; }
+  
+  // In the control-rate ranges, with a non-negative smoothness, the filter sits
+  // at the top of its range and only adds about a sample of smoothing. It is
+  // not an exact identity, so skipping it is an opt-in approximation.
+  inline void set_filter_bypass(bool filter_bypass) {
+    filter_bypass_ = filter_bypass;
+  }
+  inline bool filter_bypass() const { return filter_bypass_; }
+  
+  // Stages of the filter/wavefolder that ran on the last rendered block.
+  inline uint8_t active_stages() const { return active_stages_; }
   
   inline const GeneratorSample& Process(uint8_t control) {
+    return Process(control, 0);
+  }
+  
+  // clock_fraction is the time elapsed between the clock edge reported in
+  // control and this sample, in 1/256th of a sample.
+  inline const GeneratorSample& Process(
+      uint8_t control,
+      uint8_t clock_fraction) {
     input_samples_[playback_block_][current_sample_] = control;
+    clock_fractions_[playback_block_][current_sample_] = clock_fraction;
     const GeneratorSample& out = output_samples_[playback_block_][current_sample_];
     current_sample_ = current_sample_ + 1;
     if (current_sample_ >= kBlockSize) {
@@ -155,17 +221,18 @@ class Generator {
   inline void Process() {
     while (render_block_ != playback_block_) {
       uint8_t* in = input_samples_[render_block_];
+      uint8_t* clock_fraction = clock_fractions_[render_block_];
       GeneratorSample* out = output_samples_[render_block_];
-  #ifndef WAVETABLE_HACK
-      if (range_ == GENERATOR_RANGE_HIGH) {
-        ProcessAudioRate(in, out, kBlockSize);
+      if (wavetable_) {
+        ProcessWavetable(in, out, kBlockSize);
       } else {
-        ProcessControlRate(in, out, kBlockSize);
+        if (range_ == GENERATOR_RANGE_HIGH) {
+          ProcessAudioRate(in, clock_fraction, out, kBlockSize);
+        } else {
+          ProcessControlRate(in, clock_fraction, out, kBlockSize);
+        }
+        ProcessFilterWavefolder(out, kBlockSize);
       }
-      ProcessFilterWavefolder(out, kBlockSize);
-  #else
-      ProcessWavetable(in, out, kBlockSize);
-  #endif
       render_block_ = (render_block_ + 1) % kNumBlocks;
     }
   }
@@ -177,10 +244,27 @@ class Generator {
  private:
   // There are two versions of the rendering code, one optimized for audio, with
   // band-limiting.
-  void ProcessAudioRate(const uint8_t* in, GeneratorSample* out, size_t size);
-  void ProcessControlRate(const uint8_t* in, GeneratorSample* out, size_t size);
+  void ProcessAudioRate(
+      const uint8_t* in,
+      const uint8_t* clock_fraction,
+      GeneratorSample* out,
+      size_t size);
+  void ProcessControlRate(
+      const uint8_t* in,
+      const uint8_t* clock_fraction,
+      GeneratorSample* out,
+      size_t size);
   void ProcessWavetable(const uint8_t* in, GeneratorSample* out, size_t size);
   void ProcessFilterWavefolder(GeneratorSample* in_out, size_t size);
+  template<bool filter, bool fade, bool fold>
+  void ProcessFilterWavefolder(
+      GeneratorSample* in_out,
+      size_t size,
+      int32_t f,
+      int32_t wf_gain,
+      int32_t wf_balance,
+      int32_t fade_gain,
+      int32_t fade_increment);
 
   int32_t ComputeAntialiasAttenuation(
         int16_t pitch,
@@ -197,6 +281,10 @@ class Generator {
   int16_t ComputePitch(uint32_t phase_increment);
   int32_t ComputeCutoffFrequency(int16_t pitch, int16_t smoothness);
   void ComputeFrequencyRatio(int16_t pitch);
+  uint32_t LockToClockEdge(
+      uint32_t phase,
+      uint32_t* phase_increment,
+      uint8_t clock_fraction);
   
   inline int32_t NextIntegratedBlepSample(uint32_t t) const {
     if (t >= 65535) {
@@ -221,6 +309,7 @@ class Generator {
   
   GeneratorSample output_samples_[kNumBlocks][kBlockSize];
   uint8_t input_samples_[kNumBlocks][kBlockSize];
+  uint8_t clock_fractions_[kNumBlocks][kBlockSize];
   size_t current_sample_;
   volatile size_t playback_block_;
   volatile size_t render_block_;
@@ -241,14 +330,24 @@ class Generator {
   int16_t smoothness_;
   int16_t attenuation_;
   
+  // Block-rate caches for the audio-rate renderer.
+  int16_t attenuation_pitch_;
+  int16_t attenuation_slope_;
+  int16_t attenuation_shape_;
+  int16_t attenuation_smoothness_;
+  int16_t cached_attenuation_;
+  
   uint32_t phase_;
   uint32_t phase_increment_;
   uint16_t x_;
   uint16_t y_;
   uint16_t z_;
+  bool wavetable_;
+  WavetableMipmapCache* wavetable_cache_;
   bool wrap_;
   
   bool sync_;
+  GeneratorSyncMode sync_mode_;
   FrequencyRatio frequency_ratio_;
   
   // Time measurement and clock divider for PLL mode.
@@ -259,10 +358,18 @@ class Generator {
   uint32_t target_phase_increment_;
   uint32_t eor_counter_;
   
+  // Sub-sample timestamps and reference phase for fast lock mode.
+  uint32_t num_clock_edges_;
+  uint8_t clock_fraction_;
+  uint32_t clock_reference_phase_;
+  
   stmlib::PatternPredictor<32, 8> pattern_predictor_;
   
   int64_t uni_lp_state_[2];
   int64_t bi_lp_state_[2];
+  uint8_t stages_;
+  uint8_t active_stages_;
+  bool filter_bypass_;
   
   bool running_;
   
@@ -0,0 +1,318 @@
+// Copyright 2013 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Bank of control-rate function generators (envelopes/LFOs), each with its own
+// pitch, shape, slope and mode.
+//
+// The state is stored as one array per field, so that the block-rate pass
+// (parameter smoothing, phase increment, slope and shape coefficients) is a
+// straight walk through contiguous memory, processed in lanes of
+// kGeneratorBankLaneSize generators. Rendering is then done generator by
+// generator with a loop specialized for each mode. Gates and triggers are
+// quantized to the block boundary.
+
+#ifndef TIDES_GENERATOR_BANK_H_
+#define TIDES_GENERATOR_BANK_H_
+
+#include "stmlib/stmlib.h"
+
+#include "stmlib/utils/dsp.h"
+
+#include "tides/generator.h"
+#include "tides/resources.h"
+
+namespace tides {
+
+const size_t kGeneratorBankLaneSize = 4;
+
+// Block-rate one-pole smoothing of the pitch, shape and slope parameters.
+const int32_t kGeneratorBankSmoothing = 1;
+
+enum GeneratorBankStateBits {
+  GENERATOR_BANK_RUNNING = 1,
+  GENERATOR_BANK_GATE = 2,
+  GENERATOR_BANK_TRIGGER = 4,
+  GENERATOR_BANK_WRAP = 8
+};
+
+template<size_t capacity>
+class GeneratorBank {
+ public:
+  GeneratorBank() { }
+  ~GeneratorBank() { }
+  
+  void Init(size_t num_generators, GeneratorRange range) {
+    num_generators_ = num_generators > capacity ? capacity : num_generators;
+    pitch_offset_ = (12 << 7) - (60 << 7) * static_cast<int16_t>(range);
+    if (range == GENERATOR_RANGE_LOW) {
+      pitch_offset_ -= (12 << 7);
+    }
+    clock_divider_ = range == GENERATOR_RANGE_LOW ? 4 : 1;
+    
+    for (size_t i = 0; i < kCapacity; ++i) {
+      phase_[i] = 0;
+      phase_increment_[i] = 0;
+      end_of_attack_[i] = 1UL << 31;
+      attack_factor_[i] = 1 << kSlopeBits;
+      decay_factor_[i] = 1 << kSlopeBits;
+      pitch_[i] = smoothed_pitch_[i] = 60 << 7;
+      shape_[i] = smoothed_shape_[i] = 0;
+      slope_[i] = smoothed_slope_[i] = 0;
+      previous_slope_[i] = 0x7fffffff;
+      wave_index_[i] = WAV_REVERSED_CONTROL;
+      shape_xfade_[i] = 0;
+      mode_[i] = GENERATOR_MODE_LOOPING;
+      state_[i] = GENERATOR_BANK_RUNNING;
+    }
+  }
+  
+  void set_mode(size_t index, GeneratorMode mode) {
+    mode_[index] = mode;
+    if (mode == GENERATOR_MODE_LOOPING) {
+      state_[index] |= GENERATOR_BANK_RUNNING;
+    }
+  }
+  
+  void set_pitch(size_t index, int16_t pitch) {
+    pitch_[index] = pitch + pitch_offset_;
+  }
+  
+  void set_shape(size_t index, int16_t shape) {
+    shape_[index] = shape;
+  }
+  
+  void set_slope(size_t index, int16_t slope) {
+    slope_[index] = slope;
+  }
+  
+  void set_gate(size_t index, bool gate) {
+    uint8_t state = state_[index];
+    if (gate && !(state & GENERATOR_BANK_GATE)) {
+      state |= GENERATOR_BANK_TRIGGER;
+    }
+    state_[index] = gate
+        ? state | GENERATOR_BANK_GATE
+        : state & ~GENERATOR_BANK_GATE;
+  }
+  
+  void Trigger(size_t index) {
+    state_[index] |= GENERATOR_BANK_TRIGGER;
+  }
+  
+  inline size_t num_generators() const { return num_generators_; }
+  inline GeneratorMode mode(size_t index) const {
+    return static_cast<GeneratorMode>(mode_[index]);
+  }
+  inline bool running(size_t index) const {
+    return state_[index] & GENERATOR_BANK_RUNNING;
+  }
+  
+  // Renders size samples for each generator. The output buffers are planar:
+  // the samples of generator i are stored at [i * size, (i + 1) * size).
+  void Process(uint16_t* unipolar, int16_t* bipolar, size_t size) {
+    UpdateParameters();
+    for (size_t i = 0; i < num_generators_; ++i) {
+      switch (mode_[i]) {
+        case GENERATOR_MODE_AD:
+          Render<GENERATOR_MODE_AD>(i, unipolar, bipolar, size);
+          break;
+        case GENERATOR_MODE_LOOPING:
+          Render<GENERATOR_MODE_LOOPING>(i, unipolar, bipolar, size);
+          break;
+        case GENERATOR_MODE_AR:
+          Render<GENERATOR_MODE_AR>(i, unipolar, bipolar, size);
+          break;
+      }
+      unipolar += size;
+      bipolar += size;
+    }
+  }
+  
+ private:
+  static const size_t kCapacity = (capacity + kGeneratorBankLaneSize - 1) & \
+      ~(kGeneratorBankLaneSize - 1);
+  
+  inline uint32_t ComputePhaseIncrement(int32_t pitch) const {
+    // pitch is always above -32 octaves, so the division rounds down.
+    int32_t num_shifts = (pitch + 32 * kOctave) / kOctave - 32;
+    pitch -= num_shifts * kOctave;
+    uint32_t a = lut_increments[pitch >> 4];
+    uint32_t b = lut_increments[(pitch >> 4) + 1];
+    uint32_t phase_increment = a + ((b - a) * (pitch & 0xf) >> 4);
+    phase_increment *= clock_divider_;
+    return num_shifts >= 0
+        ? phase_increment << num_shifts
+        : phase_increment >> -num_shifts;
+  }
+  
+  void UpdateParameters() {
+    size_t num_lanes = (num_generators_ + kGeneratorBankLaneSize - 1) / \
+        kGeneratorBankLaneSize;
+    for (size_t lane = 0; lane < num_lanes; ++lane) {
+      size_t base = lane * kGeneratorBankLaneSize;
+      for (size_t j = 0; j < kGeneratorBankLaneSize; ++j) {
+        size_t i = base + j;
+        smoothed_pitch_[i] += (pitch_[i] - smoothed_pitch_[i]) >> \
+            kGeneratorBankSmoothing;
+        smoothed_shape_[i] += (shape_[i] - smoothed_shape_[i]) >> \
+            kGeneratorBankSmoothing;
+        smoothed_slope_[i] += (slope_[i] - smoothed_slope_[i]) >> \
+            kGeneratorBankSmoothing;
+      }
+      for (size_t j = 0; j < kGeneratorBankLaneSize; ++j) {
+        size_t i = base + j;
+        phase_increment_[i] = ComputePhaseIncrement(smoothed_pitch_[i]);
+        uint16_t shape = static_cast<uint16_t>(smoothed_shape_[i] + 32768);
+        shape = (shape >> 2) * 3;
+        wave_index_[i] = WAV_REVERSED_CONTROL + (shape >> 13);
+        shape_xfade_[i] = shape << 3;
+      }
+      // The divisions are only done when the slope has moved.
+      for (size_t j = 0; j < kGeneratorBankLaneSize; ++j) {
+        size_t i = base + j;
+        if (smoothed_slope_[i] == previous_slope_[i]) {
+          continue;
+        }
+        uint32_t slope_offset = stmlib::Interpolate88(
+            lut_slope_compression, smoothed_slope_[i] + 32768);
+        if (slope_offset <= 1) {
+          decay_factor_[i] = 32768 << kSlopeBits;
+          attack_factor_[i] = 1 << (kSlopeBits - 1);
+        } else {
+          decay_factor_[i] = (32768 << kSlopeBits) / slope_offset;
+          attack_factor_[i] = (32768 << kSlopeBits) / (65536 - slope_offset);
+        }
+        end_of_attack_[i] = slope_offset << 16;
+        previous_slope_[i] = smoothed_slope_[i];
+      }
+    }
+  }
+  
+  template<GeneratorMode mode>
+  void Render(
+      size_t index,
+      uint16_t* unipolar,
+      int16_t* bipolar,
+      size_t size) {
+    const int16_t* shape_1 = waveform_table[wave_index_[index]];
+    const int16_t* shape_2 = waveform_table[wave_index_[index] + 1];
+    uint16_t shape_xfade = shape_xfade_[index];
+    uint32_t phase = phase_[index];
+    uint32_t phase_increment = phase_increment_[index];
+    uint32_t end_of_attack = end_of_attack_[index];
+    uint32_t attack_factor = attack_factor_[index];
+    uint32_t decay_factor = decay_factor_[index];
+    uint8_t state = state_[index];
+    bool running = state & GENERATOR_BANK_RUNNING;
+    bool gate = state & GENERATOR_BANK_GATE;
+    bool wrap = state & GENERATOR_BANK_WRAP;
+    
+    if (state & GENERATOR_BANK_TRIGGER) {
+      phase = 0;
+      running = true;
+      wrap = false;
+    }
+    
+    while (size--) {
+      if (mode != GENERATOR_MODE_LOOPING && wrap) {
+        running = false;
+        phase = 0;
+      }
+      
+      uint32_t skewed_phase;
+      if (phase <= end_of_attack) {
+        skewed_phase = (phase >> kSlopeBits) * decay_factor;
+      } else {
+        skewed_phase = ((phase - end_of_attack) >> kSlopeBits) * attack_factor;
+        skewed_phase += 1L << 31;
+      }
+      
+      bool sustained = mode == GENERATOR_MODE_AR
+          && phase >= end_of_attack
+          && gate;
+      if (sustained) {
+        skewed_phase = 1L << 31;
+        phase = end_of_attack + 1;
+      }
+      
+      *unipolar++ = stmlib::Crossfade115(
+          shape_1,
+          shape_2,
+          skewed_phase >> 16, shape_xfade);
+      int16_t b = stmlib::Crossfade115(
+          shape_1,
+          shape_2,
+          skewed_phase >> 15, shape_xfade);
+      *bipolar++ = skewed_phase >= (1UL << 31) ? -b : b;
+      
+      if (running && !sustained) {
+        phase += phase_increment;
+        wrap = phase < phase_increment;
+      } else {
+        wrap = false;
+      }
+    }
+    
+    phase_[index] = phase;
+    state &= GENERATOR_BANK_GATE;
+    if (running) {
+      state |= GENERATOR_BANK_RUNNING;
+    }
+    if (wrap) {
+      state |= GENERATOR_BANK_WRAP;
+    }
+    state_[index] = state;
+  }
+  
+  size_t num_generators_;
+  int16_t pitch_offset_;
+  uint32_t clock_divider_;
+  
+  uint32_t phase_[kCapacity];
+  uint32_t phase_increment_[kCapacity];
+  uint32_t end_of_attack_[kCapacity];
+  uint32_t attack_factor_[kCapacity];
+  uint32_t decay_factor_[kCapacity];
+  
+  int32_t pitch_[kCapacity];
+  int32_t shape_[kCapacity];
+  int32_t slope_[kCapacity];
+  int32_t smoothed_pitch_[kCapacity];
+  int32_t smoothed_shape_[kCapacity];
+  int32_t smoothed_slope_[kCapacity];
+  int32_t previous_slope_[kCapacity];
+  
+  uint16_t shape_xfade_[kCapacity];
+  uint8_t wave_index_[kCapacity];
+  uint8_t mode_[kCapacity];
+  uint8_t state_[kCapacity];
+  
+  DISALLOW_COPY_AND_ASSIGN(GeneratorBank);
+};
+
+}  // namespace tides
+
+#endif  // TIDES_GENERATOR_BANK_H_
@@ -13,18 +13,23 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 #include <cstring>
 #include <cstdlib>
+#include <ctime>
 
 #include "tides/generator.h"
+#include "tides/generator_bank.h"
 
 using namespace tides;
 using namespace stmlib;
 
 const uint32_t kSampleRate = 48000;
 
+WavetableMipmapCache wavetable_cache;
+
 struct StereoSample {
   uint16_t l, r;
   
@@ -73,8 +78,248 @@ void write_wav_header(FILE* fp, int num_samples, int num_channels) {
   fwrite(&l, 4, 1, fp);
 }
 
+void BenchmarkWavetable() {
+  const uint32_t kNumSamples = kSampleRate * 10;
+  const char* names[] = { "audio rate", "wavetable" };
+  for (int32_t wavetable = 0; wavetable < 2; ++wavetable) {
+    Generator g;
+    g.Init();
+    g.set_range(GENERATOR_RANGE_HIGH);
+    g.set_mode(GENERATOR_MODE_LOOPING);
+    g.set_wavetable(wavetable);
+    g.set_wavetable_cache(&wavetable_cache);
+    g.set_shape(8192);
+    g.set_slope(-4096);
+    g.set_smoothness(0);
+    g.set_sync(false);
+    
+    int32_t checksum = 0;
+    clock_t start = clock();
+    for (uint32_t i = 0; i < kNumSamples; ++i) {
+      g.set_pitch((24 << 7) + (i >> 6) % (84 << 7));
+      checksum += g.Process(0).bipolar;
+      g.Process();
+    }
+    clock_t end = clock();
+    double seconds = static_cast<double>(end - start) / CLOCKS_PER_SEC;
+    printf("%s: %.3fs for 10s of audio (%d)\n",
+        names[wavetable], seconds, checksum);
+  }
+}
+
+bool TestWavetableNegativeSlope() {
+  // A negative slope puts the x coordinate in the upper half of its range.
+  // The crossfade between columns must not overshoot and wrap the output.
+  bool pass = true;
+  for (int32_t shape = -32768; shape < 32768; shape += 8192) {
+    Generator g;
+    g.Init();
+    g.set_range(GENERATOR_RANGE_HIGH);
+    g.set_mode(GENERATOR_MODE_LOOPING);
+    g.set_wavetable(true);
+    g.set_wavetable_cache(&wavetable_cache);
+    g.set_shape(shape);
+    g.set_slope(-4096);
+    g.set_smoothness(0);
+    g.set_sync(false);
+    g.set_pitch(48 << 7);
+    
+    int32_t previous = 0;
+    int32_t max_step = 0;
+    for (uint32_t i = 0; i < kSampleRate; ++i) {
+      int32_t s = g.Process(0).bipolar;
+      g.Process();
+      if (i && abs(s - previous) > max_step) {
+        max_step = abs(s - previous);
+      }
+      previous = s;
+    }
+    if (max_step >= 32768) {
+      printf("wavetable: output wraps at shape %d (step %d)\n",
+          shape, max_step);
+      pass = false;
+    }
+  }
+  return pass;
+}
+
+bool TestFastLock() {
+  // Clock edges with a non-integer period, reported with their sub-sample
+  // timestamps. With a ramp and a 1:1 frequency ratio, the unipolar output
+  // reads the phase, which must follow the clock from the second edge on.
+  const double periods[] = { 37.9, 100.37, 1234.56 };
+  const double first_edge = 37.61;
+  const size_t latency = kNumBlocks * kBlockSize;
+  bool pass = true;
+  for (size_t i = 0; i < sizeof(periods) / sizeof(double); ++i) {
+    Generator g;
+    g.Init();
+    g.set_range(GENERATOR_RANGE_MEDIUM);
+    g.set_mode(GENERATOR_MODE_LOOPING);
+    g.set_sync(true);
+    g.set_sync_mode(GENERATOR_SYNC_MODE_FAST_LOCK);
+    g.set_pitch(36 << 7);
+    g.set_shape(0);
+    g.set_slope(32767);
+    g.set_smoothness(0);
+    g.set_filter_bypass(true);
+    
+    const double period = periods[i];
+    uint32_t num_edges = 0;
+    double max_error = 0.0;
+    for (uint32_t j = 0; j < first_edge + 8 * period + latency; ++j) {
+      double edge = first_edge + num_edges * period;
+      uint8_t control = 0;
+      uint8_t fraction = 0;
+      if (j >= edge) {
+        control = CONTROL_CLOCK_RISING;
+        fraction = static_cast<uint8_t>((j - edge) * 256.0);
+        ++num_edges;
+      }
+      double phase = g.Process(control, fraction).unipolar / 65536.0;
+      g.Process();
+      
+      // The output lags the input by one buffer.
+      double t = (static_cast<double>(j) - latency - first_edge) / period;
+      if (t < 1.0) {
+        continue;
+      }
+      double error = phase - (t - floor(t));
+      error = fabs(error - floor(error + 0.5));
+      if (error > max_error) {
+        max_error = error;
+      }
+    }
+    if (max_error > 0.001) {
+      printf("fast lock: phase error %f at period %f\n", max_error, period);
+      pass = false;
+    }
+  }
+  return pass;
+}
+
+const size_t kNumBankGenerators = 8;
+const size_t kBankBlockSize = 16;
+
+void ConfigureBank(
+    Generator* generators,
+    GeneratorBank<kNumBankGenerators>* bank) {
+  bank->Init(kNumBankGenerators, GENERATOR_RANGE_MEDIUM);
+  for (size_t i = 0; i < kNumBankGenerators; ++i) {
+    int16_t pitch = (48 << 7) + i * 700;
+    int16_t shape = -30000 + i * 8000;
+    int16_t slope = -28000 + i * 7000;
+    Generator* g = &generators[i];
+    g->Init();
+    g->set_range(GENERATOR_RANGE_MEDIUM);
+    g->set_mode(GENERATOR_MODE_LOOPING);
+    g->set_pitch(pitch);
+    g->set_shape(shape);
+    g->set_slope(slope);
+    g->set_smoothness(0);
+    g->set_filter_bypass(true);
+    bank->set_pitch(i, pitch);
+    bank->set_shape(i, shape);
+    bank->set_slope(i, slope);
+  }
+}
+
+bool TestGeneratorBank() {
+  // Once the parameters have settled, both are retriggered on the same sample.
+  // From then on, the bank must render the same waveforms as the generators,
+  // which are delayed by one buffer.
+  const uint32_t kStart = kSampleRate / 10;
+  const size_t latency = kNumBlocks * kBlockSize;
+  static Generator generators[kNumBankGenerators];
+  static GeneratorBank<kNumBankGenerators> bank;
+  static int16_t bank_output[kNumBankGenerators][kSampleRate];
+  ConfigureBank(generators, &bank);
+  
+  uint16_t unipolar[kNumBankGenerators * kBankBlockSize];
+  int16_t bipolar[kNumBankGenerators * kBankBlockSize];
+  for (uint32_t i = 0; i < kSampleRate; i += kBankBlockSize) {
+    if (i == kStart) {
+      for (size_t j = 0; j < kNumBankGenerators; ++j) {
+        bank.Trigger(j);
+      }
+    }
+    bank.Process(unipolar, bipolar, kBankBlockSize);
+    for (size_t j = 0; j < kNumBankGenerators; ++j) {
+      std::copy(
+          &bipolar[j * kBankBlockSize],
+          &bipolar[(j + 1) * kBankBlockSize],
+          &bank_output[j][i]);
+    }
+  }
+  
+  bool pass = true;
+  for (size_t j = 0; j < kNumBankGenerators; ++j) {
+    int32_t max_error = 0;
+    int64_t total_error = 0;
+    for (uint32_t i = 0; i < kSampleRate + latency; ++i) {
+      uint8_t control = i == kStart ? CONTROL_GATE_RISING : 0;
+      int32_t s = generators[j].Process(control).bipolar;
+      generators[j].Process();
+      if (i >= kStart + latency) {
+        int32_t error = abs(s - bank_output[j][i - latency]);
+        max_error = error > max_error ? error : max_error;
+        total_error += error;
+      }
+    }
+    int32_t mean_error = total_error / (kSampleRate - kStart);
+    if (max_error >= 1024 || mean_error >= 64) {
+      printf("bank: generator %d differs (max %d, mean %d)\n",
+          static_cast<int>(j), max_error, mean_error);
+      pass = false;
+    }
+  }
+  return pass;
+}
+
+void BenchmarkGeneratorBank() {
+  const uint32_t kNumSamples = kSampleRate * 10;
+  static Generator generators[kNumBankGenerators];
+  static GeneratorBank<kNumBankGenerators> bank;
+  ConfigureBank(generators, &bank);
+  
+  int32_t checksum = 0;
+  clock_t start = clock();
+  for (uint32_t i = 0; i < kNumSamples; ++i) {
+    for (size_t j = 0; j < kNumBankGenerators; ++j) {
+      checksum += generators[j].Process(0).bipolar;
+      generators[j].Process();
+    }
+  }
+  clock_t end = clock();
+  double seconds = static_cast<double>(end - start) / CLOCKS_PER_SEC;
+  printf("%d generators: %.3fs for 10s of audio (%d)\n",
+      static_cast<int>(kNumBankGenerators), seconds, checksum);
+  
+  uint16_t unipolar[kNumBankGenerators * kBankBlockSize];
+  int16_t bipolar[kNumBankGenerators * kBankBlockSize];
+  checksum = 0;
+  start = clock();
+  for (uint32_t i = 0; i < kNumSamples; i += kBankBlockSize) {
+    bank.Process(unipolar, bipolar, kBankBlockSize);
+    for (size_t j = 0; j < kNumBankGenerators; ++j) {
+      checksum += bipolar[j * kBankBlockSize];
+    }
+  }
+  end = clock();
+  seconds = static_cast<double>(end - start) / CLOCKS_PER_SEC;
+  printf("bank of %d: %.3fs for 10s of audio (%d)\n",
+      static_cast<int>(kNumBankGenerators), seconds, checksum);
+}
 
 int main(void) {
+  if (!TestWavetableNegativeSlope() ||
+      !TestFastLock() ||
+      !TestGeneratorBank()) {
+    return 1;
+  }
+  BenchmarkWavetable();
+  BenchmarkGeneratorBank();
+  
   FILE* fp = fopen("lfo.wav", "wb");
   write_wav_header(fp, kSampleRate * 10, 2);
   
@@ -90,7 +335,7 @@ int main(void) {
       int32_t max = 0;
       for (uint32_t k = 0; k < kSampleRate; ++k) {
         GeneratorSample s = g.Process(0);
-        g.FillBufferSafe();
+        g.Process();
         if (s.bipolar < min) {
           min = s.bipolar;
         } else if (s.bipolar > max) {
@@ -140,6 +385,6 @@ int main(void) {
     // StereoSample s = StereoSample(g.Process(control * 0));
     TriggerPair s = TriggerPair(g.Process(control));
     fwrite(&s, sizeof(s), 1, fp);
-    g.FillBufferSafe();
+    g.Process();
   }  
 }
@@ -43,6 +43,9 @@ Dac dac;
 GateOutput gate_output;
 GateInput gate_input;
 Generator generator;
+#ifdef WAVETABLE_HACK
+WavetableMipmapCache wavetable_cache;
+#endif  // WAVETABLE_HACK
 Plotter plotter;
 System sys;
 Ui ui;
@@ -141,6 +144,9 @@ void Init() {
   gate_output.Init();
   gate_input.Init();
   generator.Init();
+#ifdef WAVETABLE_HACK
+  generator.set_wavetable_cache(&wavetable_cache);
+#endif  // WAVETABLE_HACK
   plotter.Init(plotter_program, sizeof(plotter_program) / sizeof(PlotInstruction));
   ui.Init(&generator, &cv_scaler);
   sys.StartTimers();
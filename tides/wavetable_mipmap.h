@@ -0,0 +1,179 @@
+// Copyright 2013 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Per-wave pitch-dependent band limiting for the wavetable mode.
+//
+// Each of the 256-sample waves in wt_waves is stored in flash with a full
+// spectrum (harmonics up to 128), which only stays below Nyquist for pitches
+// under 48000 / 256 Hz. Above that, the generator reads a reduced copy of the
+// wave: copy n has 256 >> n samples, harmonics up to 128 >> n, and is
+// obtained from copy n - 1 by a half-band lowpass and 2:1 decimation. The
+// copies are computed when a wave is first read at a high pitch and kept in a
+// small least-recently-used cache, since the bilinear morphing only ever
+// touches the 4 waves at the corners of the current cell of the 8x8 grid.
+//
+// Like the waves in flash, every copy ends with a duplicate of its first
+// sample, so Interpolate824(copy, phase >> n) reads it without wrapping.
+
+#ifndef TIDES_WAVETABLE_MIPMAP_H_
+#define TIDES_WAVETABLE_MIPMAP_H_
+
+#include "stmlib/stmlib.h"
+
+#include "tides/resources.h"
+
+namespace tides {
+
+const size_t kWavetableSizeBits = 8;
+const size_t kWavetableSize = 1 << kWavetableSizeBits;
+const size_t kWavetableStride = kWavetableSize + 1;
+const size_t kNumWavetableMipmapLevels = 6;
+
+// Storage for copies 1 to 5 of a wave: 128 + 64 + 32 + 16 + 8 samples, plus
+// the guard sample of each copy.
+const size_t kWavetableMipmapSize = kWavetableSize - \
+    (kWavetableSize >> (kNumWavetableMipmapLevels - 1)) + \
+    kNumWavetableMipmapLevels - 1;
+
+// When x or y crosses a cell boundary, the new cell shares 2 corners with the
+// previous one. 6 slots hold both cells, so scanning back and forth across a
+// boundary does not rebuild anything.
+const size_t kNumWavetableCacheSlots = 6;
+
+// 15-tap half-band lowpass (Kaiser-windowed sinc, beta = 7). Only the taps at
+// odd distances from the center are listed; the center tap is 1/2 and the
+// other even taps are 0. 15-bit fixed point, unity gain at DC.
+const size_t kWavetableHalfBandTapsSize = 4;
+const int32_t kWavetableHalfBandTaps[kWavetableHalfBandTapsSize] = {
+  9759, -1866, 308, -9
+};
+
+class WavetableMipmapCache {
+ public:
+  WavetableMipmapCache() { }
+  ~WavetableMipmapCache() { }
+  
+  void Init() {
+    for (size_t i = 0; i < kNumWavetableCacheSlots; ++i) {
+      wave_[i] = 0xffff;
+      last_use_[i] = 0;
+    }
+    time_ = 0;
+  }
+  
+  // Returns copies 1 to 5 of a wave, computing them if the wave is not
+  // already in the cache.
+  const int16_t* Load(uint16_t wave) {
+    ++time_;
+    size_t victim = 0;
+    for (size_t i = 0; i < kNumWavetableCacheSlots; ++i) {
+      if (wave_[i] == wave) {
+        last_use_[i] = time_;
+        return mipmaps_[i];
+      }
+      if (last_use_[i] < last_use_[victim]) {
+        victim = i;
+      }
+    }
+    wave_[victim] = wave;
+    last_use_[victim] = time_;
+    Build(wt_waves + wave * kWavetableStride, mipmaps_[victim]);
+    return mipmaps_[victim];
+  }
+  
+  // Harmonic 128 >> n of a wave played with this phase increment is below
+  // Nyquist when phase_increment >> 24 < 1 << n. The copy to read is thus
+  // given by the number of significant bits in phase_increment >> 24.
+  static inline size_t ComputeLevel(uint32_t phase_increment) {
+    uint32_t octaves = phase_increment >> (32 - kWavetableSizeBits);
+    size_t level = 0;
+    while (octaves) {
+      octaves >>= 1;
+      ++level;
+    }
+    return level < kNumWavetableMipmapLevels
+        ? level
+        : kNumWavetableMipmapLevels - 1;
+  }
+  
+  // Copy 0 is the wave in flash; copy n > 0 starts after copies 1 to n - 1.
+  static inline const int16_t* Level(
+      const int16_t* wave,
+      const int16_t* mipmap,
+      size_t level) {
+    if (level == 0) {
+      return wave;
+    }
+    size_t offset = kWavetableSize - (kWavetableSize >> (level - 1));
+    return mipmap + offset + level - 1;
+  }
+  
+ private:
+  // Half-band filters and decimates the periodic wave at source (size
+  // samples) into destination (size / 2 samples, plus the guard sample).
+  static void Decimate(
+      const int16_t* source,
+      size_t size,
+      int16_t* destination) {
+    size_t mask = size - 1;
+    int16_t* first = destination;
+    for (size_t i = 0; i < size; i += 2) {
+      int32_t sum = static_cast<int32_t>(source[i]) << 14;
+      size_t distance = 1;
+      for (size_t tap = 0; tap < kWavetableHalfBandTapsSize; ++tap) {
+        int32_t pair = source[(i + distance) & mask];
+        pair += source[(i - distance) & mask];
+        sum += kWavetableHalfBandTaps[tap] * pair;
+        distance += 2;
+      }
+      sum >>= 15;
+      CLIP(sum)
+      *destination++ = sum;
+    }
+    *destination = *first;
+  }
+  
+  void Build(const int16_t* wave, int16_t* mipmap) {
+    size_t size = kWavetableSize;
+    for (size_t level = 1; level < kNumWavetableMipmapLevels; ++level) {
+      int16_t* copy = mipmap + (kWavetableSize - size) + level - 1;
+      Decimate(wave, size, copy);
+      wave = copy;
+      size >>= 1;
+    }
+  }
+  
+  int16_t mipmaps_[kNumWavetableCacheSlots][kWavetableMipmapSize];
+  uint16_t wave_[kNumWavetableCacheSlots];
+  uint32_t last_use_[kNumWavetableCacheSlots];
+  uint32_t time_;
+  
+  DISALLOW_COPY_AND_ASSIGN(WavetableMipmapCache);
+};
+
+}  // namespace tides
+
+#endif  // TIDES_WAVETABLE_MIPMAP_H_
@@ -0,0 +1,115 @@
+// Copyright 2013 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Timestamped MIDI events, and a single-producer single-consumer queue to
+// pass them from the main loop (which parses the MIDI stream) to the CV/gate
+// refresh interrupt (which applies them).
+
+#ifndef YARNS_MIDI_EVENT_QUEUE_H_
+#define YARNS_MIDI_EVENT_QUEUE_H_
+
+#include "stmlib/stmlib.h"
+
+namespace yarns {
+
+enum MidiEventType {
+  MIDI_EVENT_NOTE_ON,
+  MIDI_EVENT_NOTE_OFF,
+  MIDI_EVENT_AFTERTOUCH,
+  MIDI_EVENT_CHANNEL_AFTERTOUCH,
+  MIDI_EVENT_CONTROL_CHANGE,
+  MIDI_EVENT_PITCH_BEND,
+  MIDI_EVENT_CLOCK,
+  MIDI_EVENT_START,
+  MIDI_EVENT_CONTINUE,
+  MIDI_EVENT_STOP,
+  MIDI_EVENT_RESET
+};
+
+// Timestamps are expressed in CV/gate refresh ticks (8kHz), and wrap around.
+struct TimestampedMidiByte {
+  uint16_t timestamp;
+  uint8_t byte;
+};
+
+struct MidiEvent {
+  uint16_t timestamp;
+  uint8_t type;
+  uint8_t channel;
+  uint8_t data[2];
+};
+
+template<size_t size>
+class MidiEventQueue {
+ public:
+  MidiEventQueue() { }
+  ~MidiEventQueue() { }
+  
+  void Init() {
+    read_ptr_ = write_ptr_ = 0;
+  }
+  
+  inline bool readable() const {
+    return read_ptr_ != write_ptr_;
+  }
+  
+  inline bool writable() const {
+    return ((write_ptr_ + 1) % size) != read_ptr_;
+  }
+  
+  // Called by the producer only. Events are dropped when the queue is full,
+  // rather than overwriting events the consumer might be reading.
+  inline bool Push(const MidiEvent& event) {
+    size_t w = write_ptr_;
+    size_t next = (w + 1) % size;
+    if (next == read_ptr_) {
+      return false;
+    }
+    events_[w] = event;
+    write_ptr_ = next;
+    return true;
+  }
+  
+  // Called by the consumer only.
+  inline const MidiEvent& Peek() const {
+    return events_[read_ptr_];
+  }
+  
+  inline void Pop() {
+    read_ptr_ = (read_ptr_ + 1) % size;
+  }
+  
+ private:
+  MidiEvent events_[size];
+  volatile size_t read_ptr_;
+  volatile size_t write_ptr_;
+  
+  DISALLOW_COPY_AND_ASSIGN(MidiEventQueue);
+};
+
+}  // namespace yarns
+
+#endif // YARNS_MIDI_EVENT_QUEUE_H_
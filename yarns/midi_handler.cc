@@ -40,7 +40,7 @@ namespace yarns {
 using namespace std;
 
 /* static */
-MidiHandler::MidiBuffer MidiHandler::input_buffer_; 
+MidiHandler::MidiInputBuffer MidiHandler::input_buffer_; 
 
 /* static */
 MidiHandler::MidiBuffer MidiHandler::output_buffer_;
@@ -48,9 +48,33 @@ MidiHandler::MidiBuffer MidiHandler::output_buffer_;
 /* static */
 MidiHandler::SmallMidiBuffer MidiHandler::high_priority_output_buffer_;
 
+/* static */
+MidiHandler::MidiBuffer MidiHandler::dispatch_output_buffer_;
+
+/* static */
+MidiHandler::SmallMidiBuffer MidiHandler::dispatch_high_priority_output_buffer_;
+
 /* static */
 stmlib_midi::MidiStreamParser<MidiHandler> MidiHandler::parser_;
 
+/* static */
+MidiEventQueue<kMidiEventQueueSize> MidiHandler::event_queue_;
+
+/* static */
+volatile uint16_t MidiHandler::tick_;
+
+/* static */
+volatile uint16_t MidiHandler::idle_ticks_;
+
+/* static */
+uint16_t MidiHandler::event_timestamp_;
+
+/* static */
+volatile bool MidiHandler::locked_;
+
+/* static */
+bool MidiHandler::dispatching_;
+
 /* static */
 const MidiHandler::SysExDescription MidiHandler::accepted_sysex_[] = {
   { { 0xf0, 0x00, 0x21, 0x02, 0x00, 0x0b }, 6, 0xff,
@@ -88,6 +112,14 @@ void MidiHandler::Init() {
   input_buffer_.Init();
   output_buffer_.Init();
   high_priority_output_buffer_.Init();
+  dispatch_output_buffer_.Init();
+  dispatch_high_priority_output_buffer_.Init();
+  event_queue_.Init();
+  tick_ = 0;
+  idle_ticks_ = 0;
+  event_timestamp_ = 0;
+  locked_ = false;
+  dispatching_ = false;
   sysex_rx_write_ptr_ = 0;
   previous_packet_index_ = 0;
   calibration_voice_ = 0xff;
@@ -95,6 +127,98 @@ void MidiHandler::Init() {
   factory_testing_requested_ = false;
 }
 
+/* static */
+void MidiHandler::DispatchEvents() {
+  size_t num_events = 0;
+  while (event_queue_.readable() && num_events < kMaxEventsPerTick) {
+    const MidiEvent& e = event_queue_.Peek();
+    int16_t delay = static_cast<int16_t>(tick_ - e.timestamp);
+    if (delay < static_cast<int16_t>(kMidiEventLatency) && delay >= 0) {
+      break;
+    }
+    ApplyEvent(e);
+    event_queue_.Pop();
+    ++num_events;
+  }
+}
+
+/* static */
+void MidiHandler::ApplyEvent(const MidiEvent& e) {
+  uint8_t channel = e.channel;
+  switch (e.type) {
+    case MIDI_EVENT_NOTE_ON:
+      if (multi.NoteOn(channel, e.data[0], e.data[1]) &&
+          !multi.direct_thru()) {
+        Send3(0x90 | channel, e.data[0], e.data[1]);
+      }
+      break;
+      
+    case MIDI_EVENT_NOTE_OFF:
+      if (multi.NoteOff(channel, e.data[0], e.data[1]) &&
+          !multi.direct_thru()) {
+        Send3(0x80 | channel, e.data[0], 0);
+      }
+      break;
+
+    case MIDI_EVENT_AFTERTOUCH:
+      if (multi.Aftertouch(channel, e.data[0], e.data[1]) &&
+          !multi.direct_thru()) {
+        Send3(0xa0 | channel, e.data[0], e.data[1]);
+      }
+      break;
+
+    case MIDI_EVENT_CHANNEL_AFTERTOUCH:
+      if (multi.Aftertouch(channel, e.data[0]) && !multi.direct_thru()) {
+        Send2(0xd0 | channel, e.data[0]);
+      }
+      break;
+
+    case MIDI_EVENT_CONTROL_CHANGE:
+      if (multi.ControlChange(channel, e.data[0], e.data[1]) &&
+          !multi.direct_thru()) {
+        Send3(0xb0 | channel, e.data[0], e.data[1]);
+      }
+      break;
+
+    case MIDI_EVENT_PITCH_BEND:
+      {
+        uint16_t pitch_bend = (e.data[0] << 7) | e.data[1];
+        if (multi.PitchBend(channel, pitch_bend) && !multi.direct_thru()) {
+          Send3(0xe0 | channel, e.data[0], e.data[1]);
+        }
+      }
+      break;
+
+    case MIDI_EVENT_CLOCK:
+      if (!multi.internal_clock()) {
+        multi.Clock();
+      }
+      break;
+
+    case MIDI_EVENT_START:
+      if (!multi.internal_clock()) {
+        multi.Start(false);
+      }
+      break;
+
+    case MIDI_EVENT_CONTINUE:
+      if (!multi.internal_clock()) {
+        multi.Continue();
+      }
+      break;
+
+    case MIDI_EVENT_STOP:
+      if (!multi.internal_clock()) {
+        multi.Stop();
+      }
+      break;
+
+    case MIDI_EVENT_RESET:
+      multi.Reset();
+      break;
+  }
+}
+
 /* static */
 void MidiHandler::DecodeSysExMessage() {
   uint8_t length = sysex_rx_write_ptr_;
@@ -34,6 +34,7 @@
 #include "stmlib/utils/ring_buffer.h"
 #include "stmlib/midi/midi.h"
 
+#include "yarns/midi_event_queue.h"
 #include "yarns/multi.h"
 
 namespace yarns {
@@ -41,9 +42,27 @@ namespace yarns {
 const size_t kSysexMaxChunkSize = 64;
 const size_t kSysexRxBufferSize = kSysexMaxChunkSize * 2 + 16;
 
+// Delay between the reception of the last byte of a message and the refresh
+// tick at which it is applied, in ticks. This leaves time to the main loop to
+// parse the message, so that the latency is constant rather than dependent on
+// the main loop load.
+const uint16_t kMidiEventLatency = 8;
+const size_t kMidiEventQueueSize = 64;
+
+// Maximum number of events applied by a single refresh tick, to bound the time
+// spent in the interrupt to that of a single event. At 8 events per ms, a
+// backlog is drained much faster than the MIDI input can fill it.
+const size_t kMaxEventsPerTick = 1;
+
+// Time without any MIDI input (other than real-time messages) after which
+// flash operations which block the CPU for a long time (page erasures) are
+// allowed. 0.5s.
+const uint16_t kMidiIdleTicks = 4000;
+
 class MidiHandler {
  public:
   typedef stmlib::RingBuffer<uint8_t, 128> MidiBuffer;
+  typedef stmlib::RingBuffer<TimestampedMidiByte, 128> MidiInputBuffer;
   typedef stmlib::RingBuffer<uint8_t, 32> SmallMidiBuffer;
    
   MidiHandler() { }
@@ -51,37 +70,29 @@ class MidiHandler {
   
   static void Init();
   
+  // The channel messages are parsed in the main loop, and applied to the multi
+  // from the refresh interrupt, at a fixed delay after their reception.
   static void NoteOn(uint8_t channel, uint8_t note, uint8_t velocity) {
-    if (multi.NoteOn(channel, note, velocity) && !multi.direct_thru()) {
-      Send3(0x90 | channel, note, velocity);
-    }
+    PostEvent(MIDI_EVENT_NOTE_ON, channel, note, velocity);
   }
   
   static void NoteOff(uint8_t channel, uint8_t note, uint8_t velocity) {
-    if (multi.NoteOff(channel, note, velocity) && !multi.direct_thru()) {
-      Send3(0x80 | channel, note, 0);
-    }
+    PostEvent(MIDI_EVENT_NOTE_OFF, channel, note, velocity);
   }
   
   static void Aftertouch(uint8_t channel, uint8_t note, uint8_t velocity) {
-    if (multi.Aftertouch(channel, note, velocity) && !multi.direct_thru()) {
-      Send3(0xa0 | channel, note, velocity);
-    }
+    PostEvent(MIDI_EVENT_AFTERTOUCH, channel, note, velocity);
   }
   
   static void Aftertouch(uint8_t channel, uint8_t velocity) {
-    if (multi.Aftertouch(channel, velocity) && !multi.direct_thru()) {
-      Send2(0xd0 | channel, velocity);
-    }
+    PostEvent(MIDI_EVENT_CHANNEL_AFTERTOUCH, channel, velocity, 0);
   }
   
   static void ControlChange(
       uint8_t channel,
       uint8_t controller,
       uint8_t value) {
-    if (multi.ControlChange(channel, controller, value) && !multi.direct_thru()) {
-      Send3(0xb0 | channel, controller, value);
-    }
+    PostEvent(MIDI_EVENT_CONTROL_CHANGE, channel, controller, value);
   }
   
   static void ProgramChange(uint8_t channel, uint8_t program) {
@@ -91,9 +102,11 @@ class MidiHandler {
   }
   
   static void PitchBend(uint8_t channel, uint16_t pitch_bend) {
-    if (multi.PitchBend(channel, pitch_bend) && !multi.direct_thru()) {
-      Send3(0xe0 | channel, pitch_bend >> 7, pitch_bend & 0x7f);
-    }
+    PostEvent(
+        MIDI_EVENT_PITCH_BEND,
+        channel,
+        pitch_bend >> 7,
+        pitch_bend & 0x7f);
   }
 
   static void SysExStart() {
@@ -113,31 +126,23 @@ class MidiHandler {
   static void BozoByte(uint8_t bozo_byte) { }
 
   static void Clock() {
-    if (!multi.internal_clock()) {
-      multi.Clock();
-    }
+    PostEvent(MIDI_EVENT_CLOCK, 0, 0, 0);
   }
   
   static void Start() {
-    if (!multi.internal_clock()) {
-      multi.Start(false);
-    }
+    PostEvent(MIDI_EVENT_START, 0, 0, 0);
   }
   
   static void Continue() {
-    if (!multi.internal_clock()) {
-      multi.Continue();
-    }
+    PostEvent(MIDI_EVENT_CONTINUE, 0, 0, 0);
   }
   
   static void Stop() {
-    if (!multi.internal_clock()) {
-      multi.Stop();
-    }
+    PostEvent(MIDI_EVENT_STOP, 0, 0, 0);
   }
   
   static void Reset() {
-    multi.Reset();
+    PostEvent(MIDI_EVENT_RESET, 0, 0, 0);
   }
   
   static bool CheckChannel(uint8_t channel) { return true; }
@@ -181,30 +186,80 @@ class MidiHandler {
     SendNow(0xfc);
   }
   
+  // Called from the refresh interrupt.
   static void PushByte(uint8_t byte) {
-    input_buffer_.Overwrite(byte);
+    TimestampedMidiByte b;
+    b.timestamp = tick_;
+    b.byte = byte;
+    input_buffer_.Overwrite(b);
+    // Clock and active sensing bytes keep flowing from a connected device
+    // which is not playing anything.
+    if (byte < 0xf8) {
+      idle_ticks_ = 0;
+    }
   }
   
   static void ProcessInput() {
+    // The messages sent while dispatching events are complete, since they are
+    // written from the interrupt. Moving them from the main loop keeps it the
+    // only writer of output_buffer_.
+    while (dispatch_output_buffer_.readable()) {
+      output_buffer_.Overwrite(dispatch_output_buffer_.ImmediateRead());
+    }
     while (input_buffer_.readable()) {
-      parser_.PushByte(input_buffer_.ImmediateRead());
+      TimestampedMidiByte b = input_buffer_.ImmediateRead();
+      event_timestamp_ = b.timestamp;
+      parser_.PushByte(b.byte);
     }
   }
   
+  // Called from the refresh interrupt, before the multi is refreshed.
+  static void Tick() {
+    ++tick_;
+    if (idle_ticks_ < kMidiIdleTicks) {
+      ++idle_ticks_;
+    }
+    if (!locked_) {
+      dispatching_ = true;
+      DispatchEvents();
+      dispatching_ = false;
+    }
+  }
+  
+  // The main loop holds this lock while it modifies the state of the multi
+  // itself (UI, internal clock, SysEx messages decoded by ProcessInput).
+  // Events are then held until it is released.
+  static inline void Lock() { locked_ = true; }
+  static inline void Unlock() { locked_ = false; }
+  
+  static inline uint16_t tick() { return tick_; }
+  static inline bool idle() { return idle_ticks_ >= kMidiIdleTicks; }
+  
   static inline MidiBuffer* mutable_output_buffer() { return &output_buffer_; }
   static inline SmallMidiBuffer* mutable_high_priority_output_buffer() {
     return &high_priority_output_buffer_;
   }
+  static inline SmallMidiBuffer* mutable_dispatch_high_priority_output_buffer() {
+    return &dispatch_high_priority_output_buffer_;
+  }
 
+  // Each output buffer has a single writer: the main loop, or the event
+  // dispatcher in the refresh interrupt.
   static inline void Send3(uint8_t byte_1, uint8_t byte_2, uint8_t byte_3) {
-    output_buffer_.Overwrite(byte_1);
-    output_buffer_.Overwrite(byte_2);
-    output_buffer_.Overwrite(byte_3);
+    MidiBuffer* buffer = dispatching_
+        ? &dispatch_output_buffer_
+        : &output_buffer_;
+    buffer->Overwrite(byte_1);
+    buffer->Overwrite(byte_2);
+    buffer->Overwrite(byte_3);
   }
 
   static inline void Send2(uint8_t byte_1, uint8_t byte_2) {
-    output_buffer_.Overwrite(byte_1);
-    output_buffer_.Overwrite(byte_2);
+    MidiBuffer* buffer = dispatching_
+        ? &dispatch_output_buffer_
+        : &output_buffer_;
+    buffer->Overwrite(byte_1);
+    buffer->Overwrite(byte_2);
   }
 
   static inline void Send1(uint8_t byte) {
@@ -216,7 +271,11 @@ class MidiHandler {
   }
 
   static inline void SendNow(uint8_t byte) {
-    high_priority_output_buffer_.Overwrite(byte);
+    if (dispatching_) {
+      dispatch_high_priority_output_buffer_.Overwrite(byte);
+    } else {
+      high_priority_output_buffer_.Overwrite(byte);
+    }
   }
   
   typedef void (*SysExHandlerFn)();
@@ -251,6 +310,23 @@ class MidiHandler {
       const uint8_t* data,
       size_t size);
   static void DecodeSysExMessage();
+  
+  static inline void PostEvent(
+      MidiEventType type,
+      uint8_t channel,
+      uint8_t data_1,
+      uint8_t data_2) {
+    MidiEvent e;
+    e.timestamp = event_timestamp_;
+    e.type = type;
+    e.channel = channel;
+    e.data[0] = data_1;
+    e.data[1] = data_2;
+    event_queue_.Push(e);
+  }
+  
+  static void DispatchEvents();
+  static void ApplyEvent(const MidiEvent& e);
   inline static void ProcessSysExByte(uint8_t sysex_byte) {
     if (!multi.direct_thru()) {
       Send1(sysex_byte);
@@ -264,10 +340,19 @@ class MidiHandler {
   static void HandleScaleOctaveTuning2ByteForm();
   static void HandleYarnsSpecificMessage();
   
-  static MidiBuffer input_buffer_; 
+  static MidiInputBuffer input_buffer_; 
   static MidiBuffer output_buffer_; 
   static SmallMidiBuffer high_priority_output_buffer_;
+  static MidiBuffer dispatch_output_buffer_;
+  static SmallMidiBuffer dispatch_high_priority_output_buffer_;
   static stmlib_midi::MidiStreamParser<MidiHandler> parser_;
+  static MidiEventQueue<kMidiEventQueueSize> event_queue_;
+  
+  static volatile uint16_t tick_;
+  static volatile uint16_t idle_ticks_;
+  static uint16_t event_timestamp_;
+  static volatile bool locked_;
+  static bool dispatching_;
   
   static uint8_t sysex_rx_buffer_[kSysexRxBufferSize];
   static uint8_t sysex_rx_write_ptr_;
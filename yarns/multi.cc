@@ -63,6 +63,8 @@ void Multi::Init() {
   running_ = false;
   latched_ = false;
   recording_ = false;
+  playing_song_ = false;
+  setting_changes_ = 0;
   
   // Put the multi in a usable state. Even if these settings will later be
   // overriden with some data retrieved from Flash (presets).
@@ -96,6 +98,7 @@ void Multi::Init() {
   voicing->tuning_root = 0;
   voicing->tuning_system = 0;
   voicing->audio_mode = 0;
+  voicing->stealing_mode = VOICE_STEALING_MODE_OLDEST;
 
   SequencerSettings* seq = part_[0].mutable_sequencer_settings();
   seq->clock_division = 7;
@@ -158,12 +161,8 @@ void Multi::Clock() {
   if (!clock_input_prescaler_) {
     midi_handler.OnClock();
     
-    if (song_pointer_) {
-      ClockSong();
-    } else {
-      for (uint8_t i = 0; i < num_active_parts_; ++i) {
-        part_[i].Clock();
-      }
+    for (uint8_t i = 0; i < num_active_parts_; ++i) {
+      part_[i].Clock();
     }
     
     ++bar_position_;
@@ -216,7 +215,6 @@ void Multi::Start(bool started_by_keyboard) {
   for (uint8_t i = 0; i < num_active_parts_; ++i) {
     part_[i].Start(started_by_keyboard);
   }
-  song_pointer_ = NULL;
 }
 
 void Multi::Stop() {
@@ -233,7 +231,17 @@ void Multi::Stop() {
   running_ = false;
   latched_ = false;
   started_by_keyboard_ = false;
-  song_pointer_ = NULL;
+  for (uint8_t i = 0; i < kNumParts; ++i) {
+    part_[i].set_sequence(NULL);
+  }
+  if (playing_song_) {
+    for (uint8_t i = 0; i < kNumParts; ++i) {
+      SequencerSettings* seq = part_[i].mutable_sequencer_settings();
+      seq->clock_division = saved_clock_division_[i];
+      seq->gate_length = saved_gate_length_[i];
+    }
+    playing_song_ = false;
+  }
 }
 
 void Multi::Refresh() {
@@ -259,14 +267,23 @@ void Multi::Set(uint8_t address, uint8_t value) {
       ChangeLayout(
           static_cast<Layout>(previous_value),
           static_cast<Layout>(value));
-    } else if (address == MULTI_CLOCK_TEMPO) {
-      internal_clock_.set_tempo(settings_.clock_tempo);
-    } else if (address == MULTI_CLOCK_SWING) {
-      internal_clock_.set_swing(settings_.clock_swing);
+    } else if (address == MULTI_CLOCK_TEMPO || address == MULTI_CLOCK_SWING) {
+      setting_changes_ |= MULTI_SETTING_CHANGE_CLOCK;
     }
   }
 }
 
+void Multi::ApplySettingChanges() {
+  if (setting_changes_ & MULTI_SETTING_CHANGE_CLOCK) {
+    internal_clock_.set_tempo(settings_.clock_tempo);
+    internal_clock_.set_swing(settings_.clock_swing);
+  }
+  setting_changes_ = 0;
+  for (uint8_t i = 0; i < kNumParts; ++i) {
+    part_[i].ApplySettingChanges();
+  }
+}
+
 void Multi::GetCvGate(uint16_t* cv, bool* gate) {
   switch (settings_.layout) {
     case LAYOUT_MONO:
@@ -339,7 +356,7 @@ void Multi::GetCvGate(uint16_t* cv, bool* gate) {
         cv[1] = voice_[1].trigger_dac_code();
         cv[2] = voice_[2].trigger_dac_code();
         cv[3] = voice_[3].trigger_dac_code();
-        gate[0] = voice_[0].trigger() && ~voice_[1].gate();
+        gate[0] = voice_[0].trigger() && !voice_[1].gate();
         gate[1] = voice_[0].trigger() && voice_[1].gate();
         gate[2] = clock();
         gate[3] = reset_or_playing_flag();
@@ -401,6 +418,24 @@ bool Multi::GetAudioSource(uint8_t* audio_source) {
   return has_audio_source;
 }
 
+bool Multi::quiet() {
+  for (uint8_t i = 0; i < kNumVoices; ++i) {
+    if (voice_[i].gate_on()) {
+      return false;
+    }
+  }
+  uint8_t audio_source[4];
+  GetAudioSource(audio_source);
+  for (uint8_t i = 0; i < 4; ++i) {
+    // Unless the oscillator is gated, it keeps sounding after the gate is off.
+    if (audio_source[i] != 0xff &&
+        !(voice_[audio_source[i]].audio_mode() & 0x80)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void Multi::GetLedsBrightness(uint8_t* brightness) {
   if (layout_configurator_.learning()) {
     fill(&brightness[0], &brightness[kNumVoices], 0);
@@ -703,48 +738,31 @@ void Multi::Touch() {
 }
 
 
-const uint8_t song[] = {
-  #include "song/song.h"
-  255,
-};
+#include "song/song_sequences.h"
 
 void Multi::StartSong() {
+  Stop();
   Set(MULTI_LAYOUT, LAYOUT_QUAD_MONO);
   part_[0].mutable_voicing_settings()->audio_mode = 0x83;
   part_[1].mutable_voicing_settings()->audio_mode = 0x83;
   part_[2].mutable_voicing_settings()->audio_mode = 0x84;
   part_[3].mutable_voicing_settings()->audio_mode = 0x86;
+  for (uint8_t i = 0; i < kNumParts; ++i) {
+    // One step every 6 ticks, held until the next step.
+    SequencerSettings* seq = part_[i].mutable_sequencer_settings();
+    saved_clock_division_[i] = seq->clock_division;
+    saved_gate_length_[i] = seq->gate_length;
+    seq->clock_division = 7;
+    seq->gate_length = 6;
+  }
   UpdateLayout();
   settings_.clock_tempo = 140;
-  Stop();
   Start(false);
+  playing_song_ = true;
   
-  song_pointer_ = &song[0];
-  song_clock_ = 0;
-  song_delta_ = 0;
-}
-
-void Multi::ClockSong() {
-  while (song_clock_ >= song_delta_) {
-    if (*song_pointer_ == 255) {
-      song_pointer_ = &song[0];
-    }
-    if (*song_pointer_ == 254) {
-      song_delta_ += 6;
-    } else {
-      uint8_t part = *song_pointer_ >> 6;
-      uint8_t note = *song_pointer_ & 0x3f;
-      if (note == 0) {
-        part_[part].AllNotesOff();
-      } else {
-        part_[part].NoteOn(0, note + 24, 100);
-      }
-      song_clock_ = 0;
-      song_delta_ = 0;
-    }
-    ++song_pointer_;
+  for (uint8_t i = 0; i < kNumParts; ++i) {
+    part_[i].set_sequence(song_parts[i]);
   }
-  ++song_clock_;
 }
 
 bool Multi::ControlChange(uint8_t channel, uint8_t controller, uint8_t value) {
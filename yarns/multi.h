@@ -78,6 +78,10 @@ enum MultiSetting {
   MULTI_REMOTE_CONTROL_CHANNEL
 };
 
+enum MultiSettingChange {
+  MULTI_SETTING_CHANGE_CLOCK = 1
+};
+
 enum Layout {
   LAYOUT_MONO,
   LAYOUT_DUAL_MONO,
@@ -286,7 +290,15 @@ class Multi {
     }
   }
   
+  // Layout changes are applied immediately, since the settings of the parts
+  // are rewritten by a layout change, and may be written right after it. So
+  // are the part setting changes which release notes, since the note-ons
+  // which follow them must not be killed. The clock and voice parameters are
+  // recomputed by ApplySettingChanges(), called once per iteration of the
+  // main loop, so that a burst of setting changes (from remote control CCs
+  // for example) triggers a single recomputation.
   void Set(uint8_t address, uint8_t value);
+  void ApplySettingChanges();
   inline uint8_t Get(uint8_t address) const {
     const uint8_t* bytes;
     bytes = static_cast<const uint8_t*>(static_cast<const void*>(&settings_));
@@ -336,6 +348,9 @@ class Multi {
   
   void GetCvGate(uint16_t* cv, bool* gate);
   bool GetAudioSource(uint8_t* audio_source);
+  // Returns true when all gates are off and no audio output is sounding, so
+  // that stalling the main loop has no audible effect.
+  bool quiet();
   void GetLedsBrightness(uint8_t* brightness);
 
   template<typename T>
@@ -397,7 +412,6 @@ class Multi {
  private:
   void ChangeLayout(Layout old_layout, Layout new_layout);
   void UpdateLayout();
-  void ClockSong();
   void HandleRemoteControlCC(uint8_t controller, uint8_t value);
   
   MultiSettings settings_;
@@ -418,20 +432,22 @@ class Multi {
   uint16_t clock_pulse_counter_;
   uint16_t reset_pulse_counter_;
   
+  // Sequencer settings overridden by the song, restored when it stops.
+  bool playing_song_;
+  uint8_t saved_clock_division_[kNumParts];
+  uint8_t saved_gate_length_[kNumParts];
+  
   // Indicates that a setting has been changed and that the multi should
   // be saved in memory.
   bool dirty_;
   
   uint8_t num_active_parts_;
+  uint8_t setting_changes_;
   
   Part part_[kNumParts];
   Voice voice_[kNumVoices];
 
   LayoutConfigurator layout_configurator_;
-  
-  const uint8_t* song_pointer_;
-  uint32_t song_clock_;
-  uint8_t song_delta_;
 
   DISALLOW_COPY_AND_ASSIGN(Multi);
 };
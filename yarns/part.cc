@@ -61,7 +61,11 @@ void Part::Init() {
   polychained_ = false;
   ignore_note_off_messages_ = false;
   seq_recording_ = false;
+  seq_rec_slide_ = false;
+  seq_rec_full_ = false;
   seq_running_ = false;
+  sequence_reader_.Init(NULL);
+  setting_changes_ = 0;
   release_latched_keys_on_next_note_on_ = false;
 }
   
@@ -73,8 +77,8 @@ void Part::AllocateVoices(Voice* voice, uint8_t num_voices, bool polychain) {
   for (uint8_t i = 0; i < num_voices_; ++i) {
     voice_[i] = voice + i;
   }
-  poly_allocator_.Clear();
-  poly_allocator_.set_size(num_voices_ * (polychain ? 2 : 1));
+  poly_allocator_.set_size(
+      num_voices_ * (polychain ? kNumPolychainedUnits : 1));
   TouchVoices();
 }
 
@@ -94,7 +98,7 @@ bool Part::NoteOn(uint8_t channel, uint8_t note, uint8_t velocity) {
   }
   pressed_keys_.NoteOn(note, velocity);
   
-  if ((!(seq_.num_steps && seq_running_) && !seq_.arp_range)
+  if ((!sequencer_playing() && !seq_.arp_range)
       || sent_from_step_editor) {
     InternalNoteOn(note, velocity);
   }
@@ -119,7 +123,7 @@ bool Part::NoteOff(uint8_t channel, uint8_t note) {
   } else {
     pressed_keys_.NoteOff(note);
     
-    if ((!(seq_.num_steps && seq_running_) && !seq_.arp_range) ||
+    if ((!sequencer_playing() && !seq_.arp_range) ||
         sent_from_step_editor) {
       InternalNoteOff(note);
     }
@@ -200,7 +204,11 @@ bool Part::PitchBend(uint8_t channel, uint16_t pitch_bend) {
   
   if (seq_recording_ &&
       (pitch_bend > 8192 + 2048 || pitch_bend < 8192 - 2048)) {
-    seq_.step[seq_rec_step_].data[1] |= 0x80;
+    if (seq_.compact || seq_rec_step_ >= kNumSteps) {
+      seq_rec_slide_ = true;
+    } else {
+      seq_.step[seq_rec_step_].data[1] |= 0x80;
+    }
   }
   
   return midi_.out_mode != MIDI_OUT_MODE_OFF;
@@ -212,7 +220,7 @@ bool Part::Aftertouch(uint8_t channel, uint8_t note, uint8_t velocity) {
         voicing_.allocation_mode == VOICE_ALLOCATION_MODE_POLY ? \
         poly_allocator_.Find(note) : \
         FindVoiceForNote(note);
-    if (voice_index < poly_allocator_.size()) {
+    if (voice_index < num_voices_) {
       voice_[voice_index]->Aftertouch(velocity);
     }
   } else {
@@ -238,7 +246,7 @@ void Part::Reset() {
 
 void Part::Clock() {
   if (!arp_seq_prescaler_) {
-    if (seq_.num_steps && seq_running_) {
+    if (sequencer_playing()) {
       ClockSequencer();
     } else if (seq_.arp_range) {
       ClockArpeggiator();
@@ -271,6 +279,13 @@ void Part::Start(bool started_by_keyboard) {
 
   seq_step_ = 0;
   seq_running_ = !started_by_keyboard;
+  if (seq_.compact && !SequenceReader::Validate(
+          seq_.mutable_sequence(), sizeof(seq_.step))) {
+    // Corrupted settings: the steps hold neither a sequence nor steps.
+    seq_.compact = false;
+    seq_.num_steps = 0;
+  }
+  sequence_reader_.Init(seq_.compact ? seq_.mutable_sequence() : NULL);
   
   release_latched_keys_on_next_note_on_ = false;
   ignore_note_off_messages_ = false;
@@ -303,14 +318,82 @@ void Part::StartRecording() {
   }
   seq_recording_ = true;
   seq_rec_step_ = 0;
-  seq_overdubbing_ = seq_.num_steps && seq_running_;
+  seq_rec_slide_ = false;
+  seq_rec_full_ = false;
+  // A compact sequence cannot be overdubbed: it is recorded again.
+  seq_overdubbing_ = seq_.num_steps && seq_running_ && !seq_.compact;
   if (!seq_overdubbing_) {
+    if (sequence_reader_.sequence() == seq_.mutable_sequence()) {
+      sequence_reader_.Init(NULL);
+    }
     std::fill(
         &seq_.step[0],
         &seq_.step[kNumSteps],
         SequencerStep(SEQUENCER_STEP_REST, 0));
     seq_.num_steps = 0;
+    seq_.compact = false;
+  }
+}
+
+void Part::RecordStep(const SequencerStep& step) {
+  if (!seq_recording_) {
+    return;
+  }
+  if (seq_rec_step_ >= kNumSteps && !seq_.compact &&
+      !StartCompactSequence()) {
+    // The steps do not fit in a compact sequence: wrap to the first step.
+    seq_rec_step_ = 0;
+  }
+  if (seq_.compact) {
+    SequencerStep s = step;
+    if (seq_rec_slide_ && s.has_note()) {
+      s.data[1] |= 0x80;
+    }
+    if (sequence_writer_.Write(s)) {
+      seq_rec_slide_ = false;
+      ++seq_rec_step_;
+    } else {
+      // The step is dropped, and the display shows that the sequence is full.
+      seq_rec_full_ = true;
+    }
+    return;
+  }
+  
+  seq_.step[seq_rec_step_].data[0] = step.data[0];
+  seq_.step[seq_rec_step_].data[1] |= step.data[1];
+  if (seq_rec_slide_) {
+    seq_.step[seq_rec_step_].data[1] |= 0x80;
+  }
+  seq_rec_slide_ = false;
+  ++seq_rec_step_;
+  // Extend sequence.
+  if (!seq_overdubbing_ && seq_rec_step_ > seq_.num_steps) {
+    seq_.num_steps = seq_rec_step_;
+  }
+  // Wrap to first step.
+  if (seq_overdubbing_ && seq_rec_step_ >= seq_.num_steps) {
+    seq_rec_step_ = 0;
+  }
+}
+
+bool Part::StartCompactSequence() {
+  // Re-encode the steps recorded so far, in place.
+  uint8_t steps[kNumSteps * 2];
+  uint8_t* sequence = seq_.mutable_sequence();
+  std::copy(&sequence[0], &sequence[sizeof(steps)], &steps[0]);
+  sequence_writer_.Init(sequence, sizeof(steps));
+  for (uint8_t i = 0; i < kNumSteps; ++i) {
+    if (!sequence_writer_.Write(
+            SequencerStep(steps[2 * i], steps[2 * i + 1]))) {
+      std::copy(&steps[0], &steps[sizeof(steps)], &sequence[0]);
+      return false;
+    }
   }
+  seq_.compact = true;
+  if (seq_running_ && !sequence_reader_.active()) {
+    sequence_reader_.Init(sequence);
+  }
+  return true;
 }
 
 void Part::StopSequencerArpeggiatorNotes() {
@@ -322,7 +405,19 @@ void Part::StopSequencerArpeggiatorNotes() {
 }
 
 void Part::ClockSequencer() {
-  const SequencerStep& step = seq_.step[seq_step_];
+  SequencerStep step;
+  SequencerStep next_step;
+  if (sequence_reader_.active()) {
+    step = sequence_reader_.Read();
+    next_step = sequence_reader_.next_step();
+  } else {
+    step = seq_.step[seq_step_];
+    ++seq_step_;
+    if (seq_step_ >= seq_.num_steps) {
+      seq_step_ = 0;
+    }
+    next_step = seq_.step[seq_step_];
+  }
 
   if (step.has_note()) {
     int16_t note = step.note();
@@ -331,7 +426,12 @@ void Part::ClockSequencer() {
       // note = first note.
       // But this is not the case when we are playing several sequences at the
       // same time. In this case, we use root note = 60.
-      int8_t root_note = !has_siblings_ ? seq_.first_note() : 60;
+      int8_t root_note = 60;
+      if (!has_siblings_) {
+        root_note = sequence_reader_.active()
+            ? sequence_reader_.root_note()
+            : seq_.first_note();
+      }
       note += pressed_keys_.most_recent_note().note - root_note;
       while (note > 127) {
         note -= 12;
@@ -350,11 +450,7 @@ void Part::ClockSequencer() {
     generated_notes_.NoteOn(note, step.velocity());
     gate_length_counter_ = seq_.gate_length;
   }
-  ++seq_step_;
-  if (seq_step_ >= seq_.num_steps) {
-    seq_step_ = 0;
-  }
-  if (seq_.step[seq_step_].is_tie() || seq_.step[seq_step_].is_slid()) {
+  if (next_step.is_tie() || next_step.is_slid()) {
     // The next step contains a "sustain" message; or a slid note. Extends
     // the duration of the current note.
     gate_length_counter_ += clock_divisions[seq_.clock_division];
@@ -475,6 +571,9 @@ void Part::ReleaseLatchedNotes() {
 }
 
 void Part::DispatchSortedNotes(bool unison) {
+  // A new or released note only shifts the voices above it in the sorted
+  // order. The voices which keep their note are not retuned, and their
+  // portamento is not restarted.
   uint8_t n = mono_allocator_.size();
   for (uint8_t i = 0; i < num_voices_; ++i) {
     uint8_t index = 0xff;
@@ -484,12 +583,18 @@ void Part::DispatchSortedNotes(bool unison) {
       index = i < mono_allocator_.size() ? i : 0xff;
     }
     if (index != 0xff) {
+      const NoteEntry& entry = mono_allocator_.sorted_note(index);
+      if (active_note_[i] == entry.note &&
+          voice_[i]->velocity() == entry.velocity &&
+          voice_[i]->gate_on()) {
+        continue;
+      }
       voice_[i]->NoteOn(
-          Tune(mono_allocator_.sorted_note(index).note),
-          mono_allocator_.sorted_note(index).velocity,
+          Tune(entry.note),
+          entry.velocity,
           voicing_.portamento,
           !voice_[i]->gate_on());
-      active_note_[i] = mono_allocator_.sorted_note(index).note;
+      active_note_[i] = entry.note;
     } else {
       voice_[i]->NoteOff();
       active_note_[i] = VOICE_ALLOCATION_NOT_FOUND;
@@ -530,7 +635,7 @@ void Part::InternalNoteOn(uint8_t note, uint8_t velocity) {
     uint8_t voice_index = 0;
     switch (voicing_.allocation_mode) {
       case VOICE_ALLOCATION_MODE_POLY:
-        voice_index = poly_allocator_.NoteOn(note);
+        voice_index = poly_allocator_.NoteOn(note, velocity);
         break;
         
       case VOICE_ALLOCATION_MODE_POLY_CYCLIC:
@@ -554,8 +659,16 @@ void Part::InternalNoteOn(uint8_t note, uint8_t velocity) {
     }
     
     if (voice_index < num_voices_) {
-      // Prevent the same note from being simultaneously played on two channels.
-      KillAllInstancesOfNote(note);
+      if (voicing_.allocation_mode == VOICE_ALLOCATION_MODE_POLY) {
+        // The allocator never assigns the same note to two voices.
+        if (active_note_[voice_index] == note) {
+          voice_[voice_index]->NoteOff();
+        }
+      } else {
+        // Prevent the same note from being simultaneously played on two
+        // channels.
+        KillAllInstancesOfNote(note);
+      }
       voice_[voice_index]->NoteOn(
           Tune(note),
           velocity,
@@ -570,13 +683,10 @@ void Part::InternalNoteOn(uint8_t note, uint8_t velocity) {
 }
 
 void Part::KillAllInstancesOfNote(uint8_t note) {
-  while (true) {
-    uint8_t index = FindVoiceForNote(note);
-    if (index != VOICE_ALLOCATION_NOT_FOUND) {
-      voice_[index]->NoteOff();
-      active_note_[index] = VOICE_ALLOCATION_NOT_FOUND;
-    } else {
-      break;
+  for (uint8_t i = 0; i < num_voices_; ++i) {
+    if (active_note_[i] == note) {
+      voice_[i]->NoteOff();
+      active_note_[i] = VOICE_ALLOCATION_NOT_FOUND;
     }
   }
 }
@@ -635,6 +745,7 @@ void Part::InternalNoteOff(uint8_t note) {
 }
 
 void Part::TouchVoiceAllocation() {
+  poly_allocator_.set_stealing_mode(voicing_.stealing_mode);
   AllNotesOff();
   ResetAllControllers();
 }
@@ -666,7 +777,8 @@ void Part::Set(uint8_t address, uint8_t value) {
       case PART_MIDI_MIN_VELOCITY:
       case PART_MIDI_MAX_VELOCITY:
         // Shut all channels off when a MIDI parameter is changed to prevent
-        // stuck notes.
+        // stuck notes. This cannot be deferred: it would kill the notes
+        // received after the change.
         AllNotesOff();
         break;
         
@@ -674,6 +786,10 @@ void Part::Set(uint8_t address, uint8_t value) {
         TouchVoiceAllocation();
         break;
         
+      case PART_VOICING_STEALING_MODE:
+        poly_allocator_.set_stealing_mode(value);
+        break;
+        
       case PART_VOICING_PITCH_BEND_RANGE:
       case PART_VOICING_MODULATION_RATE:
       case PART_VOICING_VIBRATO_RANGE:
@@ -684,7 +800,7 @@ void Part::Set(uint8_t address, uint8_t value) {
       case PART_VOICING_AUDIO_MODE:
       case PART_VOICING_TUNING_TRANSPOSE:
       case PART_VOICING_TUNING_FINE:
-        TouchVoices();
+        setting_changes_ |= PART_SETTING_CHANGE_VOICES;
         break;
         
       case PART_SEQUENCER_ARP_DIRECTION:
@@ -695,6 +811,14 @@ void Part::Set(uint8_t address, uint8_t value) {
   }
 }
 
+void Part::ApplyPendingSettingChanges() {
+  uint8_t changes = setting_changes_;
+  setting_changes_ = 0;
+  if (changes & PART_SETTING_CHANGE_VOICES) {
+    TouchVoices();
+  }
+}
+
 int16_t Part::Tune(int16_t midi_note) {
   int16_t note = midi_note;
   int16_t pitch = note << 7;
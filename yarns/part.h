@@ -32,15 +32,20 @@
 #include <algorithm>
 
 #include "stmlib/stmlib.h"
-#include "stmlib/algorithms/voice_allocator.h"
 #include "stmlib/algorithms/note_stack.h"
 
+#include "yarns/sequence.h"
+#include "yarns/voice_allocator.h"
+
 namespace yarns {
 
 class Voice;
 
 const uint8_t kNumSteps = 64;
 const uint8_t kMaxNumVoices = 4;
+// The polychained layouts chain two units: their names give the total number
+// of voices. The voices of the second unit are allocated by the first one.
+const uint8_t kNumPolychainedUnits = 2;
 
 enum ArpeggiatorDirection {
   ARPEGGIATOR_DIRECTION_UP,
@@ -114,9 +119,17 @@ struct VoicingSettings {
   uint8_t trigger_shape;
   uint8_t aux_cv;
   uint8_t audio_mode;
-  uint8_t padding[16];
+  uint8_t stealing_mode;
+  uint8_t padding[15];
 };
 
+// Derived state to recompute after some settings have been changed. Set()
+// only records the changes, which are applied at once by ApplySettingChanges().
+// Changes which release notes (MIDI filter, allocation mode) are applied by
+// Set(), in order with the MIDI events.
+enum PartSettingChange {
+  PART_SETTING_CHANGE_VOICES = 1
+};
 
 enum PartSetting {
   PART_MIDI_CHANNEL,
@@ -142,6 +155,7 @@ enum PartSetting {
   PART_VOICING_TRIGGER_SHAPE,
   PART_VOICING_AUX_CV,
   PART_VOICING_AUDIO_MODE,
+  PART_VOICING_STEALING_MODE,
   PART_VOICING_LAST = PART_VOICING_ALLOCATION_MODE + sizeof(VoicingSettings) - 1,
   PART_SEQUENCER_CLOCK_DIVISION,
   PART_SEQUENCER_GATE_LENGTH,
@@ -153,36 +167,6 @@ enum PartSetting {
   PART_SEQUENCER_EUCLIDEAN_ROTATE
 };
 
-enum SequencerStepFlags {
-  SEQUENCER_STEP_REST = 0x80,
-  SEQUENCER_STEP_TIE = 0x81
-};
-
-struct SequencerStep {
-  // BYTE 0:
-  // 0x00 to 0x7f: note
-  // 0x80: rest
-  // 0x81: tie
-  //
-  // BYTE 1:
-  // 7 bits of velocity + 1 bit for slide flag.
-  SequencerStep() { }
-  SequencerStep(uint8_t data_0, uint8_t data_1) {
-    data[0] = data_0;
-    data[1] = data_1;
-  }
-  
-  uint8_t data[2];
-  
-  inline bool has_note() const { return !(data[0] & 0x80); }
-  inline bool is_rest() const { return data[0] == SEQUENCER_STEP_REST; }
-  inline bool is_tie() const { return data[0] == SEQUENCER_STEP_TIE; }
-  inline uint8_t note() const { return data[0] & 0x7f; }
-  
-  inline bool is_slid() const { return data[1] & 0x80; }
-  inline uint8_t velocity() const { return data[1] & 0x7f; }
-};
-
 struct SequencerSettings {
   uint8_t clock_division;
   uint8_t gate_length;
@@ -194,7 +178,11 @@ struct SequencerSettings {
   uint8_t euclidean_rotate;
   uint8_t num_steps;
   SequencerStep step[kNumSteps];
-  uint8_t padding[7];
+  // The steps hold a compact sequence (see sequence.h) instead.
+  uint8_t compact;
+  uint8_t padding[6];
+  
+  inline uint8_t* mutable_sequence() { return &step[0].data[0]; }
   
   int16_t first_note() {
     for (uint8_t i = 0; i < num_steps; ++i) {
@@ -238,25 +226,10 @@ class Part {
   }
   void StartRecording();
   
-  inline void RecordStep(const SequencerStep& step) {
-    if (seq_recording_) {
-      seq_.step[seq_rec_step_].data[0] = step.data[0];
-      seq_.step[seq_rec_step_].data[1] |= step.data[1];
-      ++seq_rec_step_;
-      uint8_t last_step = seq_overdubbing_ ? seq_.num_steps : kNumSteps;
-      // Extend sequence.
-      if (!seq_overdubbing_ && seq_rec_step_ > seq_.num_steps) {
-        seq_.num_steps = seq_rec_step_;
-      }
-      // Wrap to first step.
-      if (seq_rec_step_ >= last_step) {
-        seq_rec_step_ = 0;
-      }
-    }
-  }
-
+  void RecordStep(const SequencerStep& step);
+  
   inline void ModifyNoteAtCurrentStep(uint8_t note) {
-    if (seq_recording_) {
+    if (seq_recording_ && !seq_.compact && seq_rec_step_ < kNumSteps) {
       seq_.step[seq_rec_step_].data[0] = note;
     }
   }
@@ -308,6 +281,11 @@ class Part {
   }
   
   void Set(uint8_t address, uint8_t value);
+  inline void ApplySettingChanges() {
+    if (setting_changes_) {
+      ApplyPendingSettingChanges();
+    }
+  }
   inline uint8_t Get(uint8_t address) const {
     const uint8_t* bytes;
     bytes = static_cast<const uint8_t*>(static_cast<const void*>(&midi_));
@@ -325,13 +303,20 @@ class Part {
   
   inline bool recording() const { return seq_recording_; }
   inline bool overdubbing() const { return seq_overdubbing_; }
-  inline uint8_t recording_step() const { return seq_rec_step_; }
+  inline uint16_t recording_step() const { return seq_rec_step_; }
+  inline bool recording_full() const { return seq_rec_full_; }
   inline uint8_t num_steps() const { return seq_.num_steps; }
-  inline void set_recording_step(uint8_t n) { seq_rec_step_ = n; }
+  inline void set_recording_step(uint8_t n) {
+    // A compact sequence can only be appended to.
+    if (!seq_.compact) {
+      seq_rec_step_ = n;
+    }
+  }
   
   void Touch() {
     TouchVoices();
     TouchVoiceAllocation();
+    setting_changes_ = 0;
   }
   
   inline void Latch() {
@@ -347,7 +332,18 @@ class Part {
     has_siblings_ = has_siblings;
   }
   
+  // Plays a compact sequence (see sequence.h) instead of the steps of the
+  // sequencer settings. NULL returns to the sequencer settings.
+  inline void set_sequence(const uint8_t* sequence) {
+    sequence_reader_.Init(sequence);
+  }
+  
  private:
+  void ApplyPendingSettingChanges();
+  inline bool sequencer_playing() const {
+    return seq_running_ && (seq_.num_steps || sequence_reader_.active());
+  }
+  
   int16_t Tune(int16_t note);
   void ResetAllControllers();
   void TouchVoiceAllocation();
@@ -359,6 +355,7 @@ class Part {
   void DispatchSortedNotes(bool unison);
   void KillAllInstancesOfNote(uint8_t note);
   
+  bool StartCompactSequence();
   void ClockSequencer();
   void ClockArpeggiator();
   void StopSequencerArpeggiatorNotes();
@@ -378,7 +375,7 @@ class Part {
   stmlib::NoteStack<12> pressed_keys_;
   stmlib::NoteStack<12> generated_notes_;  // by sequencer or arpeggiator.
   stmlib::NoteStack<12> mono_allocator_;
-  stmlib::VoiceAllocator<kMaxNumVoices * 2> poly_allocator_;
+  VoiceAllocator<kMaxNumVoices * kNumPolychainedUnits> poly_allocator_;
   uint8_t active_note_[kMaxNumVoices];
   uint8_t cyclic_allocation_note_counter_;
   
@@ -393,13 +390,20 @@ class Part {
   bool seq_recording_;
   bool seq_overdubbing_;
   uint8_t seq_step_;
-  uint8_t seq_rec_step_;
+  // A compact sequence can be much longer than kNumSteps steps.
+  uint16_t seq_rec_step_;
+  bool seq_rec_slide_;
+  bool seq_rec_full_;
+  SequenceReader sequence_reader_;
+  SequenceWriter sequence_writer_;
   
   uint16_t gate_length_counter_;
   uint16_t lfo_counter_;
   
   bool has_siblings_;
   
+  uint8_t setting_changes_;
+  
   DISALLOW_COPY_AND_ASSIGN(Part);
 };
 
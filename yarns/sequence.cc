@@ -0,0 +1,242 @@
+// Copyright 2013 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Sequencer steps, and compact storage of long sequences.
+
+#include "yarns/sequence.h"
+
+namespace yarns {
+
+void SequenceReader::Init(const uint8_t* sequence) {
+  sequence_ = sequence;
+  Rewind();
+}
+
+void SequenceReader::Rewind() {
+  if (!sequence_) {
+    return;
+  }
+  chain_entry_ = &sequence_[3 + 2 * sequence_[0]];
+  chain_end_ = chain_entry_ + 3 * sequence_[1];
+  StartChainEntry();
+  next_step_ = DecodeStep();
+}
+
+/* static */
+bool SequenceReader::Validate(const uint8_t* sequence, uint8_t size) {
+  uint8_t num_patterns = sequence[0];
+  uint8_t num_chain_entries = sequence[1];
+  if (!num_patterns || !num_chain_entries ||
+      3 + 2 * num_patterns + 3 * num_chain_entries > size) {
+    return false;
+  }
+  const uint8_t* chain_entry = &sequence[3 + 2 * num_patterns];
+  for (uint8_t i = 0; i < num_chain_entries; ++i) {
+    if (chain_entry[0] >= num_patterns) {
+      return false;
+    }
+    chain_entry += 3;
+  }
+  // Each pattern must be terminated before the end of the sequence, with no
+  // opcode running past it.
+  for (uint8_t i = 0; i < num_patterns; ++i) {
+    const uint8_t* offset = &sequence[3 + 2 * i];
+    uint16_t position = offset[0] | (offset[1] << 8);
+    while (true) {
+      if (position >= size) {
+        return false;
+      }
+      uint8_t opcode = sequence[position];
+      if (opcode == SEQUENCE_OPCODE_END_OF_PATTERN) {
+        break;
+      } else if (opcode >= SEQUENCE_OPCODE_ABSOLUTE_NOTE) {
+        if (opcode != SEQUENCE_OPCODE_ABSOLUTE_NOTE) {
+          return false;
+        }
+        position += 3;
+      } else if (opcode >= SEQUENCE_OPCODE_NOTE_VELOCITY &&
+                 opcode < SEQUENCE_OPCODE_REST) {
+        position += 2;
+      } else {
+        ++position;
+      }
+    }
+  }
+  return true;
+}
+
+void SequenceReader::StartChainEntry() {
+  const uint8_t* offset = &sequence_[3 + 2 * chain_entry_[0]];
+  pattern_start_ = &sequence_[offset[0] | (offset[1] << 8)];
+  repeat_counter_ = chain_entry_[1];
+  StartPattern();
+}
+
+void SequenceReader::StartPattern() {
+  pattern_ = pattern_start_;
+  previous_note_ = chain_entry_[2];
+  velocity_ = kSequenceDefaultVelocity;
+  run_length_ = 0;
+}
+
+SequencerStep SequenceReader::DecodeStep() {
+  if (run_length_) {
+    --run_length_;
+    return SequencerStep(run_type_, 0);
+  }
+  
+  uint8_t opcode = *pattern_;
+  if (opcode == SEQUENCE_OPCODE_END_OF_PATTERN) {
+    if (repeat_counter_ > 1) {
+      --repeat_counter_;
+      StartPattern();
+    } else {
+      chain_entry_ += 3;
+      if (chain_entry_ >= chain_end_) {
+        chain_entry_ = &sequence_[3 + 2 * sequence_[0]];
+      }
+      StartChainEntry();
+    }
+    opcode = *pattern_;
+    if (opcode == SEQUENCE_OPCODE_END_OF_PATTERN) {
+      // Empty pattern. Play a rest rather than looking further for a step.
+      return SequencerStep(SEQUENCER_STEP_REST, 0);
+    }
+  }
+  ++pattern_;
+  
+  if (opcode < SEQUENCE_OPCODE_REST) {
+    previous_note_ = (previous_note_ + (opcode & 0x3f) - 0x20) & 0x7f;
+    if (opcode >= SEQUENCE_OPCODE_NOTE_VELOCITY) {
+      velocity_ = *pattern_++;
+    }
+    return SequencerStep(previous_note_, velocity_);
+  } else if (opcode < SEQUENCE_OPCODE_TIE) {
+    run_type_ = SEQUENCER_STEP_REST;
+    run_length_ = opcode - SEQUENCE_OPCODE_REST;
+    return SequencerStep(SEQUENCER_STEP_REST, 0);
+  } else if (opcode < SEQUENCE_OPCODE_ABSOLUTE_NOTE) {
+    run_type_ = SEQUENCER_STEP_TIE;
+    run_length_ = opcode - SEQUENCE_OPCODE_TIE;
+    return SequencerStep(SEQUENCER_STEP_TIE, 0);
+  } else {
+    previous_note_ = pattern_[0] & 0x7f;
+    velocity_ = pattern_[1];
+    pattern_ += 2;
+    return SequencerStep(previous_note_, velocity_);
+  }
+}
+
+// Header of a sequence with a single pattern, played once: number of patterns,
+// number of chain entries, root note, offset of the pattern, chain entry.
+const uint8_t kSinglePatternHeaderSize = 8;
+const uint8_t kSinglePatternRootNote = 7;
+
+void SequenceWriter::Init(uint8_t* sequence, uint8_t size) {
+  sequence_ = sequence;
+  size_ = size;
+  
+  sequence_[0] = 1;
+  sequence_[1] = 1;
+  sequence_[2] = 60;
+  sequence_[3] = kSinglePatternHeaderSize;
+  sequence_[4] = 0;
+  sequence_[5] = 0;
+  sequence_[6] = 1;
+  sequence_[kSinglePatternRootNote] = 60;
+  
+  end_ = kSinglePatternHeaderSize;
+  sequence_[end_] = SEQUENCE_OPCODE_END_OF_PATTERN;
+  run_ = 0;
+  has_note_ = false;
+  previous_note_ = 60;
+  velocity_ = kSequenceDefaultVelocity;
+}
+
+uint8_t* SequenceWriter::Append(uint8_t size) {
+  if (end_ + size >= size_) {
+    return NULL;
+  }
+  uint8_t* data = &sequence_[end_];
+  end_ += size;
+  sequence_[end_] = SEQUENCE_OPCODE_END_OF_PATTERN;
+  return data;
+}
+
+bool SequenceWriter::Write(const SequencerStep& step) {
+  if (!step.has_note()) {
+    uint8_t first = SEQUENCE_OPCODE_REST;
+    uint8_t last = SEQUENCE_OPCODE_TIE - 1;
+    if (step.is_tie()) {
+      first = SEQUENCE_OPCODE_TIE;
+      last = SEQUENCE_OPCODE_ABSOLUTE_NOTE - 1;
+    }
+    if (run_ && sequence_[run_] >= first && sequence_[run_] < last) {
+      ++sequence_[run_];
+      return true;
+    }
+    uint8_t* data = Append(1);
+    if (!data) {
+      return false;
+    }
+    data[0] = first;
+    run_ = data - sequence_;
+    return true;
+  }
+  
+  uint8_t note = step.note();
+  uint8_t velocity = step.data[1];
+  
+  // The first note is the root note of the sequence.
+  uint8_t previous_note = has_note_ ? previous_note_ : note;
+  int16_t delta = static_cast<int16_t>(note) - previous_note;
+  bool relative = delta >= -0x20 && delta < 0x20;
+  uint8_t* data = Append(
+      !relative ? 3 : (velocity == velocity_ ? 1 : 2));
+  if (!data) {
+    return false;
+  }
+  if (!relative) {
+    data[0] = SEQUENCE_OPCODE_ABSOLUTE_NOTE;
+    data[1] = note;
+    data[2] = velocity;
+  } else if (velocity == velocity_) {
+    data[0] = SEQUENCE_OPCODE_NOTE + delta + 0x20;
+  } else {
+    data[0] = SEQUENCE_OPCODE_NOTE_VELOCITY + delta + 0x20;
+    data[1] = velocity;
+  }
+  if (!has_note_) {
+    sequence_[2] = sequence_[kSinglePatternRootNote] = note;
+    has_note_ = true;
+  }
+  run_ = 0;
+  previous_note_ = note;
+  velocity_ = velocity;
+  return true;
+}
+
+}  // namespace yarns
@@ -0,0 +1,188 @@
+// Copyright 2013 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Sequencer steps, and compact storage of long sequences.
+//
+// A compact sequence is a list of patterns, and a chain indicating in which
+// order, how many times, and transposed to which root note, the patterns are
+// played. All values are bytes (offsets are little-endian 16-bit words):
+//
+// Header:
+//   Number of patterns P
+//   Number of chain entries C
+//   First note of the sequence (used as root note for transposition)
+//   P offsets, from the start of the sequence, to the data of each pattern
+//   C chain entries of 3 bytes: pattern index, repeat count, root note
+//
+// Pattern data, a list of variable-length steps:
+//   0x00 to 0x3f: note, (value - 0x20) semitones above the previous note.
+//   0x40 to 0x7f: note, (value - 0x60) semitones above the previous note,
+//                 followed by a new velocity/slide byte.
+//   0x80 to 0xbf: (value - 0x7f) rests.
+//   0xc0 to 0xef: (value - 0xbf) ties.
+//   0xf0: note, followed by a note byte and a velocity/slide byte.
+//   0xff: end of pattern.
+//
+// At the beginning of a pattern, the previous note is the root note of the
+// chain entry and the velocity is kSequenceDefaultVelocity, so that a pattern
+// repeated at different pitches is stored only once.
+//
+// The reader decodes the sequence one step ahead of the playback position,
+// one step per step played, so that reading a step, whatever its encoding,
+// takes a constant time.
+//
+// The writer records a sequence made of a single pattern, played once. This
+// is how a recording longer than kNumSteps steps is stored in the sequencer
+// settings.
+
+#ifndef YARNS_SEQUENCE_H_
+#define YARNS_SEQUENCE_H_
+
+#include "stmlib/stmlib.h"
+
+namespace yarns {
+
+enum SequencerStepFlags {
+  SEQUENCER_STEP_REST = 0x80,
+  SEQUENCER_STEP_TIE = 0x81
+};
+
+struct SequencerStep {
+  // BYTE 0:
+  // 0x00 to 0x7f: note
+  // 0x80: rest
+  // 0x81: tie
+  //
+  // BYTE 1:
+  // 7 bits of velocity + 1 bit for slide flag.
+  SequencerStep() { }
+  SequencerStep(uint8_t data_0, uint8_t data_1) {
+    data[0] = data_0;
+    data[1] = data_1;
+  }
+  
+  uint8_t data[2];
+  
+  inline bool has_note() const { return !(data[0] & 0x80); }
+  inline bool is_rest() const { return data[0] == SEQUENCER_STEP_REST; }
+  inline bool is_tie() const { return data[0] == SEQUENCER_STEP_TIE; }
+  inline uint8_t note() const { return data[0] & 0x7f; }
+  
+  inline bool is_slid() const { return data[1] & 0x80; }
+  inline uint8_t velocity() const { return data[1] & 0x7f; }
+};
+
+enum SequenceOpcode {
+  SEQUENCE_OPCODE_NOTE = 0x00,
+  SEQUENCE_OPCODE_NOTE_VELOCITY = 0x40,
+  SEQUENCE_OPCODE_REST = 0x80,
+  SEQUENCE_OPCODE_TIE = 0xc0,
+  SEQUENCE_OPCODE_ABSOLUTE_NOTE = 0xf0,
+  SEQUENCE_OPCODE_END_OF_PATTERN = 0xff
+};
+
+const uint8_t kSequenceDefaultVelocity = 100;
+
+class SequenceReader {
+ public:
+  SequenceReader() { }
+  ~SequenceReader() { }
+  
+  void Init(const uint8_t* sequence);
+  void Rewind();
+  
+  // Checks that a sequence of at most size bytes, received by SysEx or read
+  // from flash, can be played without reading outside of it.
+  static bool Validate(const uint8_t* sequence, uint8_t size);
+  
+  inline SequencerStep Read() {
+    SequencerStep step = next_step_;
+    next_step_ = DecodeStep();
+    return step;
+  }
+  
+  inline const SequencerStep& next_step() const { return next_step_; }
+  inline const uint8_t* sequence() const { return sequence_; }
+  inline bool active() const { return sequence_ != NULL; }
+  inline uint8_t root_note() const {
+    return sequence_ ? sequence_[2] : 60;
+  }
+  
+ private:
+  SequencerStep DecodeStep();
+  void StartChainEntry();
+  void StartPattern();
+  
+  const uint8_t* sequence_;
+  const uint8_t* chain_entry_;
+  const uint8_t* chain_end_;
+  const uint8_t* pattern_start_;
+  const uint8_t* pattern_;
+  
+  uint8_t repeat_counter_;
+  uint8_t previous_note_;
+  uint8_t velocity_;
+  uint8_t run_length_;
+  uint8_t run_type_;
+  
+  SequencerStep next_step_;
+  
+  DISALLOW_COPY_AND_ASSIGN(SequenceReader);
+};
+
+class SequenceWriter {
+ public:
+  SequenceWriter() { }
+  ~SequenceWriter() { }
+  
+  void Init(uint8_t* sequence, uint8_t size);
+  
+  // Appends a step, and terminates the pattern again so that the sequence
+  // can be played while it is recorded. Returns false when the step does
+  // not fit.
+  bool Write(const SequencerStep& step);
+  
+ private:
+  uint8_t* Append(uint8_t size);
+  
+  uint8_t* sequence_;
+  uint8_t size_;
+  
+  // Position of the end of pattern marker.
+  uint8_t end_;
+  // Position of the last opcode if it is a run of rests or ties, 0 otherwise.
+  uint8_t run_;
+  
+  bool has_note_;
+  uint8_t previous_note_;
+  uint8_t velocity_;
+  
+  DISALLOW_COPY_AND_ASSIGN(SequenceWriter);
+};
+
+}  // namespace yarns
+
+#endif // YARNS_SEQUENCE_H_
@@ -70,6 +70,10 @@ const char* const voicing_allocation_priority_values[] = {
   "LAST", "LOW", "HIGH"
 };
 
+const char* const voicing_stealing_mode_values[] = {
+  "OLDEST", "QUIETEST", "LOWEST", "HIGHEST"
+};
+
 const char* const trigger_shape_values[] = {
   "SQ", "LINEAR", "EXPO", "RING", "STEP", "BURST"
 };
@@ -311,6 +315,13 @@ const Setting Settings::settings_[] = {
     SETTING_UNIT_ENUMERATION, 0, 6, voicing_oscillator_values,
     71, 23,
   },
+  {
+    "VS", "VOICE STEALING",
+    SETTING_DOMAIN_PART, { PART_VOICING_STEALING_MODE, 0 },
+    SETTING_UNIT_ENUMERATION, 0, VOICE_STEALING_MODE_LAST - 1,
+    voicing_stealing_mode_values,
+    110, 0,
+  },
   {
     "C/", "CLOCK DIV",
     SETTING_DOMAIN_PART, { PART_SEQUENCER_CLOCK_DIVISION, 0 },
@@ -500,6 +511,7 @@ const SettingIndex dual_poly_menu[] = {
   SETTING_MIDI_CHANNEL,
   SETTING_MIDI_OUT_MODE,
   SETTING_VOICING_ALLOCATION_MODE,
+  SETTING_VOICING_STEALING_MODE,
   SETTING_VOICING_PORTAMENTO,
   SETTING_VOICING_PITCH_BEND_RANGE,
   SETTING_VOICING_VIBRATO_RANGE,
@@ -533,6 +545,7 @@ const SettingIndex quad_poly_menu[] = {
   SETTING_MIDI_CHANNEL,
   SETTING_MIDI_OUT_MODE,
   SETTING_VOICING_ALLOCATION_MODE,
+  SETTING_VOICING_STEALING_MODE,
   SETTING_VOICING_PORTAMENTO,
   SETTING_VOICING_PITCH_BEND_RANGE,
   SETTING_VOICING_VIBRATO_RANGE,
@@ -563,6 +576,7 @@ const SettingIndex dual_polychained_menu[] = {
   SETTING_CLOCK_BAR_DURATION,
   SETTING_MIDI_CHANNEL,
   SETTING_MIDI_OUT_MODE,
+  SETTING_VOICING_STEALING_MODE,
   SETTING_VOICING_PORTAMENTO,
   SETTING_VOICING_PITCH_BEND_RANGE,
   SETTING_VOICING_VIBRATO_RANGE,
@@ -594,6 +608,7 @@ const SettingIndex quad_polychained_menu[] = {
   SETTING_CLOCK_BAR_DURATION,
   SETTING_MIDI_CHANNEL,
   SETTING_MIDI_OUT_MODE,
+  SETTING_VOICING_STEALING_MODE,
   SETTING_VOICING_PORTAMENTO,
   SETTING_VOICING_PITCH_BEND_RANGE,
   SETTING_VOICING_VIBRATO_RANGE,
@@ -626,6 +641,7 @@ const SettingIndex octal_polychained_menu[] = {
   SETTING_CLOCK_BAR_DURATION,
   SETTING_MIDI_CHANNEL,
   SETTING_MIDI_OUT_MODE,
+  SETTING_VOICING_STEALING_MODE,
   SETTING_VOICING_PORTAMENTO,
   SETTING_VOICING_PITCH_BEND_RANGE,
   SETTING_VOICING_VIBRATO_RANGE,
@@ -681,6 +697,7 @@ const SettingIndex three_one_menu[] = {
   SETTING_MIDI_OUT_MODE,
   SETTING_VOICING_ALLOCATION_MODE,
   SETTING_VOICING_ALLOCATION_PRIORITY,
+  SETTING_VOICING_STEALING_MODE,
   SETTING_VOICING_LEGATO_MODE,
   SETTING_VOICING_PORTAMENTO,
   SETTING_VOICING_PITCH_BEND_RANGE,
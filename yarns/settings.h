@@ -96,6 +96,7 @@ enum SettingIndex {
   SETTING_VOICING_TRIGGER_SHAPE,
   SETTING_VOICING_AUX_CV,
   SETTING_VOICING_AUDIO_MODE,
+  SETTING_VOICING_STEALING_MODE,
   SETTING_SEQUENCER_CLOCK_DIVISION,
   SETTING_SEQUENCER_GATE_LENGTH,
   SETTING_SEQUENCER_ARP_RANGE,
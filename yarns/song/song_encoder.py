@@ -0,0 +1,159 @@
+#!/usr/bin/python2.5
+#
+# Copyright 2013 Olivier Gillet.
+#
+# Author: Olivier Gillet (ol.gillet@gmail.com)
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+# 
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+# 
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+# 
+# See http://creativecommons.org/licenses/MIT/ for more information.
+#
+# -----------------------------------------------------------------------------
+#
+# Converts the event list of the built-in song (song.h) into one compact
+# sequence per part (see yarns/sequence.h for the format).
+#
+# Usage: python yarns/song/song_encoder.py > yarns/song/song_sequences.h
+
+import re
+import sys
+
+NUM_PARTS = 4
+PATTERN_LENGTH = 16
+DEFAULT_VELOCITY = 100
+NOTE_OFFSET = 24
+
+SEQUENCE_END_OF_PATTERN = 0xff
+SEQUENCE_ABSOLUTE_NOTE = 0xf0
+
+REST = 'rest'
+TIE = 'tie'
+
+
+def ReadSong(file_name):
+  return [int(x) for x in re.findall(r'\d+', open(file_name).read())]
+
+
+def SongToSteps(song):
+  """Converts the song events into one list of steps per part.
+
+  In song.h, 254 advances the time by one step (6 clock ticks), and any other
+  value is part << 6 | note, with note = 0 for a note off. The song is played
+  twice so that the steps at the beginning of the loop take into account the
+  notes still sustained from the end of the song.
+  """
+  steps = [[] for i in range(NUM_PARTS)]
+  sounding = [False] * NUM_PARTS
+  pending = [None] * NUM_PARTS
+  for loop in range(2):
+    steps = [[] for i in range(NUM_PARTS)]
+    for value in song:
+      if value != 254:
+        part, note = value >> 6, value & 0x3f
+        pending[part] = note + NOTE_OFFSET if note else REST
+        continue
+      for part in range(NUM_PARTS):
+        event = pending[part]
+        if event is None:
+          steps[part].append(TIE if sounding[part] else REST)
+        else:
+          steps[part].append(event)
+          sounding[part] = event != REST
+        pending[part] = None
+  return steps
+
+
+def EncodePattern(steps):
+  """Encodes a pattern. Notes are coded relatively to the previous note, the
+  first one relatively to the root note of the pattern."""
+  root = ([s for s in steps if s not in (REST, TIE)] or [60])[0]
+  previous = root
+  data = []
+  i = 0
+  while i < len(steps):
+    step = steps[i]
+    if step in (REST, TIE):
+      run = 1
+      max_run = 64 if step == REST else 48
+      while i + run < len(steps) and steps[i + run] == step and run < max_run:
+        run += 1
+      data.append((0x80 if step == REST else 0xc0) + run - 1)
+      i += run
+      continue
+    delta = step - previous
+    if -32 <= delta < 32:
+      data.append(0x20 + delta)
+    else:
+      data.extend([SEQUENCE_ABSOLUTE_NOTE, step, DEFAULT_VELOCITY])
+    previous = step
+    i += 1
+  data.append(SEQUENCE_END_OF_PATTERN)
+  return root, tuple(data)
+
+
+def EncodeSequence(steps):
+  patterns = []
+  chain = []
+  for i in range(0, len(steps), PATTERN_LENGTH):
+    root, pattern = EncodePattern(steps[i:i + PATTERN_LENGTH])
+    if pattern not in patterns:
+      patterns.append(pattern)
+    index = patterns.index(pattern)
+    if chain and chain[-1][0] == index and chain[-1][2] == root and \
+        chain[-1][1] < 255:
+      chain[-1][1] += 1
+    else:
+      chain.append([index, 1, root])
+
+  first_note = ([s for s in steps if s not in (REST, TIE)] or [60])[0]
+  header_size = 3 + 2 * len(patterns) + 3 * len(chain)
+  data = [len(patterns), len(chain), first_note]
+  offset = header_size
+  for pattern in patterns:
+    data.extend([offset & 0xff, offset >> 8])
+    offset += len(pattern)
+  for entry in chain:
+    data.extend(entry)
+  for pattern in patterns:
+    data.extend(pattern)
+  return data
+
+
+def main():
+  song = ReadSong(sys.argv[1] if len(sys.argv) > 1 else 'yarns/song/song.h')
+  steps = SongToSteps(song)
+  sys.stdout.write('// Automatically generated with:\n')
+  sys.stdout.write('// python yarns/song/song_encoder.py\n\n')
+  for part, part_steps in enumerate(steps):
+    data = EncodeSequence(part_steps)
+    sys.stdout.write('// Part %d: %d steps, %d bytes.\n' % (
+        part + 1, len(part_steps), len(data)))
+    sys.stdout.write('const uint8_t song_part_%d[] = {\n' % (part + 1))
+    for i in range(0, len(data), 12):
+      line = ', '.join('%3d' % x for x in data[i:i + 12])
+      sys.stdout.write('  %s,\n' % line)
+    sys.stdout.write('};\n\n')
+  sys.stdout.write('const uint8_t* const song_parts[] = {\n')
+  for part in range(NUM_PARTS):
+    sys.stdout.write('  song_part_%d,\n' % (part + 1))
+  sys.stdout.write('};\n')
+
+
+if __name__ == '__main__':
+  main()
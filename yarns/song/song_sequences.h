@@ -0,0 +1,108 @@
+// Automatically generated with:
+// python yarns/song/song_encoder.py
+
+// Part 1: 640 steps, 262 bytes.
+const uint8_t song_part_1[] = {
+   13,  40,  76, 149,   0, 164,   0, 177,   0, 186,   0, 193,
+    0, 205,   0, 216,   0, 227,   0, 235,   0, 240,   0, 245,
+    0, 251,   0,   2,   1,   0,   1,  76,   1,   1,  69,   2,
+    1,  71,   3,   1,  72,   4,   1,  74,   5,   1,  76,   6,
+    1,  71,   7,   1,  72,   0,   1,  76,   1,   1,  69,   2,
+    1,  71,   3,   1,  72,   4,   1,  74,   5,   1,  76,   6,
+    1,  71,   7,   1,  72,   8,   1,  64,   9,   1,  62,   9,
+    1,  60,  10,   1,  56,   8,   1,  64,   9,   1,  62,  11,
+    1,  60,  12,   1,  68,   0,   1,  76,   1,   1,  69,   2,
+    1,  71,   3,   1,  72,   4,   1,  74,   5,   1,  76,   6,
+    1,  71,   7,   1,  72,   0,   1,  76,   1,   1,  69,   2,
+    1,  71,   3,   1,  72,   4,   1,  74,   5,   1,  76,   6,
+    1,  71,   7,   1,  72,  32, 194,  27, 192,  33, 192,  34,
+  192,  34,  30,  30, 192,  31, 192, 255,  32, 194,  32, 192,
+   35, 192,  36, 194,  30, 192,  30, 192, 255,  32, 196,  33,
+  192,  34, 194,  34, 194, 255,  32, 194,  29, 194,  32, 198,
+  255, 129,  32, 194,  35, 192,  36, 194,  30, 192,  30, 192,
+  255,  32, 196,  28, 192,  36, 194,  30, 192,  30, 192, 255,
+   32, 194,  32, 192,  33, 192,  34, 194,  34, 194, 255,  32,
+  194,  29, 194,  32, 194, 131, 255,  32, 198,  28, 198, 255,
+   32, 198,  29, 198, 255,  32, 198,  35, 194, 131, 255,  32,
+  194,  36, 194,  37, 198, 255,  32, 198, 135, 255,
+};
+
+// Part 2: 640 steps, 276 bytes.
+const uint8_t song_part_2[] = {
+   13,  40,  71, 149,   0, 162,   0, 175,   0, 188,   0, 195,
+    0, 209,   0, 222,   0, 239,   0, 249,   0, 254,   0,   3,
+    1,   9,   1,  16,   1,   0,   1,  71,   1,   1,  64,   2,
+    1,  68,   3,   1,  69,   4,   1,  65,   5,   1,  67,   6,
+    1,  68,   7,   1,  69,   0,   1,  71,   1,   1,  64,   2,
+    1,  68,   3,   1,  69,   4,   1,  65,   5,   1,  67,   6,
+    1,  68,   7,   1,  69,   8,   1,  60,   8,   1,  59,   9,
+    1,  57,  10,   1,  52,   8,   1,  60,   8,   1,  59,  11,
+    1,  57,  12,   1,  62,   0,   1,  71,   1,   1,  64,   2,
+    1,  68,   3,   1,  69,   4,   1,  65,   5,   1,  67,   6,
+    1,  68,   7,   1,  69,   0,   1,  71,   1,   1,  64,   2,
+    1,  68,   3,   1,  69,   4,   1,  65,   5,   1,  67,   6,
+    1,  68,   7,   1,  69,  32, 194,  29, 192,  33, 192,  34,
+  194,  30, 192,  31, 192, 255,  32, 194,  32, 192,  37, 192,
+   35, 194,  31, 192,  30, 192, 255,  32, 192,  28, 192,  36,
+  192,  33, 192,  34, 194,  33, 194, 255,  32, 194,  27, 194,
+   32, 198, 255, 129,  32, 194,  36, 192,  35, 192,  32,  32,
+   31, 192,  30, 192, 255,  32, 196,  29, 192,  35, 192,  34,
+   30,  30, 192,  31, 192, 255,  32, 192,  28, 192,  36, 192,
+   33, 192,  34, 192,  29, 192,  36, 192,  28, 192, 255,  32,
+  192,  27, 192,  32, 194,  32, 194, 131, 255,  32, 198,  29,
+  198, 255,  32, 198,  27, 198, 255,  32, 198,  36, 194, 131,
+  255,  32, 194,  35, 194,  36, 198, 255,  32, 198, 135, 255,
+};
+
+// Part 3: 640 steps, 294 bytes.
+const uint8_t song_part_3[] = {
+   10,  40,  40, 143,   0, 160,   0, 177,   0, 194,   0, 209,
+    0, 224,   0, 238,   0, 250,   0,  11,   1,  28,   1,   0,
+    1,  40,   0,   1,  45,   1,   1,  44,   2,   1,  45,   3,
+    1,  50,   4,   1,  36,   5,   1,  47,   6,   1,  45,   0,
+    1,  40,   0,   1,  45,   1,   1,  44,   2,   1,  45,   3,
+    1,  50,   4,   1,  36,   5,   1,  47,   6,   1,  45,   7,
+    1,  57,   8,   1,  56,   7,   1,  57,   9,   1,  56,   7,
+    1,  57,   8,   1,  56,   7,   1,  57,   9,   1,  56,   0,
+    1,  40,   0,   1,  45,   1,   1,  44,   2,   1,  45,   3,
+    1,  50,   4,   1,  36,   5,   1,  47,   6,   1,  45,   0,
+    1,  40,   0,   1,  45,   1,   1,  44,   2,   1,  45,   3,
+    1,  50,   4,   1,  36,   5,   1,  47,   6,   1,  45,  32,
+  192,  44, 192,  20, 192,  44, 192,  20, 192,  44, 192,  20,
+  192,  44, 192, 255,  32, 192,  44, 192,  20, 192,  44, 192,
+   16, 192,  44, 192,  20, 192,  44, 192, 255,  32, 192,  44,
+  192,  20, 192,  44, 192,  20, 192,  44, 192,  22, 192,  33,
+  192, 255,  32, 192,  20, 192, 129,  32, 192, 129,  32, 192,
+   39, 192,  28, 192, 255,  32, 192,  44, 192, 129,  32, 192,
+   20, 192,  39, 192,  32, 192, 129, 255,  32, 192,  44, 192,
+  129,  32, 192, 129,  25, 192, 129,  36, 192, 255,  32, 192,
+   39, 192,  25, 192,  39, 192,  25, 194, 131, 255,  32, 192,
+   39, 192,  25, 192,  39, 192,  25, 192,  39, 192,  25, 192,
+   39, 192, 255,  32, 192,  40, 192,  24, 192,  40, 192,  24,
+  192,  40, 192,  24, 192,  40, 192, 255,  32, 192,  40, 192,
+   24, 192,  40, 192, 135, 255,
+};
+
+// Part 4: 640 steps, 154 bytes.
+const uint8_t song_part_4[] = {
+    2,  40,  42, 127,   0, 140,   0,   0,   1,  42,   1,   1,
+   42,   0,   1,  42,   1,   1,  42,   0,   1,  42,   1,   1,
+   42,   0,   1,  42,   1,   1,  42,   0,   1,  42,   1,   1,
+   42,   0,   1,  42,   1,   1,  42,   0,   1,  42,   1,   1,
+   42,   0,   1,  42,   1,   1,  42,   0,   1,  42,   1,   1,
+   42,   0,   1,  42,   1,   1,  42,   0,   1,  42,   1,   1,
+   42,   0,   1,  42,   1,   1,  42,   0,   1,  42,   1,   1,
+   42,   0,   1,  42,   1,   1,  42,   0,   1,  42,   1,   1,
+   42,   0,   1,  42,   1,   1,  42,   0,   1,  42,   1,   1,
+   42,   0,   1,  42,   1,   1,  42,   0,   1,  42,   1,   1,
+   42,   0,   1,  42,   1,   1,  42, 129,  32, 192, 129,  32,
+  192, 129,  32,  32, 129,  32, 192, 255, 129,  32, 192, 129,
+   32, 192, 129,  32, 192,  32, 192,  32, 192, 255,
+};
+
+const uint8_t* const song_parts[] = {
+  song_part_1,
+  song_part_2,
+  song_part_3,
+  song_part_4,
+};
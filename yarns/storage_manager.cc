@@ -28,38 +28,385 @@
 
 #include "yarns/storage_manager.h"
 
+#include "stmlib/system/flash_programming.h"
+
 #include "yarns/midi_handler.h"
 #include "yarns/multi.h"
 
 namespace yarns {
 
+using namespace std;
+
+// Journal records are 32-bit words, written as two half-words: the offset
+// first, then the tag, which validates the record. Erased flash reads as
+// 0xffffffff and marks the end of the journal.
+const uint32_t kJournalBase = kStorageLastAddress - \
+    (kNumStoragePages + kNumJournalPages) * PAGE_SIZE;
+const uint16_t kJournalHalfPages = kNumJournalPages / 2;
+const uint16_t kRecordsPerHalf = kJournalHalfPages * PAGE_SIZE / 4 - 1;
+const uint16_t kJournalMagic = 0x4a4c;
+const uint16_t kRecordMarker = 0xa000;
+const uint16_t kRecordMarkerMask = 0xe000;
+
+// Must match STORAGE_BASE_ADDRESS in the makefile.
+STATIC_ASSERT(kJournalBase == 0x801bc00, storage_base_matches_makefile);
+
+inline uint16_t RecordTag(uint32_t record) {
+  return record & 0xffff;
+}
+
+inline bool RecordValid(uint32_t record) {
+  return (RecordTag(record) & kRecordMarkerMask) == kRecordMarker;
+}
+
+inline JournalRecordType RecordType(uint32_t record) {
+  return static_cast<JournalRecordType>((record >> 11) & 0x3);
+}
+
+inline uint8_t RecordSlot(uint32_t record) {
+  return (record >> 8) & 0x7;
+}
+
+inline uint8_t RecordValue(uint32_t record) {
+  return record & 0xff;
+}
+
+inline uint16_t RecordOffset(uint32_t record) {
+  return record >> 16;
+}
+
+void StorageManager::Init() {
+  saving_ = false;
+  compaction_state_ = COMPACTION_IDLE;
+  compaction_counter_ = 0;
+  
+  for (uint8_t half = 0; half < 2; ++half) {
+    ScanHalf(half);
+  }
+  
+  if (!half_valid_[0] && !half_valid_[1]) {
+    // Blank journal (or first boot with this firmware): the program pages
+    // are the reference.
+    for (uint8_t half = 0; half < 2; ++half) {
+      for (uint16_t page = 0; page < kJournalHalfPages; ++page) {
+        EraseJournalPage(half, page);
+      }
+    }
+    WriteHeader(0, 0);
+    active_half_ = 0;
+    spare_erased_ = true;
+  } else if (half_valid_[0] != half_valid_[1]) {
+    active_half_ = half_valid_[0] ? 0 : 1;
+    spare_erased_ = erased(1 - active_half_);
+  } else {
+    // Compaction has been interrupted. Merging is idempotent, resume it.
+    int16_t delta = static_cast<int16_t>(sequence_[1] - sequence_[0]);
+    active_half_ = delta > 0 ? 1 : 0;
+    spare_erased_ = false;
+    compaction_state_ = COMPACTION_MERGE;
+  }
+}
+
+void StorageManager::Tick(bool idle) {
+  if (saving_) {
+    WriteNextSaveRecord();
+    return;
+  }
+  if (!idle) {
+    return;
+  }
+  if (compaction_state_ != COMPACTION_IDLE ||
+      num_records_[active_half_] > kRecordsPerHalf / 2) {
+    CompactionStep();
+  }
+}
+
 void StorageManager::SaveMulti(uint8_t slot) {
+  Flush();
   stream_buffer_.Rewind();
   multi.Serialize(&stream_buffer_);
+  
+  if (!storage_.Load(image_, kMultiSize, 1 + slot)) {
+    // Nothing valid to append to: write the whole program.
+    RewriteProgram(slot);
+    return;
+  }
+  ReplayJournal(slot, image_);
+  
+  const uint8_t* data = stream_buffer_.bytes();
+  uint16_t num_changes = 0;
+  for (uint16_t i = 0; i < kMultiSize; ++i) {
+    num_changes += data[i] != image_[i] ? 1 : 0;
+  }
+  if (!num_changes) {
+    return;
+  }
+  
+  if (!has_space(num_changes + 2)) {
+    // The journal is waiting for a compaction, which only runs when idle.
+    // Rewriting the program page costs one page erase; completing the
+    // compaction now could cost up to kNumStoredPrograms + kNumJournalPages.
+    RewriteProgram(slot);
+    return;
+  }
+  
+  AppendRecord(JOURNAL_RECORD_BEGIN, slot, 0, 0);
+  saving_ = true;
+  save_slot_ = slot;
+  save_offset_ = 0;
+  save_size_ = kMultiSize;
+}
+
+void StorageManager::RewriteProgram(uint8_t slot) {
   storage_.Save(stream_buffer_.bytes(), stream_buffer_.position(), 1 + slot);
+  // Only compacts when the active half has filled up, which takes many saves
+  // without any idle time in between.
+  EnsureSpace(1);
+  AppendRecord(JOURNAL_RECORD_RESET, slot, 0, 0);
 }
 
-bool StorageManager::LoadMulti(uint8_t slot) {
-  // Dummy serialization of the multi to know its size.
-  stream_buffer_.Rewind();
-  multi.Serialize(&stream_buffer_);
-  uint32_t expected_size = stream_buffer_.position();
+void StorageManager::WriteNextSaveRecord() {
+  const uint8_t* data = stream_buffer_.bytes();
+  while (save_offset_ < save_size_ &&
+         data[save_offset_] == image_[save_offset_]) {
+    ++save_offset_;
+  }
+  if (save_offset_ < save_size_) {
+    AppendRecord(
+        JOURNAL_RECORD_BYTE,
+        save_slot_,
+        save_offset_,
+        data[save_offset_]);
+    image_[save_offset_] = data[save_offset_];
+    ++save_offset_;
+  } else {
+    AppendRecord(JOURNAL_RECORD_COMMIT, save_slot_, 0, 0);
+    saving_ = false;
+  }
+}
+
+void StorageManager::Flush() {
+  while (saving_) {
+    WriteNextSaveRecord();
+  }
+}
+
+void StorageManager::EnsureSpace(uint16_t size) {
+  // Each compaction cycle switches to an empty half, so this terminates.
+  while (!has_space(size)) {
+    CompactionStep();
+  }
+}
+
+bool StorageManager::has_space(uint16_t size) const {
+  // While merging, room is kept for the reset records of the programs which
+  // remain to be merged.
+  uint16_t reserved = compaction_state_ == COMPACTION_MERGE
+      ? kNumStoredPrograms - compaction_counter_
+      : 0;
+  return num_records_[active_half_] + size + reserved <= kRecordsPerHalf;
+}
+
+void StorageManager::CompactionStep() {
+  uint8_t spare = 1 - active_half_;
+  switch (compaction_state_) {
+    case COMPACTION_IDLE:
+      compaction_state_ = spare_erased_ ? \
+          COMPACTION_SWITCH : COMPACTION_ERASE_SPARE;
+      compaction_counter_ = 0;
+      break;
+      
+    case COMPACTION_ERASE_SPARE:
+      EraseJournalPage(spare, compaction_counter_);
+      if (++compaction_counter_ == kJournalHalfPages) {
+        compaction_state_ = COMPACTION_SWITCH;
+      }
+      break;
+      
+    case COMPACTION_SWITCH:
+      WriteHeader(spare, sequence_[active_half_] + 1);
+      active_half_ = spare;
+      spare_erased_ = false;
+      compaction_state_ = COMPACTION_MERGE;
+      compaction_counter_ = 0;
+      break;
+      
+    case COMPACTION_MERGE:
+      while (compaction_counter_ < kNumStoredPrograms) {
+        if (MergeSlot(compaction_counter_++)) {
+          break;
+        }
+      }
+      if (compaction_counter_ == kNumStoredPrograms) {
+        compaction_state_ = COMPACTION_ERASE_OLD;
+        compaction_counter_ = 0;
+      }
+      break;
+      
+    case COMPACTION_ERASE_OLD:
+      // Erasing the first page invalidates the header: from then on the
+      // records of this half are ignored.
+      EraseJournalPage(spare, compaction_counter_);
+      if (++compaction_counter_ == kJournalHalfPages) {
+        spare_erased_ = true;
+        compaction_state_ = COMPACTION_IDLE;
+      }
+      break;
+  }
+}
+
+bool StorageManager::MergeSlot(uint8_t slot) {
+  if (!storage_.Load(image_, kMultiSize, 1 + slot) ||
+      !ReplayJournal(slot, image_)) {
+    return false;
+  }
+  storage_.Save(image_, kMultiSize, 1 + slot);
+  AppendRecord(JOURNAL_RECORD_RESET, slot, 0, 0);
+  return true;
+}
+
+bool StorageManager::ReplayJournal(uint8_t slot, uint8_t* image) const {
+  uint16_t n = num_journal_records();
+  
+  // Only the records written after the last rewrite of the program page count.
+  uint16_t start = 0;
+  for (uint16_t i = 0; i < n; ++i) {
+    uint32_t record = journal_record(i);
+    if (RecordValid(record) && RecordSlot(record) == slot &&
+        RecordType(record) == JOURNAL_RECORD_RESET) {
+      start = i + 1;
+    }
+  }
   
-  if (!storage_.Load(stream_buffer_.mutable_bytes(), expected_size, 1 + slot)) {
+  // Apply the complete saves. A save interrupted by a power loss has no
+  // commit record, and the next save starts with a new begin record.
+  bool applied = false;
+  bool in_save = false;
+  uint16_t begin = 0;
+  for (uint16_t i = start; i < n; ++i) {
+    uint32_t record = journal_record(i);
+    if (!RecordValid(record) || RecordSlot(record) != slot) {
+      continue;
+    }
+    if (RecordType(record) == JOURNAL_RECORD_BEGIN) {
+      in_save = true;
+      begin = i;
+    } else if (RecordType(record) == JOURNAL_RECORD_COMMIT && in_save) {
+      for (uint16_t j = begin + 1; j < i; ++j) {
+        uint32_t r = journal_record(j);
+        if (RecordValid(r) && RecordSlot(r) == slot &&
+            RecordType(r) == JOURNAL_RECORD_BYTE &&
+            RecordOffset(r) < kMultiSize) {
+          image[RecordOffset(r)] = RecordValue(r);
+        }
+      }
+      in_save = false;
+      applied = true;
+    }
+  }
+  return applied;
+}
+
+void StorageManager::AppendRecord(
+    JournalRecordType type,
+    uint8_t slot,
+    uint16_t offset,
+    uint8_t value) {
+  uint32_t address = half_address(active_half_) + \
+      (1 + num_records_[active_half_]) * 4;
+  uint16_t tag = kRecordMarker | (type << 11) | (slot << 8) | value;
+  FLASH_Unlock();
+  FLASH_ProgramHalfWord(address + 2, offset);
+  FLASH_ProgramHalfWord(address, tag);
+  ++num_records_[active_half_];
+}
+
+uint32_t StorageManager::half_address(uint8_t half) const {
+  return kJournalBase + half * kJournalHalfPages * PAGE_SIZE;
+}
+
+uint16_t StorageManager::num_journal_records() const {
+  return num_records_[0] + num_records_[1];
+}
+
+uint32_t StorageManager::journal_record(uint16_t index) const {
+  // Records of the older half come first.
+  uint8_t older = 1 - active_half_;
+  uint8_t half = older;
+  if (index >= num_records_[older]) {
+    index -= num_records_[older];
+    half = active_half_;
+  }
+  const uint32_t* words = reinterpret_cast<const uint32_t*>(
+      half_address(half));
+  return words[1 + index];
+}
+
+bool StorageManager::erased(uint8_t half) const {
+  const uint32_t* words = reinterpret_cast<const uint32_t*>(
+      half_address(half));
+  for (uint16_t i = 0; i < kRecordsPerHalf + 1; ++i) {
+    if (words[i] != 0xffffffff) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void StorageManager::ScanHalf(uint8_t half) {
+  const uint32_t* words = reinterpret_cast<const uint32_t*>(
+      half_address(half));
+  half_valid_[half] = (words[0] & 0xffff) == kJournalMagic;
+  sequence_[half] = words[0] >> 16;
+  num_records_[half] = 0;
+  if (half_valid_[half]) {
+    while (num_records_[half] < kRecordsPerHalf &&
+           words[1 + num_records_[half]] != 0xffffffff) {
+      ++num_records_[half];
+    }
+  }
+}
+
+void StorageManager::EraseJournalPage(uint8_t half, uint16_t page) {
+  FLASH_Unlock();
+  FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPRTERR);
+  FLASH_ErasePage(half_address(half) + page * PAGE_SIZE);
+  if (page == 0) {
+    half_valid_[half] = false;
+    num_records_[half] = 0;
+  }
+}
+
+void StorageManager::WriteHeader(uint8_t half, uint16_t sequence) {
+  uint32_t address = half_address(half);
+  FLASH_Unlock();
+  FLASH_ProgramHalfWord(address + 2, sequence);
+  FLASH_ProgramHalfWord(address, kJournalMagic);
+  half_valid_[half] = true;
+  sequence_[half] = sequence;
+  num_records_[half] = 0;
+}
+
+bool StorageManager::LoadMulti(uint8_t slot) {
+  Flush();
+  if (!storage_.Load(stream_buffer_.mutable_bytes(), kMultiSize, 1 + slot)) {
     return false;
   } else {
+    ReplayJournal(slot, stream_buffer_.mutable_bytes());
     DeserializeMulti();
     return true;
   }
 }
 
 void StorageManager::SaveCalibration() {
+  Flush();
   stream_buffer_.Rewind();
   multi.SerializeCalibration(&stream_buffer_);
   storage_.Save(stream_buffer_.bytes(), stream_buffer_.position(), 0);
 }
 
 bool StorageManager::LoadCalibration() {
+  Flush();
   stream_buffer_.Rewind();
   multi.SerializeCalibration(&stream_buffer_);
   uint32_t expected_size = stream_buffer_.position();
@@ -74,6 +421,7 @@ bool StorageManager::LoadCalibration() {
 }
 
 void StorageManager::SysExSendMulti() {
+  Flush();
   stream_buffer_.Rewind();
   multi.Serialize(&stream_buffer_);
   midi_handler.SysExSendPackets(
@@ -89,4 +437,4 @@ void StorageManager::DeserializeMulti() {
 /* extern */
 StorageManager storage_manager;
 
-}  // namespace yarns
\ No newline at end of file
+}  // namespace yarns
@@ -25,6 +25,21 @@
 // -----------------------------------------------------------------------------
 //
 // Responsible for flash memory storage.
+//
+// Calibration data and programs are stored in their own flash pages. Saving
+// a program does not rewrite its page: the bytes of the serialized multi which
+// differ from the stored ones are appended, one record per call to Tick(), to
+// a journal made of two halves used alternately. When the active half fills
+// up, the other half becomes active, and the records of the previous one are
+// merged back into the program pages, one page per call to Tick(), before it
+// is erased. Page erasures block the CPU, and thus CV and audio updates, so
+// compaction only progresses while the MIDI input is idle, all gates are off
+// and no oscillator is sounding. A save which does not fit in the journal rewrites
+// the program page instead.
+//
+// The journal takes the kNumJournalPages pages below the program pages: the
+// storage area spans 0x801bc00 to 0x8020000, and the makefile checks that the
+// application ends below it.
 
 #ifndef YARNS_STORAGE_MANAGER_H_
 #define YARNS_STORAGE_MANAGER_H_
@@ -36,13 +51,44 @@
 #include "stmlib/utils/stream_buffer.h"
 #include "stmlib/system/storage.h"
 
+#include "yarns/multi.h"
+
 namespace yarns {
 
+const uint32_t kStorageLastAddress = 0x8020000;
+const uint16_t kNumStoragePages = 9;
+const uint16_t kNumJournalPages = 8;
+const uint16_t kNumStoredPrograms = kNumStoragePages - 1;
+
+const size_t kMultiSize = sizeof(MultiSettings) + kNumParts * (
+    sizeof(MidiSettings) + sizeof(VoicingSettings) + sizeof(SequencerSettings));
+
+enum JournalRecordType {
+  JOURNAL_RECORD_BYTE,
+  JOURNAL_RECORD_BEGIN,
+  JOURNAL_RECORD_COMMIT,
+  JOURNAL_RECORD_RESET
+};
+
+enum CompactionState {
+  COMPACTION_IDLE,
+  COMPACTION_ERASE_SPARE,
+  COMPACTION_SWITCH,
+  COMPACTION_MERGE,
+  COMPACTION_ERASE_OLD
+};
+
 class StorageManager {
  public:
   StorageManager() { }
   ~StorageManager() { }
   
+  void Init();
+  
+  // Runs one step of the pending save (one flash write), or, when idle is set,
+  // one step of the compaction of the journal (one page erase or write).
+  void Tick(bool idle);
+  
   void SaveMulti(uint8_t slot);
   bool LoadMulti(uint8_t slot);
   void SaveCalibration();
@@ -51,16 +97,65 @@ class StorageManager {
   
   void AppendData(const uint8_t* data, size_t size, bool rewind) {
     if (rewind) {
+      Flush();
       stream_buffer_.Rewind();
     }
     stream_buffer_.Write(data, size);
   }
   
   void DeserializeMulti();
+  
+  inline bool saving() const { return saving_; }
 
  private:
+  // Completes the pending save.
+  void Flush();
+  void WriteNextSaveRecord();
+  
+  // Writes the whole serialized multi to the program page.
+  void RewriteProgram(uint8_t slot);
+  
+  // Makes sure that size records can be appended to the active half of the
+  // journal, compacting it if needed.
+  void EnsureSpace(uint16_t size);
+  void CompactionStep();
+  bool MergeSlot(uint8_t slot);
+  
+  bool ReplayJournal(uint8_t slot, uint8_t* image) const;
+  void AppendRecord(
+      JournalRecordType type,
+      uint8_t slot,
+      uint16_t offset,
+      uint8_t value);
+  
+  uint32_t half_address(uint8_t half) const;
+  bool has_space(uint16_t size) const;
+  uint16_t num_journal_records() const;
+  uint32_t journal_record(uint16_t index) const;
+  bool erased(uint8_t half) const;
+  void ScanHalf(uint8_t half);
+  void EraseJournalPage(uint8_t half, uint16_t page);
+  void WriteHeader(uint8_t half, uint16_t sequence);
+  
   stmlib::StreamBuffer<1024> stream_buffer_;
-  stmlib::Storage<0x8020000, 9> storage_;
+  stmlib::Storage<kStorageLastAddress, kNumStoragePages> storage_;
+  
+  // Content of the program being saved, as currently stored in flash.
+  uint8_t image_[kMultiSize];
+  
+  bool saving_;
+  uint8_t save_slot_;
+  uint16_t save_offset_;
+  uint16_t save_size_;
+  
+  uint8_t active_half_;
+  bool half_valid_[2];
+  uint16_t sequence_[2];
+  uint16_t num_records_[2];
+  bool spare_erased_;
+  
+  CompactionState compaction_state_;
+  uint16_t compaction_counter_;
   
   DISALLOW_COPY_AND_ASSIGN(StorageManager);
 };
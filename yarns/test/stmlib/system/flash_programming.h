@@ -0,0 +1,98 @@
+// Copyright 2013 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Simulated flash for the host build of the storage manager. It shadows the
+// STM32 flash programming header: the test maps RAM at the address of the
+// flash memory, page erases fill it with 0xff, and programming can only clear
+// bits of an erased half-word. Power can be cut after a given number of
+// flash operations.
+
+#ifndef YARNS_TEST_STMLIB_SYSTEM_FLASH_PROGRAMMING_H_
+#define YARNS_TEST_STMLIB_SYSTEM_FLASH_PROGRAMMING_H_
+
+#include <cassert>
+#include <cstring>
+
+#include "stmlib/stmlib.h"
+
+#define PAGE_SIZE (uint16_t)0x400
+
+#define FLASH_FLAG_EOP 0x20
+#define FLASH_FLAG_PGERR 0x04
+#define FLASH_FLAG_WRPRTERR 0x10
+
+typedef enum {
+  FLASH_BUSY = 1,
+  FLASH_ERROR_PG,
+  FLASH_ERROR_WRP,
+  FLASH_COMPLETE,
+  FLASH_TIMEOUT
+} FLASH_Status;
+
+extern uint32_t flash_num_operations;
+extern uint32_t flash_num_erases;
+// When non-zero, PowerLoss is thrown when this many more operations have been
+// started.
+extern uint32_t flash_power_loss_countdown;
+
+struct PowerLoss { };
+
+inline void FlashOperation() {
+  ++flash_num_operations;
+  if (flash_power_loss_countdown && !--flash_power_loss_countdown) {
+    throw PowerLoss();
+  }
+}
+
+inline void FLASH_Unlock() { }
+inline void FLASH_Lock() { }
+inline void FLASH_ClearFlag(uint32_t flags) { }
+
+inline FLASH_Status FLASH_ErasePage(uint32_t address) {
+  FlashOperation();
+  ++flash_num_erases;
+  memset(
+      reinterpret_cast<void*>(address & ~static_cast<uint32_t>(PAGE_SIZE - 1)),
+      0xff,
+      PAGE_SIZE);
+  return FLASH_COMPLETE;
+}
+
+inline FLASH_Status FLASH_ProgramHalfWord(uint32_t address, uint16_t data) {
+  uint16_t* half_word = reinterpret_cast<uint16_t*>(address);
+  assert(*half_word == 0xffff);
+  FlashOperation();
+  *half_word = data;
+  return FLASH_COMPLETE;
+}
+
+inline FLASH_Status FLASH_ProgramWord(uint32_t address, uint32_t data) {
+  FLASH_ProgramHalfWord(address, data & 0xffff);
+  FLASH_ProgramHalfWord(address + 2, data >> 16);
+  return FLASH_COMPLETE;
+}
+
+#endif  // YARNS_TEST_STMLIB_SYSTEM_FLASH_PROGRAMMING_H_
@@ -0,0 +1,646 @@
+// Copyright 2013 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Headless Yarns engine. Replays a standard MIDI file through the MIDI handler
+// and the multi, at the rate of the firmware's CV/gate refresh interrupt,
+// records every change of the voices' outputs, and reports note-on to gate
+// latency and the simulation throughput.
+//
+// Usage: yarns_test [file.mid] [layout] [main loop period in ticks]
+// Without a file, a dense built-in stress sequence is played. The rendering
+// time of the audio mode oscillators is measured beforehand, and the storage
+// manager is checked against a simulated flash memory (see
+// test/stmlib/system/flash_programming.h).
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <vector>
+
+#include <sys/mman.h>
+
+#include "yarns/midi_handler.h"
+#include "yarns/multi.h"
+#include "yarns/settings.h"
+#include "yarns/storage_manager.h"
+
+using namespace std;
+using namespace yarns;
+
+const uint32_t kRefreshRate = 8000;
+const uint32_t kInternalClockOversampling = 6;  // 48kHz internal clock.
+// 31250 bauds, 10 bits per byte.
+const double kUartByteDuration = kRefreshRate * 10.0 / 31250.0;
+
+struct TimedMessage {
+  double time;  // In refresh ticks.
+  uint8_t data[3];
+  uint8_t size;
+};
+
+struct RawEvent {
+  uint32_t tick;
+  uint32_t order;
+  uint8_t data[3];
+  uint8_t size;
+  uint32_t tempo;  // Non-zero for tempo changes.
+  
+  bool operator<(const RawEvent& other) const {
+    return tick != other.tick ? tick < other.tick : order < other.order;
+  }
+};
+
+class SmfReader {
+ public:
+  SmfReader() { }
+  ~SmfReader() { }
+  
+  bool Load(const char* file_name, vector<TimedMessage>* messages) {
+    FILE* fp = fopen(file_name, "rb");
+    if (!fp) {
+      fprintf(stderr, "Cannot open %s\n", file_name);
+      return false;
+    }
+    fseek(fp, 0, SEEK_END);
+    data_.resize(ftell(fp));
+    fseek(fp, 0, SEEK_SET);
+    if (data_.size() && fread(&data_[0], 1, data_.size(), fp) != data_.size()) {
+      fclose(fp);
+      return false;
+    }
+    fclose(fp);
+    
+    ptr_ = 0;
+    if (!Expect("MThd") || ReadLong() != 6) {
+      fprintf(stderr, "Not a standard MIDI file\n");
+      return false;
+    }
+    ReadShort();  // Format.
+    uint16_t num_tracks = ReadShort();
+    uint16_t division = ReadShort();
+    if (division & 0x8000) {
+      fprintf(stderr, "SMPTE time division not supported\n");
+      return false;
+    }
+    
+    vector<RawEvent> events;
+    for (uint16_t i = 0; i < num_tracks && ptr_ + 8 <= data_.size(); ++i) {
+      bool is_track = Expect("MTrk");
+      size_t end = ptr_ + 4 + ReadLong();
+      if (is_track) {
+        ReadTrack(end, &events);
+      }
+      ptr_ = end;
+    }
+    stable_sort(events.begin(), events.end());
+    
+    // Apply the tempo map.
+    double seconds_per_tick = 0.5 / division;
+    double time = 0.0;
+    uint32_t previous_tick = 0;
+    for (size_t i = 0; i < events.size(); ++i) {
+      const RawEvent& e = events[i];
+      time += (e.tick - previous_tick) * seconds_per_tick;
+      previous_tick = e.tick;
+      if (e.tempo) {
+        seconds_per_tick = e.tempo / 1000000.0 / division;
+      } else {
+        TimedMessage m;
+        m.time = time * kRefreshRate;
+        m.size = e.size;
+        copy(&e.data[0], &e.data[3], &m.data[0]);
+        messages->push_back(m);
+      }
+    }
+    return true;
+  }
+  
+ private:
+  bool Expect(const char* tag) {
+    if (ptr_ + 4 > data_.size() || memcmp(&data_[ptr_], tag, 4)) {
+      return false;
+    }
+    ptr_ += 4;
+    return true;
+  }
+  
+  uint32_t ReadLong() {
+    uint32_t value = 0;
+    for (size_t i = 0; i < 4 && ptr_ < data_.size(); ++i) {
+      value = (value << 8) | data_[ptr_++];
+    }
+    return value;
+  }
+  
+  uint16_t ReadShort() {
+    uint16_t value = data_[ptr_] << 8 | data_[ptr_ + 1];
+    ptr_ += 2;
+    return value;
+  }
+  
+  uint32_t ReadVariableLength(size_t end) {
+    uint32_t value = 0;
+    while (ptr_ < end) {
+      uint8_t byte = data_[ptr_++];
+      value = (value << 7) | (byte & 0x7f);
+      if (!(byte & 0x80)) {
+        break;
+      }
+    }
+    return value;
+  }
+  
+  void ReadTrack(size_t end, vector<RawEvent>* events) {
+    uint32_t tick = 0;
+    uint8_t running_status = 0;
+    if (end > data_.size()) {
+      end = data_.size();
+    }
+    while (ptr_ < end) {
+      tick += ReadVariableLength(end);
+      if (ptr_ >= end) {
+        break;
+      }
+      RawEvent e;
+      e.tick = tick;
+      e.order = events->size();
+      e.tempo = 0;
+      e.size = 0;
+      
+      uint8_t status = data_[ptr_];
+      if (status == 0xff) {
+        uint8_t type = data_[ptr_ + 1];
+        ptr_ += 2;
+        uint32_t length = ReadVariableLength(end);
+        if (type == 0x51 && length == 3) {
+          e.tempo = data_[ptr_] << 16 | data_[ptr_ + 1] << 8 | data_[ptr_ + 2];
+          events->push_back(e);
+        }
+        ptr_ += length;
+        continue;
+      } else if (status == 0xf0 || status == 0xf7) {
+        // SysEx messages are skipped.
+        ++ptr_;
+        ptr_ += ReadVariableLength(end);
+        continue;
+      }
+      
+      if (status & 0x80) {
+        running_status = status;
+        ++ptr_;
+      }
+      uint8_t type = running_status & 0xf0;
+      uint8_t data_size = (type == 0xc0 || type == 0xd0) ? 1 : 2;
+      e.data[0] = running_status;
+      e.data[1] = ptr_ < end ? data_[ptr_] : 0;
+      e.data[2] = data_size == 2 && ptr_ + 1 < end ? data_[ptr_ + 1] : 0;
+      e.size = data_size + 1;
+      ptr_ += data_size;
+      events->push_back(e);
+    }
+  }
+  
+  vector<uint8_t> data_;
+  size_t ptr_;
+  
+  DISALLOW_COPY_AND_ASSIGN(SmfReader);
+};
+
+// Chords of 4 notes on channel 1, retriggered every 12 ms, with pitch bend and
+// modulation wheel sweeps. This is close to the bandwidth of the MIDI link.
+void GenerateStressSequence(vector<TimedMessage>* messages) {
+  double time = 0.0;
+  for (uint32_t i = 0; i < 2000; ++i) {
+    uint8_t root = 36 + (i * 7) % 48;
+    for (uint8_t j = 0; j < 4; ++j) {
+      TimedMessage m = { time, { 0x90, static_cast<uint8_t>(root + j * 4),
+          static_cast<uint8_t>(64 + (i + j) % 64) }, 3 };
+      messages->push_back(m);
+    }
+    uint8_t value = i & 0x7f;
+    TimedMessage bend = { time, { 0xe0, 0, value }, 3 };
+    messages->push_back(bend);
+    TimedMessage wheel = { time, { 0xb0, 1, value }, 3 };
+    messages->push_back(wheel);
+    time += kRefreshRate * 0.006;
+    for (uint8_t j = 0; j < 4; ++j) {
+      TimedMessage m = { time, { 0x80, static_cast<uint8_t>(root + j * 4), 0 },
+          3 };
+      messages->push_back(m);
+    }
+    time += kRefreshRate * 0.006;
+  }
+}
+
+void BenchmarkOscillators() {
+  const char* const mode_names[] = {
+    "saw", "pulse", "square", "triangle", "sine", "noise"
+  };
+  const uint32_t kNumBlocks = 10 * 12000 / kAudioBlockSize;
+  
+  multi.Init();
+  for (uint8_t mode = 1; mode <= 6; ++mode) {
+    for (uint8_t i = 0; i < kNumVoices; ++i) {
+      Voice* voice = multi.mutable_voice(i);
+      voice->set_audio_mode(mode);
+      voice->NoteOn((48 + i * 7) << 7, 100, 0, true);
+      voice->Refresh();
+    }
+    uint32_t checksum = 0;
+    clock_t start = clock();
+    for (uint32_t block = 0; block < kNumBlocks; ++block) {
+      multi.RenderAudio();
+      for (uint8_t i = 0; i < kNumVoices; ++i) {
+        Voice* voice = multi.mutable_voice(i);
+        for (size_t j = 0; j < kAudioBlockSize; ++j) {
+          checksum += voice->ReadSample();
+        }
+      }
+    }
+    double seconds = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+    printf("Audio mode %-8s: %.1f ns per block of %d voices (%08x)\n",
+        mode_names[mode - 1],
+        seconds * 1e9 / kNumBlocks,
+        kNumVoices,
+        checksum);
+  }
+  for (uint8_t i = 0; i < kNumVoices; ++i) {
+    multi.mutable_voice(i)->set_audio_mode(0);
+    multi.mutable_voice(i)->NoteOff();
+  }
+}
+
+uint32_t flash_num_operations;
+uint32_t flash_num_erases;
+uint32_t flash_power_loss_countdown;
+
+struct StoredProgram {
+  bool valid;
+  uint8_t data[kMultiSize];
+};
+
+void SerializeMulti(uint8_t* data) {
+  stmlib::StreamBuffer<kMultiSize> buffer;
+  buffer.Rewind();
+  multi.Serialize(&buffer);
+  memcpy(data, buffer.bytes(), kMultiSize);
+}
+
+// Random edits, saves, loads, reboots and power losses. Every program loaded
+// must be the last one saved in its slot, or, if power was lost while it was
+// being saved, the one saved before. Returns false on a mismatch.
+bool TestStorageManager(bool power_losses) {
+  const uint32_t kFlashBase = 0x8000000;
+  const uint32_t kFlashSize = 0x20000;
+  void* flash = mmap(
+      reinterpret_cast<void*>(kFlashBase),
+      kFlashSize,
+      PROT_READ | PROT_WRITE,
+      MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS,
+      -1,
+      0);
+  if (flash == MAP_FAILED) {
+    printf("Storage: cannot map the simulated flash, skipped\n");
+    return true;
+  }
+  memset(flash, 0xff, kFlashSize);
+  flash_num_operations = 0;
+  flash_num_erases = 0;
+  flash_power_loss_countdown = 0;
+  srand(1);
+  
+  StoredProgram saved[kNumStoredPrograms];
+  StoredProgram previous[kNumStoredPrograms];
+  bool interrupted[kNumStoredPrograms];
+  memset(saved, 0, sizeof(saved));
+  memset(interrupted, 0, sizeof(interrupted));
+  
+  multi.Init();
+  storage_manager.Init();
+  uint32_t num_saves = 0;
+  uint32_t num_power_losses = 0;
+  uint32_t num_errors = 0;
+  uint32_t max_foreground_erases = 0;
+  for (uint32_t i = 0; i < 200000; ++i) {
+    uint8_t action = rand() % 100;
+    if (action < 40) {
+      // Small edits, or occasionally a new sequence.
+      uint16_t num_edits = 1 + (rand() % 20 ? rand() % 4 : rand() % 600);
+      while (num_edits--) {
+        Part* part = multi.mutable_part(rand() % kNumParts);
+        SequencerSettings* seq = part->mutable_sequencer_settings();
+        seq->step[rand() % kNumSteps].data[rand() % 2] = rand() & 0x7f;
+      }
+    } else if (action < 48) {
+      uint8_t slot = rand() % kNumStoredPrograms;
+      if (!interrupted[slot]) {
+        previous[slot] = saved[slot];
+      }
+      uint32_t num_erases = flash_num_erases;
+      storage_manager.SaveMulti(slot);
+      max_foreground_erases = max(
+          max_foreground_erases, flash_num_erases - num_erases);
+      saved[slot].valid = true;
+      SerializeMulti(saved[slot].data);
+      interrupted[slot] = true;
+      ++num_saves;
+      if (power_losses && rand() % 10 == 0) {
+        flash_power_loss_countdown = 1 + rand() % 40;
+      }
+      try {
+        while (storage_manager.saving()) {
+          storage_manager.Tick(rand() % 2);
+        }
+        interrupted[slot] = false;
+      } catch (PowerLoss&) {
+        ++num_power_losses;
+        storage_manager.Init();
+      }
+      flash_power_loss_countdown = 0;
+    } else if (action < 90) {
+      storage_manager.Tick(true);
+    } else if (action < 92) {
+      storage_manager.Init();
+    } else if (action < 94) {
+      uint8_t slot = rand() % kNumStoredPrograms;
+      uint8_t edited[kMultiSize];
+      uint8_t loaded[kMultiSize];
+      SerializeMulti(edited);
+      bool valid = storage_manager.LoadMulti(slot);
+      SerializeMulti(loaded);
+      bool match;
+      if (!saved[slot].valid) {
+        match = !valid;
+      } else {
+        match = valid && (
+            !memcmp(loaded, saved[slot].data, kMultiSize) ||
+            (interrupted[slot] && (!previous[slot].valid ||
+                !memcmp(loaded, previous[slot].data, kMultiSize))));
+      }
+      if (!match) {
+        ++num_errors;
+      }
+      if (valid) {
+        // Whichever version was loaded is the one found from now on.
+        saved[slot].valid = true;
+        memcpy(saved[slot].data, loaded, kMultiSize);
+        interrupted[slot] = false;
+      }
+      stmlib::StreamBuffer<kMultiSize> buffer;
+      memcpy(buffer.mutable_bytes(), edited, kMultiSize);
+      buffer.Rewind();
+      multi.Deserialize(&buffer);
+    }
+  }
+  munmap(flash, kFlashSize);
+  printf("Storage: %d saves, %d power losses, %d erases, "
+      "at most %d during a call to SaveMulti, %d errors\n",
+      num_saves,
+      num_power_losses,
+      flash_num_erases,
+      max_foreground_erases,
+      num_errors);
+  return num_errors == 0;
+}
+
+struct VoiceState {
+  uint16_t cv;
+  bool gate;
+  uint8_t velocity;
+  uint8_t aux;
+};
+
+struct PendingNoteOn {
+  uint8_t note;
+  uint32_t tick;
+};
+
+int main(int argc, char** argv) {
+  vector<TimedMessage> messages;
+  if (argc > 1) {
+    SmfReader reader;
+    if (!reader.Load(argv[1], &messages)) {
+      return 1;
+    }
+  } else {
+    GenerateStressSequence(&messages);
+  }
+  uint8_t layout = argc > 2 ? atoi(argv[2]) : LAYOUT_QUAD_POLY;
+  uint32_t main_loop_period = argc > 3 ? atoi(argv[3]) : 1;
+  if (main_loop_period == 0) {
+    main_loop_period = 1;
+  }
+  
+  BenchmarkOscillators();
+  if (!TestStorageManager(false) || !TestStorageManager(true)) {
+    return 1;
+  }
+  
+  // As in the firmware, the CC map must be built before any CC is received.
+  settings.Init();
+  multi.Init();
+  multi.Set(MULTI_LAYOUT, layout);
+  midi_handler.Init();
+  
+  FILE* fp = fopen("yarns_test.csv", "w");
+  fprintf(fp, "tick,voice,cv,gate,velocity,aux\n");
+  
+  // Bytes waiting to be sent on the (simulated) UART.
+  vector<uint8_t> uart_bytes;
+  // Note number on the last byte of the note-ons received by part 0, 0xff
+  // elsewhere.
+  vector<uint8_t> uart_end_of_note_on;
+  size_t uart_read_ptr = 0;
+  size_t next_message = 0;
+  double uart_ready_time = 0.0;
+  
+  // Latency is measured on the note-ons received by part 0, from the
+  // reception of their last byte to the rising edge of the gate of the voice
+  // to which the note is allocated. A note-on which never gets its own edge
+  // (not allocated, forwarded to the next unit of a polychain, or replaced by
+  // another note-on for the same note before being heard) is dropped. Part 0
+  // always drives the first voices. In mono mode, the part does not keep track
+  // of the note played by its voices, and the gate of the first voice is
+  // matched to the last note-on.
+  vector<PendingNoteOn> pending_note_ons;
+  uint64_t total_latency = 0;
+  uint32_t min_latency = 0xffffffff;
+  uint32_t max_latency = 0;
+  uint32_t num_latency_measurements = 0;
+  uint32_t num_dropped_note_ons = 0;
+  
+  VoiceState state[kNumVoices];
+  memset(state, 0, sizeof(state));
+  uint32_t num_output_changes = 0;
+  uint32_t num_midi_out_bytes = 0;
+  
+  double end_time = messages.empty() ? 0 : messages.back().time;
+  uint32_t num_ticks = static_cast<uint32_t>(end_time) + kRefreshRate;
+  
+  bool mono = multi.part(0).voicing_settings().allocation_mode == \
+      VOICE_ALLOCATION_MODE_MONO;
+  clock_t start = clock();
+  for (uint32_t tick = 0; tick < num_ticks; ++tick) {
+    // Serialize the messages due at this tick on the UART.
+    while (next_message < messages.size() &&
+           messages[next_message].time <= tick) {
+      const TimedMessage& m = messages[next_message++];
+      bool note_on = (m.data[0] & 0xf0) == 0x90 && m.data[2] && \
+          multi.part(0).accepts(m.data[0] & 0xf, m.data[1], m.data[2]);
+      for (uint8_t i = 0; i < m.size; ++i) {
+        uart_bytes.push_back(m.data[i]);
+        uart_end_of_note_on.push_back(
+            note_on && i == m.size - 1 ? m.data[1] : 0xff);
+      }
+    }
+    
+    // Body of the SysTick handler.
+    if (uart_read_ptr < uart_bytes.size() && uart_ready_time <= tick) {
+      midi_handler.PushByte(uart_bytes[uart_read_ptr]);
+      uint8_t note = uart_end_of_note_on[uart_read_ptr];
+      if (note != 0xff) {
+        for (size_t j = 0; j < pending_note_ons.size(); ++j) {
+          if (pending_note_ons[j].note == note) {
+            pending_note_ons.erase(pending_note_ons.begin() + j);
+            ++num_dropped_note_ons;
+            break;
+          }
+        }
+        PendingNoteOn n = { note, tick };
+        pending_note_ons.push_back(n);
+      }
+      ++uart_read_ptr;
+      uart_ready_time = max(uart_ready_time, static_cast<double>(tick)) + \
+          kUartByteDuration;
+    }
+    while (midi_handler.mutable_high_priority_output_buffer()->readable()) {
+      midi_handler.mutable_high_priority_output_buffer()->ImmediateRead();
+      ++num_midi_out_bytes;
+    }
+    while (midi_handler.mutable_dispatch_high_priority_output_buffer()->
+        readable()) {
+      midi_handler.mutable_dispatch_high_priority_output_buffer()->
+          ImmediateRead();
+      ++num_midi_out_bytes;
+    }
+    while (midi_handler.mutable_output_buffer()->readable()) {
+      midi_handler.mutable_output_buffer()->ImmediateRead();
+      ++num_midi_out_bytes;
+    }
+    midi_handler.Tick();
+    multi.Refresh();
+    uint16_t cv[kNumVoices];
+    bool gate[kNumVoices];
+    multi.GetCvGate(cv, gate);
+    
+    for (uint8_t i = 0; i < kNumVoices; ++i) {
+      const Voice& voice = multi.voice(i);
+      VoiceState s;
+      s.cv = voice.note_dac_code();
+      s.gate = voice.gate();
+      s.velocity = voice.velocity();
+      s.aux = voice.aux_cv();
+      if (s.gate && !state[i].gate) {
+        size_t match = pending_note_ons.size();
+        if (mono) {
+          // The edge is caused by the last note-on; the previous ones were
+          // superseded before being heard.
+          if (i == 0 && match) {
+            --match;
+            num_dropped_note_ons += match;
+            pending_note_ons.erase(
+                pending_note_ons.begin(),
+                pending_note_ons.begin() + match);
+            match = 0;
+          }
+        } else {
+          for (size_t j = 0; j < pending_note_ons.size(); ++j) {
+            if (multi.part(0).FindVoiceForNote(pending_note_ons[j].note) == i) {
+              match = j;
+              break;
+            }
+          }
+        }
+        if (match < pending_note_ons.size()) {
+          uint32_t latency = tick - pending_note_ons[match].tick;
+          pending_note_ons.erase(pending_note_ons.begin() + match);
+          total_latency += latency;
+          min_latency = min(min_latency, latency);
+          max_latency = max(max_latency, latency);
+          ++num_latency_measurements;
+        }
+      }
+      if (memcmp(&s, &state[i], sizeof(s))) {
+        fprintf(fp, "%u,%d,%d,%d,%d,%d\n",
+            tick, i, s.cv, s.gate, s.velocity, s.aux);
+        state[i] = s;
+        ++num_output_changes;
+      }
+    }
+    
+    // Timer interrupt.
+    for (uint8_t i = 0; i < kInternalClockOversampling; ++i) {
+      multi.RefreshInternalClock();
+    }
+    
+    // Main loop.
+    if ((tick % main_loop_period) == 0) {
+      midi_handler.Lock();
+      multi.ProcessInternalClockEvents();
+      multi.ApplySettingChanges();
+      midi_handler.ProcessInput();
+      midi_handler.Unlock();
+      multi.RenderAudio();
+    }
+  }
+  double seconds = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+  fclose(fp);
+  num_dropped_note_ons += pending_note_ons.size();
+  
+  double simulated_seconds = static_cast<double>(num_ticks) / kRefreshRate;
+  printf("Messages: %u, simulated time: %.2fs, output changes: %u, "
+         "MIDI out bytes: %u\n",
+      static_cast<uint32_t>(messages.size()),
+      simulated_seconds,
+      num_output_changes,
+      num_midi_out_bytes);
+  if (num_latency_measurements) {
+    printf("Note-on to gate latency (ms): min %.3f, avg %.3f, max %.3f "
+           "(%u notes)\n",
+        min_latency * 1000.0 / kRefreshRate,
+        total_latency * 1000.0 / kRefreshRate / num_latency_measurements,
+        max_latency * 1000.0 / kRefreshRate,
+        num_latency_measurements);
+  }
+  printf("Dropped note-ons: %u\n", num_dropped_note_ons);
+  printf("Throughput: %.0f ticks/s, %.0f messages/s, %.1fx real time\n",
+      num_ticks / seconds,
+      messages.size() / seconds,
+      simulated_seconds / seconds);
+  return 0;
+}
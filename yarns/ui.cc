@@ -317,8 +317,11 @@ void Ui::PrintRecordingPart() {
 void Ui::PrintRecordingStatus() {
   if (push_it_) {
     PrintPushItNote();
+  } else if (recording_part().recording_full()) {
+    display_.Print("FL");
   } else {
-    uint8_t n = recording_part().recording_step() + 1;
+    // Only the last two digits of long sequences are shown.
+    uint8_t n = (recording_part().recording_step() + 1) % 100;
     strcpy(buffer_, "00");
     buffer_[0] += n / 10;
     buffer_[1] += n % 10;
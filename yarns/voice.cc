@@ -250,7 +250,9 @@ static const uint16_t kPitchTableStart = 116 * 128;
 
 
 void Oscillator::Init(int32_t scale, int32_t offset) {
-  audio_buffer_.Init();
+  std::fill(&audio_buffer_[0], &audio_buffer_[kAudioBufferSize], offset);
+  read_ptr_ = 0;
+  write_ptr_ = 0;
   phase_ = 0;
   next_sample_ = 0;
   high_ = false;
@@ -281,31 +283,28 @@ uint32_t Oscillator::ComputePhaseIncrement(int16_t midi_pitch) {
   return phase_increment;
 }
 
-void Oscillator::RenderSilence() {
-  size_t size = kAudioBlockSize;
-  while (size--) {
-    audio_buffer_.Overwrite(offset_);
-  }
+void Oscillator::RenderSilence(uint16_t* destination) {
+  std::fill(&destination[0], &destination[kAudioBlockSize], offset_);
 }
 
-void Oscillator::RenderSine(uint32_t phase_increment) {
+void Oscillator::RenderSine(uint32_t phase_increment, uint16_t* destination) {
   size_t size = kAudioBlockSize;
   while (size--) {
     phase_ += phase_increment;
     int32_t sample = Interpolate1022(wav_sine, phase_);
-    audio_buffer_.Overwrite(offset_ - (scale_ * sample >> 16));
+    *destination++ = offset_ - (scale_ * sample >> 16);
   }
 }
 
-void Oscillator::RenderNoise() {
+void Oscillator::RenderNoise(uint16_t* destination) {
   size_t size = kAudioBlockSize;
   while (size--) {
     int16_t sample = Random::GetSample();
-    audio_buffer_.Overwrite(offset_ - (scale_ * sample >> 16));
+    *destination++ = offset_ - (scale_ * sample >> 16);
   }
 }
 
-void Oscillator::RenderSaw(uint32_t phase_increment) {
+void Oscillator::RenderSaw(uint32_t phase_increment, uint16_t* destination) {
   uint32_t phase = phase_;
   int32_t next_sample = next_sample_;
   size_t size = kAudioBlockSize;
@@ -321,7 +320,7 @@ void Oscillator::RenderSaw(uint32_t phase_increment) {
     }
     next_sample += phase >> 17;
     this_sample = (this_sample - 16384) << 1;
-    audio_buffer_.Overwrite(offset_ - (scale_ * this_sample >> 16));
+    *destination++ = offset_ - (scale_ * this_sample >> 16);
   }
   next_sample_ = next_sample;
   phase_ = phase;
@@ -330,7 +329,8 @@ void Oscillator::RenderSaw(uint32_t phase_increment) {
 void Oscillator::RenderSquare(
     uint32_t phase_increment,
     uint32_t pw,
-    bool integrate) {
+    bool integrate,
+    uint16_t* destination) {
   uint32_t phase = phase_;
   int32_t next_sample = next_sample_;
   int32_t integrator_state = integrator_state_;
@@ -362,7 +362,7 @@ void Oscillator::RenderSquare(
       integrator_state += integrator_coefficient * (this_sample - integrator_state) >> 15;
       this_sample = integrator_state << 3;
     }
-    audio_buffer_.Overwrite(offset_ - (scale_ * this_sample >> 16));
+    *destination++ = offset_ - (scale_ * this_sample >> 16);
   }
   integrator_state_ = integrator_state;
   next_sample_ = next_sample;
@@ -370,36 +370,37 @@ void Oscillator::RenderSquare(
 }
 
 void Oscillator::Render(uint8_t mode, int16_t note, bool gate) {
-  if (mode == 0 || audio_buffer_.writable() < kAudioBlockSize) {
+  if (mode == 0 || !writable()) {
     return;
   }
   
+  uint16_t* destination = &audio_buffer_[write_ptr_ % kAudioBufferSize];
   if ((mode & 0x80) && !gate) {
-    RenderSilence();
-    return;
-  }
-  
-  uint32_t phase_increment = ComputePhaseIncrement(note);
-  switch ((mode & 0x0f) - 1) {
-    case 0:
-      RenderSaw(phase_increment);
-      break;
-    case 1:
-      RenderSquare(phase_increment, 0x40000000, false);
-      break;
-    case 2:
-      RenderSquare(phase_increment, 0x80000000, false);
-      break;
-    case 3:
-      RenderSquare(phase_increment, 0x80000000, true);
-      break;
-    case 4:
-      RenderSine(phase_increment);
-      break;
-    default:
-      RenderNoise();
-      break;
+    RenderSilence(destination);
+  } else {
+    uint32_t phase_increment = ComputePhaseIncrement(note);
+    switch ((mode & 0x0f) - 1) {
+      case 0:
+        RenderSaw(phase_increment, destination);
+        break;
+      case 1:
+        RenderSquare(phase_increment, 0x40000000, false, destination);
+        break;
+      case 2:
+        RenderSquare(phase_increment, 0x80000000, false, destination);
+        break;
+      case 3:
+        RenderSquare(phase_increment, 0x80000000, true, destination);
+        break;
+      case 4:
+        RenderSine(phase_increment, destination);
+        break;
+      default:
+        RenderNoise(destination);
+        break;
+    }
   }
+  write_ptr_ += kAudioBlockSize;
 }
 
 }  // namespace yarns
\ No newline at end of file
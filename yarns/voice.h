@@ -30,12 +30,12 @@
 #define YARNS_VOICE_H_
 
 #include "stmlib/stmlib.h"
-#include "stmlib/utils/ring_buffer.h"
 
 namespace yarns {
 
 const uint16_t kNumOctaves = 11;
 const size_t kAudioBlockSize = 64;
+const size_t kAudioBufferSize = kAudioBlockSize * 2;
 
 enum TriggerShape {
   TRIGGER_SHAPE_SQUARE,
@@ -60,18 +60,37 @@ class Oscillator {
   ~Oscillator() { }
   void Init(int32_t scale, int32_t offset);
   void Render(uint8_t mode, int16_t note, bool gate);
+  
+  // The buffer is made of two blocks. The audio interrupt reads from one
+  // while the other one is rendered in a single pass.
+  inline bool writable() const {
+    return static_cast<uint16_t>(write_ptr_ - read_ptr_) <= \
+        kAudioBufferSize - kAudioBlockSize;
+  }
   inline uint16_t ReadSample() {
-    return audio_buffer_.ImmediateRead();
+    uint16_t read_ptr = read_ptr_;
+    if (read_ptr == write_ptr_) {
+      // The rendering is late: hold the last sample rather than replaying
+      // the stale block.
+      uint16_t last = read_ptr - 1;
+      return audio_buffer_[last % kAudioBufferSize];
+    }
+    read_ptr_ = read_ptr + 1;
+    return audio_buffer_[read_ptr % kAudioBufferSize];
   }
 
  private:
   uint32_t ComputePhaseIncrement(int16_t pitch);
   
-  void RenderSilence();
-  void RenderNoise();
-  void RenderSine(uint32_t phase_increment);
-  void RenderSaw(uint32_t phase_increment);
-  void RenderSquare(uint32_t phase_increment, uint32_t pw, bool integrate);
+  void RenderSilence(uint16_t* destination);
+  void RenderNoise(uint16_t* destination);
+  void RenderSine(uint32_t phase_increment, uint16_t* destination);
+  void RenderSaw(uint32_t phase_increment, uint16_t* destination);
+  void RenderSquare(
+      uint32_t phase_increment,
+      uint32_t pw,
+      bool integrate,
+      uint16_t* destination);
 
   inline int32_t ThisBlepSample(uint32_t t) {
     if (t > 65535) {
@@ -94,7 +113,9 @@ class Oscillator {
   int32_t next_sample_;
   int32_t integrator_state_;
   bool high_;
-  stmlib::RingBuffer<uint16_t, kAudioBlockSize * 2> audio_buffer_;
+  uint16_t audio_buffer_[kAudioBufferSize];
+  volatile uint16_t read_ptr_;
+  volatile uint16_t write_ptr_;
   
   DISALLOW_COPY_AND_ASSIGN(Oscillator);
 };
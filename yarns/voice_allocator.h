@@ -0,0 +1,284 @@
+// Copyright 2013 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Polyphonic voice allocator.
+//
+// Each voice belongs to one of two intrusive lists: the released voices, in
+// the order in which they were released, and the active voices, in the order
+// in which they were triggered. Active voices are also indexed by note (128
+// bit set) and by velocity (32 buckets of 4 velocities, each an intrusive list
+// in trigger order). Finding a voice for a note, allocating a voice and
+// stealing one - whatever the stealing policy - thus run in constant time,
+// independently of the number of voices.
+//
+// Indices larger than the number of voices driven by this unit are forwarded
+// to the next unit of a polychain.
+
+#ifndef YARNS_VOICE_ALLOCATOR_H_
+#define YARNS_VOICE_ALLOCATOR_H_
+
+#include "stmlib/stmlib.h"
+
+namespace yarns {
+
+enum VoiceStealingMode {
+  VOICE_STEALING_MODE_OLDEST,
+  VOICE_STEALING_MODE_QUIETEST,
+  VOICE_STEALING_MODE_LOWEST,
+  VOICE_STEALING_MODE_HIGHEST,
+  VOICE_STEALING_MODE_LAST
+};
+
+const uint8_t kNoVoice = 0xff;
+const uint8_t kNoNote = 0xff;
+const uint8_t kNumVelocityBuckets = 32;
+
+struct VoiceList {
+  uint8_t head;
+  uint8_t tail;
+};
+
+template<uint8_t capacity>
+class VoiceAllocator {
+ public:
+  VoiceAllocator() { }
+  ~VoiceAllocator() { }
+  
+  void Init() {
+    size_ = 0;
+    stealing_mode_ = VOICE_STEALING_MODE_OLDEST;
+    Clear();
+  }
+  
+  // Forgets all notes. All voices are released, in index order.
+  void Clear() {
+    for (uint8_t i = 0; i < 128; ++i) {
+      voice_for_note_[i] = kNoVoice;
+    }
+    for (uint8_t i = 0; i < 4; ++i) {
+      active_notes_[i] = 0;
+    }
+    for (uint8_t i = 0; i < kNumVelocityBuckets; ++i) {
+      velocity_bucket_[i].head = velocity_bucket_[i].tail = kNoVoice;
+    }
+    active_velocities_ = 0;
+    released_.head = released_.tail = kNoVoice;
+    active_.head = active_.tail = kNoVoice;
+    for (uint8_t i = 0; i < size_; ++i) {
+      note_[i] = kNoNote;
+      velocity_[i] = 0;
+      active_flag_[i] = false;
+      Append(&released_, next_, previous_, i);
+    }
+  }
+  
+  // Releases all voices and forgets their notes, preserving the order in
+  // which they will be reused.
+  void ClearNotes() {
+    while (active_.head != kNoVoice) {
+      uint8_t voice = active_.head;
+      Deactivate(voice);
+      Append(&released_, next_, previous_, voice);
+    }
+    for (uint8_t i = 0; i < size_; ++i) {
+      if (note_[i] != kNoNote) {
+        voice_for_note_[note_[i]] = kNoVoice;
+        note_[i] = kNoNote;
+      }
+    }
+  }
+  
+  uint8_t NoteOn(uint8_t note, uint8_t velocity) {
+    if (!size_) {
+      return kNoVoice;
+    }
+    // Retrigger the voice which has last played this note; or use the voice
+    // released the longest time ago; or steal one.
+    uint8_t voice = voice_for_note_[note];
+    if (voice == kNoVoice) {
+      voice = released_.head != kNoVoice ? released_.head : Steal();
+    }
+    
+    if (active_flag_[voice]) {
+      Deactivate(voice);
+    } else {
+      Remove(&released_, next_, previous_, voice);
+    }
+    if (note_[voice] != kNoNote && voice_for_note_[note_[voice]] == voice) {
+      voice_for_note_[note_[voice]] = kNoVoice;
+    }
+    note_[voice] = note;
+    velocity_[voice] = velocity;
+    voice_for_note_[note] = voice;
+    Activate(voice);
+    return voice;
+  }
+  
+  uint8_t NoteOff(uint8_t note) {
+    uint8_t voice = voice_for_note_[note];
+    if (voice != kNoVoice && active_flag_[voice]) {
+      Deactivate(voice);
+      Append(&released_, next_, previous_, voice);
+    }
+    return voice;
+  }
+  
+  // Voice which is playing, or has last played, this note.
+  inline uint8_t Find(uint8_t note) const {
+    return voice_for_note_[note];
+  }
+  
+  inline void set_size(uint8_t size) {
+    size_ = size > capacity ? capacity : size;
+    Clear();
+  }
+  inline uint8_t size() const { return size_; }
+  
+  inline void set_stealing_mode(uint8_t stealing_mode) {
+    stealing_mode_ = stealing_mode;
+  }
+  inline uint8_t stealing_mode() const { return stealing_mode_; }
+  
+ private:
+  static inline void Append(
+      VoiceList* list,
+      uint8_t* next,
+      uint8_t* previous,
+      uint8_t voice) {
+    next[voice] = kNoVoice;
+    previous[voice] = list->tail;
+    if (list->tail != kNoVoice) {
+      next[list->tail] = voice;
+    } else {
+      list->head = voice;
+    }
+    list->tail = voice;
+  }
+  
+  static inline void Remove(
+      VoiceList* list,
+      uint8_t* next,
+      uint8_t* previous,
+      uint8_t voice) {
+    if (previous[voice] != kNoVoice) {
+      next[previous[voice]] = next[voice];
+    } else {
+      list->head = next[voice];
+    }
+    if (next[voice] != kNoVoice) {
+      previous[next[voice]] = previous[voice];
+    } else {
+      list->tail = previous[voice];
+    }
+  }
+  
+  void Activate(uint8_t voice) {
+    uint8_t note = note_[voice];
+    uint8_t bucket = velocity_[voice] >> 2;
+    Append(&active_, next_, previous_, voice);
+    Append(
+        &velocity_bucket_[bucket],
+        next_in_bucket_,
+        previous_in_bucket_,
+        voice);
+    active_notes_[note >> 5] |= 1UL << (note & 0x1f);
+    active_velocities_ |= 1UL << bucket;
+    active_flag_[voice] = true;
+  }
+  
+  void Deactivate(uint8_t voice) {
+    uint8_t note = note_[voice];
+    uint8_t bucket = velocity_[voice] >> 2;
+    Remove(&active_, next_, previous_, voice);
+    Remove(
+        &velocity_bucket_[bucket],
+        next_in_bucket_,
+        previous_in_bucket_,
+        voice);
+    active_notes_[note >> 5] &= ~(1UL << (note & 0x1f));
+    if (velocity_bucket_[bucket].head == kNoVoice) {
+      active_velocities_ &= ~(1UL << bucket);
+    }
+    active_flag_[voice] = false;
+  }
+  
+  // Only called when all voices are active.
+  uint8_t Steal() const {
+    switch (stealing_mode_) {
+      case VOICE_STEALING_MODE_QUIETEST:
+        return velocity_bucket_[__builtin_ctz(active_velocities_)].head;
+        
+      case VOICE_STEALING_MODE_LOWEST:
+        for (uint8_t i = 0; i < 4; ++i) {
+          if (active_notes_[i]) {
+            return voice_for_note_[(i << 5) + __builtin_ctz(active_notes_[i])];
+          }
+        }
+        break;
+        
+      case VOICE_STEALING_MODE_HIGHEST:
+        for (int8_t i = 3; i >= 0; --i) {
+          if (active_notes_[i]) {
+            return voice_for_note_[
+                (i << 5) + 31 - __builtin_clz(active_notes_[i])];
+          }
+        }
+        break;
+        
+      default:
+        break;
+    }
+    return active_.head;
+  }
+  
+  uint8_t note_[capacity];
+  uint8_t velocity_[capacity];
+  bool active_flag_[capacity];
+  
+  // Links in the list of released voices, or in the list of active voices.
+  uint8_t next_[capacity];
+  uint8_t previous_[capacity];
+  VoiceList released_;
+  VoiceList active_;
+  
+  // Links in the list of active voices with similar velocities.
+  uint8_t next_in_bucket_[capacity];
+  uint8_t previous_in_bucket_[capacity];
+  VoiceList velocity_bucket_[kNumVelocityBuckets];
+  uint32_t active_velocities_;
+  
+  uint8_t voice_for_note_[128];
+  uint32_t active_notes_[4];
+  
+  uint8_t size_;
+  uint8_t stealing_mode_;
+  
+  DISALLOW_COPY_AND_ASSIGN(VoiceAllocator);
+};
+
+}  // namespace yarns
+
+#endif  // YARNS_VOICE_ALLOCATOR_H_
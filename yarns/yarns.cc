@@ -88,10 +88,15 @@ void SysTick_Handler() {
   }
   
   // Try to push some MIDI data out.
-  if (midi_handler.mutable_high_priority_output_buffer()->readable()) {
+  MidiHandler::SmallMidiBuffer* high_priority_output_buffer =
+      midi_handler.mutable_high_priority_output_buffer();
+  if (!high_priority_output_buffer->readable()) {
+    high_priority_output_buffer =
+        midi_handler.mutable_dispatch_high_priority_output_buffer();
+  }
+  if (high_priority_output_buffer->readable()) {
     if (midi_io.writable()) {
-      midi_io.Overwrite(
-          midi_handler.mutable_high_priority_output_buffer()->ImmediateRead());
+      midi_io.Overwrite(high_priority_output_buffer->ImmediateRead());
     }
   }
 
@@ -105,6 +110,7 @@ void SysTick_Handler() {
   // compared to the CV output. This ensures that the CV output will have been
   // refreshed to the right value when the trigger/gate is sent.
   gate_output.Write(gate);
+  midi_handler.Tick();
   multi.Refresh();
   multi.GetCvGate(cv, gate);
   has_audio_sources = multi.GetAudioSource(audio_source);
@@ -170,6 +176,7 @@ void Init() {
   ui.Init();
 
   // Load multi 0 on boot.
+  storage_manager.Init();
   storage_manager.LoadMulti(0);
   storage_manager.LoadCalibration();
   
@@ -184,10 +191,15 @@ void Init() {
 int main(void) {
   Init();
   while (1) {
+    midi_handler.Lock();
     ui.DoEvents();
-    midi_handler.ProcessInput();
     multi.ProcessInternalClockEvents();
+    multi.ApplySettingChanges();
+    midi_handler.ProcessInput();
+    midi_handler.Unlock();
     multi.RenderAudio();
+    storage_manager.Tick(
+        midi_handler.idle() && !multi.running() && multi.quiet());
     if (midi_handler.factory_testing_requested()) {
       midi_handler.AcknowledgeFactoryTestingRequest();
       ui.StartFactoryTesting();